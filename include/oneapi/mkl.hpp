@@ -28,4 +28,7 @@
 #include "oneapi/mkl/rng.hpp"
 #include "oneapi/mkl/sparse_blas.hpp"
 
+#include "oneapi/mkl/lapack/gesvd_randomized.hpp"
+#include "oneapi/mkl/lapack/syevx_lobpcg.hpp"
+
 #endif //_ONEMKL_HPP_
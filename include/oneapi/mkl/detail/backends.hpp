@@ -39,6 +39,7 @@ enum class backend {
     portblas,
     cufft,
     rocfft,
+    portable,
     unsupported
 };
 
@@ -56,6 +57,7 @@ static backendmap backend_map = { { backend::mklcpu, "mklcpu" },
                                   { backend::portblas, "portblas" },
                                   { backend::cufft, "cufft" },
                                   { backend::rocfft, "rocfft" },
+                                  { backend::portable, "portable" },
                                   { backend::unsupported, "unsupported" } };
 
 } //namespace mkl
@@ -89,7 +89,10 @@ static std::map<domain, std::map<device, std::vector<const char*>>> libraries =
       { { device::x86cpu,
           {
 #ifdef ENABLE_MKLCPU_BACKEND
-              LIB_NAME("dft_mklcpu")
+              LIB_NAME("dft_mklcpu"),
+#endif
+#ifdef ENABLE_PORTABLE_BACKEND
+              LIB_NAME("dft_portable"),
 #endif
           } },
         { device::intelgpu,
@@ -141,25 +144,37 @@ static std::map<domain, std::map<device, std::vector<const char*>>> libraries =
       { { device::x86cpu,
           {
 #ifdef ENABLE_MKLCPU_BACKEND
-              LIB_NAME("rng_mklcpu")
+              LIB_NAME("rng_mklcpu"),
+#endif
+#ifdef ENABLE_PORTABLE_BACKEND
+              LIB_NAME("rng_portable"),
 #endif
           } },
         { device::intelgpu,
           {
 #ifdef ENABLE_MKLGPU_BACKEND
-              LIB_NAME("rng_mklgpu")
+              LIB_NAME("rng_mklgpu"),
+#endif
+#ifdef ENABLE_PORTABLE_BACKEND
+              LIB_NAME("rng_portable"),
 #endif
           } },
         { device::amdgpu,
           {
 #ifdef ENABLE_ROCRAND_BACKEND
-              LIB_NAME("rng_rocrand")
+              LIB_NAME("rng_rocrand"),
+#endif
+#ifdef ENABLE_PORTABLE_BACKEND
+              LIB_NAME("rng_portable"),
 #endif
           } },
         { device::nvidiagpu,
           {
 #ifdef ENABLE_CURAND_BACKEND
-              LIB_NAME("rng_curand")
+              LIB_NAME("rng_curand"),
+#endif
+#ifdef ENABLE_PORTABLE_BACKEND
+              LIB_NAME("rng_portable"),
 #endif
           } } } },
 
@@ -35,5 +35,8 @@
 #include "oneapi/mkl/dft/descriptor.hpp"
 #include "oneapi/mkl/dft/forward.hpp"
 #include "oneapi/mkl/dft/backward.hpp"
+#include "oneapi/mkl/dft/convolve.hpp"
+#include "oneapi/mkl/dft/stft.hpp"
+#include "oneapi/mkl/dft/sub_devices.hpp"
 
 #endif // _ONEMKL_DFT_HPP_
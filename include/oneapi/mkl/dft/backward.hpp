@@ -50,12 +50,24 @@ void compute_backward(descriptor_type &desc, sycl::buffer<data_type, 1> &inout_r
     static_assert(detail::valid_compute_arg<descriptor_type, data_type>::value,
                   "unexpected type for data_type");
 
-    using scalar_type = typename detail::descriptor_info<descriptor_type>::scalar_type;
-    auto type_corrected_inout_re = inout_re.template reinterpret<scalar_type, 1>(
-        detail::reinterpret_range<data_type, scalar_type>(inout_re.size()));
-    auto type_corrected_inout_im = inout_im.template reinterpret<scalar_type, 1>(
-        detail::reinterpret_range<data_type, scalar_type>(inout_im.size()));
-    get_commit(desc)->backward_ip_rr(desc, type_corrected_inout_re, type_corrected_inout_im);
+    if constexpr (detail::is_real_real_domain<descriptor_type>) {
+        // REAL_REAL domain data is never split: the two arrays are the input and output of an
+        // out-of-place transform.
+        using real_type = typename detail::descriptor_info<descriptor_type>::forward_type;
+        auto type_corrected_in = inout_re.template reinterpret<real_type, 1>(
+            detail::reinterpret_range<data_type, real_type>(inout_re.size()));
+        auto type_corrected_out = inout_im.template reinterpret<real_type, 1>(
+            detail::reinterpret_range<data_type, real_type>(inout_im.size()));
+        get_commit(desc)->backward_op_cc(desc, type_corrected_in, type_corrected_out);
+    }
+    else {
+        using scalar_type = typename detail::descriptor_info<descriptor_type>::scalar_type;
+        auto type_corrected_inout_re = inout_re.template reinterpret<scalar_type, 1>(
+            detail::reinterpret_range<data_type, scalar_type>(inout_re.size()));
+        auto type_corrected_inout_im = inout_im.template reinterpret<scalar_type, 1>(
+            detail::reinterpret_range<data_type, scalar_type>(inout_im.size()));
+        get_commit(desc)->backward_ip_rr(desc, type_corrected_inout_re, type_corrected_inout_im);
+    }
 }
 
 //Out-of-place transform
@@ -85,6 +97,8 @@ void compute_backward(descriptor_type &desc, sycl::buffer<input_type, 1> &in_re,
                   "unexpected type for input_type");
     static_assert(detail::valid_compute_arg<descriptor_type, output_type>::value,
                   "unexpected type for output_type");
+    static_assert(!detail::is_real_real_domain<descriptor_type>,
+                  "REAL_REAL domain data has no real and imaginary parts");
 
     using scalar_type = typename detail::descriptor_info<descriptor_type>::scalar_type;
     auto type_corrected_in_re = in_re.template reinterpret<scalar_type, 1>(
@@ -109,8 +123,15 @@ sycl::event compute_backward(descriptor_type &desc, data_type *inout,
                   "unexpected type for data_type");
 
     using fwd_type = typename detail::descriptor_info<descriptor_type>::forward_type;
-    return get_commit(desc)->backward_ip_cc(desc, reinterpret_cast<fwd_type *>(inout),
-                                            dependencies);
+    auto type_corrected_inout = reinterpret_cast<fwd_type *>(inout);
+    if (!get_parts(desc).empty()) {
+        return compute_parts(desc, [&](descriptor_type &part, std::int64_t first_batch) {
+            const std::int64_t offset = first_batch * part.get_values().fwd_dist;
+            return get_commit(part)->backward_ip_cc(part, type_corrected_inout + offset,
+                                                    dependencies);
+        });
+    }
+    return get_commit(desc)->backward_ip_cc(desc, type_corrected_inout, dependencies);
 }
 
 //In-place transform, using config_param::COMPLEX_STORAGE=config_value::REAL_REAL data format
@@ -120,10 +141,20 @@ sycl::event compute_backward(descriptor_type &desc, data_type *inout_re, data_ty
     static_assert(detail::valid_compute_arg<descriptor_type, data_type>::value,
                   "unexpected type for data_type");
 
-    using scalar_type = typename detail::descriptor_info<descriptor_type>::scalar_type;
-    return get_commit(desc)->backward_ip_rr(desc, reinterpret_cast<scalar_type *>(inout_re),
-                                            reinterpret_cast<scalar_type *>(inout_im),
-                                            dependencies);
+    if constexpr (detail::is_real_real_domain<descriptor_type>) {
+        // REAL_REAL domain data is never split: the two arrays are the input and output of an
+        // out-of-place transform.
+        using real_type = typename detail::descriptor_info<descriptor_type>::forward_type;
+        return get_commit(desc)->backward_op_cc(desc, reinterpret_cast<real_type *>(inout_re),
+                                                reinterpret_cast<real_type *>(inout_im),
+                                                dependencies);
+    }
+    else {
+        using scalar_type = typename detail::descriptor_info<descriptor_type>::scalar_type;
+        return get_commit(desc)->backward_ip_rr(desc, reinterpret_cast<scalar_type *>(inout_re),
+                                                reinterpret_cast<scalar_type *>(inout_im),
+                                                dependencies);
+    }
 }
 
 //Out-of-place transform
@@ -137,8 +168,18 @@ sycl::event compute_backward(descriptor_type &desc, input_type *in, output_type
 
     using fwd_type = typename detail::descriptor_info<descriptor_type>::forward_type;
     using bwd_type = typename detail::descriptor_info<descriptor_type>::backward_type;
-    return get_commit(desc)->backward_op_cc(desc, reinterpret_cast<bwd_type *>(in),
-                                            reinterpret_cast<fwd_type *>(out), dependencies);
+    auto type_corrected_in = reinterpret_cast<bwd_type *>(in);
+    auto type_corrected_out = reinterpret_cast<fwd_type *>(out);
+    if (!get_parts(desc).empty()) {
+        return compute_parts(desc, [&](descriptor_type &part, std::int64_t first_batch) {
+            const auto &values = part.get_values();
+            return get_commit(part)->backward_op_cc(
+                part, type_corrected_in + first_batch * values.bwd_dist,
+                type_corrected_out + first_batch * values.fwd_dist, dependencies);
+        });
+    }
+    return get_commit(desc)->backward_op_cc(desc, type_corrected_in, type_corrected_out,
+                                            dependencies);
 }
 
 //Out-of-place transform, using config_param::COMPLEX_STORAGE=config_value::REAL_REAL data format
@@ -150,6 +191,8 @@ sycl::event compute_backward(descriptor_type &desc, input_type *in_re, input_typ
                   "unexpected type for input_type");
     static_assert(detail::valid_compute_arg<descriptor_type, output_type>::value,
                   "unexpected type for output_type");
+    static_assert(!detail::is_real_real_domain<descriptor_type>,
+                  "REAL_REAL domain data has no real and imaginary parts");
 
     using scalar_type = typename detail::descriptor_info<descriptor_type>::scalar_type;
     return get_commit(desc)->backward_op_rr(desc, reinterpret_cast<scalar_type *>(in_re),
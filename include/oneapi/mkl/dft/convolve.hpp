@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_CONVOLVE_HPP_
+#define _ONEMKL_DFT_CONVOLVE_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "detail/types_impl.hpp"
+
+// Linear convolution and correlation of long one-dimensional signals through a committed
+// one-dimensional descriptor, whose length is the block size of an overlap-save scheme. Each
+// block of the signal is transformed, multiplied by the spectrum of the kernel and transformed
+// back in a single submission, without storing the spectrum of the whole signal.
+//
+// For a signal of length n and a kernel of length m, no longer than the descriptor, out receives
+// the n + m - 1 elements of the full result:
+//   convolve:  out[k] = sum_j kernel[j] * signal[k - j]
+//   correlate: out[k] = sum_j conj(kernel[j]) * signal[k + j - (m - 1)]
+// with signal taken as zero outside [0, n). Blocks of length L produce L - m + 1 outputs each, so
+// a descriptor several times longer than the kernel keeps the overlap small. The scale factors
+// of the descriptor do not apply to the result. The signal, kernel and output are contiguous, so
+// the descriptor must have one transform and the default strides.
+
+namespace oneapi::mkl::dft {
+
+namespace detail {
+
+template <typename descriptor_type, typename data_type>
+void convolve_impl(descriptor_type &desc, convolution_kind kind,
+                   sycl::buffer<data_type, 1> &signal, sycl::buffer<data_type, 1> &kernel,
+                   sycl::buffer<data_type, 1> &out) {
+    static_assert(detail::valid_compute_arg<descriptor_type, data_type>::value,
+                  "unexpected type for data_type");
+
+    using fwd_type = typename detail::descriptor_info<descriptor_type>::forward_type;
+    auto type_corrected_signal = signal.template reinterpret<fwd_type, 1>(
+        detail::reinterpret_range<data_type, fwd_type>(signal.size()));
+    auto type_corrected_kernel = kernel.template reinterpret<fwd_type, 1>(
+        detail::reinterpret_range<data_type, fwd_type>(kernel.size()));
+    auto type_corrected_out = out.template reinterpret<fwd_type, 1>(
+        detail::reinterpret_range<data_type, fwd_type>(out.size()));
+    get_commit(desc)->convolve(desc, kind, type_corrected_signal, type_corrected_kernel,
+                               type_corrected_out);
+}
+
+template <typename descriptor_type, typename data_type>
+sycl::event convolve_impl(descriptor_type &desc, convolution_kind kind,
+                          const data_type *signal, std::int64_t signal_length,
+                          const data_type *kernel, std::int64_t kernel_length, data_type *out,
+                          const std::vector<sycl::event> &dependencies) {
+    static_assert(detail::valid_compute_arg<descriptor_type, data_type>::value,
+                  "unexpected type for data_type");
+
+    using fwd_type = typename detail::descriptor_info<descriptor_type>::forward_type;
+    auto fwd_length = [](std::int64_t length) {
+        return static_cast<std::int64_t>(detail::reinterpret_range<data_type, fwd_type>(
+            static_cast<std::size_t>(std::max<std::int64_t>(length, 0))));
+    };
+    return get_commit(desc)->convolve(desc, kind, reinterpret_cast<const fwd_type *>(signal),
+                                      fwd_length(signal_length),
+                                      reinterpret_cast<const fwd_type *>(kernel),
+                                      fwd_length(kernel_length),
+                                      reinterpret_cast<fwd_type *>(out), dependencies);
+}
+
+} // namespace detail
+
+//Buffer version
+
+//Convolution, with the lengths of the signal and kernel buffers
+template <typename descriptor_type, typename data_type>
+void convolve(descriptor_type &desc, sycl::buffer<data_type, 1> &signal,
+              sycl::buffer<data_type, 1> &kernel, sycl::buffer<data_type, 1> &out) {
+    detail::convolve_impl(desc, detail::convolution_kind::CONVOLUTION, signal, kernel, out);
+}
+
+//Correlation, with the lengths of the signal and kernel buffers
+template <typename descriptor_type, typename data_type>
+void correlate(descriptor_type &desc, sycl::buffer<data_type, 1> &signal,
+               sycl::buffer<data_type, 1> &kernel, sycl::buffer<data_type, 1> &out) {
+    detail::convolve_impl(desc, detail::convolution_kind::CORRELATION, signal, kernel, out);
+}
+
+//USM version
+
+//Convolution
+template <typename descriptor_type, typename data_type>
+sycl::event convolve(descriptor_type &desc, const data_type *signal, std::int64_t signal_length,
+                     const data_type *kernel, std::int64_t kernel_length, data_type *out,
+                     const std::vector<sycl::event> &dependencies = {}) {
+    return detail::convolve_impl(desc, detail::convolution_kind::CONVOLUTION, signal,
+                                 signal_length, kernel, kernel_length, out, dependencies);
+}
+
+//Correlation
+template <typename descriptor_type, typename data_type>
+sycl::event correlate(descriptor_type &desc, const data_type *signal, std::int64_t signal_length,
+                      const data_type *kernel, std::int64_t kernel_length, data_type *out,
+                      const std::vector<sycl::event> &dependencies = {}) {
+    return detail::convolve_impl(desc, detail::convolution_kind::CORRELATION, signal,
+                                 signal_length, kernel, kernel_length, out, dependencies);
+}
+
+} // namespace oneapi::mkl::dft
+
+#endif // _ONEMKL_DFT_CONVOLVE_HPP_
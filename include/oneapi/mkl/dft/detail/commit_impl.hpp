@@ -26,6 +26,7 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include "oneapi/mkl/exceptions.hpp"
 #include "descriptor_impl.hpp"
 
 namespace oneapi::mkl {
@@ -46,7 +47,8 @@ public:
     using descriptor_type = typename oneapi::mkl::dft::detail::descriptor<prec, dom>;
     using fwd_type = typename descriptor_info<descriptor_type>::forward_type;
     using bwd_type = typename descriptor_info<descriptor_type>::backward_type;
-    using scalar_type = typename descriptor_info<descriptor_type>::scalar_type;
+    // The element type of the separate real and imaginary arrays of the *_rr functions.
+    using scalar_type = split_storage_t<descriptor_type>;
 
     commit_impl(sycl::queue queue, mkl::backend backend) : queue_(queue), backend_(backend) {}
 
@@ -67,6 +69,12 @@ public:
 
     virtual void commit(const dft_values<prec, dom> &) = 0;
 
+    // The size in bytes of the scratch memory a descriptor with an external workspace must
+    // provide. Backends that manage their memory themselves need none.
+    virtual std::int64_t get_workspace_external_bytes() const {
+        return 0;
+    }
+
     virtual void forward_ip_cc(descriptor_type &desc, sycl::buffer<fwd_type, 1> &inout) = 0;
     virtual void forward_ip_rr(descriptor_type &desc, sycl::buffer<scalar_type, 1> &inout_re,
                                sycl::buffer<scalar_type, 1> &inout_im) = 0;
@@ -108,6 +116,56 @@ public:
     virtual sycl::event backward_op_rr(descriptor_type &desc, scalar_type *in_re,
                                        scalar_type *in_im, scalar_type *out_re, scalar_type *out_im,
                                        const std::vector<sycl::event> &dependencies) = 0;
+
+    // dft::convolve and dft::correlate. Only backends that can fuse the pointwise product into
+    // their transforms implement them.
+    virtual void convolve(descriptor_type & /*desc*/, convolution_kind /*kind*/,
+                          sycl::buffer<fwd_type, 1> & /*signal*/,
+                          sycl::buffer<fwd_type, 1> & /*kernel*/,
+                          sycl::buffer<fwd_type, 1> & /*out*/) {
+        throw mkl::unimplemented("DFT", "convolve",
+                                 "Convolution is not supported by the committed backend.");
+    }
+    virtual sycl::event convolve(descriptor_type & /*desc*/, convolution_kind /*kind*/,
+                                 const fwd_type * /*signal*/, std::int64_t /*signal_length*/,
+                                 const fwd_type * /*kernel*/, std::int64_t /*kernel_length*/,
+                                 fwd_type * /*out*/,
+                                 const std::vector<sycl::event> & /*dependencies*/) {
+        throw mkl::unimplemented("DFT", "convolve",
+                                 "Convolution is not supported by the committed backend.");
+    }
+
+    // dft::stft and dft::istft, for backends that window and overlap the frames themselves.
+    virtual void stft(descriptor_type & /*desc*/, sycl::buffer<fwd_type, 1> & /*signal*/,
+                      sycl::buffer<fwd_type, 1> & /*window*/, std::int64_t /*hop*/,
+                      sycl::buffer<bwd_type, 1> & /*out*/) {
+        throw mkl::unimplemented("DFT", "stft",
+                                 "The short-time Fourier transform is not supported by the "
+                                 "committed backend.");
+    }
+    virtual sycl::event stft(descriptor_type & /*desc*/, const fwd_type * /*signal*/,
+                             std::int64_t /*signal_length*/, const fwd_type * /*window*/,
+                             std::int64_t /*hop*/, bwd_type * /*out*/,
+                             const std::vector<sycl::event> & /*dependencies*/) {
+        throw mkl::unimplemented("DFT", "stft",
+                                 "The short-time Fourier transform is not supported by the "
+                                 "committed backend.");
+    }
+    virtual void istft(descriptor_type & /*desc*/, sycl::buffer<bwd_type, 1> & /*spectra*/,
+                       sycl::buffer<fwd_type, 1> & /*window*/, std::int64_t /*hop*/,
+                       sycl::buffer<fwd_type, 1> & /*out*/) {
+        throw mkl::unimplemented("DFT", "istft",
+                                 "The short-time Fourier transform is not supported by the "
+                                 "committed backend.");
+    }
+    virtual sycl::event istft(descriptor_type & /*desc*/, const bwd_type * /*spectra*/,
+                              std::int64_t /*frames*/, const fwd_type * /*window*/,
+                              std::int64_t /*hop*/, fwd_type * /*out*/,
+                              const std::vector<sycl::event> & /*dependencies*/) {
+        throw mkl::unimplemented("DFT", "istft",
+                                 "The short-time Fourier transform is not supported by the "
+                                 "committed backend.");
+    }
 };
 
 } // namespace oneapi::mkl::dft::detail
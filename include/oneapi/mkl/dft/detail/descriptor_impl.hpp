@@ -26,6 +26,10 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include <memory>
+#include <optional>
+#include <vector>
+
 #include "oneapi/mkl/detail/backend_selector.hpp"
 #include "oneapi/mkl/detail/export.hpp"
 
@@ -43,6 +47,21 @@ class descriptor;
 template <precision prec, domain dom>
 inline commit_impl<prec, dom>* get_commit(descriptor<prec, dom>& desc);
 
+template <precision prec, domain dom>
+inline std::vector<descriptor<prec, dom>>& get_parts(descriptor<prec, dom>& desc);
+
+// Scratch memory given to a descriptor with set_workspace: either a USM allocation or a buffer.
+template <typename T>
+struct external_workspace {
+    bool is_set = false;
+    T* usm = nullptr;
+    std::optional<sycl::buffer<T, 1>> buffer;
+};
+
+template <precision prec, domain dom>
+inline const external_workspace<typename precision_t<prec>::real_t>& get_workspace(
+    const descriptor<prec, dom>& desc);
+
 template <precision prec, domain dom>
 class descriptor {
 public:
@@ -52,9 +71,13 @@ public:
     // Syntax for d-dimensional DFT
     descriptor(std::vector<std::int64_t> dimensions);
 
-    // Copy operations are included in the oneAPI oneMKL specification, but not yet
-    // implemented here. If you need copies, please open an issue at
-    // https://github.com/oneapi-src/oneMKL/issues
+    // A copy of a committed descriptor is committed too. It shares the backend plans of the
+    // original, except on cuFFT and rocFFT where it builds its own because their plans hold a
+    // stream binding and work area. Either one may be reconfigured and recommitted without
+    // affecting the other. A copy must be given its own external workspace.
+    descriptor(const descriptor&);
+
+    descriptor& operator=(const descriptor&);
 
     descriptor(descriptor&&);
 
@@ -68,6 +91,19 @@ public:
 
     void commit(sycl::queue& queue);
 
+    // Commit to several queues, e.g. on the NUMA sub-devices of a CPU, splitting the
+    // NUMBER_OF_TRANSFORMS batches into consecutive runs, one per queue, the first queues taking
+    // one more when they do not divide evenly. USM compute calls on interleaved data run each
+    // run on its queue; the other compute calls run on the first queue.
+    void commit(const std::vector<sycl::queue>& queues);
+
+    // With WORKSPACE_PLACEMENT set to WORKSPACE_EXTERNAL, provide the scratch memory used by
+    // compute calls after committing. It must hold at least WORKSPACE_EXTERNAL_BYTES bytes and
+    // must be set again after each commit. The caller orders the compute calls that share it.
+    void set_workspace(typename precision_t<prec>::real_t* usm_workspace);
+
+    void set_workspace(sycl::buffer<typename precision_t<prec>::real_t, 1>& buffer_workspace);
+
 #ifdef ENABLE_MKLCPU_BACKEND
     void commit(backend_selector<backend::mklcpu> selector);
 #endif
@@ -84,20 +120,60 @@ public:
     void commit(backend_selector<backend::rocfft> selector);
 #endif
 
+#ifdef ENABLE_PORTABLE_BACKEND
+    void commit(backend_selector<backend::portable> selector);
+#endif
+
     const dft_values<prec, dom>& get_values() const noexcept {
         return values_;
     };
 
+    // Release the plans kept for reuse by the plan cache (see the DFT_PLAN_CACHE_SIZE CMake
+    // option). Plans still used by a committed descriptor stay alive until it is recommitted or
+    // destroyed.
+    static void release_cached_plans();
+
+    // Set how many plans the plan cache keeps, overriding the ONEMKL_DFT_PLAN_CACHE_SIZE
+    // environment variable and the DFT_PLAN_CACHE_SIZE CMake option; 0 disables the cache.
+    // Releases the least recently used plans beyond the new capacity.
+    static void set_plan_cache_capacity(std::int64_t capacity);
+
 private:
-    // Has a value when the descriptor is committed.
-    std::unique_ptr<commit_impl<prec, dom>> pimpl_;
+    // Has a value when the descriptor is committed. Committed configurations are shared with
+    // other descriptors through the plan cache, so the commit_impl must not be recommitted.
+    std::shared_ptr<commit_impl<prec, dom>> pimpl_;
+
+    using create_commit_fn = commit_impl<prec, dom>* (*)(const descriptor&, sycl::queue&);
+
+    // How pimpl_ was built and from which values, for copies that cannot share it.
+    create_commit_fn create_ = nullptr;
+    dft_values<prec, dom> committed_values_;
 
     // descriptor configuration values_ and structs
     dft_values<prec, dom> values_;
 
+    using real_t = typename precision_t<prec>::real_t;
+
+    // Set by set_workspace, cleared by commit.
+    external_workspace<real_t> workspace_;
+
+    // For a commit to several queues, a descriptor committed to each queue for its batches.
+    std::vector<descriptor> parts_;
+
     friend commit_impl<prec, dom>* get_commit<prec, dom>(descriptor<prec, dom>&);
+    friend std::vector<descriptor>& get_parts<prec, dom>(descriptor<prec, dom>&);
+    friend const external_workspace<real_t>& get_workspace<prec, dom>(const descriptor&);
 
-    using real_t = typename precision_t<prec>::real_t;
+    // Commit to queue, building the backend plans with create unless the plan cache has them.
+    void commit_cached(sycl::queue& queue, create_commit_fn create);
+
+    // Commit to the first queue and, with several queues and batches, the parts to each queue.
+    void commit_split(const std::vector<sycl::queue>& queues, create_commit_fn create);
+
+    // Give a copy its own commit_impl when the backend plans cannot be shared.
+    void unshare_commit();
+
+    void check_set_workspace() const;
 };
 
 template <precision prec, domain dom>
@@ -105,6 +181,33 @@ inline commit_impl<prec, dom>* get_commit(descriptor<prec, dom>& desc) {
     return desc.pimpl_.get();
 }
 
+template <precision prec, domain dom>
+inline const external_workspace<typename precision_t<prec>::real_t>& get_workspace(
+    const descriptor<prec, dom>& desc) {
+    return desc.workspace_;
+}
+
+template <precision prec, domain dom>
+inline std::vector<descriptor<prec, dom>>& get_parts(descriptor<prec, dom>& desc) {
+    return desc.parts_;
+}
+
+// Run compute(part, first_batch) for each part of a descriptor committed to several queues,
+// returning an event on the first queue that completes once every part has.
+template <precision prec, domain dom, typename Compute>
+sycl::event compute_parts(descriptor<prec, dom>& desc, Compute compute) {
+    std::vector<sycl::event> done;
+    std::int64_t first_batch = 0;
+    for (auto& part : get_parts(desc)) {
+        done.push_back(compute(part, first_batch));
+        first_batch += part.get_values().number_of_transforms;
+    }
+    return get_commit(desc)->get_queue().submit([&](sycl::handler& cgh) {
+        cgh.depends_on(done);
+        cgh.host_task([]() {});
+    });
+}
+
 } // namespace detail
 } // namespace dft
 } // namespace mkl
@@ -25,8 +25,10 @@ ONEMKL_EXPORT dft::detail::commit_impl<prec, dom> *create_commit(
 
 // BUFFER version
 
+// The element type of separate real and imaginary arrays, a placeholder for REAL_REAL domain
+// descriptors.
 template <typename descriptor_type>
-using scalar = typename detail::descriptor_info<descriptor_type>::scalar_type;
+using scalar = detail::split_storage_t<descriptor_type>;
 template <typename descriptor_type>
 using fwd = typename detail::descriptor_info<descriptor_type>::forward_type;
 template <typename descriptor_type>
@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_PORTABLE_HPP_
+#define _ONEMKL_DFT_PORTABLE_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <string>
+
+#include "oneapi/mkl/detail/export.hpp"
+#include "oneapi/mkl/dft/detail/types_impl.hpp"
+
+namespace oneapi::mkl::dft::portable {
+
+#include "oneapi/mkl/dft/detail/dft_ct.hxx"
+
+// The choices of the descriptors committed with config_param::TUNING_LEVEL, as text. Importing
+// them, e.g. at the start of another process, lets later tuned commits reuse them instead of
+// measuring again. import_wisdom() throws invalid_argument, and imports nothing, for text that is
+// malformed or holds a choice that does not fit its key. forget_wisdom() discards every choice.
+ONEMKL_EXPORT std::string export_wisdom();
+ONEMKL_EXPORT void import_wisdom(const std::string &wisdom);
+ONEMKL_EXPORT void forget_wisdom();
+
+} // namespace oneapi::mkl::dft::portable
+
+#endif // _ONEMKL_DFT_PORTABLE_HPP_
@@ -31,6 +31,8 @@
 #include <type_traits>
 #include <complex>
 
+#include "oneapi/mkl/bfloat16.hpp"
+
 namespace oneapi {
 namespace mkl {
 namespace dft {
@@ -38,14 +40,43 @@ namespace detail {
 
 typedef long DFT_ERROR;
 
-enum class precision { SINGLE, DOUBLE };
+enum class precision { SINGLE, DOUBLE, HALF, BFLOAT16 };
 
+// real_t is the type of the scale factors and of the arithmetic of a transform. HALF and BFLOAT16
+// transforms read and write 16-bit data but compute in single precision.
 template <precision prec>
 struct precision_t {
-    using real_t = std::conditional_t<prec == precision::SINGLE, float, double>;
+    using real_t = std::conditional_t<prec == precision::DOUBLE, double, float>;
 };
 
-enum class domain { REAL, COMPLEX };
+template <precision prec>
+inline constexpr bool is_16bit_precision = prec == precision::HALF || prec == precision::BFLOAT16;
+
+// Complex element of HALF and BFLOAT16 data: the real and imaginary parts, interleaved like
+// std::complex, which is only specified for float, double and long double.
+template <typename T>
+struct complex_pair {
+    T re;
+    T im;
+    constexpr T real() const {
+        return re;
+    }
+    constexpr T imag() const {
+        return im;
+    }
+};
+
+// The complex element type of data whose real element type is T.
+template <typename T>
+using complex_t =
+    std::conditional_t<std::is_floating_point_v<T>, std::complex<T>, complex_pair<T>>;
+
+// REAL_REAL transforms map real data to real data: a discrete cosine or sine transform of the kind
+// set by config_param::REAL_REAL_KIND.
+enum class domain { REAL, COMPLEX, REAL_REAL };
+
+// Which product of dft::convolve and dft::correlate a backend computes.
+enum class convolution_kind { CONVOLUTION, CORRELATION };
 
 // Forward declarations
 template <precision prec, domain dom>
@@ -86,6 +117,61 @@ struct descriptor_info<descriptor<precision::DOUBLE, domain::COMPLEX>> {
     using forward_type = std::complex<double>;
     using backward_type = std::complex<double>;
 };
+template <>
+struct descriptor_info<descriptor<precision::SINGLE, domain::REAL_REAL>> {
+    using scalar_type = float;
+    using forward_type = float;
+    using backward_type = float;
+};
+template <>
+struct descriptor_info<descriptor<precision::DOUBLE, domain::REAL_REAL>> {
+    using scalar_type = double;
+    using forward_type = double;
+    using backward_type = double;
+};
+template <>
+struct descriptor_info<descriptor<precision::HALF, domain::REAL>> {
+    using scalar_type = sycl::half;
+    using forward_type = sycl::half;
+    using backward_type = complex_pair<sycl::half>;
+};
+template <>
+struct descriptor_info<descriptor<precision::HALF, domain::COMPLEX>> {
+    using scalar_type = sycl::half;
+    using forward_type = complex_pair<sycl::half>;
+    using backward_type = complex_pair<sycl::half>;
+};
+template <>
+struct descriptor_info<descriptor<precision::BFLOAT16, domain::REAL>> {
+    using scalar_type = oneapi::mkl::bfloat16;
+    using forward_type = oneapi::mkl::bfloat16;
+    using backward_type = complex_pair<oneapi::mkl::bfloat16>;
+};
+template <>
+struct descriptor_info<descriptor<precision::BFLOAT16, domain::COMPLEX>> {
+    using scalar_type = oneapi::mkl::bfloat16;
+    using forward_type = complex_pair<oneapi::mkl::bfloat16>;
+    using backward_type = complex_pair<oneapi::mkl::bfloat16>;
+};
+
+template <typename descriptor_type>
+inline constexpr bool is_real_real_domain = false;
+template <precision prec>
+inline constexpr bool is_real_real_domain<descriptor<prec, domain::REAL_REAL>> = true;
+
+// Placeholder element type of the separate real and imaginary arrays of a REAL_REAL domain
+// descriptor, which has no complex data. It keeps the signatures taking such arrays apart from
+// those taking forward and backward data, which have the scalar type.
+template <typename scalar_type>
+struct no_split_storage {};
+
+// The element type of the separate real and imaginary arrays of complex data stored with
+// config_value::REAL_REAL.
+template <typename descriptor_type>
+using split_storage_t =
+    std::conditional_t<is_real_real_domain<descriptor_type>,
+                       no_split_storage<typename descriptor_info<descriptor_type>::scalar_type>,
+                       typename descriptor_info<descriptor_type>::scalar_type>;
 
 template <typename T, typename... Ts>
 using is_one_of = typename std::bool_constant<(std::is_same_v<T, Ts> || ...)>;
@@ -95,7 +181,12 @@ using valid_compute_arg = typename std::bool_constant<
     (std::is_same_v<typename detail::descriptor_info<descriptor_type>::scalar_type, float> &&
      is_one_of<T, float, sycl::float2, sycl::float4, std::complex<float>>::value) ||
     (std::is_same_v<typename detail::descriptor_info<descriptor_type>::scalar_type, double> &&
-     is_one_of<T, double, sycl::double2, sycl::double4, std::complex<double>>::value)>;
+     is_one_of<T, double, sycl::double2, sycl::double4, std::complex<double>>::value) ||
+    (std::is_same_v<typename detail::descriptor_info<descriptor_type>::scalar_type, sycl::half> &&
+     is_one_of<T, sycl::half, sycl::half2, sycl::half4, complex_pair<sycl::half>>::value) ||
+    (std::is_same_v<typename detail::descriptor_info<descriptor_type>::scalar_type,
+                    oneapi::mkl::bfloat16> &&
+     is_one_of<T, oneapi::mkl::bfloat16, complex_pair<oneapi::mkl::bfloat16>>::value)>;
 
 // compute the range of a reinterpreted buffer
 template <typename In, typename Out>
@@ -140,7 +231,26 @@ enum class config_param {
     ORDERING,
     TRANSPOSE,
     PACKED_FORMAT,
-    COMMIT_STATUS
+    COMMIT_STATUS,
+
+    WORKSPACE_PLACEMENT,
+    WORKSPACE_EXTERNAL_BYTES,
+
+    // Upper bound in bytes on the memory a compute call works in besides its data, or 0 for none.
+    MAX_WORKING_SET_BYTES,
+
+    // The transform of a REAL_REAL domain descriptor in the forward direction.
+    REAL_REAL_KIND,
+
+    // How much time commit may spend measuring candidate plans.
+    TUNING_LEVEL,
+
+    // Pruned one-dimensional transforms read only the first PRUNED_INPUT_LENGTH elements of their
+    // input, taking the others as zero, and write only the PRUNED_OUTPUT_LENGTH elements of their
+    // output from PRUNED_OUTPUT_OFFSET. Lengths of 0 extend to the end of the transform.
+    PRUNED_INPUT_LENGTH,
+    PRUNED_OUTPUT_OFFSET,
+    PRUNED_OUTPUT_LENGTH
 };
 
 enum class config_value {
@@ -169,7 +279,31 @@ enum class config_value {
     NONE,
 
     // for config_param::PACKED_FORMAT for storing conjugate-even finite sequence in real containers
-    CCE_FORMAT
+    CCE_FORMAT,
+
+    // for config_param::WORKSPACE_PLACEMENT
+    WORKSPACE_AUTOMATIC,
+    WORKSPACE_EXTERNAL,
+
+    // for config_param::REAL_REAL_KIND. The unnormalized type II and III discrete cosine and sine
+    // transforms of length N, for 0 <= k < N:
+    //   DCT_II:  y[k] = 2 * sum_j x[j] * cos(pi * (j + 1/2) * k / N)
+    //   DCT_III: y[k] = x[0] + 2 * sum_{j>0} x[j] * cos(pi * j * (k + 1/2) / N)
+    //   DST_II:  y[k] = 2 * sum_j x[j] * sin(pi * (j + 1/2) * (k + 1) / N)
+    //   DST_III: y[k] = (-1)^k * x[N-1] + 2 * sum_{j<N-1} x[j] * sin(pi * (j + 1) * (k + 1/2) / N)
+    // The backward transform is the inverse kind, DCT_III for DCT_II and so on, so a round trip
+    // multiplies the data by 2 * N along each dimension.
+    DCT_II,
+    DCT_III,
+    DST_II,
+    DST_III,
+
+    // for config_param::TUNING_LEVEL. TUNING_MEASURE times the factorizations of each transform
+    // length, TUNING_EXHAUSTIVE also the blocking of the lines of strided dimensions. Choices
+    // already recorded as wisdom are reused without measuring.
+    TUNING_NONE,
+    TUNING_MEASURE,
+    TUNING_EXHAUSTIVE
 };
 
 template <precision prec, domain dom>
@@ -193,6 +327,13 @@ public:
     config_value ordering;
     bool transpose;
     config_value packed_format;
+    config_value workspace_placement;
+    std::int64_t max_working_set_bytes;
+    config_value real_real_kind;
+    config_value tuning_level;
+    std::int64_t pruned_input_length;
+    std::int64_t pruned_output_offset;
+    std::int64_t pruned_output_length;
     std::vector<std::int64_t> dimensions;
 };
 
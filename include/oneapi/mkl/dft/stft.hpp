@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_STFT_HPP_
+#define _ONEMKL_DFT_STFT_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "detail/types_impl.hpp"
+
+// Short-time Fourier transforms through a committed one-dimensional REAL domain descriptor,
+// whose length n is the frame length.
+//
+// stft transforms the frames of n samples that start every hop samples of the signal and lie
+// entirely within it, multiplying each by the n-element window as it is read from the signal, so
+// no framed copy of the signal is made. Frame f = 0, ..., (signal_length - n) / hop has its
+// n / 2 + 1 spectrum elements at out[f * (n / 2 + 1)], scaled by the forward scale of the
+// descriptor.
+//
+// istft inverts frames spectra laid out that way: each frame is transformed back, scaled by the
+// backward scale, multiplied by the window and overlap-added into the (frames - 1) * hop + n
+// samples of out, which are divided by the sum of the squared windows covering them, or set to
+// zero where that sum is zero. It needs hop <= n, and with a backward scale of 1 / n it returns
+// the signal given to stft.
+
+namespace oneapi::mkl::dft {
+
+namespace detail {
+
+template <typename descriptor_type>
+inline void check_stft_descriptor() {
+    using info = detail::descriptor_info<descriptor_type>;
+    static_assert(std::is_same_v<typename info::forward_type, typename info::scalar_type> &&
+                      !std::is_same_v<typename info::backward_type, typename info::scalar_type>,
+                  "The short-time Fourier transform requires a REAL domain descriptor");
+}
+
+template <typename descriptor_type>
+using stft_real_t = typename detail::descriptor_info<descriptor_type>::forward_type;
+
+template <typename descriptor_type>
+using stft_complex_t = typename detail::descriptor_info<descriptor_type>::backward_type;
+
+} // namespace detail
+
+//Buffer version
+
+//Short-time Fourier transform of the whole signal buffer
+template <typename descriptor_type>
+void stft(descriptor_type &desc, sycl::buffer<detail::stft_real_t<descriptor_type>, 1> &signal,
+          sycl::buffer<detail::stft_real_t<descriptor_type>, 1> &window, std::int64_t hop,
+          sycl::buffer<detail::stft_complex_t<descriptor_type>, 1> &out) {
+    detail::check_stft_descriptor<descriptor_type>();
+    get_commit(desc)->stft(desc, signal, window, hop, out);
+}
+
+//Inverse of the frames held in the spectra buffer
+template <typename descriptor_type>
+void istft(descriptor_type &desc, sycl::buffer<detail::stft_complex_t<descriptor_type>, 1> &spectra,
+           sycl::buffer<detail::stft_real_t<descriptor_type>, 1> &window, std::int64_t hop,
+           sycl::buffer<detail::stft_real_t<descriptor_type>, 1> &out) {
+    detail::check_stft_descriptor<descriptor_type>();
+    get_commit(desc)->istft(desc, spectra, window, hop, out);
+}
+
+//USM version
+
+//Short-time Fourier transform
+template <typename descriptor_type>
+sycl::event stft(descriptor_type &desc, const detail::stft_real_t<descriptor_type> *signal,
+                 std::int64_t signal_length, const detail::stft_real_t<descriptor_type> *window,
+                 std::int64_t hop, detail::stft_complex_t<descriptor_type> *out,
+                 const std::vector<sycl::event> &dependencies = {}) {
+    detail::check_stft_descriptor<descriptor_type>();
+    return get_commit(desc)->stft(desc, signal, signal_length, window, hop, out, dependencies);
+}
+
+//Inverse short-time Fourier transform
+template <typename descriptor_type>
+sycl::event istft(descriptor_type &desc, const detail::stft_complex_t<descriptor_type> *spectra,
+                  std::int64_t frames, const detail::stft_real_t<descriptor_type> *window,
+                  std::int64_t hop, detail::stft_real_t<descriptor_type> *out,
+                  const std::vector<sycl::event> &dependencies = {}) {
+    detail::check_stft_descriptor<descriptor_type>();
+    return get_commit(desc)->istft(desc, spectra, frames, window, hop, out, dependencies);
+}
+
+} // namespace oneapi::mkl::dft
+
+#endif // _ONEMKL_DFT_STFT_HPP_
@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_SUB_DEVICES_HPP_
+#define _ONEMKL_DFT_SUB_DEVICES_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <vector>
+
+namespace oneapi::mkl::dft {
+
+// Queues on the NUMA sub-devices of device, sharing one context, for committing a batched
+// descriptor to several queues; or a single queue on device when it cannot be partitioned by
+// NUMA domain. The data of the batches of each queue is best allocated and first written on
+// that queue, so that it is local to the socket transforming it.
+inline std::vector<sycl::queue> numa_queues(const sycl::device &device) {
+    try {
+        auto sub_devices = device.create_sub_devices<
+            sycl::info::partition_property::partition_by_affinity_domain>(
+            sycl::info::partition_affinity_domain::numa);
+        if (sub_devices.size() > 1) {
+            sycl::context context(sub_devices);
+            std::vector<sycl::queue> queues;
+            for (const auto &sub_device : sub_devices) {
+                queues.emplace_back(context, sub_device);
+            }
+            return queues;
+        }
+    }
+    catch (const sycl::exception &) {
+        // The device does not support this partitioning.
+    }
+    return { sycl::queue(device) };
+}
+
+} // namespace oneapi::mkl::dft
+
+#endif // _ONEMKL_DFT_SUB_DEVICES_HPP_
@@ -35,6 +35,10 @@ using config_param = detail::config_param;
 using config_value = detail::config_value;
 using DFT_ERROR = detail::DFT_ERROR;
 
+// Complex data of precision::HALF and precision::BFLOAT16 descriptors.
+using complex_half = detail::complex_pair<sycl::half>;
+using complex_bfloat16 = detail::complex_pair<oneapi::mkl::bfloat16>;
+
 } // namespace dft
 } // namespace mkl
 } // namespace oneapi
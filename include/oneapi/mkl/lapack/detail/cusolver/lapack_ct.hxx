@@ -262,6 +262,28 @@ static inline void heevd(backend_selector<backend::cusolver> selector, oneapi::m
     oneapi::mkl::lapack::cusolver::heevd(selector.get_queue(), jobz, uplo, n, a, lda, w, scratchpad,
                                          scratchpad_size);
 }
+static inline void heevx(backend_selector<backend::cusolver> selector, oneapi::mkl::compz jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::cusolver::heevx(selector.get_queue(), jobz, range, uplo, n, a, lda, vl, vu,
+                                         il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void heevx(backend_selector<backend::cusolver> selector, oneapi::mkl::compz jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                         double vu, std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::cusolver::heevx(selector.get_queue(), jobz, range, uplo, n, a, lda, vl, vu,
+                                         il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+}
 static inline void hegvd(backend_selector<backend::cusolver> selector, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -500,6 +522,26 @@ static inline void syevd(backend_selector<backend::cusolver> selector, oneapi::m
     oneapi::mkl::lapack::cusolver::syevd(selector.get_queue(), jobz, uplo, n, a, lda, w, scratchpad,
                                          scratchpad_size);
 }
+static inline void syevx(backend_selector<backend::cusolver> selector, oneapi::mkl::compz jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, double vl, double vu,
+                         std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::cusolver::syevx(selector.get_queue(), jobz, range, uplo, n, a, lda, vl, vu,
+                                         il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void syevx(backend_selector<backend::cusolver> selector, oneapi::mkl::compz jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::cusolver::syevx(selector.get_queue(), jobz, range, uplo, n, a, lda, vl, vu,
+                                         il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+}
 static inline void sygvd(backend_selector<backend::cusolver> selector, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
@@ -1217,6 +1259,30 @@ static inline sycl::event heevd(backend_selector<backend::cusolver> selector, on
     return oneapi::mkl::lapack::cusolver::heevd(selector.get_queue(), jobz, uplo, n, a, lda, w,
                                                 scratchpad, scratchpad_size, dependencies);
 }
+static inline sycl::event heevx(backend_selector<backend::cusolver> selector,
+                                oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+                                std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w,
+                                std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::cusolver::heevx(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                                vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                scratchpad_size, dependencies);
+}
+static inline sycl::event heevx(backend_selector<backend::cusolver> selector,
+                                oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+                                std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::cusolver::heevx(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                                vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                scratchpad_size, dependencies);
+}
 static inline sycl::event hegvd(backend_selector<backend::cusolver> selector, std::int64_t itype,
                                 oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                                 std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
@@ -1481,6 +1547,28 @@ static inline sycl::event syevd(backend_selector<backend::cusolver> selector, on
     return oneapi::mkl::lapack::cusolver::syevd(selector.get_queue(), jobz, uplo, n, a, lda, w,
                                                 scratchpad, scratchpad_size, dependencies);
 }
+static inline sycl::event syevx(backend_selector<backend::cusolver> selector,
+                                oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                                double vl, double vu, std::int64_t il, std::int64_t iu,
+                                double abstol, std::int64_t *m, double *w, double *z,
+                                std::int64_t ldz, double *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::cusolver::syevx(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                                vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                scratchpad_size, dependencies);
+}
+static inline sycl::event syevx(backend_selector<backend::cusolver> selector,
+                                oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                                float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                                std::int64_t *m, float *w, float *z, std::int64_t ldz,
+                                float *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::cusolver::syevx(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                                vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                scratchpad_size, dependencies);
+}
 static inline sycl::event sygvd(backend_selector<backend::cusolver> selector, std::int64_t itype,
                                 oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                                 double *a, std::int64_t lda, double *b, std::int64_t ldb, double *w,
@@ -2343,6 +2431,17 @@ std::int64_t heevd_scratchpad_size(backend_selector<backend::cusolver> selector,
                                                                          uplo, n, lda);
 }
 template <typename fp_type>
+std::int64_t heevx_scratchpad_size(backend_selector<backend::cusolver> selector,
+                                   oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   typename fp_type::value_type vl, typename fp_type::value_type vu,
+                                   std::int64_t il, std::int64_t iu,
+                                   typename fp_type::value_type abstol, std::int64_t ldz) {
+    return oneapi::mkl::lapack::cusolver::heevx_scratchpad_size<fp_type>(selector.get_queue(), jobz,
+                                                                         range, uplo, n, lda, vl,
+                                                                         vu, il, iu, abstol, ldz);
+}
+template <typename fp_type>
 std::int64_t hegvd_scratchpad_size(backend_selector<backend::cusolver> selector, std::int64_t itype,
                                    oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                                    std::int64_t lda, std::int64_t ldb) {
@@ -2437,6 +2536,16 @@ std::int64_t syevd_scratchpad_size(backend_selector<backend::cusolver> selector,
                                                                          uplo, n, lda);
 }
 template <typename fp_type>
+std::int64_t syevx_scratchpad_size(backend_selector<backend::cusolver> selector,
+                                   oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   fp_type vl, fp_type vu, std::int64_t il, std::int64_t iu,
+                                   fp_type abstol, std::int64_t ldz) {
+    return oneapi::mkl::lapack::cusolver::syevx_scratchpad_size<fp_type>(selector.get_queue(), jobz,
+                                                                         range, uplo, n, lda, vl,
+                                                                         vu, il, iu, abstol, ldz);
+}
+template <typename fp_type>
 std::int64_t sygvd_scratchpad_size(backend_selector<backend::cusolver> selector, std::int64_t itype,
                                    oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                                    std::int64_t lda, std::int64_t ldb) {
@@ -2625,3 +2734,7 @@ std::int64_t ungqr_batch_scratchpad_size(backend_selector<backend::cusolver> sel
     return oneapi::mkl::lapack::cusolver::ungqr_batch_scratchpad_size<fp_type>(
         selector.get_queue(), m, n, k, lda, group_count, group_sizes);
 }
+static inline void set_info_array(backend_selector<backend::cusolver> selector, std::int64_t *info,
+                                  std::int64_t size) {
+    oneapi::mkl::lapack::cusolver::set_info_array(selector.get_queue(), info, size);
+}
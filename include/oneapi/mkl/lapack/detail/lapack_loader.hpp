@@ -192,6 +192,22 @@ ONEMKL_EXPORT void heevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi:
                          sycl::buffer<std::complex<double>> &a, std::int64_t lda,
                          sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                         double vu, std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size);
 ONEMKL_EXPORT void hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -334,6 +350,20 @@ ONEMKL_EXPORT void syevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi:
                          oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
                          std::int64_t lda, sycl::buffer<float> &w, sycl::buffer<float> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, double vl, double vu,
+                         std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size);
 ONEMKL_EXPORT void sygvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
@@ -786,6 +816,22 @@ ONEMKL_EXPORT sycl::event heevd(oneapi::mkl::device libkey, sycl::queue &queue,
                                 std::complex<double> *a, std::int64_t lda, double *w,
                                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                                 const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+                                std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w,
+                                std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+                                std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                                 oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                                 std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
@@ -948,6 +994,20 @@ ONEMKL_EXPORT sycl::event syevd(oneapi::mkl::device libkey, sycl::queue &queue,
                                 float *a, std::int64_t lda, float *w, float *scratchpad,
                                 std::int64_t scratchpad_size,
                                 const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                                double vl, double vu, std::int64_t il, std::int64_t iu,
+                                double abstol, std::int64_t *m, double *w, double *z,
+                                std::int64_t ldz, double *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                                float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                                std::int64_t *m, float *w, float *z, std::int64_t ldz,
+                                float *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event sygvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                                 oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                                 double *a, std::int64_t lda, double *b, std::int64_t ldb, double *w,
@@ -1492,6 +1552,14 @@ std::int64_t heevd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queu
                                    std::int64_t lda);
 template <typename fp_type,
           oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                   oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   typename fp_type::value_type vl, typename fp_type::value_type vu,
+                                   std::int64_t il, std::int64_t iu,
+                                   typename fp_type::value_type abstol, std::int64_t ldz);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
 std::int64_t hegvd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
                                    std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
@@ -1555,6 +1623,13 @@ std::int64_t syevd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queu
                                    std::int64_t lda);
 template <typename fp_type,
           oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                   oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   fp_type vl, fp_type vu, std::int64_t il, std::int64_t iu,
+                                   fp_type abstol, std::int64_t ldz);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t sygvd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
                                    std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
@@ -1831,6 +1906,29 @@ ONEMKL_EXPORT std::int64_t heevd_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
     std::int64_t n, std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t heevx_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
+                                                                      sycl::queue &queue,
+                                                                      oneapi::mkl::compz jobz,
+                                                                      oneapi::mkl::rangev range,
+                                                                      oneapi::mkl::uplo uplo,
+                                                                      std::int64_t n,
+                                                                      std::int64_t lda, float vl,
+                                                                      float vu, std::int64_t il,
+                                                                      std::int64_t iu, float abstol,
+                                                                      std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
+                                                                       sycl::queue &queue,
+                                                                       oneapi::mkl::compz jobz,
+                                                                       oneapi::mkl::rangev range,
+                                                                       oneapi::mkl::uplo uplo,
+                                                                       std::int64_t n,
+                                                                       std::int64_t lda, double vl,
+                                                                       double vu, std::int64_t il,
+                                                                       std::int64_t iu,
+                                                                       double abstol,
+                                                                       std::int64_t ldz);
+template <>
 ONEMKL_EXPORT std::int64_t hegvd_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
     oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t ldb);
@@ -2023,6 +2121,23 @@ ONEMKL_EXPORT std::int64_t syevd_scratchpad_size<double>(oneapi::mkl::device lib
                                                          oneapi::mkl::uplo uplo, std::int64_t n,
                                                          std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t syevx_scratchpad_size<float>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, oneapi::mkl::compz jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, float vl, float vu,
+                                                        std::int64_t il, std::int64_t iu,
+                                                        float abstol, std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_scratchpad_size<double>(oneapi::mkl::device libkey,
+                                                         sycl::queue &queue,
+                                                         oneapi::mkl::compz jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, double vl, double vu,
+                                                         std::int64_t il, std::int64_t iu,
+                                                         double abstol, std::int64_t ldz);
+template <>
 ONEMKL_EXPORT std::int64_t sygvd_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, std::int64_t itype,
                                                         oneapi::mkl::job jobz,
@@ -2376,6 +2491,9 @@ template <>
 ONEMKL_EXPORT std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *k, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+
+ONEMKL_EXPORT void set_info_array(oneapi::mkl::device libkey, sycl::queue &queue,
+                                  std::int64_t *info, std::int64_t size);
 } //namespace detail
 } //namespace lapack
 } //namespace mkl
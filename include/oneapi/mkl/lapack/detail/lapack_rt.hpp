@@ -249,6 +249,28 @@ static inline void heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl:
     detail::heevd(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, scratchpad,
                   scratchpad_size);
 }
+static inline void heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                         double vu, std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
 static inline void hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                          oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -469,6 +491,24 @@ static inline void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl:
     detail::syevd(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, scratchpad,
                   scratchpad_size);
 }
+static inline void syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                         double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                         float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
 static inline void sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                          oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
                          std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
@@ -1131,6 +1171,26 @@ static inline sycl::event heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneap
     return detail::heevd(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, scratchpad,
                          scratchpad_size, dependencies);
 }
+static inline sycl::event heevx(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, float vl, float vu,
+                                std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                                float *w, std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevx(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, double vl, double vu,
+                                std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                                double *w, std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
 static inline sycl::event hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                 oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
                                 std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
@@ -1369,6 +1429,25 @@ static inline sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneap
     return detail::syevd(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, scratchpad,
                          scratchpad_size, dependencies);
 }
+static inline sycl::event syevx(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                double *z, std::int64_t ldz, double *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevx(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+                                std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
 static inline sycl::event sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                 oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
                                 double *b, std::int64_t ldb, double *w, double *scratchpad,
@@ -2120,6 +2199,16 @@ std::int64_t heevd_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
     return detail::heevd_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, uplo, n, lda);
 }
 template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_scratchpad_size(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda,
+                                   typename fp_type::value_type vl, typename fp_type::value_type vu,
+                                   std::int64_t il, std::int64_t iu,
+                                   typename fp_type::value_type abstol, std::int64_t ldz) {
+    return detail::heevx_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range, uplo, n,
+                                                  lda, vl, vu, il, iu, abstol, ldz);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
 std::int64_t hegvd_scratchpad_size(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
                                    std::int64_t ldb) {
@@ -2205,6 +2294,15 @@ std::int64_t syevd_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
     return detail::syevd_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, uplo, n, lda);
 }
 template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_scratchpad_size(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, fp_type vl, fp_type vu,
+                                   std::int64_t il, std::int64_t iu, fp_type abstol,
+                                   std::int64_t ldz) {
+    return detail::syevx_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range, uplo, n,
+                                                  lda, vl, vu, il, iu, abstol, ldz);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t sygvd_scratchpad_size(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
                                    std::int64_t ldb) {
@@ -2387,6 +2485,10 @@ std::int64_t ungqr_batch_scratchpad_size(sycl::queue &queue, std::int64_t *m, st
                                                         group_count, group_sizes);
 }
 
+static inline void set_info_array(sycl::queue &queue, std::int64_t *info, std::int64_t size) {
+    detail::set_info_array(get_device_id(queue), queue, info, size);
+}
+
 } // namespace lapack
 } // namespace mkl
 } // namespace oneapi
@@ -154,6 +154,22 @@ ONEMKL_EXPORT void heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl:
                          std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
                          sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                         double vu, std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size);
 ONEMKL_EXPORT void hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                          oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -292,6 +308,18 @@ ONEMKL_EXPORT void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl:
                          std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
                          sycl::buffer<float> &w, sycl::buffer<float> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                         double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                         float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size);
 ONEMKL_EXPORT void sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                          oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
                          std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
@@ -716,6 +744,20 @@ ONEMKL_EXPORT sycl::event heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneap
                                 double *w, std::complex<double> *scratchpad,
                                 std::int64_t scratchpad_size,
                                 const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, float vl, float vu,
+                                std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                                float *w, std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, double vl, double vu,
+                                std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                                double *w, std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                 oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
                                 std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
@@ -858,6 +900,19 @@ ONEMKL_EXPORT sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneap
                                 std::int64_t n, float *a, std::int64_t lda, float *w,
                                 float *scratchpad, std::int64_t scratchpad_size,
                                 const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                double *z, std::int64_t ldz, double *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+                                std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                 oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
                                 double *b, std::int64_t ldb, double *w, double *scratchpad,
@@ -1344,6 +1399,13 @@ template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullp
 std::int64_t heevd_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda);
 template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_scratchpad_size(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda,
+                                   typename fp_type::value_type vl, typename fp_type::value_type vu,
+                                   std::int64_t il, std::int64_t iu,
+                                   typename fp_type::value_type abstol, std::int64_t ldz);
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
 std::int64_t hegvd_scratchpad_size(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
                                    std::int64_t ldb);
@@ -1396,6 +1458,12 @@ template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t syevd_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda);
 template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_scratchpad_size(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, fp_type vl, fp_type vu,
+                                   std::int64_t il, std::int64_t iu, fp_type abstol,
+                                   std::int64_t ldz);
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t sygvd_scratchpad_size(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
                                    std::int64_t ldb);
@@ -1634,6 +1702,27 @@ ONEMKL_EXPORT std::int64_t heevd_scratchpad_size<std::complex<double>>(sycl::que
                                                                        std::int64_t n,
                                                                        std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t heevx_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                                      oneapi::mkl::compz jobz,
+                                                                      oneapi::mkl::rangev range,
+                                                                      oneapi::mkl::uplo uplo,
+                                                                      std::int64_t n,
+                                                                      std::int64_t lda, float vl,
+                                                                      float vu, std::int64_t il,
+                                                                      std::int64_t iu, float abstol,
+                                                                      std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                                       oneapi::mkl::compz jobz,
+                                                                       oneapi::mkl::rangev range,
+                                                                       oneapi::mkl::uplo uplo,
+                                                                       std::int64_t n,
+                                                                       std::int64_t lda, double vl,
+                                                                       double vu, std::int64_t il,
+                                                                       std::int64_t iu,
+                                                                       double abstol,
+                                                                       std::int64_t ldz);
+template <>
 ONEMKL_EXPORT std::int64_t hegvd_scratchpad_size<std::complex<float>>(
     sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
     std::int64_t n, std::int64_t lda, std::int64_t ldb);
@@ -1794,6 +1883,21 @@ ONEMKL_EXPORT std::int64_t syevd_scratchpad_size<double>(sycl::queue &queue, one
                                                          oneapi::mkl::uplo uplo, std::int64_t n,
                                                          std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t syevx_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, float vl, float vu,
+                                                        std::int64_t il, std::int64_t iu,
+                                                        float abstol, std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_scratchpad_size<double>(sycl::queue &queue,
+                                                         oneapi::mkl::compz jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, double vl, double vu,
+                                                         std::int64_t il, std::int64_t iu,
+                                                         double abstol, std::int64_t ldz);
+template <>
 ONEMKL_EXPORT std::int64_t sygvd_scratchpad_size<float>(sycl::queue &queue, std::int64_t itype,
                                                         oneapi::mkl::job jobz,
                                                         oneapi::mkl::uplo uplo, std::int64_t n,
@@ -2137,3 +2241,5 @@ template <>
 ONEMKL_EXPORT std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(
     sycl::queue &queue, std::int64_t *m, std::int64_t *n, std::int64_t *k, std::int64_t *lda,
     std::int64_t group_count, std::int64_t *group_sizes);
+
+ONEMKL_EXPORT void set_info_array(sycl::queue &queue, std::int64_t *info, std::int64_t size);
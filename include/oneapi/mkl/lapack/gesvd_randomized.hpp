@@ -0,0 +1,276 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/blas.hpp"
+#include "oneapi/mkl/lapack.hpp"
+#include "oneapi/mkl/rng.hpp"
+
+// Randomized truncated SVD (Halko, Martinsson and Tropp) composed from the public run-time
+// dispatch APIs of the BLAS, LAPACK and RNG domains, so it runs on any backend providing them.
+//
+// For a rank k approximation of the m x n matrix A with l = min(k + oversampling, m, n):
+//   1. Draw a Gaussian sketch Omega (n x l) and form Y = A Omega.
+//   2. Run power_iterations rounds of Y = A (A^H Q(Y)), re-orthonormalizing in between.
+//   3. Q = orth(Y) (m x l), B = Q^H A (l x n).
+//   4. B = Ub S VTb with gesvd, U = Q Ub.
+// The leading k singular triplets are written to s, u and vt.
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace detail {
+namespace rsvd {
+
+template <typename T>
+struct real_type {
+    using type = T;
+};
+template <typename T>
+struct real_type<std::complex<T>> {
+    using type = T;
+};
+
+template <typename T>
+constexpr bool is_complex = !std::is_same_v<T, typename real_type<T>::type>;
+
+inline oneapi::mkl::jobsvd small_jobu(oneapi::mkl::jobsvd jobu) {
+    return jobu == oneapi::mkl::jobsvd::novec ? oneapi::mkl::jobsvd::novec
+                                              : oneapi::mkl::jobsvd::vectors;
+}
+
+inline oneapi::mkl::jobsvd small_jobvt(oneapi::mkl::jobsvd jobvt) {
+    return jobvt == oneapi::mkl::jobsvd::novec ? oneapi::mkl::jobsvd::novec
+                                               : oneapi::mkl::jobsvd::somevec;
+}
+
+// Offsets into the scratchpad, in elements of T. The sketch region has one spare element so
+// an even number of reals can always be drawn from the Box-Muller generator.
+struct layout {
+    std::int64_t l;
+    std::int64_t omega;
+    std::int64_t y;
+    std::int64_t tau;
+    std::int64_t ub;
+    std::int64_t vtb;
+    std::int64_t sv;
+    std::int64_t work;
+    std::int64_t work_size;
+    std::int64_t total;
+};
+
+template <typename T>
+std::int64_t form_q_scratchpad_size(sycl::queue &queue, std::int64_t rows, std::int64_t l) {
+    if constexpr (is_complex<T>)
+        return lapack::ungqr_scratchpad_size<T>(queue, rows, l, l, rows);
+    else
+        return lapack::orgqr_scratchpad_size<T>(queue, rows, l, l, rows);
+}
+
+template <typename T>
+layout make_layout(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                   std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t oversampling) {
+    layout lay;
+    const std::int64_t l = std::min(k + oversampling, std::min(m, n));
+    lay.l = l;
+    lay.omega = 0;
+    lay.y = lay.omega + n * l + 1;
+    lay.tau = lay.y + m * l;
+    lay.ub = lay.tau + l;
+    lay.vtb = lay.ub + l * l;
+    lay.sv = lay.vtb + l * n;
+    lay.work = lay.sv + l;
+    lay.work_size = std::max({ lapack::geqrf_scratchpad_size<T>(queue, m, l, m),
+                               lapack::geqrf_scratchpad_size<T>(queue, n, l, n),
+                               form_q_scratchpad_size<T>(queue, m, l),
+                               form_q_scratchpad_size<T>(queue, n, l),
+                               lapack::gesvd_scratchpad_size<T>(queue, small_jobu(jobu),
+                                                                small_jobvt(jobvt), l, n, l, l,
+                                                                l) });
+    lay.total = lay.work + lay.work_size;
+    return lay;
+}
+
+// Overwrite the rows x l matrix x with an orthonormal basis of its column space
+template <typename T>
+sycl::event orthonormalize(sycl::queue &queue, std::int64_t rows, std::int64_t l, T *x, T *tau,
+                           T *work, std::int64_t work_size,
+                           const std::vector<sycl::event> &dependencies) {
+    auto qr = lapack::geqrf(queue, rows, l, x, rows, tau, work, work_size, dependencies);
+    if constexpr (is_complex<T>)
+        return lapack::ungqr(queue, rows, l, l, x, rows, tau, work, work_size, { qr });
+    else
+        return lapack::orgqr(queue, rows, l, l, x, rows, tau, work, work_size, { qr });
+}
+
+// The engine state is released when engine goes out of scope, and some backends (mklcpu) still
+// read it from the pending generate task, so the draw is waited for before returning. Keeping the
+// engine alive in a dependent host_task instead is not an option: engine destruction may itself
+// submit to the queue on other backends (mklgpu).
+template <typename T>
+sycl::event sketch(sycl::queue &queue, std::int64_t count, T *omega, std::uint64_t seed,
+                   const std::vector<sycl::event> &dependencies) {
+    using real_t = typename real_type<T>::type;
+    std::int64_t reals = is_complex<T> ? 2 * count : count;
+    reals += reals % 2;
+    rng::philox4x32x10 engine(queue, seed);
+    rng::gaussian<real_t, rng::gaussian_method::box_muller2> distr;
+    auto done =
+        rng::generate(distr, engine, reals, reinterpret_cast<real_t *>(omega), dependencies);
+    done.wait();
+    return done;
+}
+
+} // namespace rsvd
+} // namespace detail
+
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gesvd_randomized_scratchpad_size(sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                                              oneapi::mkl::jobsvd jobvt, std::int64_t m,
+                                              std::int64_t n, std::int64_t k, std::int64_t lda,
+                                              std::int64_t ldu, std::int64_t ldvt,
+                                              std::int64_t oversampling) {
+    if (m == 0 || n == 0 || k == 0)
+        return 0;
+    return detail::rsvd::make_layout<fp_type>(queue, jobu, jobvt, m, n, k, oversampling).total;
+}
+
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+sycl::event gesvd_randomized(sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                             oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n,
+                             std::int64_t k, fp_type *a, std::int64_t lda,
+                             typename detail::rsvd::real_type<fp_type>::type *s, fp_type *u,
+                             std::int64_t ldu, fp_type *vt, std::int64_t ldvt,
+                             std::int64_t oversampling, std::int64_t power_iterations,
+                             std::uint64_t seed, fp_type *scratchpad, std::int64_t scratchpad_size,
+                             const std::vector<sycl::event> &dependencies = {}) {
+    using real_t = typename detail::rsvd::real_type<fp_type>::type;
+    using oneapi::mkl::jobsvd;
+    using oneapi::mkl::transpose;
+    const char *func = "gesvd_randomized";
+
+    if (jobu != jobsvd::novec && jobu != jobsvd::somevec)
+        throw lapack::invalid_argument(func, "jobu must be jobsvd::novec or jobsvd::somevec", -2);
+    if (jobvt != jobsvd::novec && jobvt != jobsvd::somevec)
+        throw lapack::invalid_argument(func, "jobvt must be jobsvd::novec or jobsvd::somevec", -3);
+    if (m < 0)
+        throw lapack::invalid_argument(func, "", -4);
+    if (n < 0)
+        throw lapack::invalid_argument(func, "", -5);
+    if (k < 0 || k > std::min(m, n))
+        throw lapack::invalid_argument(func, "k must satisfy 0 <= k <= min(m, n)", -6);
+    if (lda < std::max<std::int64_t>(1, m))
+        throw lapack::invalid_argument(func, "", -8);
+    if (jobu == jobsvd::somevec && ldu < std::max<std::int64_t>(1, m))
+        throw lapack::invalid_argument(func, "", -11);
+    if (jobvt == jobsvd::somevec && ldvt < std::max<std::int64_t>(1, k))
+        throw lapack::invalid_argument(func, "", -13);
+    if (oversampling < 0)
+        throw lapack::invalid_argument(func, "", -14);
+    if (power_iterations < 0)
+        throw lapack::invalid_argument(func, "", -15);
+
+    if (m == 0 || n == 0 || k == 0) {
+        return queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
+            cgh.single_task([]() {});
+        });
+    }
+
+    const auto lay = detail::rsvd::make_layout<fp_type>(queue, jobu, jobvt, m, n, k, oversampling);
+    if (scratchpad_size < lay.total) {
+        throw lapack::invalid_argument(
+            func,
+            "scratchpad_size is smaller than the value returned by "
+            "gesvd_randomized_scratchpad_size",
+            -18);
+    }
+
+    const std::int64_t l = lay.l;
+    fp_type *omega = scratchpad + lay.omega;
+    fp_type *y = scratchpad + lay.y;
+    fp_type *tau = scratchpad + lay.tau;
+    fp_type *ub = scratchpad + lay.ub;
+    fp_type *vtb = scratchpad + lay.vtb;
+    real_t *sv = reinterpret_cast<real_t *>(scratchpad + lay.sv);
+    fp_type *work = scratchpad + lay.work;
+    const std::int64_t work_size = lay.work_size;
+    const fp_type one = 1;
+    const fp_type zero = 0;
+
+    // Range finder: Y = A Omega, refined by power iterations
+    auto ev = detail::rsvd::sketch(queue, n * l, omega, seed, dependencies);
+    ev = blas::column_major::gemm(queue, transpose::nontrans, transpose::nontrans, m, l, n, one, a,
+                                  lda, omega, n, zero, y, m, { ev });
+    for (std::int64_t it = 0; it < power_iterations; ++it) {
+        ev = detail::rsvd::orthonormalize(queue, m, l, y, tau, work, work_size, { ev });
+        ev = blas::column_major::gemm(queue, transpose::conjtrans, transpose::nontrans, n, l, m,
+                                      one, a, lda, y, m, zero, omega, n, { ev });
+        ev = detail::rsvd::orthonormalize(queue, n, l, omega, tau, work, work_size, { ev });
+        ev = blas::column_major::gemm(queue, transpose::nontrans, transpose::nontrans, m, l, n,
+                                      one, a, lda, omega, n, zero, y, m, { ev });
+    }
+    ev = detail::rsvd::orthonormalize(queue, m, l, y, tau, work, work_size, { ev });
+
+    // B = Q^H A is small (l x n); B reuses the sketch region
+    fp_type *b = omega;
+    ev = blas::column_major::gemm(queue, transpose::conjtrans, transpose::nontrans, l, n, m, one,
+                                  y, m, a, lda, zero, b, l, { ev });
+    ev = lapack::gesvd(queue, detail::rsvd::small_jobu(jobu), detail::rsvd::small_jobvt(jobvt), l,
+                       n, b, l, sv, ub, l, vtb, l, work, work_size, { ev });
+
+    std::vector<sycl::event> outputs;
+    outputs.push_back(queue.memcpy(s, sv, k * sizeof(real_t), ev));
+    if (jobu == jobsvd::somevec) {
+        outputs.push_back(blas::column_major::gemm(queue, transpose::nontrans,
+                                                   transpose::nontrans, m, k, l, one, y, m, ub, l,
+                                                   zero, u, ldu, { ev }));
+    }
+    if (jobvt == jobsvd::somevec) {
+        outputs.push_back(queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(ev);
+            cgh.parallel_for(sycl::range<2>(n, k), [=](sycl::id<2> idx) {
+                const std::int64_t col = idx[0], row = idx[1];
+                vt[row + col * ldvt] = vtb[row + col * l];
+            });
+        }));
+    }
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(outputs);
+        cgh.single_task([]() {});
+    });
+}
+
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
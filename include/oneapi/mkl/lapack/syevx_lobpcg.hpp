@@ -0,0 +1,468 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/blas.hpp"
+#include "oneapi/mkl/lapack.hpp"
+
+// Extreme eigenpairs of a symmetric or Hermitian matrix with the locally optimal block
+// preconditioned conjugate gradient method (LOBPCG, Knyazev), composed from the public run-time
+// dispatch APIs of the BLAS and LAPACK domains, so it runs on any backend providing them.
+//
+// For the k = iu - il + 1 smallest (il = 1) or largest (iu = n) eigenpairs, a block of
+// l = k + guard_vectors vectors X is iterated. Each iteration:
+//   1. W = A X - X Theta is the block residual.
+//   2. S = orth([X W P]), whose leading l columns span X since the QR keeps leading spans.
+//   3. Rayleigh-Ritz: S^H A S = C Theta C^H with syevd/heevd, keeping the l extreme Ritz pairs.
+//   4. X = S C, A X = (A S) C and P = S(:, l:) C(l:, :), the new search directions.
+// Only O(n l) memory and O(n^2 l) work per iteration are needed. Matrices too small for a block
+// of 3 l columns are solved with syevd/heevd on a copy of A instead.
+//
+// A requested pair has converged when |A x - theta x|_2 <= tol * max |Ritz value|, the largest
+// Ritz value of the last Rayleigh-Ritz step estimating |A|_2. The residual norms are read back
+// after every iteration, which stops once all k pairs have converged or after max_iterations.
+// The number of pairs left unconverged is raised as the info of a computation_error once the
+// outputs hold the last approximations, as LAPACK syevx reports its failed eigenvectors.
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace detail {
+namespace lobpcg {
+
+template <typename T>
+struct real_type {
+    using type = T;
+};
+template <typename T>
+struct real_type<std::complex<T>> {
+    using type = T;
+};
+
+template <typename T>
+constexpr bool is_complex = !std::is_same_v<T, typename real_type<T>::type>;
+
+// Extra vectors iterated with the requested ones; they speed up the convergence of the last
+// requested eigenpairs when they are close to the next ones.
+constexpr std::int64_t guard_vectors = 8;
+
+inline std::int64_t block_size(std::int64_t n, std::int64_t k) {
+    return std::min(k + guard_vectors, n);
+}
+
+inline bool is_iterative(std::int64_t n, std::int64_t k) {
+    return 3 * block_size(n, k) <= n;
+}
+
+// Offsets into the scratchpad, in elements of T
+struct layout {
+    std::int64_t l;
+    // iterative path
+    std::int64_t s;     // n x 3l basis [X W P]
+    std::int64_t as;    // n x 3l, A S
+    std::int64_t ax;    // n x l, A X
+    std::int64_t x;     // n x l, new X
+    std::int64_t p;     // n x l, new P
+    std::int64_t g;     // 3l x 3l Rayleigh quotient and its eigenvectors
+    std::int64_t tau;   // 3l
+    std::int64_t theta; // 3l reals
+    std::int64_t res;   // l + 1 reals, residual norms and max |Ritz value|
+    // direct path
+    std::int64_t a;     // n x n copy of A
+    std::int64_t w;     // n reals
+    std::int64_t work;
+    std::int64_t work_size;
+    std::int64_t total;
+};
+
+template <typename T>
+std::int64_t eigh_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n) {
+    if constexpr (is_complex<T>)
+        return lapack::heevd_scratchpad_size<T>(queue, oneapi::mkl::job::vec, uplo, n, n);
+    else
+        return lapack::syevd_scratchpad_size<T>(queue, oneapi::mkl::job::vec, uplo, n, n);
+}
+
+template <typename T>
+std::int64_t form_q_scratchpad_size(sycl::queue &queue, std::int64_t rows, std::int64_t cols) {
+    if constexpr (is_complex<T>)
+        return lapack::ungqr_scratchpad_size<T>(queue, rows, cols, cols, rows);
+    else
+        return lapack::orgqr_scratchpad_size<T>(queue, rows, cols, cols, rows);
+}
+
+// Number of elements of T holding count reals
+template <typename T>
+constexpr std::int64_t reals_size(std::int64_t count) {
+    return is_complex<T> ? (count + 1) / 2 : count;
+}
+
+template <typename T>
+layout make_layout(sycl::queue &queue, std::int64_t n, std::int64_t k) {
+    layout lay{};
+    const std::int64_t l = block_size(n, k);
+    lay.l = l;
+    if (is_iterative(n, k)) {
+        lay.s = 0;
+        lay.as = lay.s + 3 * n * l;
+        lay.ax = lay.as + 3 * n * l;
+        lay.x = lay.ax + n * l;
+        lay.p = lay.x + n * l;
+        lay.g = lay.p + n * l;
+        lay.tau = lay.g + 9 * l * l;
+        lay.theta = lay.tau + 3 * l;
+        lay.res = lay.theta + reals_size<T>(3 * l);
+        lay.work = lay.res + reals_size<T>(l + 1);
+        lay.work_size = std::max({ lapack::geqrf_scratchpad_size<T>(queue, n, 3 * l, n),
+                                   form_q_scratchpad_size<T>(queue, n, 3 * l),
+                                   eigh_scratchpad_size<T>(queue, oneapi::mkl::uplo::upper,
+                                                           3 * l) });
+    }
+    else {
+        lay.a = 0;
+        lay.w = lay.a + n * n;
+        lay.work = lay.w + reals_size<T>(n);
+        lay.work_size = eigh_scratchpad_size<T>(queue, oneapi::mkl::uplo::upper, n);
+    }
+    lay.total = lay.work + lay.work_size;
+    return lay;
+}
+
+// Overwrite the rows x cols matrix x with an orthonormal basis of its column space
+template <typename T>
+sycl::event orthonormalize(sycl::queue &queue, std::int64_t rows, std::int64_t cols, T *x, T *tau,
+                           T *work, std::int64_t work_size,
+                           const std::vector<sycl::event> &dependencies) {
+    auto qr = lapack::geqrf(queue, rows, cols, x, rows, tau, work, work_size, dependencies);
+    if constexpr (is_complex<T>)
+        return lapack::ungqr(queue, rows, cols, cols, x, rows, tau, work, work_size, { qr });
+    else
+        return lapack::orgqr(queue, rows, cols, cols, x, rows, tau, work, work_size, { qr });
+}
+
+// c = A b for the n x cols matrix b, reading the uplo triangle of A
+template <typename T>
+sycl::event apply(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t cols,
+                  const T *a, std::int64_t lda, const T *b, T *c,
+                  const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_complex<T>)
+        return blas::column_major::hemm(queue, oneapi::mkl::side::left, uplo, n, cols, T(1), a,
+                                        lda, b, n, T(0), c, n, dependencies);
+    else
+        return blas::column_major::symm(queue, oneapi::mkl::side::left, uplo, n, cols, T(1), a,
+                                        lda, b, n, T(0), c, n, dependencies);
+}
+
+template <typename T>
+sycl::event eigh(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
+                 typename real_type<T>::type *w, T *work, std::int64_t work_size,
+                 const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_complex<T>)
+        return lapack::heevd(queue, oneapi::mkl::job::vec, uplo, n, a, n, w, work, work_size,
+                             dependencies);
+    else
+        return lapack::syevd(queue, oneapi::mkl::job::vec, uplo, n, a, n, w, work, work_size,
+                             dependencies);
+}
+
+// Fill the n x l matrix x with values uniform in [-1, 1) from a counter-based hash of seed
+template <typename T>
+sycl::event start_vectors(sycl::queue &queue, std::int64_t count, T *x, std::uint64_t seed,
+                          const std::vector<sycl::event> &dependencies) {
+    using real_t = typename real_type<T>::type;
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.parallel_for(sycl::range<1>(count), [=](sycl::id<1> idx) {
+            auto uniform = [=](std::uint64_t counter) {
+                // splitmix64 finalizer
+                std::uint64_t z = seed + (counter + 1) * 0x9e3779b97f4a7c15ull;
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+                z ^= z >> 31;
+                return real_t(2) * static_cast<real_t>(z >> 11) * real_t(0x1.0p-53) - real_t(1);
+            };
+            const std::uint64_t i = idx[0];
+            if constexpr (is_complex<T>)
+                x[i] = T(uniform(2 * i), uniform(2 * i + 1));
+            else
+                x[i] = uniform(i);
+        });
+    });
+}
+
+template <typename T>
+inline typename real_type<T>::type abs2(const T &x) {
+    if constexpr (is_complex<T>)
+        return x.real() * x.real() + x.imag() * x.imag();
+    else
+        return x * x;
+}
+
+template <typename T>
+sycl::event evx(const char *func, sycl::queue &queue, oneapi::mkl::compz jobz,
+                oneapi::mkl::uplo uplo, std::int64_t n, const T *a, std::int64_t lda,
+                std::int64_t il, std::int64_t iu, typename real_type<T>::type tol,
+                std::int64_t max_iterations, std::uint64_t seed, typename real_type<T>::type *w,
+                T *z, std::int64_t ldz, T *scratchpad, std::int64_t scratchpad_size,
+                const std::vector<sycl::event> &dependencies) {
+    using real_t = typename real_type<T>::type;
+    using oneapi::mkl::transpose;
+
+    if (jobz != oneapi::mkl::compz::novectors && jobz != oneapi::mkl::compz::vectors)
+        throw lapack::invalid_argument(func, "", -2);
+    if (n < 0)
+        throw lapack::invalid_argument(func, "", -4);
+    if (lda < std::max<std::int64_t>(1, n))
+        throw lapack::invalid_argument(func, "", -6);
+    if (il < 1 || il > std::max<std::int64_t>(1, n))
+        throw lapack::invalid_argument(func, "", -7);
+    if (iu < std::min(n, il) || iu > n)
+        throw lapack::invalid_argument(func, "", -8);
+    if (n > 0 && il != 1 && iu != n)
+        throw lapack::invalid_argument(
+            func, "only the smallest (il = 1) or largest (iu = n) eigenpairs can be selected", -7);
+    if (max_iterations < 0)
+        throw lapack::invalid_argument(func, "", -10);
+    if (jobz == oneapi::mkl::compz::vectors && ldz < std::max<std::int64_t>(1, n))
+        throw lapack::invalid_argument(func, "", -14);
+
+    const std::int64_t k = (n == 0) ? 0 : iu - il + 1;
+    if (k == 0) {
+        return queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
+            cgh.single_task([]() {});
+        });
+    }
+
+    const auto lay = make_layout<T>(queue, n, k);
+    if (scratchpad_size < lay.total) {
+        throw lapack::invalid_argument(
+            func, "scratchpad_size is smaller than the value returned by the scratchpad query",
+            -16);
+    }
+
+    const bool vectors = jobz == oneapi::mkl::compz::vectors;
+    T *work = scratchpad + lay.work;
+    const std::int64_t work_size = lay.work_size;
+
+    if (!is_iterative(n, k)) {
+        T *a_copy = scratchpad + lay.a;
+        real_t *w_all = reinterpret_cast<real_t *>(scratchpad + lay.w);
+        auto ev = queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
+            cgh.parallel_for(sycl::range<2>(n, n), [=](sycl::id<2> idx) {
+                const std::int64_t col = idx[0], row = idx[1];
+                a_copy[row + col * n] = a[row + col * lda];
+            });
+        });
+        ev = eigh(queue, uplo, n, a_copy, w_all, work, work_size, { ev });
+        return queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(ev);
+            cgh.parallel_for(sycl::range<2>(k, n), [=](sycl::id<2> idx) {
+                const std::int64_t col = idx[0], row = idx[1];
+                if (row == 0)
+                    w[col] = w_all[il - 1 + col];
+                if (vectors)
+                    z[row + col * ldz] = a_copy[row + (il - 1 + col) * n];
+            });
+        });
+    }
+
+    const std::int64_t l = lay.l;
+    const bool largest = il != 1;
+    T *s = scratchpad + lay.s;
+    T *as = scratchpad + lay.as;
+    T *ax = scratchpad + lay.ax;
+    T *x = scratchpad + lay.x;
+    T *p = scratchpad + lay.p;
+    T *g = scratchpad + lay.g;
+    T *tau = scratchpad + lay.tau;
+    real_t *theta = reinterpret_cast<real_t *>(scratchpad + lay.theta);
+    real_t *res = reinterpret_cast<real_t *>(scratchpad + lay.res);
+    const real_t tolerance =
+        tol > real_t(0) ? tol : real_t(n) * std::numeric_limits<real_t>::epsilon();
+    const T one = 1;
+    const T zero = 0;
+
+    // Rayleigh-Ritz on the nb columns of s, which must be orthonormal. The l extreme Ritz
+    // vectors replace X and A X, and the directions they take outside of X replace P.
+    std::int64_t first = 0;
+    auto rayleigh_ritz = [&](std::int64_t nb, sycl::event ev) {
+        ev = apply(queue, uplo, n, nb, a, lda, s, as, { ev });
+        ev = blas::column_major::gemm(queue, transpose::conjtrans, transpose::nontrans, nb, nb, n,
+                                      one, s, n, as, n, zero, g, nb, { ev });
+        ev = eigh(queue, oneapi::mkl::uplo::upper, nb, g, theta, work, work_size, { ev });
+        first = largest ? nb - l : 0;
+        const T *c = g + first * nb;
+        std::vector<sycl::event> updates;
+        updates.push_back(blas::column_major::gemm(queue, transpose::nontrans,
+                                                   transpose::nontrans, n, l, nb, one, s, n, c,
+                                                   nb, zero, x, n, { ev }));
+        updates.push_back(blas::column_major::gemm(queue, transpose::nontrans,
+                                                   transpose::nontrans, n, l, nb, one, as, n, c,
+                                                   nb, zero, ax, n, { ev }));
+        if (nb > l) {
+            updates.push_back(blas::column_major::gemm(
+                queue, transpose::nontrans, transpose::nontrans, n, l, nb - l, one, s + l * n, n,
+                c + l, nb, zero, p, n, { ev }));
+        }
+        std::vector<sycl::event> copies;
+        copies.push_back(queue.memcpy(s, x, n * l * sizeof(T), updates));
+        if (nb > l)
+            copies.push_back(queue.memcpy(s + 2 * l * n, p, n * l * sizeof(T), updates));
+        return queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(copies);
+            cgh.single_task([]() {});
+        });
+    };
+
+    // The requested pairs are the first k (smallest) or last k (largest) of the block
+    const std::int64_t offset = largest ? l - k : 0;
+    std::vector<real_t> res_host(k + 1);
+    std::int64_t unconverged = k;
+
+    auto ev = start_vectors(queue, n * l, s, seed, dependencies);
+    ev = orthonormalize(queue, n, l, s, tau, work, work_size, { ev });
+    ev = rayleigh_ritz(l, ev);
+    std::int64_t nb = l;
+    for (std::int64_t it = 0;; ++it) {
+        // W = A X - X Theta, with P kept from the previous iteration after the first one
+        const real_t *theta_x = theta + first;
+        ev = queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(ev);
+            cgh.parallel_for(sycl::range<2>(l, n), [=](sycl::id<2> idx) {
+                const std::int64_t col = idx[0], row = idx[1];
+                s[row + (l + col) * n] = ax[row + col * n] - s[row + col * n] * theta_x[col];
+            });
+        });
+        // Residual norms of the requested pairs, then the extreme Ritz value as the |A| estimate
+        ev = queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(ev);
+            cgh.parallel_for(sycl::range<1>(k), [=](sycl::id<1> idx) {
+                const T *r = s + (l + offset + idx[0]) * n;
+                real_t sum = 0;
+                for (std::int64_t row = 0; row < n; ++row)
+                    sum += abs2(r[row]);
+                res[idx[0]] = sycl::sqrt(sum);
+                if (idx[0] == 0)
+                    res[k] = sycl::fmax(sycl::fabs(theta[0]), sycl::fabs(theta[nb - 1]));
+            });
+        });
+        queue.memcpy(res_host.data(), res, (k + 1) * sizeof(real_t), ev).wait_and_throw();
+        const real_t bound = tolerance * res_host[k];
+        // NaN residuals count as unconverged
+        unconverged = std::count_if(res_host.begin(), res_host.begin() + k,
+                                    [=](real_t r) { return !(r <= bound); });
+        if (unconverged == 0 || it == max_iterations)
+            break;
+
+        nb = (it == 0) ? 2 * l : 3 * l;
+        ev = orthonormalize(queue, n, nb, s, tau, work, work_size, { ev });
+        ev = rayleigh_ritz(nb, ev);
+    }
+
+    const real_t *theta_x = theta + first + offset;
+    const T *x_out = s + offset * n;
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(ev);
+        cgh.parallel_for(sycl::range<2>(k, n), [=](sycl::id<2> idx) {
+            const std::int64_t col = idx[0], row = idx[1];
+            if (row == 0)
+                w[col] = theta_x[col];
+            if (vectors)
+                z[row + col * ldz] = x_out[row + col * n];
+        });
+    });
+    if (unconverged > 0) {
+        done.wait_and_throw();
+        throw lapack::computation_error(func,
+                                        std::to_string(unconverged) +
+                                            " eigenpairs did not converge to the tolerance",
+                                        unconverged);
+    }
+    return done;
+}
+
+} // namespace lobpcg
+} // namespace detail
+
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_lobpcg_scratchpad_size(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                          oneapi::mkl::uplo upper_lower, std::int64_t n,
+                                          std::int64_t lda, std::int64_t il, std::int64_t iu,
+                                          std::int64_t ldz) {
+    if (n == 0 || iu < il)
+        return 0;
+    return detail::lobpcg::make_layout<fp_type>(queue, n, iu - il + 1).total;
+}
+
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+sycl::event syevx_lobpcg(sycl::queue &queue, oneapi::mkl::compz jobz,
+                         oneapi::mkl::uplo upper_lower, std::int64_t n, const fp_type *a,
+                         std::int64_t lda, std::int64_t il, std::int64_t iu, fp_type tol,
+                         std::int64_t max_iterations, std::uint64_t seed, fp_type *w, fp_type *z,
+                         std::int64_t ldz, fp_type *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies = {}) {
+    return detail::lobpcg::evx("syevx_lobpcg", queue, jobz, upper_lower, n, a, lda, il, iu, tol,
+                               max_iterations, seed, w, z, ldz, scratchpad, scratchpad_size,
+                               dependencies);
+}
+
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_lobpcg_scratchpad_size(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                          oneapi::mkl::uplo upper_lower, std::int64_t n,
+                                          std::int64_t lda, std::int64_t il, std::int64_t iu,
+                                          std::int64_t ldz) {
+    if (n == 0 || iu < il)
+        return 0;
+    return detail::lobpcg::make_layout<fp_type>(queue, n, iu - il + 1).total;
+}
+
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+sycl::event heevx_lobpcg(sycl::queue &queue, oneapi::mkl::compz jobz,
+                         oneapi::mkl::uplo upper_lower, std::int64_t n, const fp_type *a,
+                         std::int64_t lda, std::int64_t il, std::int64_t iu,
+                         typename fp_type::value_type tol, std::int64_t max_iterations,
+                         std::uint64_t seed, typename fp_type::value_type *w, fp_type *z,
+                         std::int64_t ldz, fp_type *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies = {}) {
+    return detail::lobpcg::evx("heevx_lobpcg", queue, jobz, upper_lower, n, a, lda, il, iu, tol,
+                               max_iterations, seed, w, z, ldz, scratchpad, scratchpad_size,
+                               dependencies);
+}
+
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
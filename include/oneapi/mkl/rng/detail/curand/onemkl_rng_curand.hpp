@@ -65,6 +65,7 @@
 #include <CL/sycl.hpp>
 #endif
 #include <cstdint>
+#include <vector>
 
 #include "oneapi/mkl/detail/export.hpp"
 #include "oneapi/mkl/rng/detail/engine_impl.hpp"
@@ -86,6 +87,24 @@ ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mrg32k3a(sycl::queue
 ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mrg32k3a(
     sycl::queue queue, std::initializer_list<std::uint32_t> seed);
 
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mcg31m1(sycl::queue queue,
+                                                                    std::uint32_t seed);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mcg59(sycl::queue queue,
+                                                                  std::uint64_t seed);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mt19937(sycl::queue queue,
+                                                                    std::uint32_t seed);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mt19937(
+    sycl::queue queue, std::initializer_list<std::uint32_t> seed);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_sobol(sycl::queue queue,
+                                                                  std::uint32_t dimensions);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_sobol(
+    sycl::queue queue, std::vector<std::uint32_t>& direction_numbers);
+
 } // namespace curand
 } // namespace rng
 } // namespace mkl
@@ -96,6 +96,12 @@ public:
     virtual void generate(const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr,
                           std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) = 0;
 
+    virtual void generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) = 0;
+
+    virtual void generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) = 0;
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) = 0;
 
@@ -168,6 +174,14 @@ public:
         const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr, std::int64_t n,
         std::uint32_t* r, const std::vector<sycl::event>& dependencies) = 0;
 
+    virtual sycl::event generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) = 0;
+
+    virtual sycl::event generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) = 0;
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) = 0;
 
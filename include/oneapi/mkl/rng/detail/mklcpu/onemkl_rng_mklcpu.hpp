@@ -21,6 +21,7 @@
 #define _ONEMKL_RNG_MKLCPU_HPP_
 
 #include <cstdint>
+#include <vector>
 #if __has_include(<sycl/sycl.hpp>)
 #include <sycl/sycl.hpp>
 #else
@@ -47,6 +48,24 @@ ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mrg32k3a(sycl::queue
 ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mrg32k3a(
     sycl::queue queue, std::initializer_list<std::uint32_t> seed);
 
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mcg31m1(sycl::queue queue,
+                                                                    std::uint32_t seed);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mcg59(sycl::queue queue,
+                                                                  std::uint64_t seed);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mt19937(sycl::queue queue,
+                                                                    std::uint32_t seed);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mt19937(
+    sycl::queue queue, std::initializer_list<std::uint32_t> seed);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_sobol(sycl::queue queue,
+                                                                  std::uint32_t dimensions);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_sobol(
+    sycl::queue queue, std::vector<std::uint32_t>& direction_numbers);
+
 } // namespace mklcpu
 } // namespace rng
 } // namespace mkl
@@ -21,6 +21,7 @@
 #define _ONEMKL_RNG_LOADER_HPP_
 
 #include <cstdint>
+#include <vector>
 #if __has_include(<sycl/sycl.hpp>)
 #include <sycl/sycl.hpp>
 #else
@@ -49,6 +50,24 @@ ONEMKL_EXPORT engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, sycl::que
 ONEMKL_EXPORT engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, sycl::queue queue,
                                            std::initializer_list<std::uint32_t> seed);
 
+ONEMKL_EXPORT engine_impl* create_mcg31m1(oneapi::mkl::device libkey, sycl::queue queue,
+                                          std::uint32_t seed);
+
+ONEMKL_EXPORT engine_impl* create_mcg59(oneapi::mkl::device libkey, sycl::queue queue,
+                                        std::uint64_t seed);
+
+ONEMKL_EXPORT engine_impl* create_mt19937(oneapi::mkl::device libkey, sycl::queue queue,
+                                          std::uint32_t seed);
+
+ONEMKL_EXPORT engine_impl* create_mt19937(oneapi::mkl::device libkey, sycl::queue queue,
+                                          std::initializer_list<std::uint32_t> seed);
+
+ONEMKL_EXPORT engine_impl* create_sobol(oneapi::mkl::device libkey, sycl::queue queue,
+                                        std::uint32_t dimensions);
+
+ONEMKL_EXPORT engine_impl* create_sobol(oneapi::mkl::device libkey, sycl::queue queue,
+                                        std::vector<std::uint32_t>& direction_numbers);
+
 } // namespace detail
 } // namespace rng
 } // namespace mkl
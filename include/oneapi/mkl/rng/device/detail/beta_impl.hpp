@@ -0,0 +1,154 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_RNG_DEVICE_BETA_IMPL_HPP_
+#define _MKL_RNG_DEVICE_BETA_IMPL_HPP_
+
+#include "gamma_impl.hpp"
+
+namespace oneapi::mkl::rng::device::detail {
+
+// beta(p, q) is x / (x + y) for x and y gamma values of shapes p and q. Shapes below one are
+// combined as logarithms, 1 / (1 + exp(ln(y) - ln(x))), since their gamma values can underflow.
+template <typename RealType, typename Method>
+class distribution_base<oneapi::mkl::rng::device::beta<RealType, Method>> {
+public:
+    struct param_type {
+        param_type(RealType p, RealType q, RealType a, RealType b) : p_(p), q_(q), a_(a), b_(b) {}
+        RealType p_;
+        RealType q_;
+        RealType a_;
+        RealType b_;
+    };
+
+    distribution_base(RealType p, RealType q, RealType a, RealType b)
+            : p_(p),
+              q_(q),
+              a_(a),
+              b_(b),
+              params_p_(p),
+              params_q_(q) {
+#ifndef __SYCL_DEVICE_ONLY__
+        check(p, q, b);
+#endif
+    }
+
+    RealType p() const {
+        return p_;
+    }
+
+    RealType q() const {
+        return q_;
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType b() const {
+        return b_;
+    }
+
+    param_type param() const {
+        return param_type(p_, q_, a_, b_);
+    }
+
+    void param(const param_type& pt) {
+#ifndef __SYCL_DEVICE_ONLY__
+        check(pt.p_, pt.q_, pt.b_);
+#endif
+        p_ = pt.p_;
+        q_ = pt.q_;
+        a_ = pt.a_;
+        b_ = pt.b_;
+        params_p_ = gamma_impl::params<RealType>(p_);
+        params_q_ = gamma_impl::params<RealType>(q_);
+    }
+
+protected:
+    template <typename EngineType>
+    auto generate(EngineType& engine) ->
+        typename std::conditional<EngineType::vec_size == 1, RealType,
+                                  sycl::vec<RealType, EngineType::vec_size>>::type {
+        if constexpr (EngineType::vec_size == 1) {
+            return generate_single(engine);
+        }
+        else {
+            sycl::vec<RealType, EngineType::vec_size> res;
+            if (!params_p_.boost && !params_q_.boost) {
+                sycl::vec<RealType, EngineType::vec_size> x =
+                    gamma_impl::standard_vec(params_p_, engine);
+                sycl::vec<RealType, EngineType::vec_size> y =
+                    gamma_impl::standard_vec(params_q_, engine);
+                for (int i = 0; i < EngineType::vec_size; ++i) {
+                    res[i] = x[i] / (x[i] + y[i]);
+                }
+            }
+            else {
+                sycl::vec<RealType, EngineType::vec_size> x =
+                    gamma_impl::log_standard_vec(params_p_, engine);
+                sycl::vec<RealType, EngineType::vec_size> y =
+                    gamma_impl::log_standard_vec(params_q_, engine);
+                for (int i = 0; i < EngineType::vec_size; ++i) {
+                    res[i] = RealType(1) / (RealType(1) + exp_wrapper(y[i] - x[i]));
+                }
+            }
+            return res * b_ + a_;
+        }
+    }
+
+    template <typename EngineType>
+    RealType generate_single(EngineType& engine) {
+        RealType res;
+        if (!params_p_.boost && !params_q_.boost) {
+            RealType x = gamma_impl::standard(params_p_, engine);
+            RealType y = gamma_impl::standard(params_q_, engine);
+            res = x / (x + y);
+        }
+        else {
+            RealType x = gamma_impl::log_standard(params_p_, engine);
+            RealType y = gamma_impl::log_standard(params_q_, engine);
+            res = RealType(1) / (RealType(1) + exp_wrapper(y - x));
+        }
+        return sycl::fma(res, b_, a_);
+    }
+
+    static void check(RealType p, RealType q, RealType b) {
+        if (p <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "beta", "p <= 0");
+        }
+        if (q <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "beta", "q <= 0");
+        }
+        if (b <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "beta", "b <= 0");
+        }
+    }
+
+    RealType p_;
+    RealType q_;
+    RealType a_;
+    RealType b_;
+    gamma_impl::params<RealType> params_p_;
+    gamma_impl::params<RealType> params_q_;
+};
+
+} // namespace oneapi::mkl::rng::device::detail
+
+#endif // _MKL_RNG_DEVICE_BETA_IMPL_HPP_
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_RNG_DEVICE_CAUCHY_IMPL_HPP_
+#define _MKL_RNG_DEVICE_CAUCHY_IMPL_HPP_
+
+#include "engine_words.hpp"
+#include "vm_wrappers.hpp"
+
+namespace oneapi::mkl::rng::device::detail {
+
+template <typename RealType, typename Method>
+class distribution_base<oneapi::mkl::rng::device::cauchy<RealType, Method>> {
+public:
+    struct param_type {
+        param_type(RealType a, RealType b) : a_(a), b_(b) {}
+        RealType a_;
+        RealType b_;
+    };
+
+    distribution_base(RealType a, RealType b) : a_(a), b_(b) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (b <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "cauchy", "b <= 0");
+        }
+#endif
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType b() const {
+        return b_;
+    }
+
+    param_type param() const {
+        return param_type(a_, b_);
+    }
+
+    void param(const param_type& pt) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (pt.b_ <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "cauchy", "b <= 0");
+        }
+#endif
+        a_ = pt.a_;
+        b_ = pt.b_;
+    }
+
+protected:
+    template <typename EngineType>
+    auto generate(EngineType& engine) ->
+        typename std::conditional<EngineType::vec_size == 1, RealType,
+                                  sycl::vec<RealType, EngineType::vec_size>>::type {
+        if constexpr (EngineType::vec_size == 1) {
+            return generate_single(engine);
+        }
+        else {
+            sycl::vec<std::uint32_t, EngineType::vec_size> w = words::generate(engine);
+            sycl::vec<std::uint32_t, EngineType::vec_size> hi = w;
+            if constexpr (std::is_same<RealType, double>::value) {
+                hi = words::generate(engine);
+            }
+            sycl::vec<RealType, EngineType::vec_size> res;
+            for (int i = 0; i < EngineType::vec_size; ++i) {
+                res[i] = tanpi_wrapper(centered<EngineType>(w[i], hi[i]));
+            }
+            return res * b_ + a_;
+        }
+    }
+
+    template <typename EngineType>
+    RealType generate_single(EngineType& engine) {
+        std::uint32_t w = words::generate_single(engine);
+        std::uint32_t hi = words::high_word<RealType>(engine);
+        return sycl::fma(tanpi_wrapper(centered<EngineType>(w, hi)), b_, a_);
+    }
+
+    // Uniform value in the open interval (-1/2, 1/2): the midpoints of a grid one bit coarser
+    // than the mantissa are exact and symmetric, so tanpi never reaches its poles at +-1/2
+    template <typename EngineType>
+    static RealType centered(std::uint32_t w, std::uint32_t hi) {
+        constexpr int bits = words::bits<EngineType>();
+        constexpr int digits = std::is_same<RealType, float>::value ? 23 : 52;
+        constexpr int used = std::is_same<RealType, float>::value ? bits - digits
+                                                                  : 2 * bits - digits;
+        constexpr RealType half_step =
+            RealType(1) / static_cast<RealType>(std::uint64_t{ 1 } << (digits + 1));
+        return words::to_unit<RealType, bits, used>(w, hi) + half_step - RealType(0.5);
+    }
+
+    RealType a_;
+    RealType b_;
+};
+
+} // namespace oneapi::mkl::rng::device::detail
+
+#endif // _MKL_RNG_DEVICE_CAUCHY_IMPL_HPP_
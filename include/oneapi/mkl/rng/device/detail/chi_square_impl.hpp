@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_RNG_DEVICE_CHI_SQUARE_IMPL_HPP_
+#define _MKL_RNG_DEVICE_CHI_SQUARE_IMPL_HPP_
+
+#include "gamma_impl.hpp"
+
+namespace oneapi::mkl::rng::device::detail {
+
+// chi_square(n) is gamma(n / 2) with scale 2
+template <typename RealType, typename Method>
+class distribution_base<oneapi::mkl::rng::device::chi_square<RealType, Method>> {
+public:
+    struct param_type {
+        param_type(std::int32_t n) : n_(n) {}
+        std::int32_t n_;
+    };
+
+    distribution_base(std::int32_t n) : n_(n), gamma_(RealType(1), RealType(0), RealType(2)) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (n < 1) {
+            throw oneapi::mkl::invalid_argument("rng", "chi_square", "n < 1");
+        }
+#endif
+        gamma_.param({ static_cast<RealType>(n) / RealType(2), RealType(0), RealType(2) });
+    }
+
+    std::int32_t n() const {
+        return n_;
+    }
+
+    param_type param() const {
+        return param_type(n_);
+    }
+
+    void param(const param_type& pt) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (pt.n_ < 1) {
+            throw oneapi::mkl::invalid_argument("rng", "chi_square", "n < 1");
+        }
+#endif
+        n_ = pt.n_;
+        gamma_.param({ static_cast<RealType>(n_) / RealType(2), RealType(0), RealType(2) });
+    }
+
+protected:
+    template <typename EngineType>
+    auto generate(EngineType& engine) ->
+        typename std::conditional<EngineType::vec_size == 1, RealType,
+                                  sycl::vec<RealType, EngineType::vec_size>>::type {
+        return gamma_.generate(engine);
+    }
+
+    template <typename EngineType>
+    RealType generate_single(EngineType& engine) {
+        return gamma_.generate_single(engine);
+    }
+
+    std::int32_t n_;
+    distribution_base<oneapi::mkl::rng::device::gamma<RealType, gamma_method::marsaglia>> gamma_;
+};
+
+} // namespace oneapi::mkl::rng::device::detail
+
+#endif // _MKL_RNG_DEVICE_CHI_SQUARE_IMPL_HPP_
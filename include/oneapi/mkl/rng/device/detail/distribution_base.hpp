@@ -59,6 +59,27 @@ class poisson;
 template <typename IntType = std::uint32_t, typename Method = bernoulli_method::by_default>
 class bernoulli;
 
+template <typename RealType = float, typename Method = gamma_method::by_default>
+class gamma;
+
+template <typename RealType = float, typename Method = beta_method::by_default>
+class beta;
+
+template <typename RealType = float, typename Method = chi_square_method::by_default>
+class chi_square;
+
+template <typename RealType = float, typename Method = cauchy_method::by_default>
+class cauchy;
+
+template <typename RealType = float, typename Method = weibull_method::by_default>
+class weibull;
+
+template <typename IntType = std::int32_t, typename Method = multinomial_method::by_default>
+class multinomial;
+
+template <typename RealType = float, typename Method = gaussian_mv_method::by_default>
+class gaussian_mv;
+
 } // namespace oneapi::mkl::rng::device
 
 #include "oneapi/mkl/rng/device/detail/uniform_impl.hpp"
@@ -69,5 +90,12 @@ class bernoulli;
 #include "oneapi/mkl/rng/device/detail/exponential_impl.hpp"
 #include "oneapi/mkl/rng/device/detail/poisson_impl.hpp"
 #include "oneapi/mkl/rng/device/detail/bernoulli_impl.hpp"
+#include "oneapi/mkl/rng/device/detail/gamma_impl.hpp"
+#include "oneapi/mkl/rng/device/detail/beta_impl.hpp"
+#include "oneapi/mkl/rng/device/detail/chi_square_impl.hpp"
+#include "oneapi/mkl/rng/device/detail/cauchy_impl.hpp"
+#include "oneapi/mkl/rng/device/detail/weibull_impl.hpp"
+#include "oneapi/mkl/rng/device/detail/multinomial_impl.hpp"
+#include "oneapi/mkl/rng/device/detail/gaussian_mv_impl.hpp"
 
 #endif // _MKL_RNG_DISTRIBUTION_BASE_HPP_
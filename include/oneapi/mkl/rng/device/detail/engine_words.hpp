@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_RNG_DEVICE_ENGINE_WORDS_HPP_
+#define _MKL_RNG_DEVICE_ENGINE_WORDS_HPP_
+
+#include "engine_base.hpp"
+
+namespace oneapi::mkl::rng::device::detail {
+
+struct engine_words {};
+
+// Raw 32-bit words of an engine for the methods that work on random bits directly (ziggurat,
+// Marsaglia-Tsang gamma). Being a distribution_base specialization, it is a friend of all engines.
+template <>
+class distribution_base<engine_words> {
+public:
+    // Number of random bits in one word: mcg31m1 produces values below 2^31
+    template <typename EngineType>
+    static constexpr int bits() {
+        return std::is_same<EngineType, mcg31m1<EngineType::vec_size>>::value ? 31 : 32;
+    }
+
+    // mcg59 returns the low 32 bits of its state from generate(), use the high ones instead
+    template <typename EngineType>
+    static auto generate(EngineType& engine) ->
+        typename std::conditional<EngineType::vec_size == 1, std::uint32_t,
+                                  sycl::vec<std::uint32_t, EngineType::vec_size>>::type {
+        if constexpr (std::is_same<EngineType, mcg59<EngineType::vec_size>>::value) {
+            return engine.template generate_uniform_bits<std::uint32_t>();
+        }
+        else {
+            return engine.generate();
+        }
+    }
+
+    template <typename EngineType>
+    static std::uint32_t generate_single(EngineType& engine) {
+        if constexpr (std::is_same<EngineType, mcg59<EngineType::vec_size>>::value) {
+            return engine.template generate_single_uniform_bits<std::uint32_t>();
+        }
+        else {
+            return engine.generate_single();
+        }
+    }
+    // Uniform [0, 1) value from the bits of w above the lowest Used ones. Double precision
+    // completes the mantissa with the word hi, which single precision ignores. Only as many bits
+    // as the mantissa holds are kept so that the value never rounds up to 1.
+    template <typename RealType, int Bits, int Used>
+    static RealType to_unit(std::uint32_t w, std::uint32_t hi) {
+        if constexpr (std::is_same<RealType, float>::value) {
+            constexpr int n = Bits - Used;
+            constexpr int drop = n > 24 ? n - 24 : 0;
+            constexpr float scale = 1.0f / static_cast<float>(std::uint64_t{ 1 } << (n - drop));
+            return static_cast<float>(w >> (Used + drop)) * scale;
+        }
+        else {
+            constexpr int n = 2 * Bits - Used;
+            constexpr int drop = n > 53 ? n - 53 : 0;
+            constexpr double scale = 1.0 / static_cast<double>(std::uint64_t{ 1 } << (n - drop));
+            std::uint64_t v = (static_cast<std::uint64_t>(hi) << (Bits - Used)) | (w >> Used);
+            return static_cast<double>(v >> drop) * scale;
+        }
+    }
+
+    // Word completing the mantissa in double precision
+    template <typename RealType, typename EngineType>
+    static std::uint32_t high_word(EngineType& engine) {
+        if constexpr (std::is_same<RealType, double>::value) {
+            return generate_single(engine);
+        }
+        else {
+            return 0u;
+        }
+    }
+
+    template <typename RealType, typename EngineType>
+    static RealType uniform(EngineType& engine) {
+        std::uint32_t w = generate_single(engine);
+        return to_unit<RealType, bits<EngineType>(), 0>(w, high_word<RealType>(engine));
+    }
+
+    template <typename RealType, typename EngineType>
+    static sycl::vec<RealType, EngineType::vec_size> uniform_vec(EngineType& engine) {
+        sycl::vec<std::uint32_t, EngineType::vec_size> w = generate(engine);
+        sycl::vec<std::uint32_t, EngineType::vec_size> hi = w;
+        if constexpr (std::is_same<RealType, double>::value) {
+            hi = generate(engine);
+        }
+        sycl::vec<RealType, EngineType::vec_size> res;
+        for (int j = 0; j < EngineType::vec_size; ++j) {
+            res[j] = to_unit<RealType, bits<EngineType>(), 0>(w[j], hi[j]);
+        }
+        return res;
+    }
+};
+
+using words = distribution_base<engine_words>;
+
+} // namespace oneapi::mkl::rng::device::detail
+
+#endif // _MKL_RNG_DEVICE_ENGINE_WORDS_HPP_
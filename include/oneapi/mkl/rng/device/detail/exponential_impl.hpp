@@ -21,6 +21,7 @@
 #define _MKL_RNG_DEVICE_EXPONENTIAL_IMPL_HPP_
 
 #include "vm_wrappers.hpp"
+#include "ziggurat_impl.hpp"
 
 namespace oneapi::mkl::rng::device::detail {
 
@@ -107,6 +108,68 @@ protected:
         oneapi::mkl::rng::device::poisson<std::uint32_t, poisson_method::devroye>>;
 };
 
+template <typename RealType>
+class distribution_base<
+    oneapi::mkl::rng::device::exponential<RealType, exponential_method::ziggurat>> {
+public:
+    struct param_type {
+        param_type(RealType a, RealType beta) : a_(a), beta_(beta) {}
+        RealType a_;
+        RealType beta_;
+    };
+
+    distribution_base(RealType a, RealType beta) : a_(a), beta_(beta) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (beta <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "exponential", "beta <= 0");
+        }
+#endif
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType beta() const {
+        return beta_;
+    }
+
+    param_type param() const {
+        return param_type(a_, beta_);
+    }
+
+    void param(const param_type& pt) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (pt.beta_ <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "exponential", "beta <= 0");
+        }
+#endif
+        a_ = pt.a_;
+        beta_ = pt.beta_;
+    }
+
+protected:
+    template <typename EngineType>
+    auto generate(EngineType& engine) ->
+        typename std::conditional<EngineType::vec_size == 1, RealType,
+                                  sycl::vec<RealType, EngineType::vec_size>>::type {
+        if constexpr (EngineType::vec_size == 1) {
+            return generate_single(engine);
+        }
+        else {
+            return ziggurat_impl::exponential_vec<RealType>(engine) * beta_ + a_;
+        }
+    }
+
+    template <typename EngineType>
+    RealType generate_single(EngineType& engine) {
+        return sycl::fma(ziggurat_impl::exponential<RealType>(engine), beta_, a_);
+    }
+
+    RealType a_;
+    RealType beta_;
+};
+
 } // namespace oneapi::mkl::rng::device::detail
 
 #endif // _MKL_RNG_DEVICE_EXPONENTIAL_IMPL_HPP_
@@ -0,0 +1,241 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_RNG_DEVICE_GAMMA_IMPL_HPP_
+#define _MKL_RNG_DEVICE_GAMMA_IMPL_HPP_
+
+#include "vm_wrappers.hpp"
+#include "ziggurat_impl.hpp"
+
+namespace oneapi::mkl::rng::device::detail {
+namespace gamma_impl {
+
+// Marsaglia and Tsang: for shape alpha >= 1, d * (1 + c * z)^3 with z standard normal,
+// d = alpha - 1/3 and c = 1 / sqrt(9 * d) is accepted as a gamma value with the probability
+// exp(z^2 / 2 + d - d * v + d * ln(v)), v = (1 + c * z)^3. The squeeze u < 1 - 0.0331 * z^4 takes
+// most of the decisions without logarithms. A shape below one is generated as
+// gamma(alpha + 1) * u^(1 / alpha).
+template <typename RealType>
+struct params {
+    explicit params(RealType alpha) : boost(alpha < RealType(1)) {
+        d = (boost ? alpha + RealType(1) : alpha) - RealType(1) / RealType(3);
+        c = RealType(1) / sqrt_wrapper(RealType(9) * d);
+        inv_alpha = RealType(1) / alpha;
+    }
+
+    RealType d;
+    RealType c;
+    RealType inv_alpha;
+    bool boost;
+};
+
+template <typename RealType>
+inline bool squeeze(RealType z, RealType u) {
+    RealType z2 = z * z;
+    return u < RealType(1) - RealType(0.0331) * z2 * z2;
+}
+
+template <typename RealType>
+inline bool log_test(const params<RealType>& p, RealType z, RealType v, RealType u) {
+    return ln_wrapper(u) < RealType(0.5) * z * z + p.d * (RealType(1) - v + ln_wrapper(v));
+}
+
+// Standard gamma value of shape d + 1/3 >= 1
+template <typename RealType, typename EngineType>
+inline RealType marsaglia(const params<RealType>& p, EngineType& engine) {
+    for (;;) {
+        RealType z = ziggurat_impl::gaussian<RealType>(engine);
+        RealType v = RealType(1) + p.c * z;
+        if (v <= RealType(0)) {
+            continue;
+        }
+        v = v * v * v;
+        RealType u = words::uniform<RealType>(engine);
+        if (squeeze(z, u) || log_test(p, z, v, u)) {
+            return p.d * v;
+        }
+    }
+}
+
+// Vector of standard gamma values of shape d + 1/3 >= 1. As for the ziggurat, all lanes run the
+// squeeze and the lanes it did not accept finish their own test afterwards.
+template <typename RealType, typename EngineType>
+inline sycl::vec<RealType, EngineType::vec_size> marsaglia_vec(const params<RealType>& p,
+                                                                EngineType& engine) {
+    sycl::vec<RealType, EngineType::vec_size> z = ziggurat_impl::gaussian_vec<RealType>(engine);
+    sycl::vec<RealType, EngineType::vec_size> u = words::uniform_vec<RealType>(engine);
+    sycl::vec<RealType, EngineType::vec_size> res;
+    std::uint32_t missed = 0;
+    for (int j = 0; j < EngineType::vec_size; ++j) {
+        RealType v = RealType(1) + p.c * z[j];
+        bool positive = v > RealType(0);
+        v = v * v * v;
+        res[j] = p.d * v;
+        missed |= static_cast<std::uint32_t>(!(positive && squeeze(z[j], u[j]))) << j;
+    }
+    if (missed) {
+        for (int j = 0; j < EngineType::vec_size; ++j) {
+            if ((missed >> j) & 1u) {
+                RealType v = RealType(1) + p.c * z[j];
+                if (!(v > RealType(0) && log_test(p, z[j], v * v * v, u[j]))) {
+                    res[j] = marsaglia(p, engine);
+                }
+            }
+        }
+    }
+    return res;
+}
+
+// Standard gamma value of shape alpha
+template <typename RealType, typename EngineType>
+inline RealType standard(const params<RealType>& p, EngineType& engine) {
+    RealType res = marsaglia(p, engine);
+    if (p.boost) {
+        res *= exp_wrapper(ln_wrapper(words::uniform<RealType>(engine)) * p.inv_alpha);
+    }
+    return res;
+}
+
+template <typename RealType, typename EngineType>
+inline sycl::vec<RealType, EngineType::vec_size> standard_vec(const params<RealType>& p,
+                                                               EngineType& engine) {
+    sycl::vec<RealType, EngineType::vec_size> res = marsaglia_vec(p, engine);
+    if (p.boost) {
+        sycl::vec<RealType, EngineType::vec_size> u = words::uniform_vec<RealType>(engine);
+        for (int j = 0; j < EngineType::vec_size; ++j) {
+            res[j] *= exp_wrapper(ln_wrapper(u[j]) * p.inv_alpha);
+        }
+    }
+    return res;
+}
+
+// Logarithm of a standard gamma value of shape alpha, which does not underflow for small shapes
+template <typename RealType, typename EngineType>
+inline RealType log_standard(const params<RealType>& p, EngineType& engine) {
+    RealType res = ln_wrapper(marsaglia(p, engine));
+    if (p.boost) {
+        res += ln_wrapper(words::uniform<RealType>(engine)) * p.inv_alpha;
+    }
+    return res;
+}
+
+template <typename RealType, typename EngineType>
+inline sycl::vec<RealType, EngineType::vec_size> log_standard_vec(const params<RealType>& p,
+                                                                   EngineType& engine) {
+    sycl::vec<RealType, EngineType::vec_size> res = marsaglia_vec(p, engine);
+    for (int j = 0; j < EngineType::vec_size; ++j) {
+        res[j] = ln_wrapper(res[j]);
+    }
+    if (p.boost) {
+        sycl::vec<RealType, EngineType::vec_size> u = words::uniform_vec<RealType>(engine);
+        for (int j = 0; j < EngineType::vec_size; ++j) {
+            res[j] += ln_wrapper(u[j]) * p.inv_alpha;
+        }
+    }
+    return res;
+}
+
+} // namespace gamma_impl
+
+template <typename RealType, typename Method>
+class distribution_base<oneapi::mkl::rng::device::gamma<RealType, Method>> {
+public:
+    struct param_type {
+        param_type(RealType alpha, RealType a, RealType beta) : alpha_(alpha), a_(a), beta_(beta) {}
+        RealType alpha_;
+        RealType a_;
+        RealType beta_;
+    };
+
+    distribution_base(RealType alpha, RealType a, RealType beta)
+            : alpha_(alpha),
+              a_(a),
+              beta_(beta),
+              params_(alpha) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (alpha <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "gamma", "alpha <= 0");
+        }
+        if (beta <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "gamma", "beta <= 0");
+        }
+#endif
+    }
+
+    RealType alpha() const {
+        return alpha_;
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType beta() const {
+        return beta_;
+    }
+
+    param_type param() const {
+        return param_type(alpha_, a_, beta_);
+    }
+
+    void param(const param_type& pt) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (pt.alpha_ <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "gamma", "alpha <= 0");
+        }
+        if (pt.beta_ <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "gamma", "beta <= 0");
+        }
+#endif
+        alpha_ = pt.alpha_;
+        a_ = pt.a_;
+        beta_ = pt.beta_;
+        params_ = gamma_impl::params<RealType>(alpha_);
+    }
+
+protected:
+    template <typename EngineType>
+    auto generate(EngineType& engine) ->
+        typename std::conditional<EngineType::vec_size == 1, RealType,
+                                  sycl::vec<RealType, EngineType::vec_size>>::type {
+        if constexpr (EngineType::vec_size == 1) {
+            return generate_single(engine);
+        }
+        else {
+            return gamma_impl::standard_vec(params_, engine) * beta_ + a_;
+        }
+    }
+
+    template <typename EngineType>
+    RealType generate_single(EngineType& engine) {
+        return sycl::fma(gamma_impl::standard(params_, engine), beta_, a_);
+    }
+
+    RealType alpha_;
+    RealType a_;
+    RealType beta_;
+    gamma_impl::params<RealType> params_;
+
+    friend class distribution_base<
+        oneapi::mkl::rng::device::chi_square<RealType, chi_square_method::gamma_based>>;
+};
+
+} // namespace oneapi::mkl::rng::device::detail
+
+#endif // _MKL_RNG_DEVICE_GAMMA_IMPL_HPP_
@@ -21,6 +21,7 @@
 #define _MKL_RNG_DEVICE_GAUSSIAN_IMPL_HPP_
 
 #include "vm_wrappers.hpp"
+#include "ziggurat_impl.hpp"
 
 namespace oneapi::mkl::rng::device::detail {
 
@@ -192,6 +193,67 @@ protected:
         oneapi::mkl::rng::device::poisson<std::uint32_t, poisson_method::devroye>>;
 };
 
+template <typename RealType>
+class distribution_base<oneapi::mkl::rng::device::gaussian<RealType, gaussian_method::ziggurat>> {
+public:
+    struct param_type {
+        param_type(RealType mean, RealType stddev) : mean_(mean), stddev_(stddev) {}
+        RealType mean_;
+        RealType stddev_;
+    };
+
+    distribution_base(RealType mean, RealType stddev) : mean_(mean), stddev_(stddev) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (stddev <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "gaussian", "stddev <= 0");
+        }
+#endif
+    }
+
+    RealType mean() const {
+        return mean_;
+    }
+
+    RealType stddev() const {
+        return stddev_;
+    }
+
+    param_type param() const {
+        return param_type(mean_, stddev_);
+    }
+
+    void param(const param_type& pt) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (pt.stddev_ <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "gaussian", "stddev <= 0");
+        }
+#endif
+        mean_ = pt.mean_;
+        stddev_ = pt.stddev_;
+    }
+
+protected:
+    template <typename EngineType>
+    auto generate(EngineType& engine) ->
+        typename std::conditional<EngineType::vec_size == 1, RealType,
+                                  sycl::vec<RealType, EngineType::vec_size>>::type {
+        if constexpr (EngineType::vec_size == 1) {
+            return generate_single(engine);
+        }
+        else {
+            return ziggurat_impl::gaussian_vec<RealType>(engine) * stddev_ + mean_;
+        }
+    }
+
+    template <typename EngineType>
+    RealType generate_single(EngineType& engine) {
+        return sycl::fma(ziggurat_impl::gaussian<RealType>(engine), stddev_, mean_);
+    }
+
+    RealType mean_;
+    RealType stddev_;
+};
+
 #if MKL_RNG_USE_BINARY_CODE
 
 template <typename RealType>
@@ -0,0 +1,144 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_RNG_DEVICE_GAUSSIAN_MV_IMPL_HPP_
+#define _MKL_RNG_DEVICE_GAUSSIAN_MV_IMPL_HPP_
+
+#include "vm_wrappers.hpp"
+#include "ziggurat_impl.hpp"
+
+namespace oneapi::mkl::rng::device::detail {
+
+template <typename RealType, typename Method>
+class distribution_base<oneapi::mkl::rng::device::gaussian_mv<RealType, Method>> {
+public:
+    struct param_type {
+        param_type(std::uint32_t dimen, sycl::span<const RealType> mean,
+                   sycl::span<const RealType> matrix)
+                : dimen_(dimen),
+                  mean_(mean),
+                  matrix_(matrix) {}
+        std::uint32_t dimen_;
+        sycl::span<const RealType> mean_;
+        sycl::span<const RealType> matrix_;
+    };
+
+    distribution_base(std::uint32_t dimen, sycl::span<const RealType> mean,
+                      sycl::span<const RealType> matrix)
+            : dimen_(dimen),
+              mean_(mean),
+              matrix_(matrix) {
+#ifndef __SYCL_DEVICE_ONLY__
+        check(dimen, mean, matrix);
+#endif
+    }
+
+    std::uint32_t dimen() const {
+        return dimen_;
+    }
+
+    sycl::span<const RealType> mean() const {
+        return mean_;
+    }
+
+    sycl::span<const RealType> matrix() const {
+        return matrix_;
+    }
+
+    param_type param() const {
+        return param_type(dimen_, mean_, matrix_);
+    }
+
+    void param(const param_type& pt) {
+#ifndef __SYCL_DEVICE_ONLY__
+        check(pt.dimen_, pt.mean_, pt.matrix_);
+#endif
+        dimen_ = pt.dimen_;
+        mean_ = pt.mean_;
+        matrix_ = pt.matrix_;
+    }
+
+protected:
+    // res = mean + T * z for a vector z of standard normal values. As the factor is packed by
+    // columns, column j of T is a contiguous run of the packed array: every z[j] is added to the
+    // result as soon as it is generated and never leaves registers.
+    template <typename EngineType>
+    void generate(EngineType& engine, sycl::span<RealType> res) {
+        for (std::uint32_t i = 0; i < dimen_; ++i) {
+            res[i] = mean_[i];
+        }
+        std::size_t k = 0;
+        if constexpr (std::is_same<Method, gaussian_mv_method::box_muller2>::value) {
+            // A pair of uniform values gives two columns, odd dimensions drop the last cosine
+            for (std::uint32_t j = 0; j < dimen_; j += 2) {
+                RealType u1 = engine.generate_single(RealType(0), RealType(1));
+                RealType u2 = engine.generate_single(RealType(0), RealType(1));
+                RealType r = sqrt_wrapper(RealType(-2) * ln_wrapper(u1));
+                RealType cos;
+                RealType sin = sincospi_wrapper(RealType(2) * u2, cos);
+                add_column(j, r * sin, k, res);
+                if (j + 1 < dimen_) {
+                    add_column(j + 1, r * cos, k, res);
+                }
+            }
+        }
+        else if constexpr (EngineType::vec_size == 1) {
+            for (std::uint32_t j = 0; j < dimen_; ++j) {
+                add_column(j, ziggurat_impl::gaussian<RealType>(engine), k, res);
+            }
+        }
+        else {
+            for (std::uint32_t j = 0; j < dimen_;) {
+                auto z = ziggurat_impl::gaussian_vec<RealType>(engine);
+                for (int l = 0; l < EngineType::vec_size && j < dimen_; ++l, ++j) {
+                    add_column(j, z[l], k, res);
+                }
+            }
+        }
+    }
+
+    // Adds z times column j of T, which starts at matrix_[k], and moves k past the column
+    void add_column(std::uint32_t j, RealType z, std::size_t& k, sycl::span<RealType> res) const {
+        for (std::uint32_t i = j; i < dimen_; ++i) {
+            res[i] = sycl::fma(matrix_[k++], z, res[i]);
+        }
+    }
+
+    static void check(std::uint32_t dimen, sycl::span<const RealType> mean,
+                      sycl::span<const RealType> matrix) {
+        if (dimen == 0) {
+            throw oneapi::mkl::invalid_argument("rng", "gaussian_mv", "dimen == 0");
+        }
+        if (mean.size() != dimen) {
+            throw oneapi::mkl::invalid_argument("rng", "gaussian_mv", "mean.size() != dimen");
+        }
+        if (matrix.size() != std::size_t{ dimen } * (dimen + 1) / 2) {
+            throw oneapi::mkl::invalid_argument("rng", "gaussian_mv",
+                                                "matrix.size() != dimen * (dimen + 1) / 2");
+        }
+    }
+
+    std::uint32_t dimen_;
+    sycl::span<const RealType> mean_;
+    sycl::span<const RealType> matrix_;
+};
+
+} // namespace oneapi::mkl::rng::device::detail
+
+#endif // _MKL_RNG_DEVICE_GAUSSIAN_MV_IMPL_HPP_
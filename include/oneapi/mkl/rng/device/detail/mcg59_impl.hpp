@@ -162,6 +162,9 @@ protected:
         mcg59_impl::init(this->state_, n, seed, offset);
     }
 
+    engine_base(const engine_state<oneapi::mkl::rng::device::mcg59<VecSize>>& state)
+            : state_(state) {}
+
     template <typename RealType>
     auto generate(RealType a, RealType b) ->
         typename std::conditional<VecSize == 1, RealType, sycl::vec<RealType, VecSize>>::type {
@@ -25,7 +25,11 @@
 #ifndef _MKL_RNG_DEVICE_MRG32K3A_IMPL_HPP_
 #define _MKL_RNG_DEVICE_MRG32K3A_IMPL_HPP_
 
+#ifdef ONEMKL_RNG_DEVICE_MRG32K3A_POW2_SKIP_AHEAD
+#include "oneapi/mkl/rng/device/detail/mrg32k3a_skip_ahead_pow2.hpp"
+#else
 #include "oneapi/mkl/rng/device/detail/mrg32k3a_skip_ahead_matrix.hpp"
+#endif
 
 namespace oneapi::mkl::rng::device {
 
@@ -52,6 +56,14 @@ struct mrg32k3a_params {
     static constexpr std::uint32_t a23n = 1370589;
 };
 
+#ifdef ONEMKL_RNG_DEVICE_MRG32K3A_POW2_SKIP_AHEAD
+// Powers of two of the transition matrices of both components
+static constexpr pow2_matrices<mrg32k3a_params::m1> skip_ahead_pow2_matrix_m1(
+    { { 0, 1, 0 }, { 0, 0, 1 }, { mrg32k3a_params::a13, mrg32k3a_params::a12, 0 } });
+static constexpr pow2_matrices<mrg32k3a_params::m2> skip_ahead_pow2_matrix_m2(
+    { { 0, 1, 0 }, { 0, 0, 1 }, { mrg32k3a_params::a23, 0, mrg32k3a_params::a21 } });
+#endif
+
 template <std::uint32_t M>
 struct two_pow_32_minus_m {};
 
@@ -77,6 +89,7 @@ static inline void bit_shift_and_mask(T& in) {
     in = ((in >> 32) * two_pow_32_minus_m<M>::val + (in & mask));
 }
 
+#ifndef ONEMKL_RNG_DEVICE_MRG32K3A_POW2_SKIP_AHEAD
 template <std::uint32_t M>
 static inline void matr3x3_vec_mul_mod(std::uint32_t a[3][3], std::uint32_t x[3],
                                        std::uint32_t y[3]) {
@@ -174,6 +187,7 @@ static inline void vec3_pow_mod(
     }
     matr3x3_vec_mul_mod<M>(B, x, x);
 }
+#endif
 
 template <std::int32_t VecSize>
 static inline void skip_ahead(engine_state<oneapi::mkl::rng::device::mrg32k3a<VecSize>>& state,
@@ -185,8 +199,13 @@ static inline void skip_ahead(engine_state<oneapi::mkl::rng::device::mrg32k3a<Ve
                                             "period is 2 ^ 191, skip on more than 2^192");
 #endif
     }
+#ifdef ONEMKL_RNG_DEVICE_MRG32K3A_POW2_SKIP_AHEAD
+    vec3_pow2_mod(state.s, n, num_to_skip_ptr, skip_ahead_pow2_matrix_m1);
+    vec3_pow2_mod(state.s + 3, n, num_to_skip_ptr, skip_ahead_pow2_matrix_m2);
+#else
     vec3_pow_mod<mrg32k3a_params::m1>(state.s, n, num_to_skip_ptr, skip_ahead_matrix[0]);
     vec3_pow_mod<mrg32k3a_params::m2>(state.s + 3, n, num_to_skip_ptr, skip_ahead_matrix[1]);
+#endif
 }
 
 template <std::int32_t VecSize>
@@ -326,6 +345,9 @@ protected:
         mrg32k3a_impl::init(this->state_, n, seed, n_offset, offset_ptr);
     }
 
+    engine_base(const engine_state<oneapi::mkl::rng::device::mrg32k3a<VecSize>>& state)
+            : state_(state) {}
+
     template <typename RealType>
     auto generate(RealType a, RealType b) ->
         typename std::conditional<VecSize == 1, RealType, sycl::vec<RealType, VecSize>>::type {
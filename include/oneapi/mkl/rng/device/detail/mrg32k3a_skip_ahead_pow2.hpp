@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Compact skip-ahead for mrg32k3a, used instead of mrg32k3a_skip_ahead_matrix.hpp when
+// ONEMKL_RNG_DEVICE_MRG32K3A_POW2_SKIP_AHEAD is defined. The transition matrices A^(2^k) of
+// both components are computed by repeated squaring at compile time and kept in Montgomery
+// form, and a skip applies the matrices of the set bits of num_to_skip to the state vector.
+
+#ifndef _MKL_RNG_DEVICE_MRG32K3A_SKIP_AHEAD_POW2_HPP_
+#define _MKL_RNG_DEVICE_MRG32K3A_SKIP_AHEAD_POW2_HPP_
+
+namespace oneapi::mkl::rng::device::detail {
+namespace mrg32k3a_impl {
+
+// number of 3x3 matrices A^(2^k) per component: the skip is up to 2^192
+constexpr std::size_t quantity_of_pow2_matrices = 192;
+
+// Montgomery arithmetic modulo an odd M < 2^32 with R = 2^32
+template <std::uint32_t M>
+struct montgomery {
+    // M^-1 mod 2^32 by Newton iterations, each doubles the number of correct bits
+    static constexpr std::uint32_t inverse() {
+        std::uint32_t inv = M;
+        for (int i = 0; i < 4; ++i) {
+            inv *= 2u - M * inv;
+        }
+        return inv;
+    }
+
+    static constexpr std::uint32_t m_inv = inverse();
+    static constexpr std::uint32_t r2 =
+        static_cast<std::uint32_t>(((0x100000000ull % M) * (0x100000000ull % M)) % M);
+
+    // a * b * R^-1 mod M for a, b < M: t - m * M is divisible by R, so only the high words are
+    // subtracted and no 64-bit sum can overflow
+    static constexpr std::uint32_t mul(std::uint32_t a, std::uint32_t b) {
+        std::uint64_t t = static_cast<std::uint64_t>(a) * b;
+        std::uint32_t m = static_cast<std::uint32_t>(t) * m_inv;
+        std::uint32_t t_hi = static_cast<std::uint32_t>(t >> 32);
+        std::uint32_t mm_hi =
+            static_cast<std::uint32_t>((static_cast<std::uint64_t>(m) * M) >> 32);
+        return (t_hi >= mm_hi) ? t_hi - mm_hi : M - mm_hi + t_hi;
+    }
+
+    static constexpr std::uint32_t add(std::uint32_t a, std::uint32_t b) {
+        return (a >= M - b) ? a - (M - b) : a + b;
+    }
+};
+
+template <std::uint32_t M>
+struct pow2_matrices {
+    using mont = montgomery<M>;
+
+    // a is the one-step transition matrix of the component
+    constexpr pow2_matrices(const std::uint32_t (&a)[3][3]) {
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                m[0][i][j] = mont::mul(a[i][j], mont::r2);
+            }
+        }
+        for (std::size_t p = 1; p < quantity_of_pow2_matrices; ++p) {
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    std::uint32_t sum = 0;
+                    for (int k = 0; k < 3; ++k) {
+                        sum = mont::add(sum, mont::mul(m[p - 1][i][k], m[p - 1][k][j]));
+                    }
+                    m[p][i][j] = sum;
+                }
+            }
+        }
+    }
+
+    std::uint32_t m[quantity_of_pow2_matrices][3][3] = {};
+};
+
+// x = A^(skip_params[0] + skip_params[1] * 2^64 + skip_params[2] * 2^128) * x, the matrices
+// of the powers of A commute so they are applied to x one by one
+template <std::uint32_t M>
+static inline void vec3_pow2_mod(std::uint32_t x[3], std::uint64_t n,
+                                 const std::uint64_t* skip_params,
+                                 const pow2_matrices<M>& matrices) {
+    using mont = montgomery<M>;
+    for (std::uint64_t j = 0; j < n; j++) {
+        std::uint64_t skip_param = skip_params[j];
+        for (std::uint32_t b = 0; skip_param; ++b, skip_param >>= 1) {
+            if (skip_param & 1ull) {
+                const std::uint32_t(&a)[3][3] = matrices.m[64 * j + b];
+                std::uint32_t y[3];
+                for (int i = 0; i < 3; ++i) {
+                    // Montgomery form of a times plain x gives a plain product
+                    y[i] = mont::add(mont::add(mont::mul(a[i][0], x[0]), mont::mul(a[i][1], x[1])),
+                                     mont::mul(a[i][2], x[2]));
+                }
+                x[0] = y[0];
+                x[1] = y[1];
+                x[2] = y[2];
+            }
+        }
+    }
+}
+
+} // namespace mrg32k3a_impl
+} // namespace oneapi::mkl::rng::device::detail
+
+#endif // _MKL_RNG_DEVICE_MRG32K3A_SKIP_AHEAD_POW2_HPP_
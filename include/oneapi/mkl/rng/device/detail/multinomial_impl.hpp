@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_RNG_DEVICE_MULTINOMIAL_IMPL_HPP_
+#define _MKL_RNG_DEVICE_MULTINOMIAL_IMPL_HPP_
+
+#include "engine_words.hpp"
+#include "vm_wrappers.hpp"
+
+namespace oneapi::mkl::rng::device::detail {
+namespace multinomial_impl {
+
+// Binomial value of n trials with success probability p by inversion of the distribution
+// function, walking up from zero with the ratio of consecutive probabilities. The trials are
+// taken in chunks small enough for the probability of no success, (1 - p)^m, not to underflow.
+template <typename EngineType>
+inline std::int32_t binomial(std::int32_t n, double p, EngineType& engine) {
+    if (p >= 1.0) {
+        return n;
+    }
+    if (p <= 0.0) {
+        return 0;
+    }
+    bool flip = p > 0.5;
+    if (flip) {
+        p = 1.0 - p;
+    }
+    double ratio = p / (1.0 - p);
+    double ln_q = ln_wrapper(1.0 - p);
+    // ln(1e-300) = -690.8
+    std::int32_t chunk = static_cast<std::int32_t>(sycl::fmin(-690.0 / ln_q, 2147483647.0));
+    std::int32_t res = 0;
+    for (std::int32_t done = 0; done < n;) {
+        std::int32_t m = sycl::min(chunk, n - done);
+        double f = exp_wrapper(m * ln_q);
+        double u = words::uniform<double>(engine);
+        std::int32_t k = 0;
+        while (u >= f && k < m) {
+            u -= f;
+            f *= ratio * (m - k) / (k + 1);
+            ++k;
+        }
+        res += k;
+        done += m;
+    }
+    return flip ? n - res : res;
+}
+
+} // namespace multinomial_impl
+
+template <typename IntType, typename Method>
+class distribution_base<oneapi::mkl::rng::device::multinomial<IntType, Method>> {
+public:
+    struct param_type {
+        param_type(std::int32_t ntrial, sycl::span<const double> p) : ntrial_(ntrial), p_(p) {}
+        std::int32_t ntrial_;
+        sycl::span<const double> p_;
+    };
+
+    distribution_base(std::int32_t ntrial, sycl::span<const double> p) : ntrial_(ntrial), p_(p) {
+#ifndef __SYCL_DEVICE_ONLY__
+        check(ntrial, p);
+#endif
+    }
+
+    std::int32_t ntrial() const {
+        return ntrial_;
+    }
+
+    sycl::span<const double> p() const {
+        return p_;
+    }
+
+    param_type param() const {
+        return param_type(ntrial_, p_);
+    }
+
+    void param(const param_type& pt) {
+#ifndef __SYCL_DEVICE_ONLY__
+        check(pt.ntrial_, pt.p_);
+#endif
+        ntrial_ = pt.ntrial_;
+        p_ = pt.p_;
+    }
+
+protected:
+    // Conditional binomial method: the count of each category is a binomial value over the trials
+    // left, with the probability of the category relative to the categories left. The last one
+    // takes the remaining trials.
+    template <typename EngineType>
+    void generate(EngineType& engine, sycl::span<IntType> res) {
+        double left = 0.0;
+        for (std::size_t i = 0; i < p_.size(); ++i) {
+            left += p_[i];
+        }
+        std::int32_t trials = ntrial_;
+        for (std::size_t i = 0; i + 1 < p_.size(); ++i) {
+            std::int32_t count = 0;
+            if (trials > 0 && left > 0.0) {
+                count = multinomial_impl::binomial(trials, p_[i] / left, engine);
+            }
+            res[i] = static_cast<IntType>(count);
+            trials -= count;
+            left -= p_[i];
+        }
+        res[p_.size() - 1] = static_cast<IntType>(trials);
+    }
+
+    static void check(std::int32_t ntrial, sycl::span<const double> p) {
+        if (ntrial < 0) {
+            throw oneapi::mkl::invalid_argument("rng", "multinomial", "ntrial < 0");
+        }
+        if (p.empty()) {
+            throw oneapi::mkl::invalid_argument("rng", "multinomial", "p is empty");
+        }
+    }
+
+    std::int32_t ntrial_;
+    sycl::span<const double> p_;
+};
+
+} // namespace oneapi::mkl::rng::device::detail
+
+#endif // _MKL_RNG_DEVICE_MULTINOMIAL_IMPL_HPP_
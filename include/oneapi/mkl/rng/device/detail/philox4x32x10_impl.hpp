@@ -432,6 +432,9 @@ protected:
         philox4x32x10_impl::init(this->state_, n, seed, n_offset, offset_ptr);
     }
 
+    engine_base(const engine_state<oneapi::mkl::rng::device::philox4x32x10<VecSize>>& state)
+            : state_(state) {}
+
     template <typename RealType>
     __attribute__((always_inline)) inline auto generate(RealType a, RealType b) ->
         typename std::conditional<VecSize == 1, RealType, sycl::vec<RealType, VecSize>>::type {
@@ -39,12 +39,22 @@ static inline DataType cospi_wrapper(DataType a) {
     return sycl::cospi(a);
 }
 
+template <typename DataType>
+static inline DataType tanpi_wrapper(DataType a) {
+    return sycl::tanpi(a);
+}
+
 template <typename DataType>
 static inline DataType sincospi_wrapper(DataType a, DataType& b) {
     b = sycl::cospi(a);
     return sycl::sinpi(a);
 }
 
+template <typename DataType>
+static inline DataType exp_wrapper(DataType a) {
+    return sycl::exp(a);
+}
+
 template <typename DataType>
 static inline DataType ln_wrapper(DataType a) {
     if (a == DataType(0)) {
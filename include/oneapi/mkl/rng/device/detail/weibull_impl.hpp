@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_RNG_DEVICE_WEIBULL_IMPL_HPP_
+#define _MKL_RNG_DEVICE_WEIBULL_IMPL_HPP_
+
+#include "vm_wrappers.hpp"
+
+namespace oneapi::mkl::rng::device::detail {
+
+template <typename RealType, typename Method>
+class distribution_base<oneapi::mkl::rng::device::weibull<RealType, Method>> {
+public:
+    struct param_type {
+        param_type(RealType alpha, RealType a, RealType beta) : alpha_(alpha), a_(a), beta_(beta) {}
+        RealType alpha_;
+        RealType a_;
+        RealType beta_;
+    };
+
+    distribution_base(RealType alpha, RealType a, RealType beta)
+            : alpha_(alpha),
+              a_(a),
+              beta_(beta),
+              inv_alpha_(RealType(1) / alpha) {
+#ifndef __SYCL_DEVICE_ONLY__
+        check(alpha, beta);
+#endif
+    }
+
+    RealType alpha() const {
+        return alpha_;
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType beta() const {
+        return beta_;
+    }
+
+    param_type param() const {
+        return param_type(alpha_, a_, beta_);
+    }
+
+    void param(const param_type& pt) {
+#ifndef __SYCL_DEVICE_ONLY__
+        check(pt.alpha_, pt.beta_);
+#endif
+        alpha_ = pt.alpha_;
+        a_ = pt.a_;
+        beta_ = pt.beta_;
+        inv_alpha_ = RealType(1) / alpha_;
+    }
+
+protected:
+    // a + beta * (-ln(u))^(1 / alpha)
+    template <typename EngineType>
+    auto generate(EngineType& engine) ->
+        typename std::conditional<EngineType::vec_size == 1, RealType,
+                                  sycl::vec<RealType, EngineType::vec_size>>::type {
+        using OutType = typename std::conditional<EngineType::vec_size == 1, RealType,
+                                                  sycl::vec<RealType, EngineType::vec_size>>::type;
+
+        OutType res = engine.generate(RealType(0), RealType(1));
+        if constexpr (EngineType::vec_size == 1) {
+            res = exp_wrapper(ln_wrapper(-ln_wrapper(res)) * inv_alpha_);
+        }
+        else {
+            for (int i = 0; i < EngineType::vec_size; ++i) {
+                res[i] = exp_wrapper(ln_wrapper(-ln_wrapper(res[i])) * inv_alpha_);
+            }
+        }
+        return res * beta_ + a_;
+    }
+
+    template <typename EngineType>
+    RealType generate_single(EngineType& engine) {
+        RealType res = engine.generate_single(RealType(0), RealType(1));
+        res = exp_wrapper(ln_wrapper(-ln_wrapper(res)) * inv_alpha_);
+        return sycl::fma(res, beta_, a_);
+    }
+
+    static void check(RealType alpha, RealType beta) {
+        if (alpha <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "weibull", "alpha <= 0");
+        }
+        if (beta <= RealType(0)) {
+            throw oneapi::mkl::invalid_argument("rng", "weibull", "beta <= 0");
+        }
+    }
+
+    RealType alpha_;
+    RealType a_;
+    RealType beta_;
+    RealType inv_alpha_;
+};
+
+} // namespace oneapi::mkl::rng::device::detail
+
+#endif // _MKL_RNG_DEVICE_WEIBULL_IMPL_HPP_
@@ -0,0 +1,284 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKL_RNG_DEVICE_ZIGGURAT_IMPL_HPP_
+#define _MKL_RNG_DEVICE_ZIGGURAT_IMPL_HPP_
+
+#include "engine_words.hpp"
+#include "vm_wrappers.hpp"
+
+namespace oneapi::mkl::rng::device::detail {
+namespace ziggurat_impl {
+
+// Marsaglia and Tsang ziggurat: the area under the density is covered by layers of equal area.
+// Layer 0 is the base strip, a rectangle of width w[0] standing for [0, r] plus the tail beyond
+// r. Layer i > 0 is the rectangle [0, w[i]] x [f[i], f[i - 1]], with f[i] the density at w[i].
+// A point x = u * w[i] with u < k[i] = w[i - 1] / w[i] lies under the density whatever its
+// height, so it is accepted without evaluating the density; only the remaining 1.5% (normal) to
+// 2.2% (exponential) of the points need exp or log.
+constexpr std::uint32_t layers = 256;
+
+template <typename RealType>
+struct table {
+    RealType k[layers];
+    RealType w[layers];
+    RealType f[layers];
+};
+
+// Compile-time exp, log and sqrt used to build the tables in double precision
+
+constexpr double ln2 = 0x1.62E42FEFA39EFP-1;
+
+constexpr double exp_ce(double x) {
+    // x = n * ln(2) + y, |y| <= ln(2) / 2
+    std::int64_t n = static_cast<std::int64_t>(x / ln2 + (x < 0.0 ? -0.5 : 0.5));
+    double y = x - static_cast<double>(n) * ln2;
+    double term = 1.0;
+    double sum = 1.0;
+    for (int i = 1; i < 25; ++i) {
+        term *= y / i;
+        sum += term;
+    }
+    for (; n > 0; --n) {
+        sum *= 2.0;
+    }
+    for (; n < 0; ++n) {
+        sum *= 0.5;
+    }
+    return sum;
+}
+
+constexpr double log_ce(double x) {
+    // x = 2^n * m, 1 <= m < 2, ln(m) = 2 * atanh((m - 1) / (m + 1))
+    std::int32_t n = 0;
+    for (; x >= 2.0; ++n) {
+        x *= 0.5;
+    }
+    for (; x < 1.0; --n) {
+        x *= 2.0;
+    }
+    double z = (x - 1.0) / (x + 1.0);
+    double term = z;
+    double sum = 0.0;
+    for (int i = 1; i < 60; i += 2) {
+        sum += term / i;
+        term *= z * z;
+    }
+    return 2.0 * sum + n * ln2;
+}
+
+constexpr double sqrt_ce(double x) {
+    // Newton iterations decrease monotonically from any start above the root
+    double y = x > 1.0 ? x : 1.0;
+    for (int i = 0; i < 64; ++i) {
+        double next = 0.5 * (y + x / y);
+        if (next >= y) {
+            break;
+        }
+        y = next;
+    }
+    return y;
+}
+
+// Builds the layers from the top of the base strip r and the layer area v for the density f
+// with inverse f_inv
+template <typename RealType, typename Density, typename InverseDensity>
+constexpr table<RealType> make_table(double r, double v, Density f, InverseDensity f_inv) {
+    table<RealType> t{};
+    double q = v / f(r);
+    t.k[0] = static_cast<RealType>(r / q);
+    t.k[1] = RealType(0);
+    t.w[0] = static_cast<RealType>(q);
+    t.w[layers - 1] = static_cast<RealType>(r);
+    t.f[0] = RealType(1);
+    t.f[layers - 1] = static_cast<RealType>(f(r));
+    double x = r;
+    for (std::uint32_t i = layers - 2; i > 0; --i) {
+        double x_next = f_inv(v / x + f(x));
+        t.k[i + 1] = static_cast<RealType>(x_next / x);
+        x = x_next;
+        t.f[i] = static_cast<RealType>(f(x));
+        t.w[i] = static_cast<RealType>(x);
+    }
+    return t;
+}
+
+// exp(-x^2 / 2) with 256 layers
+constexpr double gaussian_r = 3.6541528853610088;
+constexpr double gaussian_v = 4.92867323399e-3;
+
+template <typename RealType>
+struct gaussian_table {
+    static constexpr table<RealType> value = make_table<RealType>(
+        gaussian_r, gaussian_v, [](double x) { return exp_ce(-0.5 * x * x); },
+        [](double y) { return sqrt_ce(-2.0 * log_ce(y)); });
+};
+
+// exp(-x) with 256 layers
+constexpr double exponential_r = 7.69711747013104972;
+constexpr double exponential_v = 3.949659822581572e-3;
+
+template <typename RealType>
+struct exponential_table {
+    static constexpr table<RealType> value = make_table<RealType>(
+        exponential_r, exponential_v, [](double x) { return exp_ce(-x); },
+        [](double y) { return -log_ce(y); });
+};
+
+// Completes a point x of layer i that missed the fast test: the tail for the base strip, the
+// comparison with the density otherwise. Returns false if the point is rejected.
+template <typename RealType, typename EngineType>
+inline bool gaussian_slow_path(std::uint32_t i, RealType& x, EngineType& engine) {
+    constexpr RealType r = static_cast<RealType>(gaussian_r);
+    const auto& t = gaussian_table<RealType>::value;
+    if (i == 0) {
+        // Marsaglia's tail method
+        RealType y;
+        do {
+            x = -ln_wrapper(words::uniform<RealType>(engine)) / r;
+            y = -ln_wrapper(words::uniform<RealType>(engine));
+        } while (y + y < x * x);
+        x += r;
+        return true;
+    }
+    RealType y = t.f[i] + words::uniform<RealType>(engine) * (t.f[i - 1] - t.f[i]);
+    return y < exp_wrapper(RealType(-0.5) * x * x);
+}
+
+// Standard normal value. The low byte of the first word selects the layer, the next bit the sign
+// and the remaining bits the position in the layer.
+template <typename RealType, typename EngineType>
+inline RealType gaussian(EngineType& engine) {
+    constexpr int bits = words::bits<EngineType>();
+    const auto& t = gaussian_table<RealType>::value;
+    for (;;) {
+        std::uint32_t w = words::generate_single(engine);
+        std::uint32_t hi = words::high_word<RealType>(engine);
+        std::uint32_t i = w & (layers - 1);
+        RealType u = words::to_unit<RealType, bits, 9>(w, hi);
+        RealType x = u * t.w[i];
+        if (u < t.k[i] || gaussian_slow_path(i, x, engine)) {
+            return (w & layers) ? -x : x;
+        }
+    }
+}
+
+// Vector of standard normal values. Every lane runs the fast test without branching and only
+// records whether it missed; the few lanes that did are completed afterwards one at a time, so
+// the slow path does not make the lanes diverge. A lane finishes its own slow path rather than
+// starting over to keep the distribution exact.
+template <typename RealType, typename EngineType>
+inline sycl::vec<RealType, EngineType::vec_size> gaussian_vec(EngineType& engine) {
+    constexpr int bits = words::bits<EngineType>();
+    const auto& t = gaussian_table<RealType>::value;
+    sycl::vec<std::uint32_t, EngineType::vec_size> w = words::generate(engine);
+    sycl::vec<std::uint32_t, EngineType::vec_size> hi = w;
+    if constexpr (std::is_same<RealType, double>::value) {
+        hi = words::generate(engine);
+    }
+    sycl::vec<RealType, EngineType::vec_size> res;
+    std::uint32_t missed = 0;
+    for (int j = 0; j < EngineType::vec_size; ++j) {
+        std::uint32_t i = w[j] & (layers - 1);
+        RealType u = words::to_unit<RealType, bits, 9>(w[j], hi[j]);
+        RealType x = u * t.w[i];
+        res[j] = (w[j] & layers) ? -x : x;
+        missed |= static_cast<std::uint32_t>(u >= t.k[i]) << j;
+    }
+    if (missed) {
+        for (int j = 0; j < EngineType::vec_size; ++j) {
+            if ((missed >> j) & 1u) {
+                std::uint32_t i = w[j] & (layers - 1);
+                RealType x = words::to_unit<RealType, bits, 9>(w[j], hi[j]) * t.w[i];
+                if (gaussian_slow_path(i, x, engine)) {
+                    res[j] = (w[j] & layers) ? -x : x;
+                }
+                else {
+                    res[j] = gaussian<RealType>(engine);
+                }
+            }
+        }
+    }
+    return res;
+}
+
+template <typename RealType, typename EngineType>
+inline bool exponential_slow_path(std::uint32_t i, RealType& x, EngineType& engine) {
+    const auto& t = exponential_table<RealType>::value;
+    if (i == 0) {
+        // The tail of the exponential is a shifted exponential
+        x = static_cast<RealType>(exponential_r) - ln_wrapper(words::uniform<RealType>(engine));
+        return true;
+    }
+    RealType y = t.f[i] + words::uniform<RealType>(engine) * (t.f[i - 1] - t.f[i]);
+    return y < exp_wrapper(-x);
+}
+
+// Standard exponential value. The low byte of the first word selects the layer and the
+// remaining bits the position in the layer.
+template <typename RealType, typename EngineType>
+inline RealType exponential(EngineType& engine) {
+    constexpr int bits = words::bits<EngineType>();
+    const auto& t = exponential_table<RealType>::value;
+    for (;;) {
+        std::uint32_t w = words::generate_single(engine);
+        std::uint32_t hi = words::high_word<RealType>(engine);
+        std::uint32_t i = w & (layers - 1);
+        RealType u = words::to_unit<RealType, bits, 8>(w, hi);
+        RealType x = u * t.w[i];
+        if (u < t.k[i] || exponential_slow_path(i, x, engine)) {
+            return x;
+        }
+    }
+}
+
+// Vector of standard exponential values, see gaussian_vec for the handling of the lanes
+template <typename RealType, typename EngineType>
+inline sycl::vec<RealType, EngineType::vec_size> exponential_vec(EngineType& engine) {
+    constexpr int bits = words::bits<EngineType>();
+    const auto& t = exponential_table<RealType>::value;
+    sycl::vec<std::uint32_t, EngineType::vec_size> w = words::generate(engine);
+    sycl::vec<std::uint32_t, EngineType::vec_size> hi = w;
+    if constexpr (std::is_same<RealType, double>::value) {
+        hi = words::generate(engine);
+    }
+    sycl::vec<RealType, EngineType::vec_size> res;
+    std::uint32_t missed = 0;
+    for (int j = 0; j < EngineType::vec_size; ++j) {
+        std::uint32_t i = w[j] & (layers - 1);
+        RealType u = words::to_unit<RealType, bits, 8>(w[j], hi[j]);
+        res[j] = u * t.w[i];
+        missed |= static_cast<std::uint32_t>(u >= t.k[i]) << j;
+    }
+    if (missed) {
+        for (int j = 0; j < EngineType::vec_size; ++j) {
+            if ((missed >> j) & 1u) {
+                std::uint32_t i = w[j] & (layers - 1);
+                RealType x = res[j];
+                res[j] = exponential_slow_path(i, x, engine) ? x : exponential<RealType>(engine);
+            }
+        }
+    }
+    return res;
+}
+
+} // namespace ziggurat_impl
+} // namespace oneapi::mkl::rng::device::detail
+
+#endif // _MKL_RNG_DEVICE_ZIGGURAT_IMPL_HPP_
@@ -119,6 +119,7 @@ private:
 // Supported methods:
 //      oneapi::mkl::rng::device::gaussian_method::box_muller2
 //      oneapi::mkl::rng::device::gaussian_method::icdf
+//      oneapi::mkl::rng::device::gaussian_method::ziggurat
 //
 // Input arguments:
 //      mean   - mean. 0 by default
@@ -127,7 +128,8 @@ private:
 template <typename RealType, typename Method>
 class gaussian : detail::distribution_base<gaussian<RealType, Method>> {
 public:
-    static_assert(std::is_same<Method, gaussian_method::box_muller2>::value
+    static_assert(std::is_same<Method, gaussian_method::box_muller2>::value ||
+                      std::is_same<Method, gaussian_method::ziggurat>::value
 #if MKL_RNG_USE_BINARY_CODE
                       || std::is_same<Method, gaussian_method::icdf>::value
 #endif
@@ -313,6 +315,7 @@ private:
 // Supported methods:
 //      oneapi::mkl::rng::device::exponential_method::icdf
 //      oneapi::mkl::rng::device::exponential_method::icdf_accurate
+//      oneapi::mkl::rng::device::exponential_method::ziggurat
 //
 // Input arguments:
 //      displ - displacement. 0.0 by default
@@ -322,7 +325,8 @@ template <typename RealType, typename Method>
 class exponential : detail::distribution_base<exponential<RealType, Method>> {
 public:
     static_assert(std::is_same<Method, exponential_method::icdf>::value ||
-                      std::is_same<Method, exponential_method::icdf_accurate>::value,
+                      std::is_same<Method, exponential_method::icdf_accurate>::value ||
+                      std::is_same<Method, exponential_method::ziggurat>::value,
                   "oneMKL: rng/exponential: method is incorrect");
 
     static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
@@ -475,6 +479,455 @@ public:
     friend typename Distr::result_type generate_single(Distr& distr, Engine& engine);
 };
 
+// Class template oneapi::mkl::rng::device::gamma
+//
+// Represents continuous gamma random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::device::gamma_method::marsaglia
+//
+// Input arguments:
+//      alpha - shape. 1.0 by default
+//      a     - displacement. 0.0 by default
+//      beta  - scalefactor. 1.0 by default
+//
+template <typename RealType, typename Method>
+class gamma : detail::distribution_base<gamma<RealType, Method>> {
+public:
+    static_assert(std::is_same<Method, gamma_method::marsaglia>::value,
+                  "oneMKL: rng/gamma: method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "oneMKL: rng/gamma: type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+    using param_type = typename detail::distribution_base<gamma<RealType, Method>>::param_type;
+
+    gamma()
+            : detail::distribution_base<gamma<RealType, Method>>(
+                  static_cast<RealType>(1.0), static_cast<RealType>(0.0),
+                  static_cast<RealType>(1.0)) {}
+
+    explicit gamma(RealType alpha, RealType a = static_cast<RealType>(0.0),
+                   RealType beta = static_cast<RealType>(1.0))
+            : detail::distribution_base<gamma<RealType, Method>>(alpha, a, beta) {}
+    explicit gamma(const param_type& pt)
+            : detail::distribution_base<gamma<RealType, Method>>(pt.alpha_, pt.a_, pt.beta_) {}
+
+    RealType alpha() const {
+        return detail::distribution_base<gamma<RealType, Method>>::alpha();
+    }
+
+    RealType a() const {
+        return detail::distribution_base<gamma<RealType, Method>>::a();
+    }
+
+    RealType beta() const {
+        return detail::distribution_base<gamma<RealType, Method>>::beta();
+    }
+
+    param_type param() const {
+        return detail::distribution_base<gamma<RealType, Method>>::param();
+    }
+
+    void param(const param_type& pt) {
+        detail::distribution_base<gamma<RealType, Method>>::param(pt);
+    }
+
+    template <typename Distr, typename Engine>
+    friend auto generate(Distr& distr, Engine& engine) ->
+        typename std::conditional<Engine::vec_size == 1, typename Distr::result_type,
+                                  sycl::vec<typename Distr::result_type, Engine::vec_size>>::type;
+    template <typename Distr, typename Engine>
+    friend typename Distr::result_type generate_single(Distr& distr, Engine& engine);
+};
+
+// Class template oneapi::mkl::rng::device::beta
+//
+// Represents continuous beta random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::device::beta_method::gamma_based
+//
+// Input arguments:
+//      p - shape. 1.0 by default
+//      q - shape. 1.0 by default
+//      a - displacement. 0.0 by default
+//      b - scalefactor. 1.0 by default
+//
+template <typename RealType, typename Method>
+class beta : detail::distribution_base<beta<RealType, Method>> {
+public:
+    static_assert(std::is_same<Method, beta_method::gamma_based>::value,
+                  "oneMKL: rng/beta: method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "oneMKL: rng/beta: type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+    using param_type = typename detail::distribution_base<beta<RealType, Method>>::param_type;
+
+    beta()
+            : detail::distribution_base<beta<RealType, Method>>(
+                  static_cast<RealType>(1.0), static_cast<RealType>(1.0),
+                  static_cast<RealType>(0.0), static_cast<RealType>(1.0)) {}
+
+    explicit beta(RealType p, RealType q, RealType a = static_cast<RealType>(0.0),
+                  RealType b = static_cast<RealType>(1.0))
+            : detail::distribution_base<beta<RealType, Method>>(p, q, a, b) {}
+    explicit beta(const param_type& pt)
+            : detail::distribution_base<beta<RealType, Method>>(pt.p_, pt.q_, pt.a_, pt.b_) {}
+
+    RealType p() const {
+        return detail::distribution_base<beta<RealType, Method>>::p();
+    }
+
+    RealType q() const {
+        return detail::distribution_base<beta<RealType, Method>>::q();
+    }
+
+    RealType a() const {
+        return detail::distribution_base<beta<RealType, Method>>::a();
+    }
+
+    RealType b() const {
+        return detail::distribution_base<beta<RealType, Method>>::b();
+    }
+
+    param_type param() const {
+        return detail::distribution_base<beta<RealType, Method>>::param();
+    }
+
+    void param(const param_type& pt) {
+        detail::distribution_base<beta<RealType, Method>>::param(pt);
+    }
+
+    template <typename Distr, typename Engine>
+    friend auto generate(Distr& distr, Engine& engine) ->
+        typename std::conditional<Engine::vec_size == 1, typename Distr::result_type,
+                                  sycl::vec<typename Distr::result_type, Engine::vec_size>>::type;
+    template <typename Distr, typename Engine>
+    friend typename Distr::result_type generate_single(Distr& distr, Engine& engine);
+};
+
+// Class template oneapi::mkl::rng::device::chi_square
+//
+// Represents continuous chi-square random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::device::chi_square_method::gamma_based
+//
+// Input arguments:
+//      n - number of degrees of freedom. 5 by default
+//
+template <typename RealType, typename Method>
+class chi_square : detail::distribution_base<chi_square<RealType, Method>> {
+public:
+    static_assert(std::is_same<Method, chi_square_method::gamma_based>::value,
+                  "oneMKL: rng/chi_square: method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "oneMKL: rng/chi_square: type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+    using param_type = typename detail::distribution_base<chi_square<RealType, Method>>::param_type;
+
+    chi_square() : detail::distribution_base<chi_square<RealType, Method>>(5) {}
+
+    explicit chi_square(std::int32_t n)
+            : detail::distribution_base<chi_square<RealType, Method>>(n) {}
+    explicit chi_square(const param_type& pt)
+            : detail::distribution_base<chi_square<RealType, Method>>(pt.n_) {}
+
+    std::int32_t n() const {
+        return detail::distribution_base<chi_square<RealType, Method>>::n();
+    }
+
+    param_type param() const {
+        return detail::distribution_base<chi_square<RealType, Method>>::param();
+    }
+
+    void param(const param_type& pt) {
+        detail::distribution_base<chi_square<RealType, Method>>::param(pt);
+    }
+
+    template <typename Distr, typename Engine>
+    friend auto generate(Distr& distr, Engine& engine) ->
+        typename std::conditional<Engine::vec_size == 1, typename Distr::result_type,
+                                  sycl::vec<typename Distr::result_type, Engine::vec_size>>::type;
+    template <typename Distr, typename Engine>
+    friend typename Distr::result_type generate_single(Distr& distr, Engine& engine);
+};
+
+// Class template oneapi::mkl::rng::device::cauchy
+//
+// Represents continuous Cauchy random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::device::cauchy_method::icdf
+//
+// Input arguments:
+//      a - displacement. 0.0 by default
+//      b - scalefactor. 1.0 by default
+//
+template <typename RealType, typename Method>
+class cauchy : detail::distribution_base<cauchy<RealType, Method>> {
+public:
+    static_assert(std::is_same<Method, cauchy_method::icdf>::value,
+                  "oneMKL: rng/cauchy: method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "oneMKL: rng/cauchy: type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+    using param_type = typename detail::distribution_base<cauchy<RealType, Method>>::param_type;
+
+    cauchy()
+            : detail::distribution_base<cauchy<RealType, Method>>(static_cast<RealType>(0.0),
+                                                                  static_cast<RealType>(1.0)) {}
+
+    explicit cauchy(RealType a, RealType b)
+            : detail::distribution_base<cauchy<RealType, Method>>(a, b) {}
+    explicit cauchy(const param_type& pt)
+            : detail::distribution_base<cauchy<RealType, Method>>(pt.a_, pt.b_) {}
+
+    RealType a() const {
+        return detail::distribution_base<cauchy<RealType, Method>>::a();
+    }
+
+    RealType b() const {
+        return detail::distribution_base<cauchy<RealType, Method>>::b();
+    }
+
+    param_type param() const {
+        return detail::distribution_base<cauchy<RealType, Method>>::param();
+    }
+
+    void param(const param_type& pt) {
+        detail::distribution_base<cauchy<RealType, Method>>::param(pt);
+    }
+
+    template <typename Distr, typename Engine>
+    friend auto generate(Distr& distr, Engine& engine) ->
+        typename std::conditional<Engine::vec_size == 1, typename Distr::result_type,
+                                  sycl::vec<typename Distr::result_type, Engine::vec_size>>::type;
+    template <typename Distr, typename Engine>
+    friend typename Distr::result_type generate_single(Distr& distr, Engine& engine);
+};
+
+// Class template oneapi::mkl::rng::device::weibull
+//
+// Represents continuous Weibull random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::device::weibull_method::icdf
+//
+// Input arguments:
+//      alpha - shape. 1.0 by default
+//      a     - displacement. 0.0 by default
+//      beta  - scalefactor. 1.0 by default
+//
+template <typename RealType, typename Method>
+class weibull : detail::distribution_base<weibull<RealType, Method>> {
+public:
+    static_assert(std::is_same<Method, weibull_method::icdf>::value,
+                  "oneMKL: rng/weibull: method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "oneMKL: rng/weibull: type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+    using param_type = typename detail::distribution_base<weibull<RealType, Method>>::param_type;
+
+    weibull()
+            : detail::distribution_base<weibull<RealType, Method>>(
+                  static_cast<RealType>(1.0), static_cast<RealType>(0.0),
+                  static_cast<RealType>(1.0)) {}
+
+    explicit weibull(RealType alpha, RealType a = static_cast<RealType>(0.0),
+                     RealType beta = static_cast<RealType>(1.0))
+            : detail::distribution_base<weibull<RealType, Method>>(alpha, a, beta) {}
+    explicit weibull(const param_type& pt)
+            : detail::distribution_base<weibull<RealType, Method>>(pt.alpha_, pt.a_, pt.beta_) {}
+
+    RealType alpha() const {
+        return detail::distribution_base<weibull<RealType, Method>>::alpha();
+    }
+
+    RealType a() const {
+        return detail::distribution_base<weibull<RealType, Method>>::a();
+    }
+
+    RealType beta() const {
+        return detail::distribution_base<weibull<RealType, Method>>::beta();
+    }
+
+    param_type param() const {
+        return detail::distribution_base<weibull<RealType, Method>>::param();
+    }
+
+    void param(const param_type& pt) {
+        detail::distribution_base<weibull<RealType, Method>>::param(pt);
+    }
+
+    template <typename Distr, typename Engine>
+    friend auto generate(Distr& distr, Engine& engine) ->
+        typename std::conditional<Engine::vec_size == 1, typename Distr::result_type,
+                                  sycl::vec<typename Distr::result_type, Engine::vec_size>>::type;
+    template <typename Distr, typename Engine>
+    friend typename Distr::result_type generate_single(Distr& distr, Engine& engine);
+};
+
+// Class template oneapi::mkl::rng::device::multinomial
+//
+// Represents discrete multinomial random number distribution. One generated value is the vector
+// of the counts of all categories, see the generate function taking an output span. The
+// generation uses double precision
+//
+// Supported types:
+//      std::int32_t
+//      std::uint32_t
+//
+// Supported methods:
+//      oneapi::mkl::rng::device::multinomial_method::conditional_binomial
+//
+// Input arguments:
+//      ntrial - number of independent trials
+//      p      - probabilities of the categories, the span must stay valid while the
+//               distribution is used on the device. The generation time grows linearly with
+//               ntrial and the number of categories
+//
+template <typename IntType, typename Method>
+class multinomial : detail::distribution_base<multinomial<IntType, Method>> {
+public:
+    static_assert(std::is_same<Method, multinomial_method::conditional_binomial>::value,
+                  "oneMKL: rng/multinomial: method is incorrect");
+
+    static_assert(std::is_same<IntType, std::int32_t>::value ||
+                      std::is_same<IntType, std::uint32_t>::value,
+                  "oneMKL: rng/multinomial: type is not supported");
+
+    using method_type = Method;
+    using result_type = IntType;
+    using param_type = typename detail::distribution_base<multinomial<IntType, Method>>::param_type;
+
+    explicit multinomial(std::int32_t ntrial, sycl::span<const double> p)
+            : detail::distribution_base<multinomial<IntType, Method>>(ntrial, p) {}
+    explicit multinomial(const param_type& pt)
+            : detail::distribution_base<multinomial<IntType, Method>>(pt.ntrial_, pt.p_) {}
+
+    std::int32_t ntrial() const {
+        return detail::distribution_base<multinomial<IntType, Method>>::ntrial();
+    }
+
+    sycl::span<const double> p() const {
+        return detail::distribution_base<multinomial<IntType, Method>>::p();
+    }
+
+    param_type param() const {
+        return detail::distribution_base<multinomial<IntType, Method>>::param();
+    }
+
+    void param(const param_type& pt) {
+        detail::distribution_base<multinomial<IntType, Method>>::param(pt);
+    }
+
+    template <typename Type, typename M, typename Engine>
+    friend void generate(multinomial<Type, M>& distr, Engine& engine, sycl::span<Type> res);
+};
+
+// Class template oneapi::mkl::rng::device::gaussian_mv
+//
+// Represents continuous multivariate normal random number distribution. One generated value is a
+// vector of dimen correlated values, see the generate function taking an output span
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::device::gaussian_mv_method::box_muller2
+//      oneapi::mkl::rng::device::gaussian_mv_method::ziggurat
+//
+// Input arguments:
+//      dimen  - dimension of the vectors
+//      mean   - mean vector of dimen elements
+//      matrix - lower triangular Cholesky factor T of the covariance matrix, T * T^t, packed by
+//               columns as in LAPACK packed storage: T(i, j) for i >= j is
+//               matrix[i + j * (2 * dimen - j - 1) / 2]. The spans must stay valid while the
+//               distribution is used on the device
+//
+template <typename RealType, typename Method>
+class gaussian_mv : detail::distribution_base<gaussian_mv<RealType, Method>> {
+public:
+    static_assert(std::is_same<Method, gaussian_mv_method::box_muller2>::value ||
+                      std::is_same<Method, gaussian_mv_method::ziggurat>::value,
+                  "oneMKL: rng/gaussian_mv: method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "oneMKL: rng/gaussian_mv: type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+    using param_type =
+        typename detail::distribution_base<gaussian_mv<RealType, Method>>::param_type;
+
+    explicit gaussian_mv(std::uint32_t dimen, sycl::span<const RealType> mean,
+                         sycl::span<const RealType> matrix)
+            : detail::distribution_base<gaussian_mv<RealType, Method>>(dimen, mean, matrix) {}
+    explicit gaussian_mv(const param_type& pt)
+            : detail::distribution_base<gaussian_mv<RealType, Method>>(pt.dimen_, pt.mean_,
+                                                                       pt.matrix_) {}
+
+    std::uint32_t dimen() const {
+        return detail::distribution_base<gaussian_mv<RealType, Method>>::dimen();
+    }
+
+    sycl::span<const RealType> mean() const {
+        return detail::distribution_base<gaussian_mv<RealType, Method>>::mean();
+    }
+
+    sycl::span<const RealType> matrix() const {
+        return detail::distribution_base<gaussian_mv<RealType, Method>>::matrix();
+    }
+
+    param_type param() const {
+        return detail::distribution_base<gaussian_mv<RealType, Method>>::param();
+    }
+
+    void param(const param_type& pt) {
+        detail::distribution_base<gaussian_mv<RealType, Method>>::param(pt);
+    }
+
+    template <typename Type, typename M, typename Engine>
+    friend void generate(gaussian_mv<Type, M>& distr, Engine& engine, sycl::span<Type> res);
+};
+
 } // namespace oneapi::mkl::rng::device
 
 #endif // _MKL_RNG_DEVICE_DISTRIBUTIONS_HPP_
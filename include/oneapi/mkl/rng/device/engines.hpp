@@ -44,6 +44,9 @@ public:
 
     static constexpr std::int32_t vec_size = VecSize;
 
+    // Engine state that store_state saves and load_state restores
+    using state_type = detail::engine_state<philox4x32x10<VecSize>>;
+
     philox4x32x10() : detail::engine_base<philox4x32x10<VecSize>>(default_seed) {}
 
     philox4x32x10(std::uint64_t seed, std::uint64_t offset = 0)
@@ -61,6 +64,15 @@ public:
                                                           offset.begin()) {}
 
 private:
+    explicit philox4x32x10(const state_type& state)
+            : detail::engine_base<philox4x32x10<VecSize>>(state) {}
+
+    template <typename Engine>
+    friend Engine load_state(const typename Engine::state_type* state);
+
+    template <typename Engine>
+    friend void store_state(const Engine& engine, typename Engine::state_type* state);
+
     template <typename Engine>
     friend void skip_ahead(Engine& engine, std::uint64_t num_to_skip);
 
@@ -85,6 +97,9 @@ public:
 
     static constexpr std::int32_t vec_size = VecSize;
 
+    // Engine state that store_state saves and load_state restores
+    using state_type = detail::engine_state<mrg32k3a<VecSize>>;
+
     mrg32k3a() : detail::engine_base<mrg32k3a<VecSize>>(default_seed) {}
 
     mrg32k3a(std::uint32_t seed, std::uint64_t offset = 0)
@@ -101,6 +116,14 @@ public:
                                                      offset.begin()) {}
 
 private:
+    explicit mrg32k3a(const state_type& state) : detail::engine_base<mrg32k3a<VecSize>>(state) {}
+
+    template <typename Engine>
+    friend Engine load_state(const typename Engine::state_type* state);
+
+    template <typename Engine>
+    friend void store_state(const Engine& engine, typename Engine::state_type* state);
+
     template <typename Engine>
     friend void skip_ahead(Engine& engine, std::uint64_t num_to_skip);
 
@@ -125,6 +148,9 @@ public:
 
     static constexpr std::int32_t vec_size = VecSize;
 
+    // Engine state that store_state saves and load_state restores
+    using state_type = detail::engine_state<mcg31m1<VecSize>>;
+
     mcg31m1() : detail::engine_base<mcg31m1<VecSize>>(default_seed) {}
 
     mcg31m1(std::uint32_t seed, std::uint64_t offset = 0)
@@ -134,6 +160,14 @@ public:
             : detail::engine_base<mcg31m1<VecSize>>(seed.size(), seed.begin(), offset) {}
 
 private:
+    explicit mcg31m1(const state_type& state) : detail::engine_base<mcg31m1<VecSize>>(state) {}
+
+    template <typename Engine>
+    friend Engine load_state(const typename Engine::state_type* state);
+
+    template <typename Engine>
+    friend void store_state(const Engine& engine, typename Engine::state_type* state);
+
     template <typename Engine>
     friend void skip_ahead(Engine& engine, std::uint64_t num_to_skip);
 
@@ -155,6 +189,9 @@ public:
 
     static constexpr std::int32_t vec_size = VecSize;
 
+    // Engine state that store_state saves and load_state restores
+    using state_type = detail::engine_state<mcg59<VecSize>>;
+
     mcg59() : detail::engine_base<mcg59<VecSize>>(default_seed) {}
 
     mcg59(std::uint32_t seed, std::uint64_t offset = 0)
@@ -164,6 +201,14 @@ public:
             : detail::engine_base<mcg59<VecSize>>(seed.size(), seed.begin(), offset) {}
 
 private:
+    explicit mcg59(const state_type& state) : detail::engine_base<mcg59<VecSize>>(state) {}
+
+    template <typename Engine>
+    friend Engine load_state(const typename Engine::state_type* state);
+
+    template <typename Engine>
+    friend void store_state(const Engine& engine, typename Engine::state_type* state);
+
     template <typename Engine>
     friend void skip_ahead(Engine& engine, std::uint64_t num_to_skip);
 
@@ -35,6 +35,18 @@ auto generate(Distr& distr, Engine& engine) ->
     return distr.generate(engine);
 }
 
+// Fills res, which holds at least distr.p().size() elements, with the counts of all categories
+template <typename IntType, typename Method, typename Engine>
+void generate(multinomial<IntType, Method>& distr, Engine& engine, sycl::span<IntType> res) {
+    distr.generate(engine, res);
+}
+
+// Fills res, which holds at least distr.dimen() elements, with one correlated normal vector
+template <typename RealType, typename Method, typename Engine>
+void generate(gaussian_mv<RealType, Method>& distr, Engine& engine, sycl::span<RealType> res) {
+    distr.generate(engine, res);
+}
+
 // SERVICE FUNCTIONS
 
 template <typename Engine>
@@ -47,6 +59,38 @@ void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip
     engine.skip_ahead(num_to_skip);
 }
 
+// Saves the state of engine to *state, which may live in USM memory, so that a later kernel can
+// continue the sequence with load_state instead of seeding and skipping ahead again
+template <typename Engine>
+void store_state(const Engine& engine, typename Engine::state_type* state) {
+    *state = engine.state_;
+}
+
+// Engine that continues the sequence from the state saved by store_state or init_states
+template <typename Engine>
+Engine load_state(const typename Engine::state_type* state) {
+    return Engine(*state);
+}
+
+// Host function that fills states[0], ..., states[n - 1] in USM memory in one kernel. states[i]
+// is the state of Engine(seed, i * stride), so the engines loaded from them produce subsequences
+// that do not overlap for stride outputs. i * stride must be below 2^64.
+template <typename Engine>
+sycl::event init_states(sycl::queue& queue, std::int64_t n, typename Engine::state_type* states,
+                        decltype(Engine::default_seed) seed, std::uint64_t stride,
+                        const std::vector<sycl::event>& dependencies = {}) {
+    if (n < 0) {
+        throw oneapi::mkl::invalid_argument("rng", "init_states", "n < 0");
+    }
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        cgh.parallel_for(sycl::range<1>(static_cast<std::size_t>(n)), [=](sycl::item<1> item) {
+            std::uint64_t id = item.get_id(0);
+            store_state(Engine(seed, id * stride), states + id);
+        });
+    });
+}
+
 } // namespace oneapi::mkl::rng::device
 
 #endif // _MKL_RNG_DEVICE_FUNCTIONS_HPP_
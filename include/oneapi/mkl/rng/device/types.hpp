@@ -33,6 +33,7 @@ using by_default = standard;
 namespace gaussian_method {
 struct box_muller2 {};
 struct icdf {};
+struct ziggurat {};
 using by_default = box_muller2;
 } // namespace gaussian_method
 
@@ -44,6 +45,7 @@ using by_default = box_muller2;
 namespace exponential_method {
 struct icdf {};
 struct icdf_accurate {};
+struct ziggurat {};
 using by_default = icdf;
 } // namespace exponential_method
 
@@ -57,6 +59,42 @@ struct icdf {};
 using by_default = icdf;
 } // namespace bernoulli_method
 
+namespace gamma_method {
+struct marsaglia {};
+using by_default = marsaglia;
+} // namespace gamma_method
+
+namespace beta_method {
+struct gamma_based {};
+using by_default = gamma_based;
+} // namespace beta_method
+
+namespace chi_square_method {
+struct gamma_based {};
+using by_default = gamma_based;
+} // namespace chi_square_method
+
+namespace cauchy_method {
+struct icdf {};
+using by_default = icdf;
+} // namespace cauchy_method
+
+namespace weibull_method {
+struct icdf {};
+using by_default = icdf;
+} // namespace weibull_method
+
+namespace multinomial_method {
+struct conditional_binomial {};
+using by_default = conditional_binomial;
+} // namespace multinomial_method
+
+namespace gaussian_mv_method {
+struct box_muller2 {};
+struct ziggurat {};
+using by_default = box_muller2;
+} // namespace gaussian_mv_method
+
 } // namespace oneapi::mkl::rng::device
 
 #endif // _MKL_RNG_DEVICE_TYPES_HPP_
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <limits>
+#include <vector>
 #if __has_include(<sycl/sycl.hpp>)
 #include <sycl/sycl.hpp>
 #else
@@ -351,6 +352,77 @@ private:
     double lambda_;
 };
 
+// Class template oneapi::mkl::rng::gaussian_mv
+//
+// Represents continuous multivariate normal random number distribution. The generate functions
+// produce n vectors of dimen elements each, so the output holds n * dimen values
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::gaussian_mv_method::box_muller2
+//
+// Input arguments:
+//      dimen  - dimension of the vectors
+//      mean   - mean vector of dimen elements
+//      matrix - lower triangular Cholesky factor T of the covariance matrix, T * T^t, packed by
+//               columns as in LAPACK packed storage: T(i, j) for i >= j is
+//               matrix[i + j * (2 * dimen - j - 1) / 2]
+
+namespace gaussian_mv_method {
+struct box_muller2 {};
+using by_default = box_muller2;
+} // namespace gaussian_mv_method
+
+template <typename RealType = float, typename Method = gaussian_mv_method::by_default>
+class gaussian_mv {
+public:
+    static_assert(std::is_same<Method, gaussian_mv_method::box_muller2>::value,
+                  "rng gaussian_mv distribution method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "rng gaussian_mv distribution type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+
+    explicit gaussian_mv(std::uint32_t dimen, std::vector<RealType> mean,
+                         std::vector<RealType> matrix)
+            : dimen_(dimen),
+              mean_(std::move(mean)),
+              matrix_(std::move(matrix)) {
+        if (dimen_ == 0) {
+            throw oneapi::mkl::invalid_argument("rng", "gaussian_mv", "dimen == 0");
+        }
+        if (mean_.size() != dimen_) {
+            throw oneapi::mkl::invalid_argument("rng", "gaussian_mv", "mean.size() != dimen");
+        }
+        if (matrix_.size() != std::size_t{ dimen_ } * (dimen_ + 1) / 2) {
+            throw oneapi::mkl::invalid_argument("rng", "gaussian_mv",
+                                                "matrix.size() != dimen * (dimen + 1) / 2");
+        }
+    }
+
+    std::uint32_t dimen() const {
+        return dimen_;
+    }
+
+    const std::vector<RealType>& mean() const {
+        return mean_;
+    }
+
+    const std::vector<RealType>& matrix() const {
+        return matrix_;
+    }
+
+private:
+    std::uint32_t dimen_;
+    std::vector<RealType> mean_;
+    std::vector<RealType> matrix_;
+};
+
 // Class template oneapi::mkl::rng::bits
 //
 // Represents bits of underlying random number engine
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <vector>
 #if __has_include(<sycl/sycl.hpp>)
 #include <sycl/sycl.hpp>
 #else
@@ -47,6 +48,9 @@
 #ifdef ENABLE_ROCRAND_BACKEND
 #include "oneapi/mkl/rng/detail/rocrand/onemkl_rng_rocrand.hpp"
 #endif
+#ifdef ENABLE_PORTABLE_BACKEND
+#include "oneapi/mkl/rng/detail/portable/onemkl_rng_portable.hpp"
+#endif
 
 namespace oneapi {
 namespace mkl {
@@ -103,6 +107,15 @@ public:
             : pimpl_(rocrand::create_philox4x32x10(selector.get_queue(), seed)) {}
 #endif
 
+#ifdef ENABLE_PORTABLE_BACKEND
+    philox4x32x10(backend_selector<backend::portable> selector, std::uint64_t seed = default_seed)
+            : pimpl_(portable::create_philox4x32x10(selector.get_queue(), seed)) {}
+
+    philox4x32x10(backend_selector<backend::portable> selector,
+                  std::initializer_list<std::uint64_t> seed)
+            : pimpl_(portable::create_philox4x32x10(selector.get_queue(), seed)) {}
+#endif
+
     philox4x32x10(const philox4x32x10& other) {
         pimpl_.reset(other.pimpl_.get()->copy_state());
     }
@@ -134,6 +147,9 @@ private:
     template <typename Engine>
     friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
 
+    template <typename Engine>
+    friend void leapfrog(Engine& engine, std::uint64_t idx, std::uint64_t stride);
+
     template <typename Distr, typename Engine>
     friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
                          sycl::buffer<typename Distr::result_type, 1>& r);
@@ -192,6 +208,15 @@ public:
             : pimpl_(rocrand::create_mrg32k3a(selector.get_queue(), seed)) {}
 #endif
 
+#ifdef ENABLE_PORTABLE_BACKEND
+    mrg32k3a(backend_selector<backend::portable> selector, std::uint32_t seed = default_seed)
+            : pimpl_(portable::create_mrg32k3a(selector.get_queue(), seed)) {}
+
+    mrg32k3a(backend_selector<backend::portable> selector,
+             std::initializer_list<std::uint32_t> seed)
+            : pimpl_(portable::create_mrg32k3a(selector.get_queue(), seed)) {}
+#endif
+
     mrg32k3a(const mrg32k3a& other) {
         pimpl_.reset(other.pimpl_.get()->copy_state());
     }
@@ -223,6 +248,384 @@ private:
     template <typename Engine>
     friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
 
+    template <typename Engine>
+    friend void leapfrog(Engine& engine, std::uint64_t idx, std::uint64_t stride);
+
+    template <typename Distr, typename Engine>
+    friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
+                         sycl::buffer<typename Distr::result_type, 1>& r);
+
+    template <typename Distr, typename Engine>
+    friend sycl::event generate(const Distr& distr, Engine& engine, std::int64_t n,
+                                typename Distr::result_type* r,
+                                const std::vector<sycl::event>& dependencies);
+};
+
+// Class oneapi::mkl::rng::mcg31m1
+//
+// Represents multiplicative congruential pseudorandom number generator with modulus 2^31 - 1
+//
+// Supported parallelization methods:
+//      skip_ahead
+//      leapfrog
+class mcg31m1 {
+public:
+    static constexpr std::uint32_t default_seed = 1;
+
+    mcg31m1(sycl::queue queue, std::uint32_t seed = default_seed)
+            : pimpl_(detail::create_mcg31m1(get_device_id(queue), queue, seed)) {}
+
+#ifdef ENABLE_MKLCPU_BACKEND
+    mcg31m1(backend_selector<backend::mklcpu> selector, std::uint32_t seed = default_seed)
+            : pimpl_(mklcpu::create_mcg31m1(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_MKLGPU_BACKEND
+    mcg31m1(backend_selector<backend::mklgpu> selector, std::uint32_t seed = default_seed)
+            : pimpl_(mklgpu::create_mcg31m1(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_CURAND_BACKEND
+    mcg31m1(backend_selector<backend::curand> selector, std::uint32_t seed = default_seed)
+            : pimpl_(curand::create_mcg31m1(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_ROCRAND_BACKEND
+    mcg31m1(backend_selector<backend::rocrand> selector, std::uint32_t seed = default_seed)
+            : pimpl_(rocrand::create_mcg31m1(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_PORTABLE_BACKEND
+    mcg31m1(backend_selector<backend::portable> selector, std::uint32_t seed = default_seed)
+            : pimpl_(portable::create_mcg31m1(selector.get_queue(), seed)) {}
+#endif
+
+    mcg31m1(const mcg31m1& other) {
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+    }
+
+    mcg31m1(mcg31m1&& other) {
+        pimpl_ = std::move(other.pimpl_);
+    }
+
+    mcg31m1& operator=(const mcg31m1& other) {
+        if (this == &other)
+            return *this;
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+        return *this;
+    }
+
+    mcg31m1& operator=(mcg31m1&& other) {
+        if (this == &other)
+            return *this;
+        pimpl_ = std::move(other.pimpl_);
+        return *this;
+    }
+
+private:
+    std::unique_ptr<detail::engine_impl> pimpl_;
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::uint64_t num_to_skip);
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
+
+    template <typename Engine>
+    friend void leapfrog(Engine& engine, std::uint64_t idx, std::uint64_t stride);
+
+    template <typename Distr, typename Engine>
+    friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
+                         sycl::buffer<typename Distr::result_type, 1>& r);
+
+    template <typename Distr, typename Engine>
+    friend sycl::event generate(const Distr& distr, Engine& engine, std::int64_t n,
+                                typename Distr::result_type* r,
+                                const std::vector<sycl::event>& dependencies);
+};
+
+// Class oneapi::mkl::rng::mcg59
+//
+// Represents multiplicative congruential pseudorandom number generator with modulus 2^59
+//
+// Supported parallelization methods:
+//      skip_ahead
+//      leapfrog
+class mcg59 {
+public:
+    static constexpr std::uint64_t default_seed = 1;
+
+    mcg59(sycl::queue queue, std::uint64_t seed = default_seed)
+            : pimpl_(detail::create_mcg59(get_device_id(queue), queue, seed)) {}
+
+#ifdef ENABLE_MKLCPU_BACKEND
+    mcg59(backend_selector<backend::mklcpu> selector, std::uint64_t seed = default_seed)
+            : pimpl_(mklcpu::create_mcg59(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_MKLGPU_BACKEND
+    mcg59(backend_selector<backend::mklgpu> selector, std::uint64_t seed = default_seed)
+            : pimpl_(mklgpu::create_mcg59(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_CURAND_BACKEND
+    mcg59(backend_selector<backend::curand> selector, std::uint64_t seed = default_seed)
+            : pimpl_(curand::create_mcg59(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_ROCRAND_BACKEND
+    mcg59(backend_selector<backend::rocrand> selector, std::uint64_t seed = default_seed)
+            : pimpl_(rocrand::create_mcg59(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_PORTABLE_BACKEND
+    mcg59(backend_selector<backend::portable> selector, std::uint64_t seed = default_seed)
+            : pimpl_(portable::create_mcg59(selector.get_queue(), seed)) {}
+#endif
+
+    mcg59(const mcg59& other) {
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+    }
+
+    mcg59(mcg59&& other) {
+        pimpl_ = std::move(other.pimpl_);
+    }
+
+    mcg59& operator=(const mcg59& other) {
+        if (this == &other)
+            return *this;
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+        return *this;
+    }
+
+    mcg59& operator=(mcg59&& other) {
+        if (this == &other)
+            return *this;
+        pimpl_ = std::move(other.pimpl_);
+        return *this;
+    }
+
+private:
+    std::unique_ptr<detail::engine_impl> pimpl_;
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::uint64_t num_to_skip);
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
+
+    template <typename Engine>
+    friend void leapfrog(Engine& engine, std::uint64_t idx, std::uint64_t stride);
+
+    template <typename Distr, typename Engine>
+    friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
+                         sycl::buffer<typename Distr::result_type, 1>& r);
+
+    template <typename Distr, typename Engine>
+    friend sycl::event generate(const Distr& distr, Engine& engine, std::int64_t n,
+                                typename Distr::result_type* r,
+                                const std::vector<sycl::event>& dependencies);
+};
+
+// Class oneapi::mkl::rng::mt19937
+//
+// Represents Mersenne Twister pseudorandom number generator with period 2^19937 - 1
+//
+// Supported parallelization methods:
+//      skip_ahead
+class mt19937 {
+public:
+    static constexpr std::uint32_t default_seed = 1;
+
+    mt19937(sycl::queue queue, std::uint32_t seed = default_seed)
+            : pimpl_(detail::create_mt19937(get_device_id(queue), queue, seed)) {}
+
+    mt19937(sycl::queue queue, std::initializer_list<std::uint32_t> seed)
+            : pimpl_(detail::create_mt19937(get_device_id(queue), queue, seed)) {}
+
+#ifdef ENABLE_MKLCPU_BACKEND
+    mt19937(backend_selector<backend::mklcpu> selector, std::uint32_t seed = default_seed)
+            : pimpl_(mklcpu::create_mt19937(selector.get_queue(), seed)) {}
+
+    mt19937(backend_selector<backend::mklcpu> selector, std::initializer_list<std::uint32_t> seed)
+            : pimpl_(mklcpu::create_mt19937(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_MKLGPU_BACKEND
+    mt19937(backend_selector<backend::mklgpu> selector, std::uint32_t seed = default_seed)
+            : pimpl_(mklgpu::create_mt19937(selector.get_queue(), seed)) {}
+
+    mt19937(backend_selector<backend::mklgpu> selector, std::initializer_list<std::uint32_t> seed)
+            : pimpl_(mklgpu::create_mt19937(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_CURAND_BACKEND
+    mt19937(backend_selector<backend::curand> selector, std::uint32_t seed = default_seed)
+            : pimpl_(curand::create_mt19937(selector.get_queue(), seed)) {}
+
+    mt19937(backend_selector<backend::curand> selector, std::initializer_list<std::uint32_t> seed)
+            : pimpl_(curand::create_mt19937(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_ROCRAND_BACKEND
+    mt19937(backend_selector<backend::rocrand> selector, std::uint32_t seed = default_seed)
+            : pimpl_(rocrand::create_mt19937(selector.get_queue(), seed)) {}
+
+    mt19937(backend_selector<backend::rocrand> selector, std::initializer_list<std::uint32_t> seed)
+            : pimpl_(rocrand::create_mt19937(selector.get_queue(), seed)) {}
+#endif
+
+#ifdef ENABLE_PORTABLE_BACKEND
+    mt19937(backend_selector<backend::portable> selector, std::uint32_t seed = default_seed)
+            : pimpl_(portable::create_mt19937(selector.get_queue(), seed)) {}
+
+    mt19937(backend_selector<backend::portable> selector, std::initializer_list<std::uint32_t> seed)
+            : pimpl_(portable::create_mt19937(selector.get_queue(), seed)) {}
+#endif
+
+    mt19937(const mt19937& other) {
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+    }
+
+    mt19937(mt19937&& other) {
+        pimpl_ = std::move(other.pimpl_);
+    }
+
+    mt19937& operator=(const mt19937& other) {
+        if (this == &other)
+            return *this;
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+        return *this;
+    }
+
+    mt19937& operator=(mt19937&& other) {
+        if (this == &other)
+            return *this;
+        pimpl_ = std::move(other.pimpl_);
+        return *this;
+    }
+
+private:
+    std::unique_ptr<detail::engine_impl> pimpl_;
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::uint64_t num_to_skip);
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
+
+    template <typename Engine>
+    friend void leapfrog(Engine& engine, std::uint64_t idx, std::uint64_t stride);
+
+    template <typename Distr, typename Engine>
+    friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
+                         sycl::buffer<typename Distr::result_type, 1>& r);
+
+    template <typename Distr, typename Engine>
+    friend sycl::event generate(const Distr& distr, Engine& engine, std::int64_t n,
+                                typename Distr::result_type* r,
+                                const std::vector<sycl::event>& dependencies);
+};
+
+// Class oneapi::mkl::rng::sobol
+//
+// Represents Sobol quasi-random number generator. The output interleaves the coordinates of
+// consecutive points, so a dimensions-dimensional point occupies dimensions elements
+//
+// Supported parallelization methods:
+//      skip_ahead
+//      leapfrog
+class sobol {
+public:
+    static constexpr std::uint32_t default_dimensions_number = 1;
+
+    sobol(sycl::queue queue, std::uint32_t dimensions = default_dimensions_number)
+            : pimpl_(detail::create_sobol(get_device_id(queue), queue, dimensions)) {}
+
+    sobol(sycl::queue queue, std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(detail::create_sobol(get_device_id(queue), queue, direction_numbers)) {}
+
+#ifdef ENABLE_MKLCPU_BACKEND
+    sobol(backend_selector<backend::mklcpu> selector,
+          std::uint32_t dimensions = default_dimensions_number)
+            : pimpl_(mklcpu::create_sobol(selector.get_queue(), dimensions)) {}
+
+    sobol(backend_selector<backend::mklcpu> selector, std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(mklcpu::create_sobol(selector.get_queue(), direction_numbers)) {}
+#endif
+
+#ifdef ENABLE_MKLGPU_BACKEND
+    sobol(backend_selector<backend::mklgpu> selector,
+          std::uint32_t dimensions = default_dimensions_number)
+            : pimpl_(mklgpu::create_sobol(selector.get_queue(), dimensions)) {}
+
+    sobol(backend_selector<backend::mklgpu> selector, std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(mklgpu::create_sobol(selector.get_queue(), direction_numbers)) {}
+#endif
+
+#ifdef ENABLE_CURAND_BACKEND
+    sobol(backend_selector<backend::curand> selector,
+          std::uint32_t dimensions = default_dimensions_number)
+            : pimpl_(curand::create_sobol(selector.get_queue(), dimensions)) {}
+
+    sobol(backend_selector<backend::curand> selector, std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(curand::create_sobol(selector.get_queue(), direction_numbers)) {}
+#endif
+
+#ifdef ENABLE_ROCRAND_BACKEND
+    sobol(backend_selector<backend::rocrand> selector,
+          std::uint32_t dimensions = default_dimensions_number)
+            : pimpl_(rocrand::create_sobol(selector.get_queue(), dimensions)) {}
+
+    sobol(backend_selector<backend::rocrand> selector,
+          std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(rocrand::create_sobol(selector.get_queue(), direction_numbers)) {}
+#endif
+
+#ifdef ENABLE_PORTABLE_BACKEND
+    sobol(backend_selector<backend::portable> selector,
+          std::uint32_t dimensions = default_dimensions_number)
+            : pimpl_(portable::create_sobol(selector.get_queue(), dimensions)) {}
+
+    sobol(backend_selector<backend::portable> selector,
+          std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(portable::create_sobol(selector.get_queue(), direction_numbers)) {}
+#endif
+
+    sobol(const sobol& other) {
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+    }
+
+    sobol(sobol&& other) {
+        pimpl_ = std::move(other.pimpl_);
+    }
+
+    sobol& operator=(const sobol& other) {
+        if (this == &other)
+            return *this;
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+        return *this;
+    }
+
+    sobol& operator=(sobol&& other) {
+        if (this == &other)
+            return *this;
+        pimpl_ = std::move(other.pimpl_);
+        return *this;
+    }
+
+private:
+    std::unique_ptr<detail::engine_impl> pimpl_;
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::uint64_t num_to_skip);
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
+
+    template <typename Engine>
+    friend void leapfrog(Engine& engine, std::uint64_t idx, std::uint64_t stride);
+
     template <typename Distr, typename Engine>
     friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
                          sycl::buffer<typename Distr::result_type, 1>& r);
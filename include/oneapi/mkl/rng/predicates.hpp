@@ -29,6 +29,7 @@
 
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/rng/distributions.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -46,6 +47,17 @@ inline void generate_precondition(const Distr& /*distr*/, Engine& /*engine*/, st
 #endif
 }
 
+// gaussian_mv generates n vectors of distr.dimen() elements
+template <typename RealType, typename Method, typename Engine>
+inline void generate_precondition(const gaussian_mv<RealType, Method>& distr, Engine& /*engine*/,
+                                  std::int64_t n, sycl::buffer<RealType, 1>& r) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    if (n < 0 || n > r.size() / distr.dimen()) {
+        throw oneapi::mkl::invalid_argument("rng", "generate", "n");
+    }
+#endif
+}
+
 // USM APIs
 
 template <typename Distr, typename Engine>
@@ -29,6 +29,13 @@ using fwd_type = typename dft::detail::commit_impl<prec, dom>::fwd_type;
 using bwd_type = typename dft::detail::commit_impl<prec, dom>::bwd_type;
 using descriptor_type = typename dft::detail::descriptor<prec, dom>;
 
+// Separate real and imaginary arrays never describe REAL_REAL domain data, whose descriptors give
+// the *_rr functions a placeholder scalar_type, and the compute functions never call them.
+[[noreturn]] static void reject_split_storage(const char* function) {
+    throw oneapi::mkl::invalid_argument("DFT", function,
+                                        "REAL_REAL complex storage requires a complex domain.");
+}
+
 // forward inplace COMPLEX_COMPLEX
 void forward_ip_cc(descriptor_type& desc, sycl::buffer<fwd_type, 1>& inout) override {
     oneapi::mkl::dft::BACKEND::compute_forward(desc, inout);
@@ -41,11 +48,21 @@ sycl::event forward_ip_cc(descriptor_type& desc, fwd_type* inout,
 // forward inplace REAL_REAL
 void forward_ip_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>& inout_re,
                    sycl::buffer<scalar_type, 1>& inout_im) override {
-    oneapi::mkl::dft::BACKEND::compute_forward(desc, inout_re, inout_im);
+    if constexpr (dft::detail::is_real_real_domain<descriptor_type>) {
+        reject_split_storage("compute_forward");
+    }
+    else {
+        oneapi::mkl::dft::BACKEND::compute_forward(desc, inout_re, inout_im);
+    }
 }
 sycl::event forward_ip_rr(descriptor_type& desc, scalar_type* inout_re, scalar_type* inout_im,
                           const std::vector<sycl::event>& dependencies) override {
-    return oneapi::mkl::dft::BACKEND::compute_forward(desc, inout_re, inout_im, dependencies);
+    if constexpr (dft::detail::is_real_real_domain<descriptor_type>) {
+        reject_split_storage("compute_forward");
+    }
+    else {
+        return oneapi::mkl::dft::BACKEND::compute_forward(desc, inout_re, inout_im, dependencies);
+    }
 }
 
 // forward out-of-place COMPLEX_COMPLEX
@@ -62,13 +79,23 @@ sycl::event forward_op_cc(descriptor_type& desc, fwd_type* in, bwd_type* out,
 void forward_op_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>& in_re,
                    sycl::buffer<scalar_type, 1>& in_im, sycl::buffer<scalar_type, 1>& out_re,
                    sycl::buffer<scalar_type, 1>& out_im) override {
-    oneapi::mkl::dft::BACKEND::compute_forward(desc, in_re, in_im, out_re, out_im);
+    if constexpr (dft::detail::is_real_real_domain<descriptor_type>) {
+        reject_split_storage("compute_forward");
+    }
+    else {
+        oneapi::mkl::dft::BACKEND::compute_forward(desc, in_re, in_im, out_re, out_im);
+    }
 }
 sycl::event forward_op_rr(descriptor_type& desc, scalar_type* in_re, scalar_type* in_im,
                           scalar_type* out_re, scalar_type* out_im,
                           const std::vector<sycl::event>& dependencies) override {
-    return oneapi::mkl::dft::BACKEND::compute_forward(desc, in_re, in_im, out_re, out_im,
-                                                      dependencies);
+    if constexpr (dft::detail::is_real_real_domain<descriptor_type>) {
+        reject_split_storage("compute_forward");
+    }
+    else {
+        return oneapi::mkl::dft::BACKEND::compute_forward(desc, in_re, in_im, out_re, out_im,
+                                                          dependencies);
+    }
 }
 
 // backward inplace COMPLEX_COMPLEX
@@ -83,11 +110,21 @@ sycl::event backward_ip_cc(descriptor_type& desc, fwd_type* inout,
 // backward inplace REAL_REAL
 void backward_ip_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>& inout_re,
                     sycl::buffer<scalar_type, 1>& inout_im) override {
-    oneapi::mkl::dft::BACKEND::compute_backward(desc, inout_re, inout_im);
+    if constexpr (dft::detail::is_real_real_domain<descriptor_type>) {
+        reject_split_storage("compute_backward");
+    }
+    else {
+        oneapi::mkl::dft::BACKEND::compute_backward(desc, inout_re, inout_im);
+    }
 }
 sycl::event backward_ip_rr(descriptor_type& desc, scalar_type* inout_re, scalar_type* inout_im,
                            const std::vector<sycl::event>& dependencies) override {
-    return oneapi::mkl::dft::BACKEND::compute_backward(desc, inout_re, inout_im, dependencies);
+    if constexpr (dft::detail::is_real_real_domain<descriptor_type>) {
+        reject_split_storage("compute_backward");
+    }
+    else {
+        return oneapi::mkl::dft::BACKEND::compute_backward(desc, inout_re, inout_im, dependencies);
+    }
 }
 
 // backward out-of-place COMPLEX_COMPLEX
@@ -104,11 +141,21 @@ sycl::event backward_op_cc(descriptor_type& desc, bwd_type* in, fwd_type* out,
 void backward_op_rr(descriptor_type& desc, sycl::buffer<scalar_type, 1>& in_re,
                     sycl::buffer<scalar_type, 1>& in_im, sycl::buffer<scalar_type, 1>& out_re,
                     sycl::buffer<scalar_type, 1>& out_im) override {
-    oneapi::mkl::dft::BACKEND::compute_backward(desc, in_re, in_im, out_re, out_im);
+    if constexpr (dft::detail::is_real_real_domain<descriptor_type>) {
+        reject_split_storage("compute_backward");
+    }
+    else {
+        oneapi::mkl::dft::BACKEND::compute_backward(desc, in_re, in_im, out_re, out_im);
+    }
 }
 sycl::event backward_op_rr(descriptor_type& desc, scalar_type* in_re, scalar_type* in_im,
                            scalar_type* out_re, scalar_type* out_im,
                            const std::vector<sycl::event>& dependencies) override {
-    return oneapi::mkl::dft::BACKEND::compute_backward(desc, in_re, in_im, out_re, out_im,
-                                                       dependencies);
+    if constexpr (dft::detail::is_real_real_domain<descriptor_type>) {
+        reject_split_storage("compute_backward");
+    }
+    else {
+        return oneapi::mkl::dft::BACKEND::compute_backward(desc, in_re, in_im, out_re, out_im,
+                                                           dependencies);
+    }
 }
@@ -25,6 +25,18 @@ using desc_rd_t =
     dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::REAL>;
 using desc_cd_t =
     dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::COMPLEX>;
+using desc_rh_t =
+    dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::REAL>;
+using desc_ch_t =
+    dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>;
+using desc_rb_t =
+    dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>;
+using desc_cb_t =
+    dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>;
+using desc_rrf_t =
+    dft::detail::descriptor<dft::detail::precision::SINGLE, dft::detail::domain::REAL_REAL>;
+using desc_rrd_t =
+    dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::REAL_REAL>;
 using depends_vec_t = const std::vector<sycl::event> &;
 
 #define ONEMKL_DFT_FORWARD_INSTANTIATIONS(DESCRIPTOR_T, SCALAR_T, FORWARD_T, BACKWARD_T)           \
@@ -54,5 +66,39 @@ ONEMKL_DFT_FORWARD_INSTANTIATIONS(desc_cf_t, float, std::complex<float>, std::co
 ONEMKL_DFT_FORWARD_INSTANTIATIONS(desc_rd_t, double, double, std::complex<double>)
 ONEMKL_DFT_FORWARD_INSTANTIATIONS(desc_cd_t, double, std::complex<double>, std::complex<double>)
 
+// Only backends that define ONEMKL_DFT_HALF_INSTANTIATIONS or ONEMKL_DFT_BFLOAT16_INSTANTIATIONS
+// implement HALF or BFLOAT16 transforms.
+#ifdef ONEMKL_DFT_HALF_INSTANTIATIONS
+ONEMKL_DFT_FORWARD_INSTANTIATIONS(desc_rh_t, sycl::half, sycl::half, dft::complex_half)
+ONEMKL_DFT_FORWARD_INSTANTIATIONS(desc_ch_t, sycl::half, dft::complex_half, dft::complex_half)
+#endif
+#ifdef ONEMKL_DFT_BFLOAT16_INSTANTIATIONS
+ONEMKL_DFT_FORWARD_INSTANTIATIONS(desc_rb_t, oneapi::mkl::bfloat16, oneapi::mkl::bfloat16,
+                                  dft::complex_bfloat16)
+ONEMKL_DFT_FORWARD_INSTANTIATIONS(desc_cb_t, oneapi::mkl::bfloat16, dft::complex_bfloat16,
+                                  dft::complex_bfloat16)
+#endif
+
+// REAL_REAL domain data is never split, so only the in-place and out-of-place functions exist.
+// Only backends that define ONEMKL_DFT_REAL_REAL_INSTANTIATIONS implement REAL_REAL transforms.
+#ifdef ONEMKL_DFT_REAL_REAL_INSTANTIATIONS
+#define ONEMKL_DFT_FORWARD_REAL_REAL_INSTANTIATIONS(DESCRIPTOR_T, REAL_T)                          \
+    /* Buffer API */                                                                               \
+    template ONEMKL_EXPORT void compute_forward<DESCRIPTOR_T>(DESCRIPTOR_T &,                      \
+                                                              sycl::buffer<REAL_T> &);             \
+    template ONEMKL_EXPORT void compute_forward<DESCRIPTOR_T>(                                     \
+        DESCRIPTOR_T &, sycl::buffer<REAL_T> &, sycl::buffer<REAL_T> &);                           \
+                                                                                                   \
+    /* USM API */                                                                                  \
+    template ONEMKL_EXPORT sycl::event compute_forward<DESCRIPTOR_T>(DESCRIPTOR_T &, REAL_T *,     \
+                                                                     depends_vec_t);               \
+    template ONEMKL_EXPORT sycl::event compute_forward<DESCRIPTOR_T>(                              \
+        DESCRIPTOR_T &, REAL_T *, REAL_T *, depends_vec_t);
+
+ONEMKL_DFT_FORWARD_REAL_REAL_INSTANTIATIONS(desc_rrf_t, float)
+ONEMKL_DFT_FORWARD_REAL_REAL_INSTANTIATIONS(desc_rrd_t, double)
+#undef ONEMKL_DFT_FORWARD_REAL_REAL_INSTANTIATIONS
+#endif
+
 #undef ONEMKL_DFT_FORWARD_INSTANTIATIONS
 #undef ONEMKL_DFT_FORWARD_INSTANTIATIONS_REAL_ONLY
@@ -41,6 +41,12 @@ oneapi::mkl::dft::BACKEND::create_commit,
 oneapi::mkl::dft::BACKEND::create_commit,
 oneapi::mkl::dft::BACKEND::create_commit,
 oneapi::mkl::dft::BACKEND::create_commit,
+oneapi::mkl::dft::BACKEND::create_commit,
+oneapi::mkl::dft::BACKEND::create_commit,
+oneapi::mkl::dft::BACKEND::create_commit,
+oneapi::mkl::dft::BACKEND::create_commit,
+oneapi::mkl::dft::BACKEND::create_commit,
+oneapi::mkl::dft::BACKEND::create_commit,
 // clang-format on
 
 #undef ONEAPI_MKL_DFT_BACKEND_SIGNATURES
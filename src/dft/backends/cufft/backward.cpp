@@ -58,7 +58,7 @@ ONEMKL_EXPORT void compute_backward(descriptor_type &desc,
     auto plan = detail::get_bwd_plan(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         offsets[0] *= 2; // offset is supplied in complex but we offset scalar pointer
         if (offsets[1] % 2 != 0) {
             throw oneapi::mkl::unimplemented(
@@ -103,7 +103,7 @@ ONEMKL_EXPORT void compute_backward(descriptor_type &desc,
     auto plan = detail::get_bwd_plan(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         if (offsets[1] % 2 != 0) {
             throw oneapi::mkl::unimplemented(
                 "DFT", func_name,
@@ -156,7 +156,7 @@ ONEMKL_EXPORT sycl::event compute_backward(descriptor_type &desc, fwd<descriptor
     auto plan = detail::get_bwd_plan(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         offsets[0] *= 2; // offset is supplied in complex but we offset scalar pointer
         if (offsets[1] % 2 != 0) {
             throw oneapi::mkl::unimplemented(
@@ -200,7 +200,7 @@ ONEMKL_EXPORT sycl::event compute_backward(descriptor_type &desc, bwd<descriptor
     auto plan = detail::get_bwd_plan(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         if (offsets[1] % 2 != 0) {
             throw oneapi::mkl::unimplemented(
                 "DFT", func_name,
@@ -232,6 +232,10 @@ ONEMKL_EXPORT sycl::event compute_backward(descriptor_type &, scalar<descriptor_
 }
 
 // Template function instantiations
+#define ONEMKL_DFT_HALF_INSTANTIATIONS
+#define ONEMKL_DFT_BFLOAT16_INSTANTIATIONS
 #include "dft/backends/backend_backward_instantiations.cxx"
+#undef ONEMKL_DFT_BFLOAT16_INSTANTIATIONS
+#undef ONEMKL_DFT_HALF_INSTANTIATIONS
 
 } // namespace oneapi::mkl::dft::cufft
@@ -35,6 +35,7 @@
 #include "oneapi/mkl/dft/types.hpp"
 
 #include <cufft.h>
+#include <cufftXt.h>
 #include <cuda.h>
 
 namespace oneapi::mkl::dft::cufft {
@@ -96,8 +97,35 @@ public:
                 "dft/backends/cufft", __FUNCTION__,
                 "cuFFT does not support values other than 1 for FORWARD/BACKWARD_SCALE");
         }
+        if (config_values.workspace_placement != dft::config_value::WORKSPACE_AUTOMATIC) {
+            throw mkl::unimplemented("dft/backends/cufft", __FUNCTION__,
+                                     "cuFFT backend only supports automatic workspace placement");
+        }
+        if (config_values.transpose) {
+            throw mkl::unimplemented("dft/backends/cufft", __FUNCTION__,
+                                     "cuFFT backend does not support transposed output");
+        }
+        if (config_values.max_working_set_bytes != 0) {
+            throw mkl::unimplemented("dft/backends/cufft", __FUNCTION__,
+                                     "cuFFT backend does not support bounding the working set");
+        }
+        if (config_values.pruned_input_length != 0 || config_values.pruned_output_offset != 0 ||
+            config_values.pruned_output_length != 0) {
+            throw mkl::unimplemented("dft/backends/cufft", __FUNCTION__,
+                                     "cuFFT backend does not support pruned transforms");
+        }
+        if constexpr (dft::detail::is_16bit_precision<prec>) {
+            for (auto length : config_values.dimensions) {
+                if ((length & (length - 1)) != 0) {
+                    throw mkl::unimplemented(
+                        "dft/backends/cufft", __FUNCTION__,
+                        "cuFFT only supports HALF and BFLOAT16 transforms of power-of-two lengths");
+                }
+            }
+        }
 
         // The cudaStream for the plan is set at execution time so the interop handler can pick the stream.
+        // HALF and BFLOAT16 plans take their data types from make_plan instead of these.
         constexpr cufftType fwd_type = [] {
             if constexpr (dom == dft::domain::COMPLEX) {
                 if constexpr (prec == dft::precision::SINGLE) {
@@ -266,19 +294,21 @@ public:
 
         if (valid_forward) {
             cufftHandle fwd_plan;
-            auto res = cufftPlanMany(&fwd_plan, // plan
-                                     rank, // rank
-                                     n_copy.data(), // n
-                                     inembed.data(), // inembed
-                                     istride, // istride
-                                     fwd_dist, // idist
-                                     onembed.data(), // onembed
-                                     ostride, // ostride
-                                     bwd_dist, // odist
-                                     fwd_type, // type
-                                     batch // batch
+            auto res = make_plan(&fwd_plan, // plan
+                                 rank, // rank
+                                 n_copy.data(), // n
+                                 inembed.data(), // inembed
+                                 istride, // istride
+                                 fwd_dist, // idist
+                                 onembed.data(), // onembed
+                                 ostride, // ostride
+                                 bwd_dist, // odist
+                                 fwd_type, // type
+                                 batch, // batch
+                                 true // forward
             );
 
+            check_16bit_support(res);
             if (res != CUFFT_SUCCESS) {
                 throw mkl::exception("dft/backends/cufft", __FUNCTION__,
                                      "Failed to create forward cuFFT plan.");
@@ -291,18 +321,20 @@ public:
             cufftHandle bwd_plan;
 
             // flip fwd_distance and bwd_distance because cuFFt uses input distance and output distance.
-            auto res = cufftPlanMany(&bwd_plan, // plan
-                                     rank, // rank
-                                     n_copy.data(), // n
-                                     inembed.data(), // inembed
-                                     istride, // istride
-                                     bwd_dist, // idist
-                                     onembed.data(), // onembed
-                                     ostride, // ostride
-                                     fwd_dist, // odist
-                                     bwd_type, // type
-                                     batch // batch
+            auto res = make_plan(&bwd_plan, // plan
+                                 rank, // rank
+                                 n_copy.data(), // n
+                                 inembed.data(), // inembed
+                                 istride, // istride
+                                 bwd_dist, // idist
+                                 onembed.data(), // onembed
+                                 ostride, // ostride
+                                 fwd_dist, // odist
+                                 bwd_type, // type
+                                 batch, // batch
+                                 false // forward
             );
+            check_16bit_support(res);
             if (res != CUFFT_SUCCESS) {
                 throw mkl::exception("dft/backends/cufft", __FUNCTION__,
                                      "Failed to create backward cuFFT plan.");
@@ -311,6 +343,51 @@ public:
         }
     }
 
+    // HALF and BFLOAT16 plans are made through the cufftXt interface, which takes the data type
+    // of each side rather than a cufftType.
+    static cufftResult make_plan(cufftHandle* plan, int rank, int* n, int* inembed, int istride,
+                                 int idist, int* onembed, int ostride, int odist, cufftType type,
+                                 int batch, bool forward) {
+        if constexpr (dft::detail::is_16bit_precision<prec>) {
+            constexpr bool is_half = prec == dft::precision::HALF;
+            constexpr cudaDataType real_type = is_half ? CUDA_R_16F : CUDA_R_16BF;
+            constexpr cudaDataType complex_type = is_half ? CUDA_C_16F : CUDA_C_16BF;
+            constexpr bool is_real = dom == dft::domain::REAL;
+            const cudaDataType input_type = is_real && forward ? real_type : complex_type;
+            const cudaDataType output_type = is_real && !forward ? real_type : complex_type;
+
+            std::vector<long long> n_ll(n, n + rank);
+            std::vector<long long> inembed_ll(inembed, inembed + rank);
+            std::vector<long long> onembed_ll(onembed, onembed + rank);
+            auto res = cufftCreate(plan);
+            if (res != CUFFT_SUCCESS) {
+                return res;
+            }
+            std::size_t work_size;
+            res = cufftXtMakePlanMany(*plan, rank, n_ll.data(), inembed_ll.data(), istride, idist,
+                                      input_type, onembed_ll.data(), ostride, odist, output_type,
+                                      batch, &work_size, complex_type);
+            if (res != CUFFT_SUCCESS) {
+                cufftDestroy(*plan);
+            }
+            return res;
+        }
+        else {
+            return cufftPlanMany(plan, rank, n, inembed, istride, idist, onembed, ostride, odist,
+                                 type, batch);
+        }
+    }
+
+    // cuFFT needs compute capability 5.3 for HALF and 8.0 for BFLOAT16 transforms.
+    void check_16bit_support(cufftResult res) {
+        if constexpr (dft::detail::is_16bit_precision<prec>) {
+            if (res == CUFFT_NOT_SUPPORTED) {
+                throw mkl::unsupported_device("dft/backends/cufft", "commit",
+                                              this->get_queue().get_device());
+            }
+        }
+    }
+
     ~cufft_commit() override {
         clean_plans();
     }
@@ -332,7 +409,13 @@ public:
 template <dft::precision prec, dft::domain dom>
 dft::detail::commit_impl<prec, dom>* create_commit(const dft::detail::descriptor<prec, dom>& desc,
                                                    sycl::queue& sycl_queue) {
-    return new detail::cufft_commit<prec, dom>(sycl_queue, desc.get_values());
+    if constexpr (dom == dft::detail::domain::REAL_REAL) {
+        throw mkl::unimplemented("dft/backends/cufft", "create_commit",
+                                 "The real_real domain is only supported by the portable backend.");
+    }
+    else {
+        return new detail::cufft_commit<prec, dom>(sycl_queue, desc.get_values());
+    }
 }
 
 template dft::detail::commit_impl<dft::detail::precision::SINGLE, dft::detail::domain::REAL>*
@@ -351,6 +434,30 @@ template dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::d
 create_commit(
     const dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::COMPLEX>&,
     sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::SINGLE, dft::detail::domain::REAL_REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::SINGLE, dft::detail::domain::REAL_REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::domain::REAL_REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::REAL_REAL>&,
+    sycl::queue&);
 
 namespace detail {
 template <dft::precision prec, dft::domain dom>
@@ -369,6 +476,18 @@ get_offsets<dft::detail::precision::DOUBLE, dft::detail::domain::REAL>(
 template std::array<std::int64_t, 2>
 get_offsets<dft::detail::precision::DOUBLE, dft::detail::domain::COMPLEX>(
     dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::domain::COMPLEX>*);
+template std::array<std::int64_t, 2>
+get_offsets<dft::detail::precision::HALF, dft::detail::domain::REAL>(
+    dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::REAL>*);
+template std::array<std::int64_t, 2>
+get_offsets<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>(
+    dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>*);
+template std::array<std::int64_t, 2>
+get_offsets<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>(
+    dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>*);
+template std::array<std::int64_t, 2>
+get_offsets<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>(
+    dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>*);
 
 } //namespace detail
 
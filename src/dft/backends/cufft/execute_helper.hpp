@@ -33,6 +33,7 @@
 
 #include <cuda.h>
 #include <cufft.h>
+#include <cufftXt.h>
 
 namespace oneapi::mkl::dft::cufft::detail {
 
@@ -60,6 +61,20 @@ inline auto expect_config(DescT &desc, const char *message) {
 
 enum class Direction { Forward = CUFFT_FORWARD, Backward = CUFFT_INVERSE };
 
+/// Whether the forward domain data of descriptor_type is real. std::is_floating_point does not
+/// hold for the sycl::half and bfloat16 data of HALF and BFLOAT16 descriptors.
+template <typename descriptor_type>
+inline constexpr bool is_real_forward = std::is_same_v<
+    typename dft::detail::descriptor_info<descriptor_type>::forward_type,
+    typename dft::detail::descriptor_info<descriptor_type>::scalar_type>;
+
+/// Whether data of this type belongs to a HALF or BFLOAT16 transform, whose plans are made and
+/// executed through the cufftXt interface.
+template <typename T>
+inline constexpr bool is_16bit_data =
+    dft::detail::is_one_of<T, sycl::half, oneapi::mkl::bfloat16, dft::complex_half,
+                           dft::complex_bfloat16>::value;
+
 template <Direction dir, typename forward_data_type>
 void cufft_execute(const std::string &func, CUstream stream, cufftHandle plan, void *input,
                    void *output) {
@@ -67,7 +82,15 @@ void cufft_execute(const std::string &func, CUstream stream, cufftHandle plan, v
     using single_type = std::conditional_t<is_real, float, std::complex<float>>;
     constexpr bool is_single = std::is_same_v<forward_data_type, single_type>;
 
-    if constexpr (is_real) {
+    if constexpr (is_16bit_data<forward_data_type>) {
+        // The direction is ignored for real-complex plans, which have one.
+        auto result = cufftXtExec(plan, input, output, static_cast<int>(dir));
+        if (result != CUFFT_SUCCESS) {
+            throw oneapi::mkl::exception("dft/backends/cufft", func,
+                                         "cufftXtExec returned " + std::to_string(result));
+        }
+    }
+    else if constexpr (is_real) {
         if constexpr (dir == Direction::Forward) {
             if constexpr (is_single) {
                 auto result = cufftExecR2C(plan, reinterpret_cast<cufftReal *>(input),
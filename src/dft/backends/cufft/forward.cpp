@@ -61,7 +61,7 @@ ONEMKL_EXPORT void compute_forward(descriptor_type &desc,
     auto plan = detail::get_fwd_plan(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         if (offsets[0] % 2 != 0) {
             throw oneapi::mkl::unimplemented(
                 "DFT", func_name,
@@ -105,7 +105,7 @@ ONEMKL_EXPORT void compute_forward(descriptor_type &desc, sycl::buffer<fwd<descr
     auto plan = detail::get_fwd_plan(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         if (offsets[0] % 2 != 0) {
             throw oneapi::mkl::unimplemented(
                 "DFT", func_name,
@@ -158,7 +158,7 @@ ONEMKL_EXPORT sycl::event compute_forward(descriptor_type &desc, fwd<descriptor_
     auto plan = detail::get_fwd_plan(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         if (offsets[0] % 2 != 0) {
             throw oneapi::mkl::unimplemented(
                 "DFT", func_name,
@@ -202,7 +202,7 @@ ONEMKL_EXPORT sycl::event compute_forward(descriptor_type &desc, fwd<descriptor_
     auto plan = detail::get_fwd_plan(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         if (offsets[0] % 2 != 0) {
             throw oneapi::mkl::unimplemented(
                 "DFT", func_name,
@@ -234,6 +234,10 @@ ONEMKL_EXPORT sycl::event compute_forward(descriptor_type &, scalar<descriptor_t
 }
 
 // Template function instantiations
+#define ONEMKL_DFT_HALF_INSTANTIATIONS
+#define ONEMKL_DFT_BFLOAT16_INSTANTIATIONS
 #include "dft/backends/backend_forward_instantiations.cxx"
+#undef ONEMKL_DFT_BFLOAT16_INSTANTIATIONS
+#undef ONEMKL_DFT_HALF_INSTANTIATIONS
 
 } // namespace oneapi::mkl::dft::cufft
@@ -28,18 +28,43 @@ namespace dft {
 
 template <precision prec, domain dom>
 void descriptor<prec, dom>::commit(sycl::queue &queue) {
-    if (!pimpl_ || pimpl_->get_queue() != queue) {
-        if (pimpl_) {
-            pimpl_->get_queue().wait();
-        }
-        pimpl_.reset(detail::create_commit(*this, queue));
-    }
-    pimpl_->commit(values_);
+    commit_cached(queue, &detail::create_commit<prec, dom>);
 }
 template void descriptor<precision::SINGLE, domain::COMPLEX>::commit(sycl::queue &);
 template void descriptor<precision::SINGLE, domain::REAL>::commit(sycl::queue &);
 template void descriptor<precision::DOUBLE, domain::COMPLEX>::commit(sycl::queue &);
 template void descriptor<precision::DOUBLE, domain::REAL>::commit(sycl::queue &);
+template void descriptor<precision::HALF, domain::COMPLEX>::commit(sycl::queue &);
+template void descriptor<precision::HALF, domain::REAL>::commit(sycl::queue &);
+template void descriptor<precision::BFLOAT16, domain::COMPLEX>::commit(sycl::queue &);
+template void descriptor<precision::BFLOAT16, domain::REAL>::commit(sycl::queue &);
+template void descriptor<precision::SINGLE, domain::REAL_REAL>::commit(sycl::queue &);
+template void descriptor<precision::DOUBLE, domain::REAL_REAL>::commit(sycl::queue &);
+
+template <precision prec, domain dom>
+void descriptor<prec, dom>::commit(const std::vector<sycl::queue> &queues) {
+    commit_split(queues, &detail::create_commit<prec, dom>);
+}
+template void descriptor<precision::SINGLE, domain::COMPLEX>::commit(
+    const std::vector<sycl::queue> &);
+template void descriptor<precision::SINGLE, domain::REAL>::commit(
+    const std::vector<sycl::queue> &);
+template void descriptor<precision::DOUBLE, domain::COMPLEX>::commit(
+    const std::vector<sycl::queue> &);
+template void descriptor<precision::DOUBLE, domain::REAL>::commit(
+    const std::vector<sycl::queue> &);
+template void descriptor<precision::HALF, domain::COMPLEX>::commit(
+    const std::vector<sycl::queue> &);
+template void descriptor<precision::HALF, domain::REAL>::commit(
+    const std::vector<sycl::queue> &);
+template void descriptor<precision::BFLOAT16, domain::COMPLEX>::commit(
+    const std::vector<sycl::queue> &);
+template void descriptor<precision::BFLOAT16, domain::REAL>::commit(
+    const std::vector<sycl::queue> &);
+template void descriptor<precision::SINGLE, domain::REAL_REAL>::commit(
+    const std::vector<sycl::queue> &);
+template void descriptor<precision::DOUBLE, domain::REAL_REAL>::commit(
+    const std::vector<sycl::queue> &);
 
 } //namespace dft
 } //namespace mkl
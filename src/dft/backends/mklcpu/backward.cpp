@@ -54,6 +54,15 @@ inline void check_bwd_commit(dft::descriptor<prec, dom> &desc) {
         throw mkl::invalid_argument("DFT", "compute_backward",
                                     "MKLCPU DFT descriptor was not successfully committed.");
     }
+
+    // MKLCPU allocates its own workspace, but an external one is still required to be set.
+    dft::detail::config_value placement{ 0 };
+    desc.get_value(dft::detail::config_param::WORKSPACE_PLACEMENT, &placement);
+    if (placement == dft::detail::config_value::WORKSPACE_EXTERNAL &&
+        !dft::detail::get_workspace(desc).is_set) {
+        throw mkl::invalid_argument("DFT", "compute_backward",
+                                    "An external workspace must be set before computing.");
+    }
 }
 
 // Throw an mkl::invalid_argument if the runtime param in the descriptor does not match
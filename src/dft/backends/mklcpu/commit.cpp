@@ -150,15 +150,36 @@ void commit_derived_impl<prec, dom>::set_value(mklcpu_desc_t* descHandle,
             throw mkl::invalid_argument("dft/backends/mklcpu", "commit",
                                         "MKLCPU only supports workspace set to allow");
         }
-        // Setting the ordering causes an FFT_INVALID_DESCRIPTOR. Check that default is used:
+        if (config.max_working_set_bytes != 0) {
+            throw mkl::unimplemented("dft/backends/mklcpu", "commit",
+                                     "MKLCPU does not support bounding the working set.");
+        }
+        if (config.pruned_input_length != 0 || config.pruned_output_offset != 0 ||
+            config.pruned_output_length != 0) {
+            throw mkl::unimplemented("dft/backends/mklcpu", "commit",
+                                     "MKLCPU does not support pruned transforms.");
+        }
+        // MKL leaves the forward result of one-dimensional complex transforms scrambled, which
+        // skips its final reordering; the backward transform of the same descriptor takes the
+        // scrambled data. Other transforms cause an FFT_INVALID_DESCRIPTOR.
         if (config.ordering != dft::detail::config_value::ORDERED) {
-            throw mkl::invalid_argument("dft/backends/mklcpu", "commit",
-                                        "MKLCPU only supports ordered ordering.");
+            if (dom != dft::detail::domain::COMPLEX || config.dimensions.size() != 1) {
+                throw mkl::unimplemented("dft/backends/mklcpu", "commit",
+                                         "MKLCPU only supports BACKWARD_SCRAMBLED ordering for "
+                                         "one-dimensional complex transforms.");
+            }
+            set_value_item(descHandle[dir], DFTI_ORDERING,
+                           to_mklcpu<config_param::ORDERING>(config.ordering));
         }
-        // Setting the transpose causes an FFT_INVALID_DESCRIPTOR. Check that default is used:
-        if (config.transpose != false) {
-            throw mkl::invalid_argument("dft/backends/mklcpu", "commit",
-                                        "MKLCPU only supports non-transposed.");
+        // A transposed forward result of multi-dimensional complex transforms skips the final
+        // transposition of MKL, and the backward transform takes it transposed.
+        if (config.transpose) {
+            if (dom != dft::detail::domain::COMPLEX || config.dimensions.size() < 2) {
+                throw mkl::unimplemented("dft/backends/mklcpu", "commit",
+                                         "MKLCPU only supports transposed output for "
+                                         "multi-dimensional complex transforms.");
+            }
+            set_value_item(descHandle[dir], DFTI_TRANSPOSE, DFTI_ALLOW);
         }
     }
 }
@@ -167,7 +188,18 @@ void commit_derived_impl<prec, dom>::set_value(mklcpu_desc_t* descHandle,
 template <dft::detail::precision prec, dft::detail::domain dom>
 dft::detail::commit_impl<prec, dom>* create_commit(const dft::detail::descriptor<prec, dom>& desc,
                                                    sycl::queue& sycl_queue) {
-    return new detail::commit_derived_impl<prec, dom>(sycl_queue, desc.get_values());
+    if constexpr (dft::detail::is_16bit_precision<prec>) {
+        throw mkl::unimplemented("dft/backends/mklcpu", "create_commit",
+                                 "Half and bfloat16 precision are only supported by the portable, "
+                                 "cuFFT and rocFFT backends.");
+    }
+    else if constexpr (dom == dft::detail::domain::REAL_REAL) {
+        throw mkl::unimplemented("dft/backends/mklcpu", "create_commit",
+                                 "The real_real domain is only supported by the portable backend.");
+    }
+    else {
+        return new detail::commit_derived_impl<prec, dom>(sycl_queue, desc.get_values());
+    }
 }
 
 template dft::detail::commit_impl<dft::detail::precision::SINGLE, dft::detail::domain::REAL>*
@@ -186,6 +218,30 @@ template dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::d
 create_commit(
     const dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::COMPLEX>&,
     sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::SINGLE, dft::detail::domain::REAL_REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::SINGLE, dft::detail::domain::REAL_REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::domain::REAL_REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::REAL_REAL>&,
+    sycl::queue&);
 
 } // namespace mklcpu
 } // namespace dft
@@ -28,13 +28,7 @@ namespace dft {
 
 template <precision prec, domain dom>
 void descriptor<prec, dom>::commit(backend_selector<backend::mklcpu> selector) {
-    if (!pimpl_ || pimpl_->get_queue() != selector.get_queue()) {
-        if (pimpl_) {
-            pimpl_->get_queue().wait();
-        }
-        pimpl_.reset(mklcpu::create_commit(*this, selector.get_queue()));
-    }
-    pimpl_->commit(values_);
+    commit_cached(selector.get_queue(), &mklcpu::create_commit<prec, dom>);
 }
 
 template void descriptor<precision::SINGLE, domain::COMPLEX>::commit(
@@ -45,6 +39,18 @@ template void descriptor<precision::DOUBLE, domain::COMPLEX>::commit(
     backend_selector<backend::mklcpu>);
 template void descriptor<precision::DOUBLE, domain::REAL>::commit(
     backend_selector<backend::mklcpu>);
+template void descriptor<precision::HALF, domain::COMPLEX>::commit(
+    backend_selector<backend::mklcpu>);
+template void descriptor<precision::HALF, domain::REAL>::commit(
+    backend_selector<backend::mklcpu>);
+template void descriptor<precision::BFLOAT16, domain::COMPLEX>::commit(
+    backend_selector<backend::mklcpu>);
+template void descriptor<precision::BFLOAT16, domain::REAL>::commit(
+    backend_selector<backend::mklcpu>);
+template void descriptor<precision::SINGLE, domain::REAL_REAL>::commit(
+    backend_selector<backend::mklcpu>);
+template void descriptor<precision::DOUBLE, domain::REAL_REAL>::commit(
+    backend_selector<backend::mklcpu>);
 
 } //namespace dft
 } //namespace mkl
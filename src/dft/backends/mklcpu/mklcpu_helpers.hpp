@@ -154,6 +154,22 @@ inline constexpr int to_mklcpu<dft::detail::config_param::PLACEMENT>(
     }
 }
 
+template <>
+inline constexpr int to_mklcpu<dft::detail::config_param::ORDERING>(
+    dft::detail::config_value value) {
+    if (value == dft::detail::config_value::ORDERED) {
+        return DFTI_ORDERED;
+    }
+    else if (value == dft::detail::config_value::BACKWARD_SCRAMBLED) {
+        return DFTI_BACKWARD_SCRAMBLED;
+    }
+    else {
+        throw mkl::invalid_argument("dft", "MKLCPU descriptor set_value()",
+                                    "Invalid config value for ordering.");
+        return 0;
+    }
+}
+
 template <>
 inline constexpr int to_mklcpu<dft::detail::config_param::PACKED_FORMAT>(
     dft::detail::config_value value) {
@@ -124,15 +124,28 @@ private:
         desc.set_value(backend_param::FWD_DISTANCE, config.fwd_dist);
         desc.set_value(backend_param::BWD_DISTANCE, config.bwd_dist);
         // Setting the workspace causes an FFT_INVALID_DESCRIPTOR.
+        if (config.workspace_placement != dft::detail::config_value::WORKSPACE_AUTOMATIC) {
+            throw mkl::unimplemented("dft/backends/mklgpu", "commit",
+                                     "MKLGPU only supports automatic workspace placement.");
+        }
+        if (config.max_working_set_bytes != 0) {
+            throw mkl::unimplemented("dft/backends/mklgpu", "commit",
+                                     "MKLGPU does not support bounding the working set.");
+        }
+        if (config.pruned_input_length != 0 || config.pruned_output_offset != 0 ||
+            config.pruned_output_length != 0) {
+            throw mkl::unimplemented("dft/backends/mklgpu", "commit",
+                                     "MKLGPU does not support pruned transforms.");
+        }
         // Setting the ordering causes an FFT_INVALID_DESCRIPTOR. Check that default is used:
         if (config.ordering != dft::detail::config_value::ORDERED) {
-            throw mkl::invalid_argument("dft/backends/mklgpu", "commit",
-                                        "MKLGPU only supports ordered ordering.");
+            throw mkl::unimplemented("dft/backends/mklgpu", "commit",
+                                     "MKLGPU only supports ordered ordering.");
         }
         // Setting the transpose causes an FFT_INVALID_DESCRIPTOR. Check that default is used:
         if (config.transpose != false) {
-            throw mkl::invalid_argument("dft/backends/mklgpu", "commit",
-                                        "MKLGPU only supports non-transposed.");
+            throw mkl::unimplemented("dft/backends/mklgpu", "commit",
+                                     "MKLGPU only supports non-transposed.");
         }
     }
 };
@@ -141,7 +154,18 @@ private:
 template <dft::detail::precision prec, dft::detail::domain dom>
 dft::detail::commit_impl<prec, dom>* create_commit(const dft::detail::descriptor<prec, dom>& desc,
                                                    sycl::queue& sycl_queue) {
-    return new detail::mklgpu_commit<prec, dom>(sycl_queue, desc.get_values());
+    if constexpr (dft::detail::is_16bit_precision<prec>) {
+        throw mkl::unimplemented("dft/backends/mklgpu", "create_commit",
+                                 "Half and bfloat16 precision are only supported by the portable, "
+                                 "cuFFT and rocFFT backends.");
+    }
+    else if constexpr (dom == dft::detail::domain::REAL_REAL) {
+        throw mkl::unimplemented("dft/backends/mklgpu", "create_commit",
+                                 "The real_real domain is only supported by the portable backend.");
+    }
+    else {
+        return new detail::mklgpu_commit<prec, dom>(sycl_queue, desc.get_values());
+    }
 }
 
 template dft::detail::commit_impl<dft::detail::precision::SINGLE, dft::detail::domain::REAL>*
@@ -160,5 +184,29 @@ template dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::d
 create_commit(
     const dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::COMPLEX>&,
     sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::SINGLE, dft::detail::domain::REAL_REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::SINGLE, dft::detail::domain::REAL_REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::domain::REAL_REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::REAL_REAL>&,
+    sycl::queue&);
 
 } // namespace oneapi::mkl::dft::mklgpu
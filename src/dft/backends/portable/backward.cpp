@@ -0,0 +1,248 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/exceptions.hpp"
+
+#include "oneapi/mkl/dft/descriptor.hpp"
+#include "oneapi/mkl/dft/detail/portable/onemkl_dft_portable.hpp"
+#include "oneapi/mkl/dft/types.hpp"
+
+#include "dft/backends/portable/commit_derived_impl.hpp"
+
+namespace oneapi::mkl::dft::portable {
+
+//BUFFER version
+
+//In-place transform
+template <typename descriptor_type>
+ONEMKL_EXPORT void compute_backward(descriptor_type &desc,
+                                    sycl::buffer<fwd<descriptor_type>, 1> &inout) {
+    detail::expect_config<dft::detail::config_param::PLACEMENT, dft::detail::config_value::INPLACE>(
+        desc, "compute_backward", "Unexpected value for placement");
+    auto plan = detail::get_plan(desc, "compute_backward");
+    auto workspace = detail::checked_workspace(desc, "compute_backward");
+    auto &queue = dft::detail::get_commit(desc)->get_queue();
+
+    queue.submit([&](sycl::handler &cgh) {
+        auto inout_acc = inout.template get_access<sycl::access::mode::read_write>(cgh);
+        auto scratch = detail::bind_workspace(workspace, cgh);
+        detail::host_task<class host_kernel_inplace>(cgh, [=]() {
+            auto ptr = detail::acc_to_ptr(inout_acc);
+            plan->backward(detail::backward_view<descriptor_type>(ptr), detail::view(ptr),
+                           scratch.get());
+        });
+    });
+}
+
+//In-place transform, using config_param::COMPLEX_STORAGE=config_value::REAL_REAL data format
+template <typename descriptor_type>
+ONEMKL_EXPORT void compute_backward(descriptor_type &desc,
+                                    sycl::buffer<scalar<descriptor_type>, 1> &inout_re,
+                                    sycl::buffer<scalar<descriptor_type>, 1> &inout_im) {
+    detail::expect_complex_domain<descriptor_type>("compute_backward");
+    detail::expect_config<dft::detail::config_param::COMPLEX_STORAGE,
+                          dft::detail::config_value::REAL_REAL>(
+        desc, "compute_backward", "Unexpected value for complex storage");
+    detail::expect_config<dft::detail::config_param::PLACEMENT, dft::detail::config_value::INPLACE>(
+        desc, "compute_backward", "Unexpected value for placement");
+    auto plan = detail::get_plan(desc, "compute_backward");
+    auto workspace = detail::checked_workspace(desc, "compute_backward");
+    auto &queue = dft::detail::get_commit(desc)->get_queue();
+
+    queue.submit([&](sycl::handler &cgh) {
+        auto re_acc = inout_re.template get_access<sycl::access::mode::read_write>(cgh);
+        auto im_acc = inout_im.template get_access<sycl::access::mode::read_write>(cgh);
+        auto scratch = detail::bind_workspace(workspace, cgh);
+        detail::host_task<class host_kernel_split_inplace>(cgh, [=]() {
+            auto data = detail::view(detail::acc_to_ptr(re_acc), detail::acc_to_ptr(im_acc));
+            plan->backward(data, data, scratch.get());
+        });
+    });
+}
+
+//Out-of-place transform
+template <typename descriptor_type>
+ONEMKL_EXPORT void compute_backward(descriptor_type &desc,
+                                    sycl::buffer<bwd<descriptor_type>, 1> &in,
+                                    sycl::buffer<fwd<descriptor_type>, 1> &out) {
+    detail::expect_config<dft::detail::config_param::PLACEMENT,
+                          dft::detail::config_value::NOT_INPLACE>(desc, "compute_backward",
+                                                                  "Unexpected value for placement");
+    auto plan = detail::get_plan(desc, "compute_backward");
+    auto workspace = detail::checked_workspace(desc, "compute_backward");
+    auto &queue = dft::detail::get_commit(desc)->get_queue();
+
+    queue.submit([&](sycl::handler &cgh) {
+        auto in_acc = in.template get_access<sycl::access::mode::read>(cgh);
+        auto out_acc = out.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch = detail::bind_workspace(workspace, cgh);
+        detail::host_task<class host_kernel_outofplace>(cgh, [=]() {
+            auto in_ptr = const_cast<bwd<descriptor_type> *>(detail::acc_to_ptr(in_acc));
+            auto out_ptr = detail::acc_to_ptr(out_acc);
+            plan->backward(detail::view(in_ptr), detail::view(out_ptr), scratch.get());
+        });
+    });
+}
+
+//Out-of-place transform, using config_param::COMPLEX_STORAGE=config_value::REAL_REAL data format
+template <typename descriptor_type>
+ONEMKL_EXPORT void compute_backward(descriptor_type &desc,
+                                    sycl::buffer<scalar<descriptor_type>, 1> &in_re,
+                                    sycl::buffer<scalar<descriptor_type>, 1> &in_im,
+                                    sycl::buffer<scalar<descriptor_type>, 1> &out_re,
+                                    sycl::buffer<scalar<descriptor_type>, 1> &out_im) {
+    detail::expect_complex_domain<descriptor_type>("compute_backward");
+    detail::expect_config<dft::detail::config_param::COMPLEX_STORAGE,
+                          dft::detail::config_value::REAL_REAL>(
+        desc, "compute_backward", "Unexpected value for complex storage");
+    detail::expect_config<dft::detail::config_param::PLACEMENT,
+                          dft::detail::config_value::NOT_INPLACE>(desc, "compute_backward",
+                                                                  "Unexpected value for placement");
+    auto plan = detail::get_plan(desc, "compute_backward");
+    auto workspace = detail::checked_workspace(desc, "compute_backward");
+    auto &queue = dft::detail::get_commit(desc)->get_queue();
+
+    queue.submit([&](sycl::handler &cgh) {
+        auto inre_acc = in_re.template get_access<sycl::access::mode::read>(cgh);
+        auto inim_acc = in_im.template get_access<sycl::access::mode::read>(cgh);
+        auto outre_acc = out_re.template get_access<sycl::access::mode::write>(cgh);
+        auto outim_acc = out_im.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch = detail::bind_workspace(workspace, cgh);
+        detail::host_task<class host_kernel_split_outofplace>(cgh, [=]() {
+            auto inre_ptr = const_cast<scalar<descriptor_type> *>(detail::acc_to_ptr(inre_acc));
+            auto inim_ptr = const_cast<scalar<descriptor_type> *>(detail::acc_to_ptr(inim_acc));
+            auto out_data =
+                detail::view(detail::acc_to_ptr(outre_acc), detail::acc_to_ptr(outim_acc));
+            plan->backward(detail::view(inre_ptr, inim_ptr), out_data, scratch.get());
+        });
+    });
+}
+
+//USM version
+
+//In-place transform
+template <typename descriptor_type>
+ONEMKL_EXPORT sycl::event compute_backward(descriptor_type &desc, fwd<descriptor_type> *inout,
+                                           const std::vector<sycl::event> &dependencies) {
+    detail::expect_config<dft::detail::config_param::PLACEMENT, dft::detail::config_value::INPLACE>(
+        desc, "compute_backward", "Unexpected value for placement");
+    auto plan = detail::get_plan(desc, "compute_backward");
+    auto workspace = detail::checked_workspace(desc, "compute_backward");
+    auto &queue = dft::detail::get_commit(desc)->get_queue();
+
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto scratch = detail::bind_workspace(workspace, cgh);
+        detail::host_task<class host_usm_kernel_inplace>(cgh, [=]() {
+            plan->backward(detail::backward_view<descriptor_type>(inout), detail::view(inout),
+                           scratch.get());
+        });
+    });
+}
+
+//In-place transform, using config_param::COMPLEX_STORAGE=config_value::REAL_REAL data format
+template <typename descriptor_type>
+ONEMKL_EXPORT sycl::event compute_backward(descriptor_type &desc, scalar<descriptor_type> *inout_re,
+                                           scalar<descriptor_type> *inout_im,
+                                           const std::vector<sycl::event> &dependencies) {
+    detail::expect_complex_domain<descriptor_type>("compute_backward");
+    detail::expect_config<dft::detail::config_param::COMPLEX_STORAGE,
+                          dft::detail::config_value::REAL_REAL>(
+        desc, "compute_backward", "Unexpected value for complex storage");
+    detail::expect_config<dft::detail::config_param::PLACEMENT, dft::detail::config_value::INPLACE>(
+        desc, "compute_backward", "Unexpected value for placement");
+    auto plan = detail::get_plan(desc, "compute_backward");
+    auto workspace = detail::checked_workspace(desc, "compute_backward");
+    auto &queue = dft::detail::get_commit(desc)->get_queue();
+
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto scratch = detail::bind_workspace(workspace, cgh);
+        detail::host_task<class host_usm_kernel_split_inplace>(cgh, [=]() {
+            auto data = detail::view(inout_re, inout_im);
+            plan->backward(data, data, scratch.get());
+        });
+    });
+}
+
+//Out-of-place transform
+template <typename descriptor_type>
+ONEMKL_EXPORT sycl::event compute_backward(descriptor_type &desc, bwd<descriptor_type> *in,
+                                           fwd<descriptor_type> *out,
+                                           const std::vector<sycl::event> &dependencies) {
+    detail::expect_config<dft::detail::config_param::PLACEMENT,
+                          dft::detail::config_value::NOT_INPLACE>(desc, "compute_backward",
+                                                                  "Unexpected value for placement");
+    auto plan = detail::get_plan(desc, "compute_backward");
+    auto workspace = detail::checked_workspace(desc, "compute_backward");
+    auto &queue = dft::detail::get_commit(desc)->get_queue();
+
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto scratch = detail::bind_workspace(workspace, cgh);
+        detail::host_task<class host_usm_kernel_outofplace>(cgh, [=]() {
+            plan->backward(detail::view(in), detail::view(out), scratch.get());
+        });
+    });
+}
+
+//Out-of-place transform, using config_param::COMPLEX_STORAGE=config_value::REAL_REAL data format
+template <typename descriptor_type>
+ONEMKL_EXPORT sycl::event compute_backward(descriptor_type &desc, scalar<descriptor_type> *in_re,
+                                           scalar<descriptor_type> *in_im,
+                                           scalar<descriptor_type> *out_re,
+                                           scalar<descriptor_type> *out_im,
+                                           const std::vector<sycl::event> &dependencies) {
+    detail::expect_complex_domain<descriptor_type>("compute_backward");
+    detail::expect_config<dft::detail::config_param::COMPLEX_STORAGE,
+                          dft::detail::config_value::REAL_REAL>(
+        desc, "compute_backward", "Unexpected value for complex storage");
+    detail::expect_config<dft::detail::config_param::PLACEMENT,
+                          dft::detail::config_value::NOT_INPLACE>(desc, "compute_backward",
+                                                                  "Unexpected value for placement");
+    auto plan = detail::get_plan(desc, "compute_backward");
+    auto workspace = detail::checked_workspace(desc, "compute_backward");
+    auto &queue = dft::detail::get_commit(desc)->get_queue();
+
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto scratch = detail::bind_workspace(workspace, cgh);
+        detail::host_task<class host_usm_kernel_split_outofplace>(cgh, [=]() {
+            plan->backward(detail::view(in_re, in_im), detail::view(out_re, out_im), scratch.get());
+        });
+    });
+}
+
+// Template function instantiations, including the HALF and BFLOAT16 precisions and the
+// REAL_REAL domain
+#define ONEMKL_DFT_HALF_INSTANTIATIONS
+#define ONEMKL_DFT_BFLOAT16_INSTANTIATIONS
+#define ONEMKL_DFT_REAL_REAL_INSTANTIATIONS
+#include "dft/backends/backend_backward_instantiations.cxx"
+#undef ONEMKL_DFT_REAL_REAL_INSTANTIATIONS
+#undef ONEMKL_DFT_BFLOAT16_INSTANTIATIONS
+#undef ONEMKL_DFT_HALF_INSTANTIATIONS
+
+} // namespace oneapi::mkl::dft::portable
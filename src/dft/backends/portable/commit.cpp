@@ -0,0 +1,427 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+
+#include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/detail/backends.hpp"
+#include "oneapi/mkl/dft/types.hpp"
+#include "oneapi/mkl/dft/descriptor.hpp"
+
+#include "oneapi/mkl/dft/detail/portable/onemkl_dft_portable.hpp"
+
+#include "oneapi/mkl/dft/detail/commit_impl.hpp"
+
+#include "dft/backends/portable/commit_derived_impl.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace dft {
+namespace portable {
+namespace detail {
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+commit_derived_impl<prec, dom>::commit_derived_impl(
+    sycl::queue queue, const dft::detail::dft_values<prec, dom>& /*config_values*/)
+        : oneapi::mkl::dft::detail::commit_impl<prec, dom>(queue, backend::portable) {
+    if (!queue.get_device().is_cpu()) {
+        throw mkl::invalid_argument("dft/backends/portable", "create_commit",
+                                    "The portable backend only supports CPU devices.");
+    }
+}
+
+// The transform of a plan for the given domain and config_param::REAL_REAL_KIND.
+static real_real_kind to_real_real_kind(dft::detail::domain dom, dft::detail::config_value kind) {
+    if (dom != dft::detail::domain::REAL_REAL)
+        return real_real_kind::none;
+    switch (kind) {
+        case dft::detail::config_value::DCT_III: return real_real_kind::dct_iii;
+        case dft::detail::config_value::DST_II: return real_real_kind::dst_ii;
+        case dft::detail::config_value::DST_III: return real_real_kind::dst_iii;
+        default: return real_real_kind::dct_ii;
+    }
+}
+
+static tuning_level to_tuning_level(dft::detail::config_value level) {
+    switch (level) {
+        case dft::detail::config_value::TUNING_MEASURE: return tuning_level::measure;
+        case dft::detail::config_value::TUNING_EXHAUSTIVE: return tuning_level::exhaustive;
+        default: return tuning_level::none;
+    }
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+void commit_derived_impl<prec, dom>::commit(
+    const dft::detail::dft_values<prec, dom>& config_values) {
+    const auto rank = config_values.dimensions.size();
+    if (config_values.input_strides.size() != rank + 1 ||
+        config_values.output_strides.size() != rank + 1) {
+        throw mkl::invalid_argument("dft/backends/portable", "commit",
+                                    "Strides must have one more entry than the dimensions.");
+    }
+
+    // As for the other backends, the input and output strides describe the input and output of
+    // either direction, while the distances belong to the forward and backward domains.
+    typename plan_t::config cfg;
+    cfg.dimensions = config_values.dimensions;
+    cfg.real_domain = dom == dft::detail::domain::REAL;
+    cfg.real_real = to_real_real_kind(dom, config_values.real_real_kind);
+    cfg.number_of_transforms = config_values.number_of_transforms;
+    // BACKWARD_SCRAMBLED ordering needs nothing: the Stockham passes sort their results as they
+    // go, so the natural order is already the cheapest. A transposed backward domain applies the
+    // strides of the dimensions in reverse order.
+    auto backward_strides = [&](std::vector<std::int64_t> strides) {
+        if (config_values.transpose)
+            std::reverse(strides.begin() + 1, strides.end());
+        return strides;
+    };
+    cfg.forward_input = { config_values.input_strides, config_values.fwd_dist };
+    cfg.forward_output = { backward_strides(config_values.output_strides), config_values.bwd_dist };
+    cfg.backward_input = { backward_strides(config_values.input_strides), config_values.bwd_dist };
+    cfg.backward_output = { config_values.output_strides, config_values.fwd_dist };
+    cfg.fwd_scale = config_values.fwd_scale;
+    cfg.bwd_scale = config_values.bwd_scale;
+    cfg.in_place = config_values.placement == dft::detail::config_value::INPLACE;
+    cfg.max_working_set_bytes = config_values.max_working_set_bytes;
+    cfg.tuning = to_tuning_level(config_values.tuning_level);
+    cfg.pruned_input_length = config_values.pruned_input_length;
+    cfg.pruned_output_offset = config_values.pruned_output_offset;
+    cfg.pruned_output_length = config_values.pruned_output_length;
+
+    plan_ = std::make_shared<const plan_t>(std::move(cfg));
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+std::int64_t commit_derived_impl<prec, dom>::get_workspace_external_bytes() const {
+    return plan_ ? plan_->workspace_bytes() : 0;
+}
+
+// Throw if a convolution of signal_length elements with kernel_length elements, whose result
+// is written to out_size elements, cannot be computed with plan.
+template <typename plan_type>
+static void check_convolution(const plan_type& plan, std::int64_t signal_length,
+                              std::int64_t kernel_length, std::int64_t out_size) {
+    if (!plan) {
+        throw mkl::invalid_argument("DFT", "convolve",
+                                    "Portable DFT descriptor was not successfully committed.");
+    }
+    if (plan->real_real()) {
+        throw mkl::invalid_argument("DFT", "convolve",
+                                    "Convolution requires a real or complex domain descriptor.");
+    }
+    if (plan->streamed()) {
+        throw mkl::unimplemented("dft/backends/portable", "convolve",
+                                 "Convolution is not supported by streamed descriptors.");
+    }
+    if (plan->pruned()) {
+        throw mkl::unimplemented("dft/backends/portable", "convolve",
+                                 "Convolution is not supported by pruned descriptors.");
+    }
+    if (plan->dimensions().size() != 1) {
+        throw mkl::invalid_argument("DFT", "convolve",
+                                    "Convolution requires a one-dimensional descriptor.");
+    }
+    // The signal, kernel and output are single contiguous sequences, whatever the descriptor
+    // layout, so a layout they would not follow is rejected rather than ignored.
+    if (plan->number_of_transforms() != 1) {
+        throw mkl::invalid_argument("DFT", "convolve",
+                                    "Convolution requires NUMBER_OF_TRANSFORMS to be 1.");
+    }
+    if (!plan->unit_strides()) {
+        throw mkl::invalid_argument("DFT", "convolve",
+                                    "Convolution requires the default input and output strides.");
+    }
+    if (signal_length < 1 || kernel_length < 1) {
+        throw mkl::invalid_argument("DFT", "convolve",
+                                    "The signal and kernel must not be empty.");
+    }
+    if (kernel_length > plan->dimensions().front()) {
+        throw mkl::invalid_argument("DFT", "convolve",
+                                    "The kernel must not be longer than the descriptor.");
+    }
+    if (out_size < signal_length + kernel_length - 1) {
+        throw mkl::invalid_argument("DFT", "convolve",
+                                    "The output is smaller than the full result.");
+    }
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+void commit_derived_impl<prec, dom>::convolve(descriptor_type& /*desc*/,
+                                              dft::detail::convolution_kind kind,
+                                              sycl::buffer<fwd_type, 1>& signal,
+                                              sycl::buffer<fwd_type, 1>& kernel,
+                                              sycl::buffer<fwd_type, 1>& out) {
+    const auto signal_length = static_cast<std::int64_t>(signal.size());
+    const auto kernel_length = static_cast<std::int64_t>(kernel.size());
+    check_convolution(plan_, signal_length, kernel_length, static_cast<std::int64_t>(out.size()));
+    const bool correlate = kind == dft::detail::convolution_kind::CORRELATION;
+    auto plan = plan_;
+
+    this->get_queue().submit([&](sycl::handler& cgh) {
+        auto signal_acc = signal.template get_access<sycl::access::mode::read>(cgh);
+        auto kernel_acc = kernel.template get_access<sycl::access::mode::read>(cgh);
+        auto out_acc = out.template get_access<sycl::access::mode::write>(cgh);
+        host_task<class host_kernel_convolve>(cgh, [=]() {
+            auto signal_ptr = const_cast<fwd_type*>(acc_to_ptr(signal_acc));
+            auto kernel_ptr = const_cast<fwd_type*>(acc_to_ptr(kernel_acc));
+            plan->convolve(correlate, view(signal_ptr), signal_length, view(kernel_ptr),
+                           kernel_length, view(acc_to_ptr(out_acc)));
+        });
+    });
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+sycl::event commit_derived_impl<prec, dom>::convolve(
+    descriptor_type& /*desc*/, dft::detail::convolution_kind kind, const fwd_type* signal,
+    std::int64_t signal_length, const fwd_type* kernel, std::int64_t kernel_length, fwd_type* out,
+    const std::vector<sycl::event>& dependencies) {
+    check_convolution(plan_, signal_length, kernel_length, signal_length + kernel_length - 1);
+    const bool correlate = kind == dft::detail::convolution_kind::CORRELATION;
+    auto plan = plan_;
+
+    return this->get_queue().submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        host_task<class host_kernel_convolve_usm>(cgh, [=]() {
+            plan->convolve(correlate, view(const_cast<fwd_type*>(signal)), signal_length,
+                           view(const_cast<fwd_type*>(kernel)), kernel_length, view(out));
+        });
+    });
+}
+
+// Throw if the frames of a short-time transform, hop samples apart, cannot be computed with plan.
+template <dft::detail::domain dom, typename plan_type>
+static void check_stft(const plan_type& plan, const char* function, std::int64_t hop) {
+    if (!plan) {
+        throw mkl::invalid_argument("DFT", function,
+                                    "Portable DFT descriptor was not successfully committed.");
+    }
+    if (dom != dft::detail::domain::REAL || plan->dimensions().size() != 1) {
+        throw mkl::invalid_argument(
+            "DFT", function,
+            "The short-time Fourier transform requires a one-dimensional REAL domain descriptor.");
+    }
+    if (plan->pruned()) {
+        throw mkl::unimplemented("dft/backends/portable", function,
+                                 "The short-time Fourier transform is not supported by pruned "
+                                 "descriptors.");
+    }
+    if (hop < 1) {
+        throw mkl::invalid_argument("DFT", function, "The hop size must be positive.");
+    }
+}
+
+// The number of frames of the plan's length, hop samples apart, within signal_length samples.
+template <typename plan_type>
+static std::int64_t stft_frames(const plan_type& plan, std::int64_t signal_length,
+                                std::int64_t hop) {
+    const std::int64_t length = plan->dimensions().front();
+    if (signal_length < length) {
+        throw mkl::invalid_argument("DFT", "stft", "The signal is shorter than one frame.");
+    }
+    return (signal_length - length) / hop + 1;
+}
+
+template <typename plan_type>
+static void check_istft(const plan_type& plan, std::int64_t frames, std::int64_t hop) {
+    if (frames < 1) {
+        throw mkl::invalid_argument("DFT", "istft", "There must be at least one frame.");
+    }
+    if (hop > plan->dimensions().front()) {
+        throw mkl::invalid_argument("DFT", "istft",
+                                    "The hop size must not exceed the frame length.");
+    }
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+void commit_derived_impl<prec, dom>::stft(descriptor_type& /*desc*/,
+                                          sycl::buffer<fwd_type, 1>& signal,
+                                          sycl::buffer<fwd_type, 1>& window, std::int64_t hop,
+                                          sycl::buffer<bwd_type, 1>& out) {
+    check_stft<dom>(plan_, "stft", hop);
+    if constexpr (dom == dft::detail::domain::REAL) {
+        const std::int64_t length = plan_->dimensions().front();
+        const std::int64_t frames =
+            stft_frames(plan_, static_cast<std::int64_t>(signal.size()), hop);
+        if (static_cast<std::int64_t>(window.size()) < length) {
+            throw mkl::invalid_argument("DFT", "stft", "The window is shorter than one frame.");
+        }
+        if (static_cast<std::int64_t>(out.size()) < frames * (length / 2 + 1)) {
+            throw mkl::invalid_argument("DFT", "stft",
+                                        "The output is smaller than the spectra of the frames.");
+        }
+        auto plan = plan_;
+
+        this->get_queue().submit([&](sycl::handler& cgh) {
+            auto signal_acc = signal.template get_access<sycl::access::mode::read>(cgh);
+            auto window_acc = window.template get_access<sycl::access::mode::read>(cgh);
+            auto out_acc = out.template get_access<sycl::access::mode::write>(cgh);
+            host_task<class host_kernel_stft>(cgh, [=]() {
+                plan->stft(view(const_cast<fwd_type*>(acc_to_ptr(signal_acc))), frames,
+                           view(const_cast<fwd_type*>(acc_to_ptr(window_acc))), hop,
+                           view(acc_to_ptr(out_acc)));
+            });
+        });
+    }
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+sycl::event commit_derived_impl<prec, dom>::stft(descriptor_type& /*desc*/,
+                                                 const fwd_type* signal,
+                                                 std::int64_t signal_length,
+                                                 const fwd_type* window, std::int64_t hop,
+                                                 bwd_type* out,
+                                                 const std::vector<sycl::event>& dependencies) {
+    check_stft<dom>(plan_, "stft", hop);
+    if constexpr (dom == dft::detail::domain::REAL) {
+        const std::int64_t frames = stft_frames(plan_, signal_length, hop);
+        auto plan = plan_;
+
+        return this->get_queue().submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            host_task<class host_kernel_stft_usm>(cgh, [=]() {
+                plan->stft(view(const_cast<fwd_type*>(signal)), frames,
+                           view(const_cast<fwd_type*>(window)), hop, view(out));
+            });
+        });
+    }
+    else {
+        return {};
+    }
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+void commit_derived_impl<prec, dom>::istft(descriptor_type& /*desc*/,
+                                           sycl::buffer<bwd_type, 1>& spectra,
+                                           sycl::buffer<fwd_type, 1>& window, std::int64_t hop,
+                                           sycl::buffer<fwd_type, 1>& out) {
+    check_stft<dom>(plan_, "istft", hop);
+    if constexpr (dom == dft::detail::domain::REAL) {
+        const std::int64_t length = plan_->dimensions().front();
+        const std::int64_t frames = static_cast<std::int64_t>(spectra.size()) / (length / 2 + 1);
+        check_istft(plan_, frames, hop);
+        if (static_cast<std::int64_t>(window.size()) < length) {
+            throw mkl::invalid_argument("DFT", "istft", "The window is shorter than one frame.");
+        }
+        if (static_cast<std::int64_t>(out.size()) < (frames - 1) * hop + length) {
+            throw mkl::invalid_argument("DFT", "istft",
+                                        "The output is shorter than the overlap-added frames.");
+        }
+        auto plan = plan_;
+
+        this->get_queue().submit([&](sycl::handler& cgh) {
+            auto spectra_acc = spectra.template get_access<sycl::access::mode::read>(cgh);
+            auto window_acc = window.template get_access<sycl::access::mode::read>(cgh);
+            auto out_acc = out.template get_access<sycl::access::mode::write>(cgh);
+            host_task<class host_kernel_istft>(cgh, [=]() {
+                plan->istft(view(const_cast<bwd_type*>(acc_to_ptr(spectra_acc))), frames,
+                            view(const_cast<fwd_type*>(acc_to_ptr(window_acc))), hop,
+                            view(acc_to_ptr(out_acc)));
+            });
+        });
+    }
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+sycl::event commit_derived_impl<prec, dom>::istft(descriptor_type& /*desc*/,
+                                                  const bwd_type* spectra, std::int64_t frames,
+                                                  const fwd_type* window, std::int64_t hop,
+                                                  fwd_type* out,
+                                                  const std::vector<sycl::event>& dependencies) {
+    check_stft<dom>(plan_, "istft", hop);
+    if constexpr (dom == dft::detail::domain::REAL) {
+        check_istft(plan_, frames, hop);
+        auto plan = plan_;
+
+        return this->get_queue().submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            host_task<class host_kernel_istft_usm>(cgh, [=]() {
+                plan->istft(view(const_cast<bwd_type*>(spectra)), frames,
+                            view(const_cast<fwd_type*>(window)), hop, view(out));
+            });
+        });
+    }
+    else {
+        return {};
+    }
+}
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+void* commit_derived_impl<prec, dom>::get_handle() noexcept {
+    return const_cast<plan_t*>(plan_.get());
+}
+
+} // namespace detail
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+dft::detail::commit_impl<prec, dom>* create_commit(const dft::detail::descriptor<prec, dom>& desc,
+                                                   sycl::queue& sycl_queue) {
+    return new detail::commit_derived_impl<prec, dom>(sycl_queue, desc.get_values());
+}
+
+template dft::detail::commit_impl<dft::detail::precision::SINGLE, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::SINGLE, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::SINGLE, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::SINGLE, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::SINGLE, dft::detail::domain::REAL_REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::SINGLE, dft::detail::domain::REAL_REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::domain::REAL_REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::REAL_REAL>&,
+    sycl::queue&);
+
+} // namespace portable
+} // namespace dft
+} // namespace mkl
+} // namespace oneapi
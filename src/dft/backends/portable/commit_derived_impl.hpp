@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_PORTABLE_COMMIT_DERIVED_IMPL_HPP_
+#define _ONEMKL_DFT_PORTABLE_COMMIT_DERIVED_IMPL_HPP_
+
+#include <memory>
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/detail/backends.hpp"
+#include "oneapi/mkl/dft/detail/commit_impl.hpp"
+#include "oneapi/mkl/dft/detail/types_impl.hpp"
+
+#include "dft/backends/portable/plan.hpp"
+#include "dft/backends/portable/portable_helpers.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace dft {
+namespace portable {
+namespace detail {
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+class commit_derived_impl final : public dft::detail::commit_impl<prec, dom> {
+public:
+    using plan_t = plan<typename dft::detail::precision_t<prec>::real_t>;
+
+    commit_derived_impl(sycl::queue queue, const dft::detail::dft_values<prec, dom>& config_values);
+
+    virtual void commit(const dft::detail::dft_values<prec, dom>& config_values) override;
+
+    virtual void* get_handle() noexcept override;
+
+    virtual std::int64_t get_workspace_external_bytes() const override;
+
+    virtual ~commit_derived_impl() override = default;
+
+    // Compute calls hold a reference to the plan until their host task has run, so recommitting
+    // or destroying the descriptor does not wait for them.
+    std::shared_ptr<const plan_t> get_plan() const noexcept {
+        return plan_;
+    }
+
+#define BACKEND portable
+#include "../backend_compute_signature.cxx"
+#undef BACKEND
+
+    virtual void convolve(descriptor_type& desc, dft::detail::convolution_kind kind,
+                          sycl::buffer<fwd_type, 1>& signal, sycl::buffer<fwd_type, 1>& kernel,
+                          sycl::buffer<fwd_type, 1>& out) override;
+
+    virtual sycl::event convolve(descriptor_type& desc, dft::detail::convolution_kind kind,
+                                 const fwd_type* signal, std::int64_t signal_length,
+                                 const fwd_type* kernel, std::int64_t kernel_length, fwd_type* out,
+                                 const std::vector<sycl::event>& dependencies) override;
+
+    virtual void stft(descriptor_type& desc, sycl::buffer<fwd_type, 1>& signal,
+                      sycl::buffer<fwd_type, 1>& window, std::int64_t hop,
+                      sycl::buffer<bwd_type, 1>& out) override;
+
+    virtual sycl::event stft(descriptor_type& desc, const fwd_type* signal,
+                             std::int64_t signal_length, const fwd_type* window, std::int64_t hop,
+                             bwd_type* out, const std::vector<sycl::event>& dependencies) override;
+
+    virtual void istft(descriptor_type& desc, sycl::buffer<bwd_type, 1>& spectra,
+                       sycl::buffer<fwd_type, 1>& window, std::int64_t hop,
+                       sycl::buffer<fwd_type, 1>& out) override;
+
+    virtual sycl::event istft(descriptor_type& desc, const bwd_type* spectra, std::int64_t frames,
+                              const fwd_type* window, std::int64_t hop, fwd_type* out,
+                              const std::vector<sycl::event>& dependencies) override;
+
+private:
+    std::shared_ptr<const plan_t> plan_;
+};
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+using commit_t = dft::detail::commit_impl<prec, dom>;
+
+template <dft::detail::precision prec, dft::detail::domain dom>
+using commit_derived_t = detail::commit_derived_impl<prec, dom>;
+
+// Return the plan of a descriptor committed to the portable backend.
+template <dft::detail::precision prec, dft::detail::domain dom>
+inline auto get_plan(dft::detail::descriptor<prec, dom>& desc, const char* function) {
+    auto commit_handle = dft::detail::get_commit(desc);
+    if (commit_handle == nullptr || commit_handle->get_backend() != backend::portable) {
+        throw mkl::invalid_argument(
+            "DFT", function, "DFT descriptor has not been commited for the portable backend");
+    }
+    auto plan = static_cast<commit_derived_t<prec, dom>*>(commit_handle)->get_plan();
+    if (!plan) {
+        throw mkl::invalid_argument("DFT", function,
+                                    "Portable DFT descriptor was not successfully committed.");
+    }
+    return plan;
+}
+
+} // namespace detail
+} // namespace portable
+} // namespace dft
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _ONEMKL_DFT_PORTABLE_COMMIT_DERIVED_IMPL_HPP_
@@ -0,0 +1,1359 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_SRC_PORTABLE_PLAN_HPP_
+#define _ONEMKL_DFT_SRC_PORTABLE_PLAN_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "oneapi/mkl/dft/detail/types_impl.hpp"
+#include "oneapi/mkl/exceptions.hpp"
+
+#include "dft/backends/portable/stockham.hpp"
+#include "dft/backends/portable/thread_pool.hpp"
+#include "dft/backends/portable/tuning.hpp"
+
+namespace oneapi::mkl::dft::portable::detail {
+
+// Element accessors for the data layouts a transform can read and write. Indices are in units
+// of the accessed element type, as are the strides and distances of the descriptor. T is the type
+// the transform computes in and S the type of the stored data, which is converted on each load
+// and store when it is a 16-bit type.
+template <typename T, typename S = T>
+struct real_view {
+    S* data;
+    T load(std::int64_t i) const {
+        return static_cast<T>(data[i]);
+    }
+    void store(std::int64_t i, T v) const {
+        data[i] = static_cast<S>(v);
+    }
+};
+
+template <typename T, typename S = T>
+struct interleaved_view {
+    dft::detail::complex_t<S>* data;
+    std::complex<T> load(std::int64_t i) const {
+        if constexpr (std::is_same_v<T, S>) {
+            return data[i];
+        }
+        else {
+            return { static_cast<T>(data[i].real()), static_cast<T>(data[i].imag()) };
+        }
+    }
+    void store(std::int64_t i, std::complex<T> v) const {
+        if constexpr (std::is_same_v<T, S>) {
+            data[i] = v;
+        }
+        else {
+            data[i] = { static_cast<S>(v.real()), static_cast<S>(v.imag()) };
+        }
+    }
+};
+
+template <typename T, typename S = T>
+struct split_view {
+    S* re;
+    S* im;
+    std::complex<T> load(std::int64_t i) const {
+        return { static_cast<T>(re[i]), static_cast<T>(im[i]) };
+    }
+    void store(std::int64_t i, std::complex<T> v) const {
+        re[i] = static_cast<S>(v.real());
+        im[i] = static_cast<S>(v.imag());
+    }
+};
+
+template <typename View>
+struct is_real_view : std::false_type {};
+template <typename T, typename S>
+struct is_real_view<real_view<T, S>> : std::true_type {};
+
+// The transform of a REAL_REAL domain plan in the forward direction, or none for the other
+// domains. The backward direction computes the inverse kind.
+enum class real_real_kind { none, dct_ii, dct_iii, dst_ii, dst_iii };
+
+inline real_real_kind inverse_kind(real_real_kind kind) {
+    switch (kind) {
+        case real_real_kind::dct_ii: return real_real_kind::dct_iii;
+        case real_real_kind::dct_iii: return real_real_kind::dct_ii;
+        case real_real_kind::dst_ii: return real_real_kind::dst_iii;
+        case real_real_kind::dst_iii: return real_real_kind::dst_ii;
+        default: return kind;
+    }
+}
+
+// Position of the data of one side of a transform: strides[0] is the offset and strides[1..d]
+// the stride of each dimension, as in config_param::INPUT_STRIDES.
+struct data_layout {
+    std::vector<std::int64_t> strides;
+    std::int64_t distance;
+};
+
+inline std::int64_t hardware_threads() {
+    return std::max<std::int64_t>(static_cast<std::int64_t>(std::thread::hardware_concurrency()),
+                                  1);
+}
+
+// Run body(thread, begin, end) over [0, count) split into at most max_threads chunks run by the
+// thread pool, thread being the index of the chunk in [0, max_threads). Work that is too small to
+// amortize waking the workers runs on the calling thread, as thread 0.
+template <typename F>
+void parallel_for(std::int64_t count, std::int64_t work_per_item, std::int64_t max_threads,
+                  F body) {
+    constexpr std::int64_t min_work_per_thread = std::int64_t{ 1 } << 15;
+    const std::int64_t threads =
+        std::min({ max_threads, count,
+                   std::max<std::int64_t>(count * work_per_item / min_work_per_thread, 1) });
+    if (threads <= 1) {
+        body(std::int64_t{ 0 }, std::int64_t{ 0 }, count);
+        return;
+    }
+    const std::int64_t chunk = (count + threads - 1) / threads;
+    const std::int64_t chunks = (count + chunk - 1) / chunk;
+    std::vector<std::exception_ptr> errors(static_cast<std::size_t>(chunks));
+    auto task = [&](std::int64_t t) {
+        try {
+            body(t, t * chunk, std::min(count, (t + 1) * chunk));
+        }
+        catch (...) {
+            errors[t] = std::current_exception();
+        }
+    };
+    thread_pool::run(chunks, task);
+    for (auto& error : errors)
+        if (error)
+            std::rethrow_exception(error);
+}
+
+// A committed transform: the one-dimensional plans of every dimension together with the data
+// layout, batch and scale configuration of the descriptor.
+//
+// Each transform of a batch is gathered into a contiguous row-major work array, transformed one
+// dimension at a time and scattered to the output. Reading the whole input before writing any
+// output makes in-place transforms independent of the strides. Batches are spread across
+// threads; a single large multi-dimensional transform spreads the lines of each dimension
+// instead.
+//
+// The scratch memory of a call is one block of workspace_bytes() bytes, either allocated by the
+// call or provided by the caller as an external workspace.
+//
+// REAL_REAL plans transform real work arrays with a cosine or sine transform along each dimension.
+// Each line of length n is computed with one real-to-complex transform of length n (Makhoul): the
+// even samples followed by the odd ones in reverse order have a spectrum V with
+//   DCT-II(x)[k] = 2 * Re(exp(-i*pi*k/2n) * V[k]),
+// whose inverse gives the DCT-III. The sine transforms are cosine transforms of the data with
+// alternating signs and in reverse order.
+//
+// Tuned plans measure the factorizations of each one-dimensional transform and, at
+// TUNING_EXHAUSTIVE, the number of lines gathered at a time from strided dimensions. Both choices
+// are recorded as wisdom.
+//
+// A one-dimensional complex transform whose copy would not fit in max_working_set_bytes is
+// streamed instead, with the four-step algorithm for length = n1 * n2: n2 column transforms of
+// length n1, a twiddle multiply, and n1 row transforms of length n2 whose results are the
+// output, transposed. Both passes move tiles of lines between the data and two scratch buffers,
+// loading the next tile while the current one is transformed, so the data may be larger than
+// memory, e.g. a memory-mapped file.
+//
+// A pruned one-dimensional transform of length n = p * m that reads the first K inputs and writes
+// a window of L outputs is computed the cheapest of three ways:
+// - when K <= m, each residue class k = k1 (mod p) of outputs that meets the window is a
+//   transform of length m of the inputs multiplied by exp(-2*pi*i*j*k1/n);
+// - when L <= m, the p decimated input sequences j = j1 (mod p) are transformed with length m and
+//   each output of the window sums their values at k (mod m) times exp(-2*pi*i*j1*k/n);
+// - or directly, with K * L terms.
+template <typename T>
+class plan {
+public:
+    using complex_t = std::complex<T>;
+
+    struct config {
+        std::vector<std::int64_t> dimensions;
+        bool real_domain;
+        real_real_kind real_real;
+        std::int64_t number_of_transforms;
+        data_layout forward_input, forward_output;
+        data_layout backward_input, backward_output;
+        T fwd_scale, bwd_scale;
+        bool in_place;
+        // 0 for no bound.
+        std::int64_t max_working_set_bytes;
+        tuning_level tuning;
+        // Lengths of 0 extend to the end of the transform.
+        std::int64_t pruned_input_length, pruned_output_offset, pruned_output_length;
+    };
+
+    explicit plan(config cfg) : cfg_(std::move(cfg)) {
+        const auto& dims = cfg_.dimensions;
+        shape_ = dims;
+        if (cfg_.real_domain) {
+            real_fft_ = real_fft<T>(dims.back(), radices(real_fft<T>::complex_size(dims.back())));
+            shape_.back() = dims.back() / 2 + 1;
+        }
+        size_ = 1;
+        for (auto n : shape_)
+            size_ *= n;
+        // Real work arrays take half the space.
+        data_size_ = real_real() ? (size_ + 1) / 2 : size_;
+        threads_ = hardware_threads();
+        if (cfg_.pruned_input_length != 0 || cfg_.pruned_output_offset != 0 ||
+            cfg_.pruned_output_length != 0) {
+            init_pruning();
+            return;
+        }
+        if (cfg_.max_working_set_bytes > 0 &&
+            2 * size_ * static_cast<std::int64_t>(sizeof(complex_t)) > cfg_.max_working_set_bytes) {
+            init_streaming();
+            return;
+        }
+        if (real_real()) {
+            init_real_real();
+        }
+        else {
+            const std::size_t complex_rank = shape_.size() - (cfg_.real_domain ? 1 : 0);
+            max_work_ = cfg_.real_domain ? real_fft_.work_size() : 0;
+            for (std::size_t axis = 0; axis < complex_rank; ++axis) {
+                ffts_.emplace_back(shape_[axis], radices(shape_[axis]));
+                max_work_ = std::max(max_work_, ffts_.back().work_size());
+            }
+
+            // Only dimensions other than the last one are strided in the work array.
+            std::int64_t longest = 0;
+            for (std::size_t axis = 0; axis + 1 < shape_.size() && axis < ffts_.size(); ++axis)
+                longest = std::max(longest, ffts_[axis].size());
+            line_block_ = tuned_line_block(longest);
+            lines_size_ = 2 * longest * line_block_;
+            real_line_size_ = cfg_.real_domain ? (cfg_.dimensions.back() + 1) / 2 : 0;
+        }
+        // A thread transforming whole batches needs every array, while the threads sharing the
+        // dimensions of a single transform only need their own lines.
+        const std::int64_t full = data_size_ + lines_size_ + max_work_ + real_line_size_;
+        auto workspace_size = [&]() {
+            if (cfg_.number_of_transforms == 1)
+                return full + (threads_ - 1) * (lines_size_ + max_work_);
+            return std::min(threads_, cfg_.number_of_transforms) * full;
+        };
+        workspace_size_ = workspace_size();
+        if (cfg_.max_working_set_bytes > 0) {
+            // Fewer threads need less scratch memory, and streaming less still.
+            while (threads_ > 1 && workspace_bytes() > cfg_.max_working_set_bytes) {
+                --threads_;
+                workspace_size_ = workspace_size();
+            }
+            if (workspace_bytes() > cfg_.max_working_set_bytes) {
+                ffts_.clear();
+                real_fft_ = real_fft<T>();
+                real_real_axes_.clear();
+                init_streaming();
+            }
+        }
+    }
+
+    bool real_domain() const noexcept {
+        return cfg_.real_domain;
+    }
+
+    bool real_real() const noexcept {
+        return cfg_.real_real != real_real_kind::none;
+    }
+
+    const std::vector<std::int64_t>& dimensions() const noexcept {
+        return cfg_.dimensions;
+    }
+
+    bool streamed() const noexcept {
+        return four_step_.has_value();
+    }
+
+    bool pruned() const noexcept {
+        return pruning_.has_value();
+    }
+
+    std::int64_t number_of_transforms() const noexcept {
+        return cfg_.number_of_transforms;
+    }
+
+    // Whether the data of both directions starts at offset 0 with unit stride, as for the default
+    // strides of a one-dimensional descriptor.
+    bool unit_strides() const {
+        const std::vector<std::int64_t> unit{ 0, 1 };
+        return cfg_.forward_input.strides == unit && cfg_.forward_output.strides == unit &&
+               cfg_.backward_input.strides == unit && cfg_.backward_output.strides == unit;
+    }
+
+    std::int64_t workspace_bytes() const noexcept {
+        return workspace_size_ * static_cast<std::int64_t>(sizeof(complex_t));
+    }
+
+    // external is either null or an external workspace of at least workspace_bytes() bytes.
+    template <typename In, typename Out>
+    void forward(In in, Out out, T* external = nullptr) const {
+        run<false>(in, out, cfg_.forward_input, cfg_.forward_output, cfg_.fwd_scale, external);
+    }
+
+    template <typename In, typename Out>
+    void backward(In in, Out out, T* external = nullptr) const {
+        run<true>(in, out, cfg_.backward_input, cfg_.backward_output, cfg_.bwd_scale, external);
+    }
+
+    // Linear convolution of signal with kernel, or their correlation, by overlap-save with the
+    // length of a one-dimensional plan as the block size: out receives the signal_length +
+    // kernel_length - 1 elements of the full result. Each block is transformed, multiplied by the
+    // kernel spectrum, which also carries the 1 / length scaling, and transformed back in the
+    // scratch memory of its thread, so the spectrum of the whole signal is never stored.
+    template <typename In, typename Out>
+    void convolve(bool correlate, In signal, std::int64_t signal_length, In kernel,
+                  std::int64_t kernel_length, Out out) const {
+        const std::int64_t length = cfg_.dimensions.front();
+        const std::int64_t spectrum_size = shape_.front();
+        const std::int64_t out_length = signal_length + kernel_length - 1;
+        const std::int64_t step = length - kernel_length + 1;
+        const std::int64_t blocks = (out_length + step - 1) / step;
+        const std::int64_t threads = std::min(threads_, blocks);
+        const std::int64_t per_thread = spectrum_size + max_work_ + real_line_size_;
+        std::unique_ptr<complex_t[]> scratch(
+            new complex_t[static_cast<std::size_t>(spectrum_size + threads * per_thread)]);
+        complex_t* kernel_spectrum = scratch.get();
+
+        auto thread_workspace = [&](std::int64_t thread) {
+            complex_t* p = scratch.get() + spectrum_size + thread * per_thread;
+            return workspace{ nullptr, p, p + spectrum_size,
+                              reinterpret_cast<T*>(p + spectrum_size + max_work_) };
+        };
+        // Transform the block load(0), ..., load(length - 1) into ws.lines.
+        auto forward_block = [&](const workspace& ws, auto load) {
+            if constexpr (is_real_view<In>::value) {
+                for (std::int64_t j = 0; j < length; ++j)
+                    ws.real_line[j] = load(j);
+                real_fft_.forward(ws.real_line, ws.lines, ws.work);
+            }
+            else {
+                for (std::int64_t j = 0; j < length; ++j)
+                    ws.lines[j] = load(j);
+                ffts_.front().template execute<false>(ws.lines, ws.work);
+            }
+        };
+
+        // The kernel of a correlation is conjugated and reversed.
+        const workspace kernel_ws = thread_workspace(0);
+        forward_block(kernel_ws, [&](std::int64_t j) {
+            using value_t = decltype(kernel.load(0));
+            if (j >= kernel_length)
+                return value_t(0);
+            if (!correlate)
+                return kernel.load(j);
+            if constexpr (is_real_view<In>::value)
+                return kernel.load(kernel_length - 1 - j);
+            else
+                return std::conj(kernel.load(kernel_length - 1 - j));
+        });
+        const T inverse_length = T(1) / static_cast<T>(length);
+        for (std::int64_t k = 0; k < spectrum_size; ++k)
+            kernel_spectrum[k] = kernel_ws.lines[k] * inverse_length;
+
+        parallel_for(blocks, length * 8, threads,
+                     [&](std::int64_t thread, std::int64_t begin, std::int64_t end) {
+                         const workspace ws = thread_workspace(thread);
+                         for (std::int64_t b = begin; b < end; ++b) {
+                             // Block b covers the signal from start and yields the outputs
+                             // start + kernel_length - 1 onwards, which it has in full.
+                             const std::int64_t start = b * step - (kernel_length - 1);
+                             forward_block(ws, [&](std::int64_t j) {
+                                 using value_t = decltype(signal.load(0));
+                                 const std::int64_t i = start + j;
+                                 return i < 0 || i >= signal_length ? value_t(0) : signal.load(i);
+                             });
+                             for (std::int64_t k = 0; k < spectrum_size; ++k)
+                                 ws.lines[k] *= kernel_spectrum[k];
+                             const std::int64_t last = std::min(length, out_length - start);
+                             if constexpr (is_real_view<In>::value) {
+                                 real_fft_.backward(ws.lines, ws.real_line, ws.work);
+                                 for (std::int64_t j = kernel_length - 1; j < last; ++j)
+                                     out.store(start + j, ws.real_line[j]);
+                             }
+                             else {
+                                 ffts_.front().template execute<true>(ws.lines, ws.work);
+                                 for (std::int64_t j = kernel_length - 1; j < last; ++j)
+                                     out.store(start + j, ws.lines[j]);
+                             }
+                         }
+                     });
+    }
+
+    // The short-time Fourier transform of the frames of a one-dimensional real plan's length
+    // that start every hop samples of signal. Each frame is multiplied by the window as it is
+    // gathered into the input of the real-to-complex transform, and frame f is stored at
+    // out[f * (length / 2 + 1)].
+    template <typename In, typename Window, typename Out>
+    void stft(In signal, std::int64_t frames, Window window, std::int64_t hop, Out out) const {
+        const std::int64_t length = cfg_.dimensions.front();
+        const std::int64_t spectrum_size = shape_.front();
+        const std::vector<T> w = load_window(window, length);
+        auto scratch = frame_scratch(frames);
+        parallel_for(frames, flops_estimate(), threads_,
+                     [&](std::int64_t thread, std::int64_t begin, std::int64_t end) {
+                         const workspace ws = frame_workspace(scratch.get(), thread);
+                         for (std::int64_t f = begin; f < end; ++f) {
+                             for (std::int64_t j = 0; j < length; ++j)
+                                 ws.real_line[j] = signal.load(f * hop + j) * w[j];
+                             real_fft_.forward(ws.real_line, ws.lines, ws.work);
+                             for (std::int64_t k = 0; k < spectrum_size; ++k)
+                                 out.store(f * spectrum_size + k, ws.lines[k] * cfg_.fwd_scale);
+                         }
+                     });
+    }
+
+    // The inverse of stft by weighted overlap-add: out receives the (frames - 1) * hop + length
+    // samples of the windowed inverse transforms, divided by the sum of the squared windows. Each
+    // thread owns a run of the output and adds up the frames reaching it in order, in a buffer
+    // of one frame that is shifted by hop once a frame has been added, as the samples before the
+    // next frame are then complete. Frames at the edges of the runs are transformed by both
+    // threads sharing them, so no sample is written twice and the sums are reproducible.
+    template <typename In, typename Window, typename Out>
+    void istft(In spectra, std::int64_t frames, Window window, std::int64_t hop, Out out) const {
+        const std::int64_t length = cfg_.dimensions.front();
+        const std::int64_t spectrum_size = shape_.front();
+        const std::int64_t out_length = (frames - 1) * hop + length;
+        const std::vector<T> w = load_window(window, length);
+        const std::int64_t runs = std::min(threads_, frames);
+        const std::int64_t run_length = (out_length + runs - 1) / runs;
+        auto scratch = frame_scratch(runs);
+        std::vector<T> sums(static_cast<std::size_t>(2 * runs * length));
+
+        parallel_for(runs, flops_estimate() * frames / runs, threads_,
+                     [&](std::int64_t thread, std::int64_t begin, std::int64_t end) {
+                         const workspace ws = frame_workspace(scratch.get(), thread);
+                         T* acc = sums.data() + 2 * thread * length;
+                         T* norm = acc + length;
+                         for (std::int64_t r = begin; r < end; ++r) {
+                             const std::int64_t first = r * run_length;
+                             const std::int64_t last = std::min(out_length, first + run_length);
+                             const std::int64_t f_begin =
+                                 first < length ? 0 : (first - length) / hop + 1;
+                             const std::int64_t f_end = std::min(frames, (last - 1) / hop + 1);
+                             std::fill(acc, acc + 2 * length, T(0));
+                             for (std::int64_t f = f_begin; f < f_end; ++f) {
+                                 for (std::int64_t k = 0; k < spectrum_size; ++k)
+                                     ws.lines[k] = spectra.load(f * spectrum_size + k);
+                                 real_fft_.backward(ws.lines, ws.real_line, ws.work);
+                                 for (std::int64_t j = 0; j < length; ++j) {
+                                     acc[j] += w[j] * ws.real_line[j] * cfg_.bwd_scale;
+                                     norm[j] += w[j] * w[j];
+                                 }
+                                 // Samples before the next frame, or all of the last one, are
+                                 // complete.
+                                 const std::int64_t done = f + 1 == f_end ? length : hop;
+                                 for (std::int64_t j = 0; j < done; ++j) {
+                                     const std::int64_t i = f * hop + j;
+                                     if (i >= first && i < last)
+                                         out.store(i, norm[j] > T(0) ? acc[j] / norm[j] : T(0));
+                                 }
+                                 for (T* a : { acc, norm }) {
+                                     std::copy(a + hop, a + length, a);
+                                     std::fill(a + length - hop, a + length, T(0));
+                                 }
+                             }
+                         }
+                     });
+    }
+
+private:
+    // Lines of a strided dimension are gathered line_block_ at a time so that each cache line
+    // loaded serves several of them, and transformed together with fft1d::execute_lines, whose
+    // passes vectorize across them. The line arrays hold the gathered lines, interleaved, and the
+    // scratch of their passes. TUNING_EXHAUSTIVE commits choose between these.
+    static constexpr std::int64_t default_line_block = 8;
+    static constexpr std::int64_t line_block_candidates[] = { 4, 8, 16 };
+
+    // The scratch arrays of one thread.
+    struct workspace {
+        complex_t* data;
+        complex_t* lines;
+        complex_t* work;
+        T* real_line;
+    };
+
+    // The arrays of the thread-th thread transforming whole batches.
+    workspace batch_workspace(complex_t* base, std::int64_t thread) const {
+        complex_t* p = base + thread * (data_size_ + lines_size_ + max_work_ + real_line_size_);
+        return { p, p + data_size_, p + data_size_ + lines_size_,
+                 reinterpret_cast<T*>(p + data_size_ + lines_size_ + max_work_) };
+    }
+
+    // The line arrays of the thread-th thread sharing the dimensions of a single transform. The
+    // first thread uses those of the batch workspace.
+    workspace line_workspace(const workspace& ws, std::int64_t thread) const {
+        if (thread == 0)
+            return ws;
+        complex_t* p = ws.data + data_size_ + lines_size_ + max_work_ + real_line_size_ +
+                       (thread - 1) * (lines_size_ + max_work_);
+        return { ws.data, p, p + lines_size_, nullptr };
+    }
+
+    std::vector<int> radices(std::int64_t n) const {
+        return tuned_radices<T>(n, cfg_.tuning);
+    }
+
+    // The scratch arrays of the threads transforming the frames of a short-time transform: a
+    // spectrum, the work array and a real frame for each.
+    std::unique_ptr<complex_t[]> frame_scratch(std::int64_t frames) const {
+        const std::int64_t threads = std::min(threads_, frames);
+        const std::int64_t per_thread = shape_.front() + max_work_ + real_line_size_;
+        return std::unique_ptr<complex_t[]>(
+            new complex_t[static_cast<std::size_t>(threads * per_thread)]);
+    }
+
+    workspace frame_workspace(complex_t* scratch, std::int64_t thread) const {
+        const std::int64_t spectrum_size = shape_.front();
+        complex_t* p = scratch + thread * (spectrum_size + max_work_ + real_line_size_);
+        return { nullptr, p, p + spectrum_size,
+                 reinterpret_cast<T*>(p + spectrum_size + max_work_) };
+    }
+
+    template <typename Window>
+    static std::vector<T> load_window(Window window, std::int64_t length) {
+        std::vector<T> w(static_cast<std::size_t>(length));
+        for (std::int64_t j = 0; j < length; ++j)
+            w[j] = window.load(j);
+        return w;
+    }
+
+    // The line block of the fastest transform of the work array along its strided dimensions,
+    // at TUNING_EXHAUSTIVE, or the recorded choice.
+    std::int64_t tuned_line_block(std::int64_t longest) {
+        if (cfg_.tuning != tuning_level::exhaustive || longest == 0)
+            return default_line_block;
+        std::string key = wisdom_key<T>(cfg_.real_domain ? "lines/r" : "lines/c");
+        for (auto n : shape_)
+            key += "/" + std::to_string(n);
+        if (auto choice = wisdom::find(key)) {
+            if (choice->size() == 1 && choice->front() > 0)
+                return choice->front();
+        }
+
+        const std::int64_t max_block = *std::max_element(std::begin(line_block_candidates),
+                                                         std::end(line_block_candidates));
+        std::vector<complex_t> scratch(
+            static_cast<std::size_t>(size_ + 2 * longest * max_block + max_work_));
+        std::int64_t best = default_line_block;
+        double best_seconds = std::numeric_limits<double>::infinity();
+        for (auto block : line_block_candidates) {
+            line_block_ = block;
+            workspace ws{ scratch.data(), scratch.data() + size_,
+                          scratch.data() + size_ + 2 * longest * block, nullptr };
+            const double seconds = seconds_per_call([&]() {
+                for (std::size_t axis = 0; axis < ffts_.size(); ++axis)
+                    transform_axis<false>(axis, ws, false);
+            });
+            if (seconds < best_seconds) {
+                best_seconds = seconds;
+                best = block;
+            }
+        }
+        wisdom::record(key, { best });
+        return best;
+    }
+
+    std::int64_t flops_estimate() const {
+        std::int64_t log_size = 1;
+        for (std::int64_t n = size_; n > 1; n /= 2)
+            ++log_size;
+        return size_ * log_size;
+    }
+
+    template <bool Inverse, typename In, typename Out>
+    void run(In in, Out out, const data_layout& in_layout, const data_layout& out_layout,
+             T scale, T* external) const {
+        // Owned scratch memory is left uninitialized: every array is written before it is read.
+        std::unique_ptr<T[]> owned;
+        if (external == nullptr) {
+            owned.reset(new T[static_cast<std::size_t>(2 * workspace_size_)]);
+            external = owned.get();
+        }
+        complex_t* base = reinterpret_cast<complex_t*>(external);
+        if constexpr (!is_real_view<In>::value && !is_real_view<Out>::value) {
+            if (pruning_) {
+                run_pruned<Inverse>(in, out, in_layout, out_layout, scale, base);
+                return;
+            }
+            if (four_step_) {
+                stream<Inverse>(in, out, in_layout, out_layout, scale, base);
+                return;
+            }
+        }
+        const std::int64_t batches = cfg_.number_of_transforms;
+        const bool split_lines = batches == 1;
+        parallel_for(batches, flops_estimate(), threads_,
+                     [&](std::int64_t thread, std::int64_t begin, std::int64_t end) {
+                         workspace ws = batch_workspace(base, thread);
+                         for (std::int64_t b = begin; b < end; ++b) {
+                             if constexpr (is_real_view<In>::value && is_real_view<Out>::value)
+                                 transform_real_real<Inverse>(in, out, in_layout, out_layout, b,
+                                                              scale, ws, split_lines);
+                             else
+                                 transform<Inverse>(in, out, in_layout, out_layout, b, scale, ws,
+                                                    split_lines);
+                         }
+                     });
+    }
+
+    // Visit the rows (runs along the last dimension) of shape, passing the offset of each row
+    // under the given layout and the offset of its first element in the contiguous work array.
+    template <typename F>
+    static void for_each_row(const std::vector<std::int64_t>& shape, const data_layout& layout,
+                             std::int64_t batch, F f) {
+        const std::size_t rank = shape.size();
+        const std::int64_t row_length = shape.back();
+        std::int64_t rows = 1;
+        for (std::size_t d = 0; d + 1 < rank; ++d)
+            rows *= shape[d];
+        for (std::int64_t row = 0; row < rows; ++row) {
+            std::int64_t offset = layout.strides[0] + batch * layout.distance;
+            for (std::int64_t rest = row, d = static_cast<std::int64_t>(rank) - 2; d >= 0; --d) {
+                offset += (rest % shape[d]) * layout.strides[d + 1];
+                rest /= shape[d];
+            }
+            f(offset, row * row_length);
+        }
+    }
+
+    template <bool Inverse, typename In, typename Out>
+    void transform(In in, Out out, const data_layout& in_layout, const data_layout& out_layout,
+                   std::int64_t batch, T scale, workspace& ws, bool split_lines) const {
+        const std::int64_t last_stride_in = in_layout.strides.back();
+        const std::int64_t last_stride_out = out_layout.strides.back();
+        complex_t* data = ws.data;
+
+        if constexpr (is_real_view<In>::value) {
+            // Real-to-complex along the last dimension while gathering.
+            const std::int64_t n = cfg_.dimensions.back();
+            const std::int64_t half = shape_.back();
+            std::int64_t row = 0;
+            for_each_row(cfg_.dimensions, in_layout, batch, [&](std::int64_t off, std::int64_t) {
+                for (std::int64_t j = 0; j < n; ++j)
+                    ws.real_line[j] = in.load(off + j * last_stride_in);
+                real_fft_.forward(ws.real_line, data + row * half, ws.work);
+                ++row;
+            });
+        }
+        else {
+            for_each_row(shape_, in_layout, batch, [&](std::int64_t off, std::int64_t pos) {
+                for (std::int64_t j = 0; j < shape_.back(); ++j)
+                    data[pos + j] = in.load(off + j * last_stride_in);
+            });
+        }
+
+        for (std::size_t axis = 0; axis < ffts_.size(); ++axis)
+            transform_axis<Inverse>(axis, ws, split_lines);
+
+        if constexpr (is_real_view<Out>::value) {
+            // Complex-to-real along the last dimension while scattering.
+            const std::int64_t n = cfg_.dimensions.back();
+            const std::int64_t half = shape_.back();
+            std::int64_t row = 0;
+            for_each_row(cfg_.dimensions, out_layout, batch, [&](std::int64_t off, std::int64_t) {
+                real_fft_.backward(data + row * half, ws.real_line, ws.work);
+                for (std::int64_t j = 0; j < n; ++j)
+                    out.store(off + j * last_stride_out, ws.real_line[j] * scale);
+                ++row;
+            });
+        }
+        else {
+            for_each_row(shape_, out_layout, batch, [&](std::int64_t off, std::int64_t pos) {
+                for (std::int64_t j = 0; j < shape_.back(); ++j)
+                    out.store(off + j * last_stride_out, data[pos + j] * scale);
+            });
+        }
+    }
+
+    // Transform the contiguous work array along one dimension.
+    template <bool Inverse>
+    void transform_axis(std::size_t axis, workspace& ws, bool split_lines) const {
+        const fft1d<T>& fft = ffts_[axis];
+        const std::int64_t length = shape_[axis];
+        if (length == 1)
+            return;
+        std::int64_t inner = 1;
+        for (std::size_t d = axis + 1; d < shape_.size(); ++d)
+            inner *= shape_[d];
+        const std::int64_t outer = size_ / (length * inner);
+        const std::int64_t blocks_per_outer = (inner + line_block_ - 1) / line_block_;
+        const std::int64_t units = inner == 1 ? outer : outer * blocks_per_outer;
+        complex_t* data = ws.data;
+
+        auto body = [&](std::int64_t begin, std::int64_t end, const workspace& local) {
+            complex_t* lines = local.lines;
+            complex_t* work = local.work;
+            for (std::int64_t unit = begin; unit < end; ++unit) {
+                if (inner == 1) {
+                    fft.template execute<Inverse>(data + unit * length, work);
+                    continue;
+                }
+                const std::int64_t o = unit / blocks_per_outer;
+                const std::int64_t i0 = (unit % blocks_per_outer) * line_block_;
+                const std::int64_t count = std::min(line_block_, inner - i0);
+                complex_t* base = data + o * length * inner + i0;
+                for (std::int64_t j = 0; j < length; ++j)
+                    for (std::int64_t b = 0; b < count; ++b)
+                        lines[j * count + b] = base[j * inner + b];
+                fft.template execute_lines<Inverse>(lines, count, lines + count * length, work);
+                for (std::int64_t j = 0; j < length; ++j)
+                    for (std::int64_t b = 0; b < count; ++b)
+                        base[j * inner + b] = lines[j * count + b];
+            }
+        };
+
+        if (!split_lines) {
+            body(0, units, ws);
+            return;
+        }
+        const std::int64_t work_per_unit = size_ / units;
+        parallel_for(units, work_per_unit * 4, threads_,
+                     [&](std::int64_t thread, std::int64_t begin, std::int64_t end) {
+                         body(begin, end, line_workspace(ws, thread));
+                     });
+    }
+
+    // The real-to-complex transform of the lines of one dimension of a REAL_REAL plan, with the
+    // twiddles exp(-i*pi*k/2n) for k <= n / 2.
+    struct real_real_axis {
+        real_fft<T> fft;
+        std::vector<complex_t> twiddles;
+    };
+
+    // The line arrays of a REAL_REAL plan hold line_block_ real lines of the longest dimension,
+    // the reordered samples of one line and its spectrum.
+    void init_real_real() {
+        const std::int64_t longest = *std::max_element(shape_.begin(), shape_.end());
+        max_work_ = 0;
+        for (const auto n : shape_) {
+            real_real_axis axis{ real_fft<T>(n, radices(real_fft<T>::complex_size(n))),
+                                 std::vector<complex_t>(n / 2 + 1) };
+            for (std::int64_t k = 0; k <= n / 2; ++k)
+                axis.twiddles[k] = root_of_unity<T>(k, 4 * n);
+            max_work_ = std::max(max_work_, axis.fft.work_size());
+            real_real_axes_.push_back(std::move(axis));
+        }
+        lines_size_ = real_lines_size(longest) + longest / 2 + 1;
+        real_line_size_ = 0;
+    }
+
+    // In complex elements, the real lines of the line arrays of a REAL_REAL plan.
+    std::int64_t real_lines_size(std::int64_t longest) const {
+        return ((line_block_ + 1) * longest + 1) / 2;
+    }
+
+    // Replace the n values of x with their transform of the given kind. v holds n values and
+    // spectrum n / 2 + 1.
+    void real_real_line(const real_real_axis& axis, real_real_kind kind, T* x, T* v,
+                        complex_t* spectrum, complex_t* work) const {
+        const std::int64_t n = axis.fft.size();
+        if (kind == real_real_kind::dct_ii || kind == real_real_kind::dst_ii) {
+            const bool sine = kind == real_real_kind::dst_ii;
+            for (std::int64_t j = 0; 2 * j < n; ++j)
+                v[j] = x[2 * j];
+            for (std::int64_t j = 0; 2 * j + 1 < n; ++j)
+                v[n - 1 - j] = sine ? -x[2 * j + 1] : x[2 * j + 1];
+            axis.fft.forward(v, spectrum, work);
+            // The results k and n - k are the real and imaginary parts of the same product.
+            for (std::int64_t k = 0; 2 * k <= n; ++k) {
+                const complex_t z = axis.twiddles[k] * spectrum[k];
+                x[sine ? n - 1 - k : k] = T(2) * z.real();
+                if (k > 0)
+                    x[sine ? k - 1 : n - k] = T(-2) * z.imag();
+            }
+        }
+        else {
+            const bool sine = kind == real_real_kind::dst_iii;
+            auto in = [&](std::int64_t j) {
+                return j == n ? T(0) : sine ? x[n - 1 - j] : x[j];
+            };
+            for (std::int64_t k = 0; 2 * k <= n; ++k)
+                spectrum[k] = std::conj(axis.twiddles[k]) * complex_t(in(k), -in(n - k));
+            axis.fft.backward(spectrum, v, work);
+            for (std::int64_t j = 0; 2 * j < n; ++j)
+                x[2 * j] = v[j];
+            for (std::int64_t j = 0; 2 * j + 1 < n; ++j)
+                x[2 * j + 1] = sine ? -v[n - 1 - j] : v[n - 1 - j];
+        }
+    }
+
+    template <bool Inverse, typename In, typename Out>
+    void transform_real_real(In in, Out out, const data_layout& in_layout,
+                             const data_layout& out_layout, std::int64_t batch, T scale,
+                             workspace& ws, bool split_lines) const {
+        const std::int64_t last_stride_in = in_layout.strides.back();
+        const std::int64_t last_stride_out = out_layout.strides.back();
+        T* data = reinterpret_cast<T*>(ws.data);
+        for_each_row(shape_, in_layout, batch, [&](std::int64_t off, std::int64_t pos) {
+            for (std::int64_t j = 0; j < shape_.back(); ++j)
+                data[pos + j] = in.load(off + j * last_stride_in);
+        });
+        for (std::size_t axis = 0; axis < real_real_axes_.size(); ++axis)
+            transform_real_real_axis<Inverse>(axis, ws, split_lines);
+        for_each_row(shape_, out_layout, batch, [&](std::int64_t off, std::int64_t pos) {
+            for (std::int64_t j = 0; j < shape_.back(); ++j)
+                out.store(off + j * last_stride_out, data[pos + j] * scale);
+        });
+    }
+
+    // Transform the real work array along one dimension, as transform_axis does complex ones.
+    template <bool Inverse>
+    void transform_real_real_axis(std::size_t axis, workspace& ws, bool split_lines) const {
+        const real_real_axis& line = real_real_axes_[axis];
+        const real_real_kind kind = Inverse ? inverse_kind(cfg_.real_real) : cfg_.real_real;
+        const std::int64_t length = shape_[axis];
+        const std::int64_t longest = *std::max_element(shape_.begin(), shape_.end());
+        std::int64_t inner = 1;
+        for (std::size_t d = axis + 1; d < shape_.size(); ++d)
+            inner *= shape_[d];
+        const std::int64_t outer = size_ / (length * inner);
+        const std::int64_t blocks_per_outer = (inner + line_block_ - 1) / line_block_;
+        const std::int64_t units = inner == 1 ? outer : outer * blocks_per_outer;
+        T* data = reinterpret_cast<T*>(ws.data);
+
+        auto body = [&](std::int64_t begin, std::int64_t end, const workspace& local) {
+            T* lines = reinterpret_cast<T*>(local.lines);
+            T* v = lines + line_block_ * longest;
+            complex_t* spectrum = local.lines + real_lines_size(longest);
+            for (std::int64_t unit = begin; unit < end; ++unit) {
+                if (inner == 1) {
+                    real_real_line(line, kind, data + unit * length, v, spectrum, local.work);
+                    continue;
+                }
+                const std::int64_t o = unit / blocks_per_outer;
+                const std::int64_t i0 = (unit % blocks_per_outer) * line_block_;
+                const std::int64_t count = std::min(line_block_, inner - i0);
+                T* base = data + o * length * inner + i0;
+                for (std::int64_t j = 0; j < length; ++j)
+                    for (std::int64_t b = 0; b < count; ++b)
+                        lines[b * length + j] = base[j * inner + b];
+                for (std::int64_t b = 0; b < count; ++b)
+                    real_real_line(line, kind, lines + b * length, v, spectrum, local.work);
+                for (std::int64_t j = 0; j < length; ++j)
+                    for (std::int64_t b = 0; b < count; ++b)
+                        base[j * inner + b] = lines[b * length + j];
+            }
+        };
+
+        if (!split_lines) {
+            body(0, units, ws);
+            return;
+        }
+        const std::int64_t work_per_unit = size_ / units;
+        parallel_for(units, work_per_unit * 4, threads_,
+                     [&](std::int64_t thread, std::int64_t begin, std::int64_t end) {
+                         body(begin, end, line_workspace(ws, thread));
+                     });
+    }
+
+    // The factors and tables of a streamed transform.
+    struct four_step {
+        fft1d<T> columns;
+        fft1d<T> rows;
+        // exp(-2*pi*i*e/length) = fine[e % n1] * coarse[e / n1].
+        std::vector<complex_t> fine;
+        std::vector<complex_t> coarse;
+        // In complex elements, for each of the two buffers.
+        std::int64_t tile_size;
+    };
+
+    void init_streaming() {
+        if (cfg_.dimensions.size() != 1 || cfg_.real_domain || real_real()) {
+            throw mkl::unimplemented("dft/backends/portable", "commit",
+                                     "Only one-dimensional complex transforms can be streamed "
+                                     "through a bounded working set.");
+        }
+        const std::int64_t length = size_;
+        std::int64_t n1 = 1;
+        for (std::int64_t d = 2; d * d <= length; ++d)
+            if (length % d == 0)
+                n1 = d;
+        const std::int64_t n2 = length / n1;
+        // In-place transforms transpose the data in place first, which needs a square.
+        const bool same_layouts = cfg_.forward_input.strides == cfg_.forward_output.strides &&
+                                  cfg_.forward_input.distance == cfg_.forward_output.distance;
+        if (cfg_.in_place && (n1 != n2 || !same_layouts)) {
+            throw mkl::unimplemented("dft/backends/portable", "commit",
+                                     "In-place streamed transforms need a square length and equal "
+                                     "input and output layouts.");
+        }
+
+        four_step steps{ fft1d<T>(n1, radices(n1)), fft1d<T>(n2, radices(n2)), {}, {}, 0 };
+        max_work_ = std::max(steps.columns.work_size(), steps.rows.work_size());
+        lines_size_ = 0;
+        real_line_size_ = 0;
+        // At most half of the working set goes to the scratch of the threads.
+        const std::int64_t budget =
+            cfg_.max_working_set_bytes / static_cast<std::int64_t>(sizeof(complex_t));
+        threads_ = std::clamp<std::int64_t>(budget / 2 / max_work_, 1, hardware_threads());
+        steps.tile_size = (budget - threads_ * max_work_) / 2;
+        if (steps.tile_size < n2) {
+            throw mkl::invalid_argument("dft/backends/portable", "commit",
+                                        "The maximum working set is too small to stream a "
+                                        "transform of this length.");
+        }
+        steps.fine.resize(static_cast<std::size_t>(n1));
+        for (std::int64_t e = 0; e < n1; ++e)
+            steps.fine[e] = root_of_unity<T>(e, length);
+        steps.coarse.resize(static_cast<std::size_t>(n2));
+        for (std::int64_t e = 0; e < n2; ++e)
+            steps.coarse[e] = root_of_unity<T>(e, n2);
+        workspace_size_ = 2 * steps.tile_size + threads_ * max_work_;
+        four_step_ = std::move(steps);
+    }
+
+    // Element j of line l of a pass is at index offset + l * line_stride + j * element_stride.
+    struct tile_map {
+        std::int64_t offset;
+        std::int64_t line_stride;
+        std::int64_t element_stride;
+
+        std::int64_t operator()(std::int64_t l, std::int64_t j) const {
+            return offset + l * line_stride + j * element_stride;
+        }
+    };
+
+    // Visit the elements of lines [first, first + count) in the order of their indices.
+    template <typename F>
+    static void for_each_in_tile(const tile_map& map, std::int64_t first, std::int64_t count,
+                                 std::int64_t length, F f) {
+        if (std::abs(map.element_stride) <= std::abs(map.line_stride)) {
+            for (std::int64_t l = 0; l < count; ++l)
+                for (std::int64_t j = 0; j < length; ++j)
+                    f(l, j, map(first + l, j));
+        }
+        else {
+            for (std::int64_t j = 0; j < length; ++j)
+                for (std::int64_t l = 0; l < count; ++l)
+                    f(l, j, map(first + l, j));
+        }
+    }
+
+    // Run process(t, tile) over tiles [0, tiles) while load(t + 1, other tile) runs on a worker of
+    // the thread pool, alternating between the two buffers.
+    template <typename Load, typename Process>
+    void double_buffered(std::int64_t tiles, complex_t* buffers, Load load,
+                         Process process) const {
+        const std::int64_t tile_size = four_step_->tile_size;
+        load(std::int64_t{ 0 }, buffers);
+        for (std::int64_t t = 0; t < tiles; ++t) {
+            std::exception_ptr errors[2];
+            // The caller takes the first task, the processing of the current tile.
+            auto task = [&](std::int64_t i) {
+                try {
+                    if (i == 0)
+                        process(t, buffers + (t % 2) * tile_size);
+                    else
+                        load(t + 1, buffers + ((t + 1) % 2) * tile_size);
+                }
+                catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            };
+            thread_pool::run(t + 1 < tiles ? 2 : 1, task);
+            for (auto& error : errors)
+                if (error)
+                    std::rethrow_exception(error);
+        }
+    }
+
+    // Transform the lines [0, lines) read from src through from, storing finish(l, j, value)
+    // to dst through to.
+    template <bool Inverse, typename Src, typename Dst, typename Finish>
+    void stream_pass(const fft1d<T>& fft, std::int64_t lines, Src src, const tile_map& from,
+                     Dst dst, const tile_map& to, Finish finish, complex_t* scratch) const {
+        const std::int64_t length = fft.size();
+        const std::int64_t per_tile = std::min(lines, four_step_->tile_size / length);
+        const std::int64_t tiles = (lines + per_tile - 1) / per_tile;
+        complex_t* work = scratch + 2 * four_step_->tile_size;
+        auto count_of = [&](std::int64_t t) {
+            return std::min(per_tile, lines - t * per_tile);
+        };
+        double_buffered(
+            tiles, scratch,
+            [&](std::int64_t t, complex_t* tile) {
+                for_each_in_tile(from, t * per_tile, count_of(t), length,
+                                 [&](std::int64_t l, std::int64_t j, std::int64_t i) {
+                                     tile[l * length + j] = src.load(i);
+                                 });
+            },
+            [&](std::int64_t t, complex_t* tile) {
+                parallel_for(count_of(t), length * 8, threads_,
+                             [&](std::int64_t thread, std::int64_t begin, std::int64_t end) {
+                                 for (std::int64_t l = begin; l < end; ++l)
+                                     fft.template execute<Inverse>(tile + l * length,
+                                                                   work + thread * max_work_);
+                             });
+                const std::int64_t first = t * per_tile;
+                for_each_in_tile(to, first, count_of(t), length,
+                                 [&](std::int64_t l, std::int64_t j, std::int64_t i) {
+                                     dst.store(i, finish(first + l, j, tile[l * length + j]));
+                                 });
+            });
+    }
+
+    // Transpose the square of side m at offset, with elements stride apart, in place, one pair of
+    // blocks at a time.
+    template <typename View>
+    void transpose_in_place(View data, std::int64_t offset, std::int64_t stride, std::int64_t m,
+                            complex_t* scratch) const {
+        const std::int64_t block = std::min(
+            m, static_cast<std::int64_t>(std::sqrt(static_cast<double>(four_step_->tile_size))));
+        complex_t* a = scratch;
+        complex_t* b = scratch + four_step_->tile_size;
+        auto index = [&](std::int64_t r, std::int64_t c) {
+            return offset + (r * m + c) * stride;
+        };
+        for (std::int64_t r0 = 0; r0 < m; r0 += block) {
+            for (std::int64_t c0 = r0; c0 < m; c0 += block) {
+                const std::int64_t rows = std::min(block, m - r0), cols = std::min(block, m - c0);
+                for (std::int64_t r = 0; r < rows; ++r)
+                    for (std::int64_t c = 0; c < cols; ++c)
+                        a[r * cols + c] = data.load(index(r0 + r, c0 + c));
+                if (r0 != c0) {
+                    for (std::int64_t c = 0; c < cols; ++c)
+                        for (std::int64_t r = 0; r < rows; ++r)
+                            b[c * rows + r] = data.load(index(c0 + c, r0 + r));
+                }
+                for (std::int64_t c = 0; c < cols; ++c)
+                    for (std::int64_t r = 0; r < rows; ++r)
+                        data.store(index(c0 + c, r0 + r), a[r * cols + c]);
+                if (r0 != c0) {
+                    for (std::int64_t r = 0; r < rows; ++r)
+                        for (std::int64_t c = 0; c < cols; ++c)
+                            data.store(index(r0 + r, c0 + c), b[c * rows + r]);
+                }
+            }
+        }
+    }
+
+    // The four-step algorithm of a streamed transform, one batch after another. The column pass
+    // writes its results transposed, so that the rows of the second pass are strided columns of
+    // the output and are transformed where they lie.
+    template <bool Inverse, typename In, typename Out>
+    void stream(In in, Out out, const data_layout& in_layout, const data_layout& out_layout,
+                T scale, complex_t* scratch) const {
+        const four_step& steps = *four_step_;
+        const std::int64_t n1 = steps.columns.size(), n2 = steps.rows.size();
+        auto twiddle = [&](std::int64_t l, std::int64_t j, complex_t v) {
+            const std::int64_t e = l * j;
+            const complex_t w = steps.fine[e % n1] * steps.coarse[e / n1];
+            return v * (Inverse ? std::conj(w) : w);
+        };
+        auto scaled = [&](std::int64_t, std::int64_t, complex_t v) {
+            return v * scale;
+        };
+        for (std::int64_t batch = 0; batch < cfg_.number_of_transforms; ++batch) {
+            const std::int64_t in_offset = in_layout.strides[0] + batch * in_layout.distance;
+            const std::int64_t in_stride = in_layout.strides[1];
+            const std::int64_t out_offset = out_layout.strides[0] + batch * out_layout.distance;
+            const std::int64_t out_stride = out_layout.strides[1];
+            // Line l of the first pass holds the input elements l + n2 * j and is stored to the
+            // elements n1 * l + j.
+            const tile_map transposed{ out_offset, n1 * out_stride, out_stride };
+            if (cfg_.in_place) {
+                transpose_in_place(out, out_offset, out_stride, n1, scratch);
+                stream_pass<Inverse>(steps.columns, n2, out, transposed, out, transposed, twiddle,
+                                     scratch);
+            }
+            else {
+                stream_pass<Inverse>(steps.columns, n2, in,
+                                     tile_map{ in_offset, in_stride, n2 * in_stride }, out,
+                                     transposed, twiddle, scratch);
+            }
+            const tile_map columns{ out_offset, out_stride, n1 * out_stride };
+            stream_pass<Inverse>(steps.rows, n1, out, columns, out, columns, scaled, scratch);
+        }
+    }
+
+    enum class pruning_method { output_classes, input_sequences, direct };
+
+    // The method and tables of a pruned transform.
+    struct pruning {
+        pruning_method method;
+        std::int64_t input_length, output_offset, output_length;
+        // p transforms of length m = fft.size().
+        std::int64_t p;
+        fft1d<T> fft;
+        // exp(-2*pi*i*e/length) = fine[e % fine.size()] * coarse[e / fine.size()].
+        std::vector<complex_t> fine;
+        std::vector<complex_t> coarse;
+        // In complex elements, the scratch arrays of one thread.
+        std::int64_t thread_size;
+        std::int64_t flops;
+
+        complex_t root(std::int64_t e) const {
+            const auto n1 = static_cast<std::int64_t>(fine.size());
+            return cmul(fine[e % n1], coarse[e / n1]);
+        }
+    };
+
+    // The scratch arrays of one thread of a pruned transform: the inputs read, a transform of
+    // length m, its work array and the partial sums of the window.
+    struct pruned_workspace {
+        complex_t* input;
+        complex_t* line;
+        complex_t* work;
+        complex_t* window;
+    };
+
+    pruned_workspace pruned_arrays(complex_t* base, std::int64_t thread) const {
+        const pruning& pr = *pruning_;
+        complex_t* p = base + thread * pr.thread_size;
+        complex_t* line = p + pr.input_length;
+        complex_t* work = line + pr.fft.size();
+        return { p, line, work, work + pr.fft.work_size() };
+    }
+
+    void init_pruning() {
+        if (cfg_.dimensions.size() != 1 || cfg_.real_domain || real_real()) {
+            throw mkl::unimplemented("dft/backends/portable", "commit",
+                                     "Only one-dimensional complex transforms can be pruned.");
+        }
+        const std::int64_t length = size_;
+        pruning pr;
+        pr.input_length = cfg_.pruned_input_length == 0 ? length : cfg_.pruned_input_length;
+        pr.output_offset = cfg_.pruned_output_offset;
+        pr.output_length = cfg_.pruned_output_length == 0 ? length - pr.output_offset
+                                                           : cfg_.pruned_output_length;
+        if (pr.input_length > length || pr.output_offset >= length ||
+            pr.output_length > length - pr.output_offset) {
+            throw mkl::invalid_argument("dft/backends/portable", "commit",
+                                        "The pruned input and output must lie within the length "
+                                        "of the transform.");
+        }
+
+        // The smallest divisor of length that is at least n.
+        auto divisor_at_least = [&](std::int64_t n) {
+            std::int64_t best = length;
+            for (std::int64_t d = 1; d * d <= length; ++d) {
+                if (length % d != 0)
+                    continue;
+                if (d >= n)
+                    best = std::min(best, d);
+                if (length / d >= n)
+                    best = std::min(best, length / d);
+            }
+            return best;
+        };
+        auto fft_flops = [](std::int64_t m) {
+            std::int64_t log_m = 1;
+            for (std::int64_t k = m; k > 1; k /= 2)
+                ++log_m;
+            return m * log_m;
+        };
+        const std::int64_t k = pr.input_length, l = pr.output_length;
+        const std::int64_t m_classes = divisor_at_least(k), m_sequences = divisor_at_least(l);
+        const std::int64_t classes = std::min(l, length / m_classes);
+        const std::int64_t sequences = std::min(k, length / m_sequences);
+        // Each term of a twiddled sum costs about as much as a butterfly of each element.
+        const std::int64_t flops[] = { classes * (fft_flops(m_classes) + k),
+                                       sequences * (fft_flops(m_sequences) + l), 2 * k * l };
+        const auto best = std::min_element(std::begin(flops), std::end(flops)) - std::begin(flops);
+        pr.method = static_cast<pruning_method>(best);
+        pr.flops = flops[best];
+        const std::int64_t m = pr.method == pruning_method::output_classes    ? m_classes
+                               : pr.method == pruning_method::input_sequences ? m_sequences
+                                                                              : 1;
+        pr.p = length / m;
+        pr.fft = fft1d<T>(m, radices(m));
+
+        std::int64_t n1 = 1;
+        while (n1 * n1 < length)
+            ++n1;
+        pr.fine.resize(static_cast<std::size_t>(n1));
+        for (std::int64_t e = 0; e < n1; ++e)
+            pr.fine[e] = root_of_unity<T>(e, length);
+        pr.coarse.resize(static_cast<std::size_t>((length + n1 - 1) / n1));
+        for (std::size_t e = 0; e < pr.coarse.size(); ++e)
+            pr.coarse[e] = root_of_unity<T>(static_cast<std::int64_t>(e) * n1, length);
+
+        pr.thread_size = k + m + pr.fft.work_size() +
+                         (pr.method == pruning_method::input_sequences ? l : 0);
+        max_work_ = pr.fft.work_size();
+        lines_size_ = 0;
+        real_line_size_ = 0;
+        // Batches are spread across threads, or the classes, sequences or outputs of a single
+        // transform.
+        auto workspace_size = [&]() {
+            const std::int64_t batches = cfg_.number_of_transforms;
+            return (batches == 1 ? threads_ : std::min(threads_, batches)) * pr.thread_size;
+        };
+        workspace_size_ = workspace_size();
+        if (cfg_.max_working_set_bytes > 0) {
+            while (threads_ > 1 && workspace_bytes() > cfg_.max_working_set_bytes) {
+                --threads_;
+                workspace_size_ = workspace_size();
+            }
+            if (workspace_bytes() > cfg_.max_working_set_bytes) {
+                throw mkl::invalid_argument("dft/backends/portable", "commit",
+                                            "The maximum working set is too small for this "
+                                            "pruned transform.");
+            }
+        }
+        pruning_ = std::move(pr);
+    }
+
+    template <bool Inverse, typename In, typename Out>
+    void run_pruned(In in, Out out, const data_layout& in_layout, const data_layout& out_layout,
+                    T scale, complex_t* base) const {
+        const std::int64_t batches = cfg_.number_of_transforms;
+        parallel_for(batches, pruning_->flops, threads_,
+                     [&](std::int64_t thread, std::int64_t begin, std::int64_t end) {
+                         for (std::int64_t b = begin; b < end; ++b)
+                             transform_pruned<Inverse>(in, out, in_layout, out_layout, b, scale,
+                                                       base, thread, batches == 1);
+                     });
+    }
+
+    template <bool Inverse, typename In, typename Out>
+    void transform_pruned(In in, Out out, const data_layout& in_layout,
+                          const data_layout& out_layout, std::int64_t batch, T scale,
+                          complex_t* base, std::int64_t thread, bool split) const {
+        const pruning& pr = *pruning_;
+        const std::int64_t length = size_, m = pr.fft.size();
+        const std::int64_t k_in = pr.input_length;
+        const std::int64_t first = pr.output_offset, last = first + pr.output_length;
+
+        // Reading every input first makes in-place transforms safe.
+        complex_t* x = pruned_arrays(base, thread).input;
+        const std::int64_t in_offset = in_layout.strides[0] + batch * in_layout.distance;
+        for (std::int64_t j = 0; j < k_in; ++j)
+            x[j] = in.load(in_offset + j * in_layout.strides[1]);
+        const std::int64_t out_offset = out_layout.strides[0] + batch * out_layout.distance;
+        auto store = [&](std::int64_t k, complex_t value) {
+            out.store(out_offset + k * out_layout.strides[1], value * scale);
+        };
+        auto root = [&](std::int64_t j, std::int64_t k) {
+            const complex_t w = pr.root(j * k % length);
+            return Inverse ? std::conj(w) : w;
+        };
+        // Run body(t, begin, end) over [0, count), split across the threads for a single
+        // transform, t being the thread whose scratch arrays the body uses.
+        auto spread = [&](std::int64_t count, std::int64_t work_per_item, auto body) {
+            if (split)
+                parallel_for(count, work_per_item, threads_, body);
+            else
+                body(thread, std::int64_t{ 0 }, count);
+        };
+
+        switch (pr.method) {
+            case pruning_method::output_classes: {
+                const std::int64_t classes = std::min(pr.output_length, pr.p);
+                spread(classes, pr.flops / classes,
+                       [&](std::int64_t t, std::int64_t begin, std::int64_t end) {
+                           const pruned_workspace ws = pruned_arrays(base, t);
+                           for (std::int64_t c = begin; c < end; ++c) {
+                               const std::int64_t k1 = (first + c) % pr.p;
+                               for (std::int64_t j = 0; j < k_in; ++j)
+                                   ws.line[j] = x[j] * root(j, k1);
+                               std::fill(ws.line + k_in, ws.line + m, complex_t(0));
+                               pr.fft.template execute<Inverse>(ws.line, ws.work);
+                               const std::int64_t k0 = first + (k1 - first % pr.p + pr.p) % pr.p;
+                               for (std::int64_t k = k0; k < last; k += pr.p)
+                                   store(k, ws.line[k / pr.p]);
+                           }
+                       });
+                break;
+            }
+            case pruning_method::input_sequences: {
+                // Each thread sums its sequences into its own window, then the first thread adds
+                // up the windows of all threads that took part.
+                const std::int64_t sequences = std::min(k_in, pr.p);
+                std::vector<char> used(static_cast<std::size_t>(threads_), 0);
+                spread(sequences, pr.flops / sequences,
+                       [&](std::int64_t t, std::int64_t begin, std::int64_t end) {
+                           const pruned_workspace ws = pruned_arrays(base, t);
+                           used[static_cast<std::size_t>(t)] = 1;
+                           std::fill(ws.window, ws.window + pr.output_length, complex_t(0));
+                           for (std::int64_t j1 = begin; j1 < end; ++j1) {
+                               for (std::int64_t j2 = 0; j2 < m; ++j2) {
+                                   const std::int64_t j = j2 * pr.p + j1;
+                                   ws.line[j2] = j < k_in ? x[j] : complex_t(0);
+                               }
+                               pr.fft.template execute<Inverse>(ws.line, ws.work);
+                               for (std::int64_t k = first; k < last; ++k)
+                                   ws.window[k - first] += root(j1, k) * ws.line[k % m];
+                           }
+                       });
+                for (std::int64_t k = first; k < last; ++k) {
+                    complex_t sum = 0;
+                    for (std::int64_t t = 0; t < threads_; ++t)
+                        if (used[static_cast<std::size_t>(t)])
+                            sum += pruned_arrays(base, t).window[k - first];
+                    store(k, sum);
+                }
+                break;
+            }
+            case pruning_method::direct: {
+                spread(pr.output_length, 2 * k_in,
+                       [&](std::int64_t, std::int64_t begin, std::int64_t end) {
+                           for (std::int64_t k = first + begin; k < first + end; ++k) {
+                               complex_t sum = 0;
+                               for (std::int64_t j = 0, e = 0; j < k_in; ++j) {
+                                   const complex_t w = pr.root(e);
+                                   sum += x[j] * (Inverse ? std::conj(w) : w);
+                                   e += k;
+                                   if (e >= length)
+                                       e -= length;
+                               }
+                               store(k, sum);
+                           }
+                       });
+                break;
+            }
+        }
+    }
+
+    config cfg_;
+    std::vector<std::int64_t> shape_;
+    std::int64_t size_;
+    // In complex elements, the work array of one transform.
+    std::int64_t data_size_;
+    std::int64_t max_work_;
+    std::int64_t lines_size_;
+    std::int64_t real_line_size_;
+    std::int64_t line_block_ = default_line_block;
+    std::int64_t threads_;
+    // In complex elements.
+    std::int64_t workspace_size_;
+    std::vector<fft1d<T>> ffts_;
+    real_fft<T> real_fft_;
+    std::vector<real_real_axis> real_real_axes_;
+    std::optional<four_step> four_step_;
+    std::optional<pruning> pruning_;
+};
+
+} // namespace oneapi::mkl::dft::portable::detail
+
+#endif // _ONEMKL_DFT_SRC_PORTABLE_PLAN_HPP_
@@ -0,0 +1,173 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_SRC_PORTABLE_HELPERS_HPP_
+#define _ONEMKL_DFT_SRC_PORTABLE_HELPERS_HPP_
+
+#include <complex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/dft/detail/types_impl.hpp"
+#include "oneapi/mkl/dft/detail/descriptor_impl.hpp"
+
+#include "dft/backends/portable/plan.hpp"
+
+namespace oneapi::mkl::dft::portable::detail {
+
+template <typename K, typename H, typename F>
+static inline auto host_task_internal(H& cgh, F f, int) -> decltype(cgh.host_task(f)) {
+    return cgh.host_task(f);
+}
+
+template <typename K, typename H, typename F>
+static inline void host_task(H& cgh, F f) {
+    (void)host_task_internal<K>(cgh, f, 0);
+}
+
+template <typename AccType>
+typename AccType::value_type* acc_to_ptr(AccType acc) {
+    // The pointer is only dereferenced on the host, so it needs no address space.
+    return acc.template get_multi_ptr<sycl::access::decorated::no>().get();
+}
+
+// The type transforms of data of type S compute in: HALF and BFLOAT16 data is loaded into and
+// stored from single precision.
+template <typename S>
+using compute_t = std::conditional_t<std::is_same_v<S, double>, double, float>;
+
+// View of user data in the element type of the compute call.
+template <typename S>
+inline real_view<compute_t<S>, S> view(S* data) {
+    return { data };
+}
+
+template <typename S>
+inline interleaved_view<compute_t<S>, S> view(std::complex<S>* data) {
+    return { data };
+}
+
+template <typename S>
+inline interleaved_view<compute_t<S>, S> view(dft::detail::complex_pair<S>* data) {
+    return { data };
+}
+
+template <typename S>
+inline split_view<compute_t<S>, S> view(S* re, S* im) {
+    return { re, im };
+}
+
+// View of the complex side of an in-place transform, whose data has the forward type.
+template <typename S>
+inline interleaved_view<compute_t<S>, S> complex_view(S* data) {
+    return { reinterpret_cast<dft::detail::complex_t<S>*>(data) };
+}
+
+template <typename S>
+inline interleaved_view<compute_t<S>, S> complex_view(std::complex<S>* data) {
+    return { data };
+}
+
+template <typename S>
+inline interleaved_view<compute_t<S>, S> complex_view(dft::detail::complex_pair<S>* data) {
+    return { data };
+}
+
+// View of the backward domain of an in-place transform, whose data has the forward type: complex
+// unless both domains are real.
+template <typename descriptor_type, typename S>
+inline auto backward_view(S* data) {
+    using bwd_type = typename dft::detail::descriptor_info<descriptor_type>::backward_type;
+    if constexpr (std::is_same_v<S, bwd_type>)
+        return view(data);
+    else
+        return complex_view(data);
+}
+
+// Throw an mkl::invalid_argument if the runtime param in the descriptor does not match
+// the expected value.
+template <dft::detail::config_param Param, dft::detail::config_value Expected, typename DescT>
+inline void expect_config(DescT& desc, const char* function, const char* message) {
+    dft::detail::config_value actual{ 0 };
+    desc.get_value(Param, &actual);
+    if (actual != Expected) {
+        throw mkl::invalid_argument("DFT", function, message);
+    }
+}
+
+// The external workspace of a compute call, throwing if the descriptor needs one that has not been
+// set. It is empty when the plan allocates its own scratch memory.
+template <typename descriptor_type>
+inline auto checked_workspace(descriptor_type& desc, const char* function) {
+    dft::detail::config_value placement{ 0 };
+    desc.get_value(dft::detail::config_param::WORKSPACE_PLACEMENT, &placement);
+    auto workspace = dft::detail::get_workspace(desc);
+    if (placement == dft::detail::config_value::WORKSPACE_EXTERNAL && !workspace.is_set) {
+        throw mkl::invalid_argument("DFT", function,
+                                    "An external workspace must be set before computing.");
+    }
+    return workspace;
+}
+
+// An external workspace bound to a command group, to be read in its host task.
+template <typename T>
+struct bound_workspace {
+    using accessor_t =
+        decltype(std::declval<sycl::buffer<T, 1>&>()
+                     .template get_access<sycl::access::mode::read_write>(
+                         std::declval<sycl::handler&>()));
+    T* usm;
+    std::optional<accessor_t> acc;
+
+    T* get() const {
+        return acc ? acc_to_ptr(*acc) : usm;
+    }
+};
+
+template <typename T>
+inline bound_workspace<T> bind_workspace(dft::detail::external_workspace<T>& workspace,
+                                         sycl::handler& cgh) {
+    bound_workspace<T> bound{ workspace.usm, std::nullopt };
+    if (workspace.buffer) {
+        bound.acc = workspace.buffer->template get_access<sycl::access::mode::read_write>(cgh);
+    }
+    return bound;
+}
+
+// Separate real and imaginary arrays only describe complex-domain data.
+template <typename descriptor_type>
+inline void expect_complex_domain(const char* function) {
+    using info = dft::detail::descriptor_info<descriptor_type>;
+    if constexpr (std::is_same_v<typename info::forward_type, typename info::scalar_type>) {
+        throw mkl::invalid_argument("DFT", function,
+                                    "REAL_REAL complex storage requires a complex domain.");
+    }
+}
+
+} // namespace oneapi::mkl::dft::portable::detail
+
+#endif // _ONEMKL_DFT_SRC_PORTABLE_HELPERS_HPP_
@@ -0,0 +1,572 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_SRC_PORTABLE_STOCKHAM_HPP_
+#define _ONEMKL_DFT_SRC_PORTABLE_STOCKHAM_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// One-dimensional transforms of the portable DFT backend.
+//
+// fft1d is a self-sorting (Stockham) mixed-radix FFT with hand-written butterflies for radices
+// 2, 3, 4, 5 and 8 and a generic odd butterfly for 7, 11 and 13. Lengths with any other prime
+// factor go through Bluestein's algorithm, which recasts the transform as a convolution of
+// 5-smooth length. real_fft builds the real-to-complex and complex-to-real transforms on top of a
+// half-length complex transform for even lengths and a full-length one for odd lengths.
+//
+// Forward transforms use the exp(-2*pi*i*j*k/n) kernel, backward ones exp(+2*pi*i*j*k/n); neither
+// is scaled.
+
+namespace oneapi::mkl::dft::portable::detail {
+
+// std::complex multiplication handles infinities and NaNs through a library call, which stops
+// the inner loops from vectorizing. The transforms do not need that.
+template <typename T>
+inline std::complex<T> cmul(const std::complex<T>& a, const std::complex<T>& b) {
+    return { a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real() };
+}
+
+template <typename T>
+inline std::complex<T> cmul_conj(const std::complex<T>& a, const std::complex<T>& b) {
+    return { a.real() * b.real() + a.imag() * b.imag(), a.imag() * b.real() - a.real() * b.imag() };
+}
+
+// Multiply by -i for forward transforms and by +i for backward ones.
+template <bool Inverse, typename T>
+inline std::complex<T> rotate(const std::complex<T>& a) {
+    if constexpr (Inverse)
+        return { -a.imag(), a.real() };
+    else
+        return { a.imag(), -a.real() };
+}
+
+// exp(-2*pi*i*k/n), evaluated in double precision with k reduced modulo n.
+template <typename T>
+inline std::complex<T> root_of_unity(std::int64_t k, std::int64_t n) {
+    constexpr double two_pi = 6.283185307179586476925286766559;
+    const double angle = -two_pi * static_cast<double>(k % n) / static_cast<double>(n);
+    return { static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle)) };
+}
+
+template <int R, bool Inverse, typename T>
+inline void butterfly(std::complex<T>* a, const T* cos_table, const T* sin_table) {
+    using complex_t = std::complex<T>;
+    if constexpr (R == 2) {
+        const complex_t t = a[0] - a[1];
+        a[0] += a[1];
+        a[1] = t;
+    }
+    else if constexpr (R == 3) {
+        constexpr T s60 = T(0.866025403784438646763723170752936);
+        const complex_t t1 = a[1] + a[2];
+        const complex_t t2 = a[0] - t1 * T(0.5);
+        const complex_t t3 = rotate<Inverse>(a[1] - a[2]) * s60;
+        a[0] += t1;
+        a[1] = t2 + t3;
+        a[2] = t2 - t3;
+    }
+    else if constexpr (R == 4) {
+        const complex_t t0 = a[0] + a[2];
+        const complex_t t1 = a[0] - a[2];
+        const complex_t t2 = a[1] + a[3];
+        const complex_t t3 = rotate<Inverse>(a[1] - a[3]);
+        a[0] = t0 + t2;
+        a[1] = t1 + t3;
+        a[2] = t0 - t2;
+        a[3] = t1 - t3;
+    }
+    else if constexpr (R == 5) {
+        constexpr T c1 = T(0.309016994374947424102293417182819);
+        constexpr T c2 = T(-0.809016994374947424102293417182819);
+        constexpr T s1 = T(0.951056516295153572116439333379382);
+        constexpr T s2 = T(0.587785252292473129168705954639073);
+        const complex_t s14 = a[1] + a[4];
+        const complex_t d14 = a[1] - a[4];
+        const complex_t s23 = a[2] + a[3];
+        const complex_t d23 = a[2] - a[3];
+        const complex_t b1 = a[0] + s14 * c1 + s23 * c2;
+        const complex_t b2 = a[0] + s14 * c2 + s23 * c1;
+        const complex_t r1 = rotate<Inverse>(d14 * s1 + d23 * s2);
+        const complex_t r2 = rotate<Inverse>(d14 * s2 - d23 * s1);
+        a[0] += s14 + s23;
+        a[1] = b1 + r1;
+        a[4] = b1 - r1;
+        a[2] = b2 + r2;
+        a[3] = b2 - r2;
+    }
+    else if constexpr (R == 8) {
+        constexpr T r2 = T(0.707106781186547524400844362104849);
+        complex_t even[4] = { a[0], a[2], a[4], a[6] };
+        complex_t odd[4] = { a[1], a[3], a[5], a[7] };
+        butterfly<4, Inverse>(even, cos_table, sin_table);
+        butterfly<4, Inverse>(odd, cos_table, sin_table);
+        odd[1] = (odd[1] + rotate<Inverse>(odd[1])) * r2;
+        odd[2] = rotate<Inverse>(odd[2]);
+        odd[3] = (rotate<Inverse>(odd[3]) - odd[3]) * r2;
+        for (int k = 0; k < 4; ++k) {
+            a[k] = even[k] + odd[k];
+            a[k + 4] = even[k] - odd[k];
+        }
+    }
+    else {
+        // Odd radix: pair inputs j and R - j so that outputs k and R - k share the work.
+        constexpr int H = R / 2;
+        complex_t sums[H], diffs[H];
+        complex_t dc = a[0];
+        for (int j = 1; j <= H; ++j) {
+            sums[j - 1] = a[j] + a[R - j];
+            diffs[j - 1] = a[j] - a[R - j];
+            dc += sums[j - 1];
+        }
+        complex_t out[R];
+        out[0] = dc;
+        for (int k = 1; k <= H; ++k) {
+            complex_t re = a[0], im{};
+            for (int j = 1; j <= H; ++j) {
+                re += sums[j - 1] * cos_table[(j * k) % R];
+                im += diffs[j - 1] * sin_table[(j * k) % R];
+            }
+            out[k] = re + rotate<Inverse>(im);
+            out[R - k] = re - rotate<Inverse>(im);
+        }
+        for (int k = 0; k < R; ++k)
+            a[k] = out[k];
+    }
+}
+
+// One Stockham pass: x holds s interleaved sequences of length R * m; y receives the R * s
+// interleaved sequences of length m left for the following passes.
+//
+// The butterflies of the s sequences are independent and, for a given p, read and write
+// contiguous elements. They are computed block_size sequences at a time: the block is split into
+// real and imaginary parts in local arrays, a loop applies the butterfly and the twiddles of p
+// to one sequence per iteration, and the results are interleaved back. That loop has only
+// unit-stride accesses to arrays that cannot alias, which compilers vectorize at the full vector
+// width with one sequence per lane; loads of whole std::complex values are at best vectorized as
+// pairs of real and imaginary parts. Passes with fewer than min_block_size sequences, the first
+// ones of a single line, compute one butterfly at a time. fft1d::execute_lines transforms
+// interleaved lines as more sequences per pass, so its first passes vectorize across the lines.
+template <int R, bool Inverse, typename T>
+void radix_pass(std::int64_t m, std::int64_t s, const std::complex<T>* x, std::complex<T>* y,
+                const std::complex<T>* twiddles, const T* cos_table, const T* sin_table) {
+    constexpr std::int64_t block_size = 16;
+    constexpr std::int64_t min_block_size = 8;
+    // Local copies of the tables cannot alias the block arrays.
+    T c[R] = {}, sn[R] = {};
+    if constexpr (R > 5 && R != 8) {
+        std::copy(cos_table, cos_table + R, c);
+        std::copy(sin_table, sin_table + R, sn);
+    }
+    if (s < min_block_size) {
+        // Too few sequences to fill the vector lanes: one butterfly at a time.
+        std::complex<T> a[R];
+        for (std::int64_t p = 0; p < m; ++p) {
+            const std::complex<T>* w = twiddles + p * R;
+            for (std::int64_t q = 0; q < s; ++q) {
+                for (int j = 0; j < R; ++j)
+                    a[j] = x[q + s * (p + j * m)];
+                butterfly<R, Inverse>(a, c, sn);
+                std::complex<T>* out = y + q + s * R * p;
+                out[0] = a[0];
+                for (int k = 1; k < R; ++k)
+                    out[s * k] = Inverse ? cmul_conj(a[k], w[k]) : cmul(a[k], w[k]);
+            }
+        }
+        return;
+    }
+    T re[R][block_size], im[R][block_size];
+    for (std::int64_t p = 0; p < m; ++p) {
+        T wr[R], wi[R];
+        for (int k = 0; k < R; ++k) {
+            wr[k] = twiddles[p * R + k].real();
+            wi[k] = Inverse ? -twiddles[p * R + k].imag() : twiddles[p * R + k].imag();
+        }
+        for (std::int64_t q0 = 0; q0 < s; q0 += block_size) {
+            const std::int64_t count = std::min(block_size, s - q0);
+            for (int j = 0; j < R; ++j) {
+                const std::complex<T>* in = x + q0 + s * (p + j * m);
+                for (std::int64_t b = 0; b < count; ++b) {
+                    re[j][b] = in[b].real();
+                    im[j][b] = in[b].imag();
+                }
+            }
+            for (std::int64_t b = 0; b < count; ++b) {
+                std::complex<T> a[R];
+                for (int j = 0; j < R; ++j)
+                    a[j] = { re[j][b], im[j][b] };
+                butterfly<R, Inverse>(a, c, sn);
+                re[0][b] = a[0].real();
+                im[0][b] = a[0].imag();
+                for (int k = 1; k < R; ++k) {
+                    re[k][b] = a[k].real() * wr[k] - a[k].imag() * wi[k];
+                    im[k][b] = a[k].real() * wi[k] + a[k].imag() * wr[k];
+                }
+            }
+            for (int k = 0; k < R; ++k) {
+                std::complex<T>* out = y + q0 + s * (R * p + k);
+                for (std::int64_t b = 0; b < count; ++b)
+                    out[b] = { re[k][b], im[k][b] };
+            }
+        }
+    }
+}
+
+template <typename T>
+class fft1d {
+public:
+    using complex_t = std::complex<T>;
+
+    fft1d() = default;
+
+    // radices are the radices of the passes in order, whose product must be n, or empty for the
+    // default factorization.
+    explicit fft1d(std::int64_t n, std::vector<int> radices = {}) : n_(n) {
+        if (!factorizes(n, radices))
+            radices = default_radices(n);
+        if (radices.empty() && n != 1) {
+            init_bluestein();
+            return;
+        }
+        std::int64_t length = n, stride = 1;
+        for (int r : radices) {
+            stage st;
+            st.radix = r;
+            st.m = length / r;
+            st.s = stride;
+            st.twiddles.resize(static_cast<std::size_t>(length));
+            for (std::int64_t p = 0; p < st.m; ++p)
+                for (int k = 0; k < r; ++k)
+                    st.twiddles[p * r + k] = root_of_unity<T>(p * k, length);
+            if (r > 5 && r != 8) {
+                st.cos_table.resize(r);
+                st.sin_table.resize(r);
+                for (int k = 0; k < r; ++k) {
+                    // The sign of the direction comes from rotate() in the butterfly.
+                    const complex_t w = root_of_unity<T>(k, r);
+                    st.cos_table[k] = w.real();
+                    st.sin_table[k] = -w.imag();
+                }
+            }
+            stages_.push_back(std::move(st));
+            length /= r;
+            stride *= r;
+        }
+    }
+
+    std::int64_t size() const noexcept {
+        return n_;
+    }
+
+    // The radices of the passes, or none for Bluestein's algorithm.
+    std::vector<int> radices() const {
+        std::vector<int> result;
+        for (const auto& st : stages_)
+            result.push_back(st.radix);
+        return result;
+    }
+
+    // The factorization of n into radices with a butterfly, as many radix-8 passes as possible
+    // first, or none if n has another prime factor.
+    static std::vector<int> default_radices(std::int64_t n, bool radix_8 = true) {
+        std::vector<int> radices;
+        for (int r : { 8, 4, 2, 3, 5, 7, 11, 13 }) {
+            if (r == 8 && !radix_8)
+                continue;
+            while (n % r == 0) {
+                radices.push_back(r);
+                n /= r;
+            }
+        }
+        if (n != 1)
+            radices.clear();
+        return radices;
+    }
+
+    // The factorizations of n that tuning compares, the default one first: the default radices
+    // in other orders, and without radix-8 passes.
+    static std::vector<std::vector<int>> candidate_radices(std::int64_t n) {
+        std::vector<std::vector<int>> candidates;
+        auto add = [&](std::vector<int> radices) {
+            if (std::find(candidates.begin(), candidates.end(), radices) == candidates.end())
+                candidates.push_back(std::move(radices));
+        };
+        for (bool radix_8 : { true, false }) {
+            std::vector<int> radices = default_radices(n, radix_8);
+            if (radices.empty())
+                break;
+            add(radices);
+            add(std::vector<int>(radices.rbegin(), radices.rend()));
+            std::sort(radices.begin(), radices.end());
+            add(radices);
+            add(std::vector<int>(radices.rbegin(), radices.rend()));
+        }
+        return candidates;
+    }
+
+    // Whether radices, each with a butterfly, multiply to n.
+    static bool factorizes(std::int64_t n, const std::vector<int>& radices) {
+        if (radices.empty())
+            return false;
+        for (int r : radices) {
+            if (r != 2 && r != 3 && r != 4 && r != 5 && r != 7 && r != 8 && r != 11 && r != 13)
+                return false;
+            if (n % r != 0)
+                return false;
+            n /= r;
+        }
+        return n == 1;
+    }
+
+    // Number of complex elements of scratch space that execute() needs.
+    std::int64_t work_size() const noexcept {
+        return conv_ ? 2 * conv_size_ + conv_->work_size() : n_;
+    }
+
+    // Transform n contiguous elements in place.
+    template <bool Inverse>
+    void execute(complex_t* data, complex_t* work) const {
+        if (conv_) {
+            bluestein<Inverse>(data, work);
+            return;
+        }
+        run_passes<Inverse>(data, work, 1);
+    }
+
+    // Transform lines sequences of n elements in place, element j of sequence b being
+    // data[j * lines + b]. scratch holds n * lines elements and work work_size() elements.
+    template <bool Inverse>
+    void execute_lines(complex_t* data, std::int64_t lines, complex_t* scratch,
+                       complex_t* work) const {
+        if (!conv_) {
+            run_passes<Inverse>(data, scratch, lines);
+            return;
+        }
+        for (std::int64_t b = 0; b < lines; ++b) {
+            for (std::int64_t j = 0; j < n_; ++j)
+                scratch[j] = data[j * lines + b];
+            bluestein<Inverse>(scratch, work);
+            for (std::int64_t j = 0; j < n_; ++j)
+                data[j * lines + b] = scratch[j];
+        }
+    }
+
+private:
+    // The Stockham passes over lines interleaved sequences, which are lines times as many
+    // interleaved sequences of every pass.
+    template <bool Inverse>
+    void run_passes(complex_t* data, complex_t* work, std::int64_t lines) const {
+        complex_t* x = data;
+        complex_t* y = work;
+        for (const auto& st : stages_) {
+            const std::int64_t s = st.s * lines;
+            const complex_t* w = st.twiddles.data();
+            const T* c = st.cos_table.data();
+            const T* sn = st.sin_table.data();
+            switch (st.radix) {
+                case 2: radix_pass<2, Inverse>(st.m, s, x, y, w, c, sn); break;
+                case 3: radix_pass<3, Inverse>(st.m, s, x, y, w, c, sn); break;
+                case 4: radix_pass<4, Inverse>(st.m, s, x, y, w, c, sn); break;
+                case 5: radix_pass<5, Inverse>(st.m, s, x, y, w, c, sn); break;
+                case 7: radix_pass<7, Inverse>(st.m, s, x, y, w, c, sn); break;
+                case 8: radix_pass<8, Inverse>(st.m, s, x, y, w, c, sn); break;
+                case 11: radix_pass<11, Inverse>(st.m, s, x, y, w, c, sn); break;
+                default: radix_pass<13, Inverse>(st.m, s, x, y, w, c, sn); break;
+            }
+            std::swap(x, y);
+        }
+        if (x != data)
+            std::copy(x, x + n_ * lines, data);
+    }
+
+    struct stage {
+        int radix;
+        std::int64_t m;
+        std::int64_t s;
+        std::vector<complex_t> twiddles;
+        std::vector<T> cos_table;
+        std::vector<T> sin_table;
+    };
+
+    static bool is_smooth(std::int64_t n) {
+        for (std::int64_t r : { 2, 3, 5 })
+            while (n % r == 0)
+                n /= r;
+        return n == 1;
+    }
+
+    void init_bluestein() {
+        conv_size_ = 2 * n_ - 1;
+        while (!is_smooth(conv_size_))
+            ++conv_size_;
+        conv_ = std::make_shared<const fft1d<T>>(conv_size_);
+
+        // chirp[k] = exp(-pi*i*k^2/n); k^2 is reduced modulo 2n to keep the angle accurate.
+        chirp_.resize(static_cast<std::size_t>(n_));
+        for (std::int64_t k = 0; k < n_; ++k) {
+            const auto k2 = static_cast<std::int64_t>((static_cast<std::uint64_t>(k) * k) %
+                                                      static_cast<std::uint64_t>(2 * n_));
+            chirp_[k] = root_of_unity<T>(k2, 2 * n_);
+        }
+
+        // Spectrum of the convolution kernel conj(chirp), wrapped around and pre-scaled by the
+        // 1 / conv_size_ of the inverse convolution transform.
+        std::vector<complex_t> kernel(static_cast<std::size_t>(conv_size_));
+        std::vector<complex_t> work(static_cast<std::size_t>(conv_->work_size()));
+        kernel[0] = std::conj(chirp_[0]);
+        for (std::int64_t k = 1; k < n_; ++k)
+            kernel[k] = kernel[conv_size_ - k] = std::conj(chirp_[k]);
+        conv_->template execute<false>(kernel.data(), work.data());
+        const T scale = T(1) / static_cast<T>(conv_size_);
+        for (auto& v : kernel)
+            v *= scale;
+        kernel_ = std::move(kernel);
+    }
+
+    // The backward transform is conj(forward(conj(x))); the conjugations fold into the chirp
+    // multiplications.
+    template <bool Inverse>
+    void bluestein(complex_t* data, complex_t* work) const {
+        complex_t* a = work;
+        complex_t* conv_work = work + conv_size_;
+        for (std::int64_t k = 0; k < n_; ++k)
+            a[k] = cmul(Inverse ? std::conj(data[k]) : data[k], chirp_[k]);
+        std::fill(a + n_, a + conv_size_, complex_t{});
+        conv_->template execute<false>(a, conv_work);
+        for (std::int64_t k = 0; k < conv_size_; ++k)
+            a[k] = cmul(a[k], kernel_[k]);
+        conv_->template execute<true>(a, conv_work);
+        for (std::int64_t k = 0; k < n_; ++k) {
+            const complex_t v = cmul(a[k], chirp_[k]);
+            data[k] = Inverse ? std::conj(v) : v;
+        }
+    }
+
+    std::int64_t n_ = 1;
+    std::vector<stage> stages_;
+
+    std::int64_t conv_size_ = 0;
+    std::shared_ptr<const fft1d<T>> conv_;
+    std::vector<complex_t> chirp_;
+    std::vector<complex_t> kernel_;
+};
+
+// Real-to-complex and complex-to-real transforms of length n. The complex side holds the
+// n / 2 + 1 non-redundant elements of the conjugate-even sequence.
+template <typename T>
+class real_fft {
+public:
+    using complex_t = std::complex<T>;
+
+    real_fft() = default;
+
+    // radices are those of the complex transform, of length complex_size(n).
+    explicit real_fft(std::int64_t n, std::vector<int> radices = {}) : n_(n) {
+        if (n % 2 == 0) {
+            const std::int64_t half = n / 2;
+            fft_ = fft1d<T>(half, std::move(radices));
+            twiddles_.resize(static_cast<std::size_t>(half + 1));
+            for (std::int64_t k = 0; k <= half; ++k)
+                twiddles_[k] = root_of_unity<T>(k, n);
+        }
+        else {
+            fft_ = fft1d<T>(n, std::move(radices));
+        }
+    }
+
+    // The length of the complex transform of a real transform of length n.
+    static std::int64_t complex_size(std::int64_t n) {
+        return n % 2 ? n : n / 2;
+    }
+
+    std::int64_t size() const noexcept {
+        return n_;
+    }
+
+    std::int64_t work_size() const noexcept {
+        return fft_.size() + fft_.work_size();
+    }
+
+    void forward(const T* x, complex_t* out, complex_t* work) const {
+        complex_t* z = work;
+        complex_t* fft_work = work + fft_.size();
+        if (n_ % 2) {
+            for (std::int64_t j = 0; j < n_; ++j)
+                z[j] = complex_t(x[j], T(0));
+            fft_.template execute<false>(z, fft_work);
+            std::copy(z, z + n_ / 2 + 1, out);
+            return;
+        }
+        // Transform the even and odd samples together as one complex sequence of length n / 2,
+        // then separate their spectra and combine them with one radix-2 step.
+        const std::int64_t half = n_ / 2;
+        for (std::int64_t j = 0; j < half; ++j)
+            z[j] = complex_t(x[2 * j], x[2 * j + 1]);
+        fft_.template execute<false>(z, fft_work);
+        for (std::int64_t k = 0; k <= half; ++k) {
+            const complex_t zk = z[k == half ? 0 : k];
+            const complex_t zc = std::conj(z[k == 0 ? 0 : half - k]);
+            const complex_t even = (zk + zc) * T(0.5);
+            const complex_t odd = rotate<false>(zk - zc) * T(0.5);
+            out[k] = even + cmul(odd, twiddles_[k]);
+        }
+    }
+
+    void backward(const complex_t* in, T* x, complex_t* work) const {
+        complex_t* z = work;
+        complex_t* fft_work = work + fft_.size();
+        if (n_ % 2) {
+            const std::int64_t last = n_ / 2;
+            for (std::int64_t k = 0; k <= last; ++k)
+                z[k] = in[k];
+            for (std::int64_t k = last + 1; k < n_; ++k)
+                z[k] = std::conj(in[n_ - k]);
+            fft_.template execute<true>(z, fft_work);
+            for (std::int64_t j = 0; j < n_; ++j)
+                x[j] = z[j].real();
+            return;
+        }
+        const std::int64_t half = n_ / 2;
+        for (std::int64_t k = 0; k < half; ++k) {
+            const complex_t xk = in[k];
+            const complex_t xc = std::conj(in[half - k]);
+            const complex_t even = xk + xc;
+            const complex_t odd = cmul_conj(xk - xc, twiddles_[k]);
+            z[k] = even + rotate<true>(odd);
+        }
+        fft_.template execute<true>(z, fft_work);
+        for (std::int64_t j = 0; j < half; ++j) {
+            x[2 * j] = z[j].real();
+            x[2 * j + 1] = z[j].imag();
+        }
+    }
+
+private:
+    std::int64_t n_ = 1;
+    fft1d<T> fft_;
+    std::vector<complex_t> twiddles_;
+};
+
+} // namespace oneapi::mkl::dft::portable::detail
+
+#endif // _ONEMKL_DFT_SRC_PORTABLE_STOCKHAM_HPP_
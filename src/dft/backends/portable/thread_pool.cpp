@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dft/backends/portable/thread_pool.hpp"
+
+namespace oneapi::mkl::dft::portable::detail {
+
+namespace {
+
+// One call of run: the next index to hand out and the number of finished calls, both guarded by
+// the mutex of the pool.
+struct job {
+    void (*call)(void*, std::int64_t);
+    void* context;
+    std::int64_t count;
+    std::int64_t next;
+    std::int64_t finished;
+};
+
+class workers {
+public:
+    workers() {
+        const auto threads = std::max(std::thread::hardware_concurrency(), 1u);
+        for (unsigned t = 1; t < threads; ++t)
+            threads_.emplace_back([this]() { work(); });
+    }
+
+    ~workers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& thread : threads_)
+            thread.join();
+    }
+
+    std::int64_t size() const {
+        return static_cast<std::int64_t>(threads_.size()) + 1;
+    }
+
+    void run(job& j) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        jobs_.push_back(&j);
+        wake_.notify_all();
+        // Help with the job until every index is handed out, then wait for the workers still
+        // running some of them.
+        while (j.next < j.count)
+            call(lock, j);
+        finished_.wait(lock, [&]() { return j.finished == j.count; });
+    }
+
+private:
+    // Run the next index of j, which the lock holds on entry and on return.
+    void call(std::unique_lock<std::mutex>& lock, job& j) {
+        const std::int64_t i = j.next++;
+        if (j.next == j.count)
+            jobs_.erase(std::find(jobs_.begin(), jobs_.end(), &j));
+        lock.unlock();
+        j.call(j.context, i);
+        lock.lock();
+        if (++j.finished == j.count)
+            finished_.notify_all();
+    }
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            wake_.wait(lock, [&]() { return stop_ || !jobs_.empty(); });
+            if (stop_)
+                return;
+            call(lock, *jobs_.front());
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable finished_;
+    // Jobs with indices left to hand out, oldest first.
+    std::deque<job*> jobs_;
+    std::vector<std::thread> threads_;
+    bool stop_ = false;
+};
+
+workers& pool() {
+    static workers instance;
+    return instance;
+}
+
+} // namespace
+
+std::int64_t thread_pool::size() {
+    return pool().size();
+}
+
+void thread_pool::run(std::int64_t count, void (*call)(void*, std::int64_t), void* context) {
+    if (count <= 0)
+        return;
+    job j{ call, context, count, 0, 0 };
+    pool().run(j);
+}
+
+} // namespace oneapi::mkl::dft::portable::detail
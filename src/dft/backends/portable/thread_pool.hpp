@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_SRC_PORTABLE_THREAD_POOL_HPP_
+#define _ONEMKL_DFT_SRC_PORTABLE_THREAD_POOL_HPP_
+
+#include <cstdint>
+
+namespace oneapi::mkl::dft::portable::detail {
+
+// The worker threads shared by every plan of the process: hardware_concurrency() - 1 workers,
+// started by the first parallel call and joined at exit.
+//
+// run(count, task) calls task(i) once for each i in [0, count). The calling thread takes part in
+// the work and returns once every call has finished, so a task may itself call run without
+// waiting on workers that are all busy. Tasks must not throw.
+class thread_pool {
+public:
+    // The number of threads that can run tasks at the same time, the caller included.
+    static std::int64_t size();
+
+    template <typename Task>
+    static void run(std::int64_t count, Task& task) {
+        run(count, [](void* context, std::int64_t i) { (*static_cast<Task*>(context))(i); },
+            &task);
+    }
+
+    static void run(std::int64_t count, void (*call)(void*, std::int64_t), void* context);
+};
+
+} // namespace oneapi::mkl::dft::portable::detail
+
+#endif // _ONEMKL_DFT_SRC_PORTABLE_THREAD_POOL_HPP_
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_SRC_PORTABLE_TUNING_HPP_
+#define _ONEMKL_DFT_SRC_PORTABLE_TUNING_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "dft/backends/portable/stockham.hpp"
+#include "dft/backends/portable/wisdom.hpp"
+
+// Commit-time tuning of the portable backend. Candidate plans are timed on zeros, which take as
+// long as any data and stay finite however often they are transformed, and the fastest is
+// recorded as wisdom so that it is measured once per process, or never for imported wisdom.
+
+namespace oneapi::mkl::dft::portable::detail {
+
+// config_param::TUNING_LEVEL.
+enum class tuning_level { none, measure, exhaustive };
+
+// The shortest time of a call to f over a few samples, in seconds. Calls too short for the clock
+// are repeated within each sample.
+template <typename F>
+double seconds_per_call(F f) {
+    using clock = std::chrono::steady_clock;
+    constexpr double min_sample_seconds = 1e-4;
+    constexpr std::int64_t max_calls = std::int64_t{ 1 } << 20;
+    std::int64_t calls = 1;
+    double best = std::numeric_limits<double>::infinity();
+    for (int samples = 0; samples < 3;) {
+        const auto start = clock::now();
+        for (std::int64_t c = 0; c < calls; ++c)
+            f();
+        const double seconds = std::chrono::duration<double>(clock::now() - start).count();
+        if (seconds < min_sample_seconds && calls < max_calls) {
+            calls *= 2;
+            continue;
+        }
+        best = std::min(best, seconds / static_cast<double>(calls));
+        ++samples;
+    }
+    return best;
+}
+
+template <typename T>
+std::string wisdom_key(const char* name) {
+    return std::string(name) + (std::is_same_v<T, double> ? "/d" : "/s");
+}
+
+// The radices of the transforms of length n: the default factorization without tuning,
+// otherwise the recorded choice or the fastest candidate, which is then recorded.
+template <typename T>
+std::vector<int> tuned_radices(std::int64_t n, tuning_level level) {
+    if (level == tuning_level::none)
+        return {};
+    const auto candidates = fft1d<T>::candidate_radices(n);
+    if (candidates.size() < 2)
+        return {};
+    const std::string key = wisdom_key<T>("fft1d") + "/" + std::to_string(n);
+    // fft1d falls back to the default factorization for a recorded choice that does not fit.
+    if (auto choice = wisdom::find(key))
+        return std::vector<int>(choice->begin(), choice->end());
+
+    std::vector<std::complex<T>> data(static_cast<std::size_t>(n)), work;
+    std::vector<int> best;
+    double best_seconds = std::numeric_limits<double>::infinity();
+    for (const auto& radices : candidates) {
+        const fft1d<T> fft(n, radices);
+        work.resize(static_cast<std::size_t>(fft.work_size()));
+        const double seconds = seconds_per_call(
+            [&]() { fft.template execute<false>(data.data(), work.data()); });
+        if (seconds < best_seconds) {
+            best_seconds = seconds;
+            best = radices;
+        }
+    }
+    wisdom::record(key, std::vector<std::int64_t>(best.begin(), best.end()));
+    return best;
+}
+
+} // namespace oneapi::mkl::dft::portable::detail
+
+#endif // _ONEMKL_DFT_SRC_PORTABLE_TUNING_HPP_
@@ -0,0 +1,175 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "oneapi/mkl/exceptions.hpp"
+
+#include "oneapi/mkl/dft/detail/portable/onemkl_dft_portable.hpp"
+
+#include "dft/backends/portable/stockham.hpp"
+#include "dft/backends/portable/wisdom.hpp"
+
+namespace oneapi::mkl::dft::portable {
+namespace detail {
+
+namespace {
+
+constexpr const char* wisdom_header = "onemkl-dft-portable-wisdom 1";
+
+struct wisdom_store {
+    std::mutex mutex;
+    std::map<std::string, std::vector<std::int64_t>> choices;
+};
+
+wisdom_store& store() {
+    static wisdom_store instance;
+    return instance;
+}
+
+// The positive integer of a whole key field, or 0.
+std::int64_t key_length(const std::string& field) {
+    if (field.empty() || field.size() > 18 ||
+        field.find_first_not_of("0123456789") != std::string::npos) {
+        return 0;
+    }
+    return std::stoll(field);
+}
+
+// Whether values are a choice that could have been recorded for key: radices with a butterfly
+// that multiply to the key's length for "fft1d/<precision>/<length>", or one positive line block
+// for "lines/<domain>/<precision>/<lengths>...".
+bool consistent(const std::string& key, const std::vector<std::int64_t>& values) {
+    std::vector<std::string> fields;
+    std::istringstream parts(key);
+    for (std::string field; std::getline(parts, field, '/');)
+        fields.push_back(field);
+    auto is_precision = [](const std::string& f) { return f == "s" || f == "d"; };
+    if (fields.size() == 3 && fields[0] == "fft1d" && is_precision(fields[1])) {
+        for (auto radix : values) {
+            if (radix > std::numeric_limits<int>::max())
+                return false;
+        }
+        // The radices do not depend on the precision.
+        return fft1d<float>::factorizes(key_length(fields[2]),
+                                        std::vector<int>(values.begin(), values.end()));
+    }
+    if (fields.size() >= 4 && fields[0] == "lines" && (fields[1] == "r" || fields[1] == "c") &&
+        is_precision(fields[2])) {
+        for (std::size_t i = 3; i < fields.size(); ++i) {
+            if (key_length(fields[i]) == 0)
+                return false;
+        }
+        return values.size() == 1 && values.front() > 0;
+    }
+    return false;
+}
+
+} // namespace
+
+std::optional<std::vector<std::int64_t>> wisdom::find(const std::string& key) {
+    auto& s = store();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    const auto it = s.choices.find(key);
+    if (it == s.choices.end())
+        return std::nullopt;
+    return it->second;
+}
+
+void wisdom::record(const std::string& key, std::vector<std::int64_t> values) {
+    auto& s = store();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.choices[key] = std::move(values);
+}
+
+std::string wisdom::save() {
+    auto& s = store();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    std::ostringstream text;
+    text << wisdom_header << '\n';
+    for (const auto& [key, values] : s.choices) {
+        text << key;
+        for (auto v : values)
+            text << ' ' << v;
+        text << '\n';
+    }
+    return text.str();
+}
+
+void wisdom::load(const std::string& text) {
+    // Parse everything before adding anything, so that malformed text changes nothing.
+    std::istringstream lines(text);
+    std::string line;
+    if (!std::getline(lines, line) || line != wisdom_header) {
+        throw mkl::invalid_argument("DFT", "import_wisdom",
+                                    "Wisdom does not start with the expected header.");
+    }
+    std::map<std::string, std::vector<std::int64_t>> parsed;
+    while (std::getline(lines, line)) {
+        if (line.empty())
+            continue;
+        std::istringstream fields(line);
+        std::string key;
+        fields >> key;
+        std::vector<std::int64_t> values;
+        std::int64_t v;
+        while (fields >> v)
+            values.push_back(v);
+        if (values.empty() || !fields.eof()) {
+            throw mkl::invalid_argument("DFT", "import_wisdom",
+                                        "Malformed wisdom entry: " + line);
+        }
+        if (!consistent(key, values)) {
+            throw mkl::invalid_argument("DFT", "import_wisdom",
+                                        "Inconsistent wisdom entry: " + line);
+        }
+        parsed[key] = std::move(values);
+    }
+    auto& s = store();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    for (auto& [key, values] : parsed)
+        s.choices[key] = std::move(values);
+}
+
+void wisdom::clear() {
+    auto& s = store();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.choices.clear();
+}
+
+} // namespace detail
+
+std::string export_wisdom() {
+    return detail::wisdom::save();
+}
+
+void import_wisdom(const std::string& wisdom) {
+    detail::wisdom::load(wisdom);
+}
+
+void forget_wisdom() {
+    detail::wisdom::clear();
+}
+
+} // namespace oneapi::mkl::dft::portable
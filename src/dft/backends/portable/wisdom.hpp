@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_SRC_PORTABLE_WISDOM_HPP_
+#define _ONEMKL_DFT_SRC_PORTABLE_WISDOM_HPP_
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace oneapi::mkl::dft::portable::detail {
+
+// The choices made by tuned commits, shared by every plan of the process. A key names what was
+// tuned, e.g. "fft1d/d/2310" for the radices of the double precision transforms of length 2310,
+// and maps to the chosen values.
+//
+// As text, wisdom is a header line followed by one line per key: the key and its values,
+// separated by spaces.
+class wisdom {
+public:
+    static std::optional<std::vector<std::int64_t>> find(const std::string& key);
+
+    static void record(const std::string& key, std::vector<std::int64_t> values);
+
+    static std::string save();
+
+    // Add the choices of text, which replace those with the same keys.
+    static void load(const std::string& text);
+
+    static void clear();
+};
+
+} // namespace oneapi::mkl::dft::portable::detail
+
+#endif // _ONEMKL_DFT_SRC_PORTABLE_WISDOM_HPP_
@@ -65,7 +65,7 @@ ONEMKL_EXPORT void compute_backward(descriptor_type &desc,
     auto info = detail::get_bwd_info(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         offsets[0] *= 2; // offset is supplied in complex but we offset scalar pointer
     }
     if (offsets[0] != offsets[1]) {
@@ -221,7 +221,7 @@ ONEMKL_EXPORT sycl::event compute_backward(descriptor_type &desc, fwd<descriptor
     auto info = detail::get_bwd_info(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         offsets[0] *= 2; // offset is supplied in complex but we offset scalar pointer
     }
     if (offsets[0] != offsets[1]) {
@@ -335,7 +335,9 @@ ONEMKL_EXPORT sycl::event compute_backward(descriptor_type &desc, scalar<descrip
     });
 }
 
-// Template function instantiations
+// Template function instantiations. rocFFT has no bfloat16 transforms.
+#define ONEMKL_DFT_HALF_INSTANTIATIONS
 #include "dft/backends/backend_backward_instantiations.cxx"
+#undef ONEMKL_DFT_HALF_INSTANTIATIONS
 
 } // namespace oneapi::mkl::dft::rocfft
@@ -149,6 +149,24 @@ public:
         // this could be a recommit
         clean_plans();
 
+        if (config_values.workspace_placement != dft::config_value::WORKSPACE_AUTOMATIC) {
+            throw mkl::unimplemented("dft/backends/rocfft", __FUNCTION__,
+                                     "rocFFT backend only supports automatic workspace placement");
+        }
+        if (config_values.transpose) {
+            throw mkl::unimplemented("dft/backends/rocfft", __FUNCTION__,
+                                     "rocFFT backend does not support transposed output");
+        }
+        if (config_values.max_working_set_bytes != 0) {
+            throw mkl::unimplemented("dft/backends/rocfft", __FUNCTION__,
+                                     "rocFFT backend does not support bounding the working set");
+        }
+        if (config_values.pruned_input_length != 0 || config_values.pruned_output_offset != 0 ||
+            config_values.pruned_output_length != 0) {
+            throw mkl::unimplemented("dft/backends/rocfft", __FUNCTION__,
+                                     "rocFFT backend does not support pruned transforms");
+        }
+
         const rocfft_result_placement placement =
             (config_values.placement == dft::config_value::INPLACE) ? rocfft_placement_inplace
                                                                     : rocfft_placement_notinplace;
@@ -174,6 +192,9 @@ public:
             if constexpr (prec == dft::precision::SINGLE) {
                 return rocfft_precision_single;
             }
+            else if constexpr (prec == dft::precision::HALF) {
+                return rocfft_precision_half;
+            }
             else {
                 return rocfft_precision_double;
             }
@@ -461,7 +482,17 @@ public:
 template <dft::precision prec, dft::domain dom>
 dft::detail::commit_impl<prec, dom>* create_commit(const dft::detail::descriptor<prec, dom>& desc,
                                                    sycl::queue& sycl_queue) {
-    return new detail::rocfft_commit<prec, dom>(sycl_queue, desc.get_values());
+    if constexpr (prec == dft::detail::precision::BFLOAT16) {
+        throw mkl::unimplemented("dft/backends/rocfft", "create_commit",
+                                 "rocFFT does not support bfloat16 precision.");
+    }
+    else if constexpr (dom == dft::detail::domain::REAL_REAL) {
+        throw mkl::unimplemented("dft/backends/rocfft", "create_commit",
+                                 "The real_real domain is only supported by the portable backend.");
+    }
+    else {
+        return new detail::rocfft_commit<prec, dom>(sycl_queue, desc.get_values());
+    }
 }
 
 template dft::detail::commit_impl<dft::detail::precision::SINGLE, dft::detail::domain::REAL>*
@@ -480,6 +511,30 @@ template dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::d
 create_commit(
     const dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::COMPLEX>&,
     sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::BFLOAT16, dft::detail::domain::COMPLEX>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::SINGLE, dft::detail::domain::REAL_REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::SINGLE, dft::detail::domain::REAL_REAL>&,
+    sycl::queue&);
+template dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::domain::REAL_REAL>*
+create_commit(
+    const dft::detail::descriptor<dft::detail::precision::DOUBLE, dft::detail::domain::REAL_REAL>&,
+    sycl::queue&);
 
 namespace detail {
 template <dft::precision prec, dft::domain dom>
@@ -498,6 +553,12 @@ get_offsets<dft::detail::precision::DOUBLE, dft::detail::domain::REAL>(
 template std::array<std::int64_t, 2>
 get_offsets<dft::detail::precision::DOUBLE, dft::detail::domain::COMPLEX>(
     dft::detail::commit_impl<dft::detail::precision::DOUBLE, dft::detail::domain::COMPLEX>*);
+template std::array<std::int64_t, 2>
+get_offsets<dft::detail::precision::HALF, dft::detail::domain::REAL>(
+    dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::REAL>*);
+template std::array<std::int64_t, 2>
+get_offsets<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>(
+    dft::detail::commit_impl<dft::detail::precision::HALF, dft::detail::domain::COMPLEX>*);
 
 } //namespace detail
 
@@ -47,6 +47,13 @@ inline dft::detail::commit_impl<prec, dom> *checked_get_commit(
     return commit_handle;
 }
 
+/// Whether the forward domain data of descriptor_type is real. std::is_floating_point does not
+/// hold for the sycl::half data of HALF descriptors.
+template <typename descriptor_type>
+inline constexpr bool is_real_forward = std::is_same_v<
+    typename dft::detail::descriptor_info<descriptor_type>::forward_type,
+    typename dft::detail::descriptor_info<descriptor_type>::scalar_type>;
+
 /// Throw an mkl::invalid_argument if the runtime param in the descriptor does not match
 /// the expected value.
 template <dft::config_param Param, dft::config_value Expected, typename DescT>
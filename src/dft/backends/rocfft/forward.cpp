@@ -68,7 +68,7 @@ ONEMKL_EXPORT void compute_forward(descriptor_type &desc,
     auto info = detail::get_fwd_info(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         offsets[1] *= 2; // offset is supplied in complex but we offset scalar pointer
     }
     if (offsets[0] != offsets[1]) {
@@ -223,7 +223,7 @@ ONEMKL_EXPORT sycl::event compute_forward(descriptor_type &desc, fwd<descriptor_
     auto info = detail::get_fwd_info(commit);
     auto offsets = detail::get_offsets(commit);
 
-    if constexpr (std::is_floating_point_v<fwd<descriptor_type>>) {
+    if constexpr (detail::is_real_forward<descriptor_type>) {
         offsets[1] *= 2; // offset is supplied in complex but we offset scalar pointer
     }
     if (offsets[0] != offsets[1]) {
@@ -336,7 +336,9 @@ ONEMKL_EXPORT sycl::event compute_forward(descriptor_type &desc, scalar<descript
     });
 }
 
-// Template function instantiations
+// Template function instantiations. rocFFT has no bfloat16 transforms.
+#define ONEMKL_DFT_HALF_INSTANTIATIONS
 #include "dft/backends/backend_forward_instantiations.cxx"
+#undef ONEMKL_DFT_HALF_INSTANTIATIONS
 
 } // namespace oneapi::mkl::dft::rocfft
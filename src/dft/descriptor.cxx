@@ -16,12 +16,14 @@
 *
 * SPDX-License-Identifier: Apache-2.0
 *******************************************************************************/
+#include <algorithm>
 #include <cstdarg>
 
 #include "oneapi/mkl/detail/exceptions.hpp"
 #include "oneapi/mkl/dft/descriptor.hpp"
 
 #include "dft/descriptor_config_helper.hpp"
+#include "dft/plan_cache.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -120,6 +122,34 @@ void descriptor<prec, dom>::set_value(config_param param, ...) {
         case config_param::COMMIT_STATUS:
             throw mkl::invalid_argument("DFT", "set_value", "Read-only parameter.");
             break;
+        case config_param::WORKSPACE_PLACEMENT:
+            detail::set_value<config_param::WORKSPACE_PLACEMENT>(values_,
+                                                                 va_arg(vl, config_value));
+            break;
+        case config_param::WORKSPACE_EXTERNAL_BYTES:
+            throw mkl::invalid_argument("DFT", "set_value", "Read-only parameter.");
+            break;
+        case config_param::MAX_WORKING_SET_BYTES:
+            detail::set_value<config_param::MAX_WORKING_SET_BYTES>(values_,
+                                                                   va_arg(vl, std::int64_t));
+            break;
+        case config_param::REAL_REAL_KIND:
+            detail::set_value<config_param::REAL_REAL_KIND>(values_, va_arg(vl, config_value));
+            break;
+        case config_param::TUNING_LEVEL:
+            detail::set_value<config_param::TUNING_LEVEL>(values_, va_arg(vl, config_value));
+            break;
+        case config_param::PRUNED_INPUT_LENGTH:
+            detail::set_value<config_param::PRUNED_INPUT_LENGTH>(values_, va_arg(vl, std::int64_t));
+            break;
+        case config_param::PRUNED_OUTPUT_OFFSET:
+            detail::set_value<config_param::PRUNED_OUTPUT_OFFSET>(values_,
+                                                                  va_arg(vl, std::int64_t));
+            break;
+        case config_param::PRUNED_OUTPUT_LENGTH:
+            detail::set_value<config_param::PRUNED_OUTPUT_LENGTH>(values_,
+                                                                  va_arg(vl, std::int64_t));
+            break;
         default: throw mkl::invalid_argument("DFT", "set_value", "Invalid config_param argument.");
     }
     va_end(vl);
@@ -151,6 +181,13 @@ descriptor<prec, dom>::descriptor(std::vector<std::int64_t> dimensions) {
     values_.ordering = config_value::ORDERED;
     values_.transpose = false;
     values_.packed_format = config_value::CCE_FORMAT;
+    values_.workspace_placement = config_value::WORKSPACE_AUTOMATIC;
+    values_.max_working_set_bytes = 0;
+    values_.real_real_kind = config_value::DCT_II;
+    values_.tuning_level = config_value::TUNING_NONE;
+    values_.pruned_input_length = 0;
+    values_.pruned_output_offset = 0;
+    values_.pruned_output_length = 0;
     values_.dimensions = std::move(dimensions);
 }
 
@@ -158,6 +195,27 @@ template <precision prec, domain dom>
 descriptor<prec, dom>::descriptor(std::int64_t length)
         : descriptor<prec, dom>(std::vector<std::int64_t>{ length }) {}
 
+template <precision prec, domain dom>
+descriptor<prec, dom>::descriptor(const descriptor<prec, dom>& other)
+        : pimpl_(other.pimpl_),
+          create_(other.create_),
+          committed_values_(other.committed_values_),
+          values_(other.values_),
+          parts_(other.parts_) {
+    // workspace_ is left unset: a copy computing concurrently with other must not share its
+    // external workspace, so set_workspace has to be called on the copy too.
+    unshare_commit();
+}
+
+template <precision prec, domain dom>
+descriptor<prec, dom>& descriptor<prec, dom>::operator=(const descriptor<prec, dom>& other) {
+    if (this != &other) {
+        descriptor copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
 template <precision prec, domain dom>
 descriptor<prec, dom>::descriptor(descriptor<prec, dom>&& other) = default;
 
@@ -167,6 +225,109 @@ descriptor<prec, dom>& descriptor<prec, dom>::operator=(descriptor<prec, dom>&&)
 template <precision prec, domain dom>
 descriptor<prec, dom>::~descriptor() = default;
 
+template <precision prec, domain dom>
+void descriptor<prec, dom>::commit_cached(sycl::queue& queue, create_commit_fn create) {
+    if (pimpl_ && pimpl_->get_queue() != queue) {
+        pimpl_->get_queue().wait();
+    }
+    pimpl_ = plan_cache<prec, dom>::instance().acquire(create, *this, queue);
+    create_ = create;
+    committed_values_ = values_;
+    // The workspace size may have changed, so an external workspace must be set again.
+    workspace_ = external_workspace<real_t>{};
+    parts_.clear();
+}
+
+template <precision prec, domain dom>
+void descriptor<prec, dom>::unshare_commit() {
+    if (!pimpl_ || is_shareable(*pimpl_)) {
+        return;
+    }
+    // Build the plans again from the values they were committed with, which may differ from
+    // values_ if the descriptor was reconfigured since.
+    descriptor committed(committed_values_.dimensions);
+    committed.values_ = committed_values_;
+    sycl::queue queue = pimpl_->get_queue();
+    pimpl_ = plan_cache<prec, dom>::instance().acquire(create_, committed, queue);
+    workspace_ = external_workspace<real_t>{};
+}
+
+template <precision prec, domain dom>
+void descriptor<prec, dom>::release_cached_plans() {
+    plan_cache<prec, dom>::instance().release();
+}
+
+template <precision prec, domain dom>
+void descriptor<prec, dom>::set_plan_cache_capacity(std::int64_t capacity) {
+    if (capacity < 0) {
+        throw mkl::invalid_argument("DFT", "set_plan_cache_capacity",
+                                    "The capacity must not be negative.");
+    }
+    plan_cache<prec, dom>::instance().set_capacity(static_cast<std::size_t>(capacity));
+}
+
+template <precision prec, domain dom>
+void descriptor<prec, dom>::commit_split(const std::vector<sycl::queue>& queues,
+                                         create_commit_fn create) {
+    if (queues.empty()) {
+        throw mkl::invalid_argument("DFT", "commit", "At least one queue is required.");
+    }
+    const std::int64_t batches = values_.number_of_transforms;
+    const std::int64_t parts = std::min(static_cast<std::int64_t>(queues.size()), batches);
+    if (parts > 1 && values_.workspace_placement == config_value::WORKSPACE_EXTERNAL) {
+        throw mkl::invalid_argument("DFT", "commit",
+                                    "An external workspace cannot be split across queues.");
+    }
+    sycl::queue first = queues.front();
+    commit_cached(first, create);
+    if (parts < 2) {
+        return;
+    }
+    std::vector<descriptor> committed_parts;
+    for (std::int64_t i = 0; i < parts; ++i) {
+        // Not a copy of *this, which would build plans for the first queue on some backends.
+        descriptor part(values_.dimensions);
+        part.values_ = values_;
+        part.values_.number_of_transforms = batches / parts + (i < batches % parts ? 1 : 0);
+        sycl::queue queue = queues[static_cast<std::size_t>(i)];
+        part.commit_cached(queue, create);
+        committed_parts.push_back(std::move(part));
+    }
+    parts_ = std::move(committed_parts);
+}
+
+template <precision prec, domain dom>
+void descriptor<prec, dom>::check_set_workspace() const {
+    if (!pimpl_) {
+        throw mkl::invalid_argument("DFT", "set_workspace",
+                                    "The descriptor must be committed before setting a workspace.");
+    }
+    if (values_.workspace_placement != config_value::WORKSPACE_EXTERNAL) {
+        throw mkl::invalid_argument("DFT", "set_workspace",
+                                    "Workspace placement must be WORKSPACE_EXTERNAL.");
+    }
+}
+
+template <precision prec, domain dom>
+void descriptor<prec, dom>::set_workspace(real_t* usm_workspace) {
+    check_set_workspace();
+    if (usm_workspace == nullptr && pimpl_->get_workspace_external_bytes() > 0) {
+        throw mkl::invalid_argument("DFT", "set_workspace", "Given nullptr.");
+    }
+    workspace_ = external_workspace<real_t>{ true, usm_workspace, std::nullopt };
+}
+
+template <precision prec, domain dom>
+void descriptor<prec, dom>::set_workspace(sycl::buffer<real_t, 1>& buffer_workspace) {
+    check_set_workspace();
+    if (static_cast<std::int64_t>(buffer_workspace.size() * sizeof(real_t)) <
+        pimpl_->get_workspace_external_bytes()) {
+        throw mkl::invalid_argument("DFT", "set_workspace",
+                                    "The workspace buffer is smaller than required.");
+    }
+    workspace_ = external_workspace<real_t>{ true, nullptr, buffer_workspace };
+}
+
 template <precision prec, domain dom>
 void descriptor<prec, dom>::get_value(config_param param, ...) const {
     va_list vl;
@@ -221,6 +382,39 @@ void descriptor<prec, dom>::get_value(config_param param, ...) const {
             *va_arg(vl, config_value*) =
                 pimpl_ ? config_value::COMMITTED : config_value::UNCOMMITTED;
             break;
+        case config_param::WORKSPACE_PLACEMENT:
+            *va_arg(vl, config_value*) = values_.workspace_placement;
+            break;
+        case config_param::WORKSPACE_EXTERNAL_BYTES:
+            if (!pimpl_) {
+                throw mkl::invalid_argument("DFT", "get_value",
+                                            "The descriptor must be committed to query the "
+                                            "external workspace size.");
+            }
+            *va_arg(vl, std::int64_t*) = pimpl_->get_workspace_external_bytes();
+            break;
+        case config_param::MAX_WORKING_SET_BYTES:
+            *va_arg(vl, std::int64_t*) = values_.max_working_set_bytes;
+            break;
+        case config_param::REAL_REAL_KIND:
+            if constexpr (dom != domain::REAL_REAL) {
+                throw mkl::invalid_argument("DFT", "get_value",
+                                            "Real-real kind requires the real_real domain.");
+            }
+            *va_arg(vl, config_value*) = values_.real_real_kind;
+            break;
+        case config_param::TUNING_LEVEL:
+            *va_arg(vl, config_value*) = values_.tuning_level;
+            break;
+        case config_param::PRUNED_INPUT_LENGTH:
+            *va_arg(vl, std::int64_t*) = values_.pruned_input_length;
+            break;
+        case config_param::PRUNED_OUTPUT_OFFSET:
+            *va_arg(vl, std::int64_t*) = values_.pruned_output_offset;
+            break;
+        case config_param::PRUNED_OUTPUT_LENGTH:
+            *va_arg(vl, std::int64_t*) = values_.pruned_output_length;
+            break;
         default: throw mkl::invalid_argument("DFT", "get_value", "Invalid config_param argument.");
     }
     va_end(vl);
@@ -230,6 +424,12 @@ template class descriptor<precision::SINGLE, domain::COMPLEX>;
 template class descriptor<precision::SINGLE, domain::REAL>;
 template class descriptor<precision::DOUBLE, domain::COMPLEX>;
 template class descriptor<precision::DOUBLE, domain::REAL>;
+template class descriptor<precision::HALF, domain::COMPLEX>;
+template class descriptor<precision::HALF, domain::REAL>;
+template class descriptor<precision::BFLOAT16, domain::COMPLEX>;
+template class descriptor<precision::BFLOAT16, domain::REAL>;
+template class descriptor<precision::SINGLE, domain::REAL_REAL>;
+template class descriptor<precision::DOUBLE, domain::REAL_REAL>;
 
 } //namespace detail
 } //namespace dft
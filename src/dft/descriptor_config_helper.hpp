@@ -44,6 +44,16 @@ struct real_helper<precision::DOUBLE> {
     using type = double;
 };
 
+template <>
+struct real_helper<precision::HALF> {
+    using type = float;
+};
+
+template <>
+struct real_helper<precision::BFLOAT16> {
+    using type = float;
+};
+
 template <precision Prec>
 using real_helper_t = typename real_helper<Prec>::type;
 
@@ -82,6 +92,14 @@ PARAM_TYPE_HELPER(config_param::ORDERING, config_value)
 PARAM_TYPE_HELPER(config_param::TRANSPOSE, bool)
 PARAM_TYPE_HELPER(config_param::PACKED_FORMAT, config_value)
 PARAM_TYPE_HELPER(config_param::COMMIT_STATUS, config_value)
+PARAM_TYPE_HELPER(config_param::WORKSPACE_PLACEMENT, config_value)
+PARAM_TYPE_HELPER(config_param::WORKSPACE_EXTERNAL_BYTES, std::int64_t)
+PARAM_TYPE_HELPER(config_param::MAX_WORKING_SET_BYTES, std::int64_t)
+PARAM_TYPE_HELPER(config_param::REAL_REAL_KIND, config_value)
+PARAM_TYPE_HELPER(config_param::TUNING_LEVEL, config_value)
+PARAM_TYPE_HELPER(config_param::PRUNED_INPUT_LENGTH, std::int64_t)
+PARAM_TYPE_HELPER(config_param::PRUNED_OUTPUT_OFFSET, std::int64_t)
+PARAM_TYPE_HELPER(config_param::PRUNED_OUTPUT_LENGTH, std::int64_t)
 #undef PARAM_TYPE_HELPER
 
 /** Set a value in dft_values, throwing on invalid args.
@@ -203,6 +221,65 @@ void set_value(dft_values<prec, dom>& vals,
             throw mkl::invalid_argument("DFT", "set_value", "Packed format must be CCE.");
         }
     }
+    else if constexpr (Param == config_param::WORKSPACE_PLACEMENT) {
+        if (set_val == config_value::WORKSPACE_AUTOMATIC ||
+            set_val == config_value::WORKSPACE_EXTERNAL) {
+            vals.workspace_placement = set_val;
+        }
+        else {
+            throw mkl::invalid_argument("DFT", "set_value",
+                                        "Workspace placement must be automatic or external.");
+        }
+    }
+    else if constexpr (Param == config_param::MAX_WORKING_SET_BYTES) {
+        if (set_val < 0) {
+            throw mkl::invalid_argument("DFT", "set_value",
+                                        "Maximum working set size must be non-negative.");
+        }
+        vals.max_working_set_bytes = set_val;
+    }
+    else if constexpr (Param == config_param::REAL_REAL_KIND) {
+        if constexpr (dom != domain::REAL_REAL) {
+            throw mkl::invalid_argument("DFT", "set_value",
+                                        "Real-real kind requires the real_real domain.");
+        }
+        else if (set_val == config_value::DCT_II || set_val == config_value::DCT_III ||
+                 set_val == config_value::DST_II || set_val == config_value::DST_III) {
+            vals.real_real_kind = set_val;
+        }
+        else {
+            throw mkl::invalid_argument(
+                "DFT", "set_value", "Real-real kind must be DCT_II, DCT_III, DST_II or DST_III.");
+        }
+    }
+    else if constexpr (Param == config_param::TUNING_LEVEL) {
+        if (set_val == config_value::TUNING_NONE || set_val == config_value::TUNING_MEASURE ||
+            set_val == config_value::TUNING_EXHAUSTIVE) {
+            vals.tuning_level = set_val;
+        }
+        else {
+            throw mkl::invalid_argument(
+                "DFT", "set_value",
+                "Tuning level must be TUNING_NONE, TUNING_MEASURE or TUNING_EXHAUSTIVE.");
+        }
+    }
+    else if constexpr (Param == config_param::PRUNED_INPUT_LENGTH ||
+                       Param == config_param::PRUNED_OUTPUT_OFFSET ||
+                       Param == config_param::PRUNED_OUTPUT_LENGTH) {
+        if (set_val < 0) {
+            throw mkl::invalid_argument("DFT", "set_value",
+                                        "Pruned lengths and offsets must be non-negative.");
+        }
+        if constexpr (Param == config_param::PRUNED_INPUT_LENGTH) {
+            vals.pruned_input_length = set_val;
+        }
+        else if constexpr (Param == config_param::PRUNED_OUTPUT_OFFSET) {
+            vals.pruned_output_offset = set_val;
+        }
+        else {
+            vals.pruned_output_length = set_val;
+        }
+    }
 }
 
 } // namespace detail
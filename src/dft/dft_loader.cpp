@@ -58,6 +58,51 @@ commit_impl<precision::DOUBLE, domain::REAL>* create_commit<precision::DOUBLE, d
     return function_tables[libkey].create_commit_sycl_dr(desc, sycl_queue);
 }
 
+template <>
+commit_impl<precision::HALF, domain::COMPLEX>* create_commit<precision::HALF, domain::COMPLEX>(
+    const descriptor<precision::HALF, domain::COMPLEX>& desc, sycl::queue& sycl_queue) {
+    auto libkey = get_device_id(sycl_queue);
+    return function_tables[libkey].create_commit_sycl_hz(desc, sycl_queue);
+}
+
+template <>
+commit_impl<precision::HALF, domain::REAL>* create_commit<precision::HALF, domain::REAL>(
+    const descriptor<precision::HALF, domain::REAL>& desc, sycl::queue& sycl_queue) {
+    auto libkey = get_device_id(sycl_queue);
+    return function_tables[libkey].create_commit_sycl_hr(desc, sycl_queue);
+}
+
+template <>
+commit_impl<precision::BFLOAT16, domain::COMPLEX>*
+create_commit<precision::BFLOAT16, domain::COMPLEX>(
+    const descriptor<precision::BFLOAT16, domain::COMPLEX>& desc, sycl::queue& sycl_queue) {
+    auto libkey = get_device_id(sycl_queue);
+    return function_tables[libkey].create_commit_sycl_bz(desc, sycl_queue);
+}
+
+template <>
+commit_impl<precision::BFLOAT16, domain::REAL>* create_commit<precision::BFLOAT16, domain::REAL>(
+    const descriptor<precision::BFLOAT16, domain::REAL>& desc, sycl::queue& sycl_queue) {
+    auto libkey = get_device_id(sycl_queue);
+    return function_tables[libkey].create_commit_sycl_br(desc, sycl_queue);
+}
+
+template <>
+commit_impl<precision::SINGLE, domain::REAL_REAL>*
+create_commit<precision::SINGLE, domain::REAL_REAL>(
+    const descriptor<precision::SINGLE, domain::REAL_REAL>& desc, sycl::queue& sycl_queue) {
+    auto libkey = get_device_id(sycl_queue);
+    return function_tables[libkey].create_commit_sycl_frr(desc, sycl_queue);
+}
+
+template <>
+commit_impl<precision::DOUBLE, domain::REAL_REAL>*
+create_commit<precision::DOUBLE, domain::REAL_REAL>(
+    const descriptor<precision::DOUBLE, domain::REAL_REAL>& desc, sycl::queue& sycl_queue) {
+    auto libkey = get_device_id(sycl_queue);
+    return function_tables[libkey].create_commit_sycl_drr(desc, sycl_queue);
+}
+
 template <precision prec, domain dom>
 inline oneapi::mkl::device get_device(descriptor<prec, dom>& desc, const char* func_name) {
     config_value is_committed{ config_value::UNCOMMITTED };
@@ -57,6 +57,41 @@ typedef struct {
         const oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::DOUBLE,
                                            oneapi::mkl::dft::domain::REAL>& desc,
         sycl::queue& sycl_queue);
+    oneapi::mkl::dft::detail::commit_impl<oneapi::mkl::dft::precision::HALF,
+                                          oneapi::mkl::dft::domain::COMPLEX>* (
+        *create_commit_sycl_hz)(
+        const oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::HALF,
+                                           oneapi::mkl::dft::domain::COMPLEX>& desc,
+        sycl::queue& sycl_queue);
+    oneapi::mkl::dft::detail::commit_impl<oneapi::mkl::dft::precision::HALF,
+                                          oneapi::mkl::dft::domain::REAL>* (*create_commit_sycl_hr)(
+        const oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::HALF,
+                                           oneapi::mkl::dft::domain::REAL>& desc,
+        sycl::queue& sycl_queue);
+    oneapi::mkl::dft::detail::commit_impl<oneapi::mkl::dft::precision::BFLOAT16,
+                                          oneapi::mkl::dft::domain::COMPLEX>* (
+        *create_commit_sycl_bz)(
+        const oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::BFLOAT16,
+                                           oneapi::mkl::dft::domain::COMPLEX>& desc,
+        sycl::queue& sycl_queue);
+    oneapi::mkl::dft::detail::commit_impl<oneapi::mkl::dft::precision::BFLOAT16,
+                                          oneapi::mkl::dft::domain::REAL>* (
+        *create_commit_sycl_br)(
+        const oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::BFLOAT16,
+                                           oneapi::mkl::dft::domain::REAL>& desc,
+        sycl::queue& sycl_queue);
+    oneapi::mkl::dft::detail::commit_impl<oneapi::mkl::dft::precision::SINGLE,
+                                          oneapi::mkl::dft::domain::REAL_REAL>* (
+        *create_commit_sycl_frr)(
+        const oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::SINGLE,
+                                           oneapi::mkl::dft::domain::REAL_REAL>& desc,
+        sycl::queue& sycl_queue);
+    oneapi::mkl::dft::detail::commit_impl<oneapi::mkl::dft::precision::DOUBLE,
+                                          oneapi::mkl::dft::domain::REAL_REAL>* (
+        *create_commit_sycl_drr)(
+        const oneapi::mkl::dft::descriptor<oneapi::mkl::dft::precision::DOUBLE,
+                                           oneapi::mkl::dft::domain::REAL_REAL>& desc,
+        sycl::queue& sycl_queue);
 } dft_function_table_t;
 
 #endif //_DFT_FUNCTION_TABLE_HPP_
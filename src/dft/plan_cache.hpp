@@ -0,0 +1,264 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_DFT_PLAN_CACHE_HPP_
+#define _ONEMKL_DFT_PLAN_CACHE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/detail/backends.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl/dft/detail/commit_impl.hpp"
+#include "oneapi/mkl/dft/detail/types_impl.hpp"
+#include "env_helper.hpp"
+
+// Process-wide cache of committed DFT plans.
+//
+// Committing a descriptor builds backend plans, which is expensive compared with the transforms
+// themselves for small sizes. With the cache enabled, descriptors committed with the same
+// configuration to the same queue through the same backend share one commit_impl from this cache
+// instead. A commit_impl is never recommitted once it is in the cache: changing a descriptor and
+// committing it again looks up, or builds, a different entry.
+//
+// cuFFT and rocFFT plans are never cached. Their compute calls bind the plan to the queue's
+// stream and run in a work area owned by the plan, so descriptors sharing one would race when used
+// from several threads.
+//
+// The cache holds the capacity most recently used plans of each precision and domain, 0 disabling
+// it. The capacity is read once, when the cache is first used, from the ONEMKL_DFT_PLAN_CACHE_SIZE
+// environment variable, with the DFT_PLAN_CACHE_SIZE CMake option (0 unless configured) as the
+// default; descriptor::set_plan_cache_capacity changes it at run time. A plan evicted or released
+// from the cache stays alive for as long as a descriptor still uses it. The queue rather than
+// only its device is part of the key because compute calls are submitted to the queue of the
+// commit_impl.
+
+namespace oneapi {
+namespace mkl {
+namespace dft {
+namespace detail {
+
+template <precision prec, domain dom>
+inline bool same_values(const dft_values<prec, dom>& a, const dft_values<prec, dom>& b) {
+    return a.dimensions == b.dimensions && a.input_strides == b.input_strides &&
+           a.output_strides == b.output_strides && a.bwd_scale == b.bwd_scale &&
+           a.fwd_scale == b.fwd_scale && a.number_of_transforms == b.number_of_transforms &&
+           a.fwd_dist == b.fwd_dist && a.bwd_dist == b.bwd_dist && a.placement == b.placement &&
+           a.complex_storage == b.complex_storage && a.real_storage == b.real_storage &&
+           a.conj_even_storage == b.conj_even_storage && a.workspace == b.workspace &&
+           a.ordering == b.ordering && a.transpose == b.transpose &&
+           a.packed_format == b.packed_format && a.workspace_placement == b.workspace_placement &&
+           a.max_working_set_bytes == b.max_working_set_bytes &&
+           a.real_real_kind == b.real_real_kind && a.tuning_level == b.tuning_level &&
+           a.pruned_input_length == b.pruned_input_length &&
+           a.pruned_output_offset == b.pruned_output_offset &&
+           a.pruned_output_length == b.pruned_output_length;
+}
+
+inline void hash_combine(std::size_t& seed, std::size_t value) {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+template <precision prec, domain dom>
+inline std::size_t hash_values(const dft_values<prec, dom>& values) {
+    using real_t = typename precision_t<prec>::real_t;
+    std::size_t seed = 0;
+    for (const auto* vec : { &values.dimensions, &values.input_strides, &values.output_strides }) {
+        hash_combine(seed, vec->size());
+        for (auto v : *vec) {
+            hash_combine(seed, std::hash<std::int64_t>{}(v));
+        }
+    }
+    hash_combine(seed, std::hash<real_t>{}(values.bwd_scale));
+    hash_combine(seed, std::hash<real_t>{}(values.fwd_scale));
+    hash_combine(seed, std::hash<std::int64_t>{}(values.number_of_transforms));
+    hash_combine(seed, std::hash<std::int64_t>{}(values.fwd_dist));
+    hash_combine(seed, std::hash<std::int64_t>{}(values.bwd_dist));
+    hash_combine(seed, std::hash<std::int64_t>{}(values.max_working_set_bytes));
+    for (auto v : { values.pruned_input_length, values.pruned_output_offset,
+                    values.pruned_output_length }) {
+        hash_combine(seed, std::hash<std::int64_t>{}(v));
+    }
+    for (auto v : { values.placement, values.complex_storage, values.real_storage,
+                    values.conj_even_storage, values.workspace, values.ordering,
+                    values.packed_format, values.workspace_placement, values.real_real_kind,
+                    values.tuning_level }) {
+        hash_combine(seed, std::hash<int>{}(static_cast<int>(v)));
+    }
+    hash_combine(seed, std::hash<bool>{}(values.transpose));
+    return seed;
+}
+
+// Whether a committed plan may be used by several descriptors at once.
+template <precision prec, domain dom>
+inline bool is_shareable(const commit_impl<prec, dom>& commit) {
+    const auto backend = commit.get_backend();
+    return backend != mkl::backend::cufft && backend != mkl::backend::rocfft;
+}
+
+template <precision prec, domain dom>
+class plan_cache {
+public:
+    using commit_ptr = std::shared_ptr<commit_impl<prec, dom>>;
+    // The create_commit entry point of a backend, or of the run-time dispatch loader. It
+    // identifies the backend in the cache key.
+    using create_fn = commit_impl<prec, dom>* (*)(const descriptor<prec, dom>&, sycl::queue&);
+
+    // The cache is never destroyed: releasing backend plans during static destruction could
+    // outlive the backend runtimes they belong to.
+    static plan_cache& instance() {
+        static plan_cache* cache = new plan_cache(static_cast<std::size_t>(
+            env_size("ONEMKL_DFT_PLAN_CACHE_SIZE", ONEMKL_DFT_PLAN_CACHE_SIZE)));
+        return *cache;
+    }
+
+    // Keep at most capacity plans, evicting the least recently used ones beyond it.
+    void set_capacity(std::size_t capacity) {
+        std::vector<commit_ptr> evicted;
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = capacity;
+        evict(evicted);
+    }
+
+    // Return a committed commit_impl for the configuration of desc on queue, creating and
+    // committing it with create if the cache has none.
+    commit_ptr acquire(create_fn create, const descriptor<prec, dom>& desc, sycl::queue& queue) {
+        const auto& values = desc.get_values();
+        if (capacity_ == 0) {
+            return create_and_commit(create, desc, queue);
+        }
+        std::size_t hash = std::hash<sycl::queue>{}(queue);
+        hash_combine(hash, std::hash<create_fn>{}(create));
+        hash_combine(hash, hash_values(values));
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (auto found = find(hash, create, queue, values)) {
+                return found;
+            }
+        }
+
+        // Build the plan without holding the lock, so that other configurations are not held up.
+        // Should another thread commit the same configuration meanwhile, its entry is kept.
+        auto committed = create_and_commit(create, desc, queue);
+        if (!is_shareable(*committed)) {
+            return committed;
+        }
+        std::vector<commit_ptr> evicted;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto found = find(hash, create, queue, values)) {
+            return found;
+        }
+        entries_.push_front(entry{ hash, create, queue, values, committed });
+        index_.emplace(hash, entries_.begin());
+        evict(evicted);
+        // The lock is released before the evicted plans, whose destructors may call the backend.
+        return committed;
+    }
+
+    // Drop every cached plan, along with the queues they hold.
+    void release() {
+        std::list<entry> released;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            index_.clear();
+            released.swap(entries_);
+        }
+    }
+
+private:
+    struct entry {
+        std::size_t hash;
+        create_fn create;
+        sycl::queue queue;
+        dft_values<prec, dom> values;
+        commit_ptr commit;
+    };
+    using entry_iterator = typename std::list<entry>::iterator;
+
+    explicit plan_cache(std::size_t capacity) : capacity_(capacity) {}
+
+    static commit_ptr create_and_commit(create_fn create, const descriptor<prec, dom>& desc,
+                                        sycl::queue& queue) {
+        commit_ptr committed(create(desc, queue));
+        committed->commit(desc.get_values());
+        return committed;
+    }
+
+    // Look up an entry and mark it as the most recently used. The caller holds the lock.
+    commit_ptr find(std::size_t hash, create_fn create, const sycl::queue& queue,
+                    const dft_values<prec, dom>& values) {
+        auto range = index_.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            auto& e = *it->second;
+            if (e.create == create && e.queue == queue && same_values(e.values, values)) {
+                entries_.splice(entries_.begin(), entries_, it->second);
+                return e.commit;
+            }
+        }
+        return nullptr;
+    }
+
+    // Move the least recently used plans beyond the capacity to evicted, to be released once
+    // the lock is. The caller holds the lock.
+    void evict(std::vector<commit_ptr>& evicted) {
+        while (entries_.size() > capacity_) {
+            auto& last = entries_.back();
+            erase_index(last.hash, std::prev(entries_.end()));
+            evicted.push_back(std::move(last.commit));
+            entries_.pop_back();
+        }
+    }
+
+    void erase_index(std::size_t hash, entry_iterator position) {
+        auto range = index_.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == position) {
+                index_.erase(it);
+                return;
+            }
+        }
+    }
+
+    // Changed under the lock, but read without it to skip the cache when it is disabled.
+    std::atomic<std::size_t> capacity_;
+    std::mutex mutex_;
+    // Most recently used first.
+    std::list<entry> entries_;
+    std::unordered_multimap<std::size_t, entry_iterator> index_;
+};
+
+} // namespace detail
+} // namespace dft
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _ONEMKL_DFT_PLAN_CACHE_HPP_
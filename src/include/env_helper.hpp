@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_ENV_HELPER_HPP_
+#define _ONEMKL_ENV_HELPER_HPP_
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+
+// Utility function to read a size or threshold from the environment: the value of the variable
+// name as a non-negative decimal integer, or default_value when the variable is unset or does
+// not hold one.
+inline std::int64_t env_size(const char *name, std::int64_t default_value) {
+    const char *text = std::getenv(name);
+    if (text == nullptr || *text == '\0')
+        return default_value;
+    char *end = nullptr;
+    errno = 0;
+    const long long value = std::strtoll(text, &end, 10);
+    if (errno != 0 || *end != '\0' || value < 0)
+        return default_value;
+    return static_cast<std::int64_t>(value);
+}
+
+#endif //_ONEMKL_ENV_HELPER_HPP_
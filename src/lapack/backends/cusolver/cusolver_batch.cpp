@@ -680,11 +680,7 @@ inline sycl::event getrf_batch(const char *func_name, Func func, sycl::queue &qu
         cgh.host_task([=](sycl::interop_handle ih) { sycl::free(ipiv32, queue); });
     });
 
-    // lapack_info_check calls queue.wait()
-    lapack_info_check(queue, devInfo, __func__, func_name, batch_size);
-    sycl::free(devInfo, queue);
-
-    return done_casting;
+    return lapack_info_check(queue, devInfo, done_casting, __func__, func_name, batch_size);
 }
 
 #define GETRF_STRIDED_BATCH_LAUNCHER_USM(TYPE, CUSOLVER_ROUTINE)                                 \
@@ -779,11 +775,7 @@ inline sycl::event getrf_batch(const char *func_name, Func func, sycl::queue &qu
         });
     });
 
-    // lapack_info_check calls queue.wait()
-    lapack_info_check(queue, devInfo, __func__, func_name, batch_size);
-    sycl::free(devInfo, queue);
-
-    return done_freeing;
+    return lapack_info_check(queue, devInfo, done_freeing, __func__, func_name, batch_size);
 }
 
 #define GETRF_BATCH_LAUNCHER_USM(TYPE, CUSOLVER_ROUTINE)                                         \
@@ -875,18 +867,22 @@ sycl::event getri_batch(const char *func_name, Func func, sycl::queue &queue, st
             [=](sycl::id<1> index) { a[index] = scratchpad[index]; });
     });
 
+    // Ordered after copy1 so that its event covers both copies
     auto copy2 = queue.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(done);
+        cgh.depends_on(copy1);
         cgh.parallel_for(
             sycl::range<1>{ static_cast<size_t>(ipiv32_size) }, [=](sycl::id<1> index) {
                 ipiv[(index / n) * stride_ipiv + index % n] = static_cast<int64_t>(ipiv32[index]);
             });
     });
-    copy1.wait();
-    copy2.wait();
-    sycl::free(ipiv32, queue);
-    sycl::free(devInfo, queue);
-    return done;
+
+    // Enqueue free memory, don't return event as not-neccessary for user to wait for ipiv32 being released
+    queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(copy2);
+        cgh.host_task([=]() { sycl::free(ipiv32, queue); });
+    });
+
+    return lapack_info_check(queue, devInfo, copy2, __func__, func_name, batch_size);
 }
 
 #define GETRI_BATCH_LAUNCHER_USM(TYPE, CUSOLVER_ROUTINE)                                          \
@@ -1202,6 +1198,8 @@ inline sycl::event potrf_batch(const char *func_name, Func func, sycl::queue &qu
 
     overflow_check(n, lda, stride_a, batch_size, scratchpad_size);
 
+    int *devInfo = sycl::malloc_device<int>(batch_size, queue);
+
     auto done = queue.submit([&](sycl::handler &cgh) {
         cgh.depends_on(dependencies);
         onemkl_cusolver_host_task(cgh, queue, [=](CusolverScopedContextHandler &sc) {
@@ -1220,13 +1218,13 @@ inline sycl::event potrf_batch(const char *func_name, Func func, sycl::queue &qu
             auto **a_dev_ = reinterpret_cast<cuDataType **>(a_dev);
 
             CUSOLVER_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_cublas_fill_mode(uplo),
-                                       (int)n, a_dev_, (int)lda, nullptr, (int)batch_size);
+                                       (int)n, a_dev_, (int)lda, devInfo, (int)batch_size);
 
             free(a_batched);
             cuMemFree(a_dev);
         });
     });
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name, batch_size);
 }
 
 // Scratchpad memory not needed as parts of buffer a is used as workspace memory
@@ -1260,6 +1258,8 @@ inline sycl::event potrf_batch(const char *func_name, Func func, sycl::queue &qu
         batch_size += group_sizes[i];
     }
 
+    int *devInfo = sycl::malloc_device<int>(batch_size, queue);
+
     auto done = queue.submit([&](sycl::handler &cgh) {
         cgh.depends_on(dependencies);
         onemkl_cusolver_host_task(cgh, queue, [=](CusolverScopedContextHandler &sc) {
@@ -1277,7 +1277,7 @@ inline sycl::event potrf_batch(const char *func_name, Func func, sycl::queue &qu
             // Does not use scratch so call cuSolver asynchronously and sync at end
             for (int64_t i = 0; i < group_count; i++) {
                 CUSOLVER_ERROR_FUNC_T(func_name, func, err, handle, get_cublas_fill_mode(uplo[i]),
-                                      (int)n[i], a_dev_ + offset, (int)lda[i], nullptr,
+                                      (int)n[i], a_dev_ + offset, (int)lda[i], devInfo + offset,
                                       (int)group_sizes[i]);
                 offset += group_sizes[i];
             }
@@ -1286,7 +1286,7 @@ inline sycl::event potrf_batch(const char *func_name, Func func, sycl::queue &qu
             cuMemFree(a_dev);
         });
     });
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name, batch_size);
 }
 
 // Scratchpad memory not needed as parts of buffer a is used as workspace memory
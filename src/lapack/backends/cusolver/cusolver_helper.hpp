@@ -37,6 +37,7 @@
 #include "runtime_support_helper.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/lapack/exceptions.hpp"
+#include "lapack/info_array.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -217,6 +218,23 @@ inline cusolverEigMode_t get_cusolver_job(oneapi::mkl::job jobz) {
     }
 }
 
+inline cusolverEigMode_t get_cusolver_job(oneapi::mkl::compz jobz) {
+    switch (jobz) {
+        case oneapi::mkl::compz::N: return CUSOLVER_EIG_MODE_NOVECTOR;
+        case oneapi::mkl::compz::V: return CUSOLVER_EIG_MODE_VECTOR;
+        default: throw "Wrong jobz.";
+    }
+}
+
+inline cusolverEigRange_t get_cusolver_range(oneapi::mkl::rangev range) {
+    switch (range) {
+        case oneapi::mkl::rangev::A: return CUSOLVER_EIG_RANGE_ALL;
+        case oneapi::mkl::rangev::V: return CUSOLVER_EIG_RANGE_V;
+        case oneapi::mkl::rangev::I: return CUSOLVER_EIG_RANGE_I;
+        default: throw "Wrong range.";
+    }
+}
+
 inline signed char get_cusolver_jobsvd(oneapi::mkl::jobsvd job) {
     switch (job) {
         case oneapi::mkl::jobsvd::N: return 'N';
@@ -306,6 +324,52 @@ inline void lapack_info_check(sycl::queue &queue, DEVINFO_T devinfo, const char
     }
 }
 
+// USM routines hand devInfo over to this check, which releases it. Without an info array
+// registered for the queue, waits for done and throws on a positive info; otherwise records the
+// values asynchronously and returns without blocking.
+inline sycl::event lapack_info_check(sycl::queue &queue, int *devInfo, const sycl::event &done,
+                                     const char *func_name, const char *cufunc_name,
+                                     int dev_info_size = 1) {
+    const auto array = oneapi::mkl::lapack::detail::get_info_array(queue);
+    if (array.info)
+        return oneapi::mkl::lapack::detail::record_info(queue, array, devInfo, dev_info_size,
+                                                        done);
+    std::vector<int> dev_info_(dev_info_size);
+    queue.memcpy(dev_info_.data(), devInfo, sizeof(int) * dev_info_size, done).wait();
+    sycl::free(devInfo, queue);
+    for (const auto &val : dev_info_) {
+        if (val > 0)
+            throw oneapi::mkl::lapack::computation_error(
+                func_name, std::string(cufunc_name) + " failed with info = " + std::to_string(val),
+                val);
+    }
+    return done;
+}
+
+// cuSOLVER *evdx routines return the selected eigenvectors in the leading columns of A;
+// copies them to Z and stores the number of eigenvalues found. Must be called from a host task
+// after the cuSOLVER call has completed.
+template <typename T>
+inline void store_selected_eigenvectors(int meig, std::int64_t *m, bool vectors, std::int64_t n,
+                                        T *a, std::int64_t lda, T *z, std::int64_t ldz) {
+    CUresult cuda_result;
+    std::int64_t m_host = meig;
+    CUDA_ERROR_FUNC(cuMemcpyHtoD, cuda_result, reinterpret_cast<CUdeviceptr>(m), &m_host,
+                    sizeof(std::int64_t));
+    if (!vectors || meig == 0)
+        return;
+    CUDA_MEMCPY2D copy{};
+    copy.srcMemoryType = CU_MEMORYTYPE_DEVICE;
+    copy.srcDevice = reinterpret_cast<CUdeviceptr>(a);
+    copy.srcPitch = lda * sizeof(T);
+    copy.dstMemoryType = CU_MEMORYTYPE_DEVICE;
+    copy.dstDevice = reinterpret_cast<CUdeviceptr>(z);
+    copy.dstPitch = ldz * sizeof(T);
+    copy.WidthInBytes = n * sizeof(T);
+    copy.Height = meig;
+    CUDA_ERROR_FUNC(cuMemcpy2D, cuda_result, &copy);
+}
+
 /* batched helpers */
 
 // Creates list of matrix/vector pointers from initial ptr and stride
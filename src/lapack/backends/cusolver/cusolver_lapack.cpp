@@ -359,6 +359,61 @@ HEEVD_LAUNCHER(std::complex<double>, double, cusolverDnZheevd)
 
 #undef HEEVD_LAUNCHER
 
+// abstol is ignored: the cuSOLVER *evdx routines take no tolerance
+template <typename Func, typename T_A, typename T_B>
+inline void heevx(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::compz jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  sycl::buffer<T_A> &a, std::int64_t lda, T_B vl, T_B vu, std::int64_t il,
+                  std::int64_t iu, T_B abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<T_B> &w,
+                  sycl::buffer<T_A> &z, std::int64_t ldz, sycl::buffer<T_A> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    using cuDataType_A = typename CudaEquivalentType<T_A>::Type;
+    using cuDataType_B = typename CudaEquivalentType<T_B>::Type;
+    overflow_check(n, lda, il, iu, ldz, scratchpad_size);
+    sycl::buffer<int> devInfo{ 1 };
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto devInfo_acc = devInfo.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        onemkl_cusolver_host_task(cgh, queue, [=](CusolverScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = sc.get_mem<cuDataType_A *>(a_acc);
+            auto m_ = sc.get_mem<std::int64_t *>(m_acc);
+            auto w_ = sc.get_mem<cuDataType_B *>(w_acc);
+            auto z_ = sc.get_mem<cuDataType_A *>(z_acc);
+            auto devInfo_ = sc.get_mem<int *>(devInfo_acc);
+            auto scratch_ = sc.get_mem<cuDataType_A *>(scratch_acc);
+            int meig = 0;
+            cusolverStatus_t err;
+            CUSOLVER_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_cusolver_job(jobz),
+                                       get_cusolver_range(range), get_cublas_fill_mode(uplo), n,
+                                       a_, lda, vl, vu, il, iu, &meig, w_, scratch_,
+                                       scratchpad_size, devInfo_);
+            store_selected_eigenvectors(meig, m_, jobz == oneapi::mkl::compz::vectors, n, a_, lda,
+                                        z_, ldz);
+        });
+    });
+    lapack_info_check(queue, devInfo, __func__, func_name);
+}
+
+#define HEEVX_LAUNCHER(TYPE_A, TYPE_B, CUSOLVER_ROUTINE)                                          \
+    void heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,            \
+               oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE_A> &a, std::int64_t lda, \
+               TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu, TYPE_B abstol,             \
+               sycl::buffer<std::int64_t> &m, sycl::buffer<TYPE_B> &w, sycl::buffer<TYPE_A> &z,   \
+               std::int64_t ldz, sycl::buffer<TYPE_A> &scratchpad, std::int64_t scratchpad_size) { \
+        heevx(#CUSOLVER_ROUTINE, CUSOLVER_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl, vu,   \
+              il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);                         \
+    }
+
+HEEVX_LAUNCHER(std::complex<float>, float, cusolverDnCheevdx)
+HEEVX_LAUNCHER(std::complex<double>, double, cusolverDnZheevdx)
+
+#undef HEEVX_LAUNCHER
+
 template <typename Func, typename T_A, typename T_B>
 inline void hegvd(const char *func_name, Func func, sycl::queue &queue, std::int64_t itype,
                   oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
@@ -818,6 +873,60 @@ SYEVD_LAUNCHER(double, cusolverDnDsyevd)
 
 #undef SYEVD_LAUNCHER
 
+// abstol is ignored: the cuSOLVER *evdx routines take no tolerance
+template <typename Func, typename T>
+inline void syevx(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::compz jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  sycl::buffer<T> &a, std::int64_t lda, T vl, T vu, std::int64_t il,
+                  std::int64_t iu, T abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<T> &w,
+                  sycl::buffer<T> &z, std::int64_t ldz, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    using cuDataType = typename CudaEquivalentType<T>::Type;
+    overflow_check(n, lda, il, iu, ldz, scratchpad_size);
+    sycl::buffer<int> devInfo{ 1 };
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto devInfo_acc = devInfo.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        onemkl_cusolver_host_task(cgh, queue, [=](CusolverScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = sc.get_mem<cuDataType *>(a_acc);
+            auto m_ = sc.get_mem<std::int64_t *>(m_acc);
+            auto w_ = sc.get_mem<cuDataType *>(w_acc);
+            auto z_ = sc.get_mem<cuDataType *>(z_acc);
+            auto devInfo_ = sc.get_mem<int *>(devInfo_acc);
+            auto scratch_ = sc.get_mem<cuDataType *>(scratch_acc);
+            int meig = 0;
+            cusolverStatus_t err;
+            CUSOLVER_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_cusolver_job(jobz),
+                                       get_cusolver_range(range), get_cublas_fill_mode(uplo), n,
+                                       a_, lda, vl, vu, il, iu, &meig, w_, scratch_,
+                                       scratchpad_size, devInfo_);
+            store_selected_eigenvectors(meig, m_, jobz == oneapi::mkl::compz::vectors, n, a_, lda,
+                                        z_, ldz);
+        });
+    });
+    lapack_info_check(queue, devInfo, __func__, func_name);
+}
+
+#define SYEVX_LAUNCHER(TYPE, CUSOLVER_ROUTINE)                                                    \
+    void syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,            \
+               oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a, std::int64_t lda,   \
+               TYPE vl, TYPE vu, std::int64_t il, std::int64_t iu, TYPE abstol,                   \
+               sycl::buffer<std::int64_t> &m, sycl::buffer<TYPE> &w, sycl::buffer<TYPE> &z,       \
+               std::int64_t ldz, sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {  \
+        syevx(#CUSOLVER_ROUTINE, CUSOLVER_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl, vu,   \
+              il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);                         \
+    }
+
+SYEVX_LAUNCHER(float, cusolverDnSsyevdx)
+SYEVX_LAUNCHER(double, cusolverDnDsyevdx)
+
+#undef SYEVX_LAUNCHER
+
 template <typename Func, typename T>
 inline void sygvd(const char *func_name, Func func, sycl::queue &queue, std::int64_t itype,
                   oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<T> &a,
@@ -1348,13 +1457,13 @@ inline sycl::event getrf(const char *func_name, Func func, sycl::queue &queue, s
         });
     });
 
-    queue.wait();
-
-    free(ipiv32, queue);
+    // Enqueue free memory, don't return event as not-neccessary for user to wait for ipiv32 being released
+    queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(done_casting);
+        cgh.host_task([=]() { sycl::free(ipiv32, queue); });
+    });
 
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done_casting;
+    return lapack_info_check(queue, devInfo, done_casting, __func__, func_name);
 }
 
 #define GETRF_LAUNCHER_USM(TYPE, CUSOLVER_ROUTINE)                                               \
@@ -1405,6 +1514,7 @@ inline sycl::event getrs(const char *func_name, Func func, sycl::queue &queue,
     int *ipiv32 = (int *)malloc_device(sizeof(int) * ipiv_size, queue);
 
     auto done_casting = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
         cgh.parallel_for(sycl::range<1>{ ipiv_size }, [=](sycl::id<1> index) {
             ipiv32[index] = static_cast<std::int32_t>(ipiv[index]);
         });
@@ -1427,9 +1537,11 @@ inline sycl::event getrs(const char *func_name, Func func, sycl::queue &queue,
         });
     });
 
-    queue.wait();
-
-    free(ipiv32, queue);
+    // Enqueue free memory, don't return event as not-neccessary for user to wait for ipiv32 being released
+    queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(done);
+        cgh.host_task([=]() { sycl::free(ipiv32, queue); });
+    });
 
     return done;
 }
@@ -1480,9 +1592,7 @@ inline sycl::event gesvd(const char *func_name, Func func, sycl::queue &queue,
                                        ldvt, scratch_, scratchpad_size, nullptr, devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define GESVD_LAUNCHER_USM(TYPE_A, TYPE_B, CUSOLVER_ROUTINE)                                      \
@@ -1528,9 +1638,7 @@ inline sycl::event heevd(const char *func_name, Func func, sycl::queue &queue,
                                        scratchpad_size, devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define HEEVD_LAUNCHER_USM(TYPE_A, TYPE_B, CUSOLVER_ROUTINE)                                      \
@@ -1547,6 +1655,61 @@ HEEVD_LAUNCHER_USM(std::complex<double>, double, cusolverDnZheevd)
 
 #undef HEEVD_LAUNCHER_USM
 
+// abstol is ignored: the cuSOLVER *evdx routines take no tolerance
+template <typename Func, typename T_A, typename T_B>
+inline sycl::event heevx(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, T_A *a, std::int64_t lda, T_B vl,
+                         T_B vu, std::int64_t il, std::int64_t iu, T_B abstol, std::int64_t *m,
+                         T_B *w, T_A *z, std::int64_t ldz, T_A *scratchpad,
+                         std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    using cuDataType_A = typename CudaEquivalentType<T_A>::Type;
+    using cuDataType_B = typename CudaEquivalentType<T_B>::Type;
+    overflow_check(n, lda, il, iu, ldz, scratchpad_size);
+    int *devInfo = (int *)malloc_device(sizeof(int), queue);
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        onemkl_cusolver_host_task(cgh, queue, [=](CusolverScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = reinterpret_cast<cuDataType_A *>(a);
+            auto w_ = reinterpret_cast<cuDataType_B *>(w);
+            auto z_ = reinterpret_cast<cuDataType_A *>(z);
+            auto devInfo_ = reinterpret_cast<int *>(devInfo);
+            auto scratch_ = reinterpret_cast<cuDataType_A *>(scratchpad);
+            int meig = 0;
+            cusolverStatus_t err;
+            CUSOLVER_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_cusolver_job(jobz),
+                                       get_cusolver_range(range), get_cublas_fill_mode(uplo), n,
+                                       a_, lda, vl, vu, il, iu, &meig, w_, scratch_,
+                                       scratchpad_size, devInfo_);
+            store_selected_eigenvectors(meig, m, jobz == oneapi::mkl::compz::vectors, n, a_, lda,
+                                        z_, ldz);
+        });
+    });
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
+}
+
+#define HEEVX_LAUNCHER_USM(TYPE_A, TYPE_B, CUSOLVER_ROUTINE)                                      \
+    sycl::event heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,     \
+                      oneapi::mkl::uplo uplo, std::int64_t n, TYPE_A *a, std::int64_t lda,        \
+                      TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu, TYPE_B abstol,      \
+                      std::int64_t *m, TYPE_B *w, TYPE_A *z, std::int64_t ldz, TYPE_A *scratchpad, \
+                      std::int64_t scratchpad_size,                                               \
+                      const std::vector<sycl::event> &dependencies) {                             \
+        return heevx(#CUSOLVER_ROUTINE, CUSOLVER_ROUTINE, queue, jobz, range, uplo, n, a, lda,    \
+                     vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size,           \
+                     dependencies);                                                               \
+    }
+
+HEEVX_LAUNCHER_USM(std::complex<float>, float, cusolverDnCheevdx)
+HEEVX_LAUNCHER_USM(std::complex<double>, double, cusolverDnZheevdx)
+
+#undef HEEVX_LAUNCHER_USM
+
 template <typename Func, typename T_A, typename T_B>
 inline sycl::event hegvd(const char *func_name, Func func, sycl::queue &queue, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, T_A *&a,
@@ -1575,9 +1738,7 @@ inline sycl::event hegvd(const char *func_name, Func func, sycl::queue &queue, s
                                        lda, b_, ldb, w_, scratch_, scratchpad_size, devInfo);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define HEGVD_LAUNCHER_USM(TYPE_A, TYPE_B, CUSOLVER_ROUTINE)                                      \
@@ -1622,9 +1783,7 @@ inline sycl::event hetrd(const char *func_name, Func func, sycl::queue &queue,
                                        a_, lda, d_, e_, tau_, scratch_, scratchpad_size, devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define HETRD_LAUNCHER_USM(TYPE_A, TYPE_B, CUSOLVER_ROUTINE)                                   \
@@ -1894,9 +2053,7 @@ inline sycl::event potrf(const char *func_name, Func func, sycl::queue &queue,
                                        a_, lda, scratch_, scratchpad_size, devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define POTRF_LAUNCHER_USM(TYPE, CUSOLVER_ROUTINE)                                            \
@@ -1937,9 +2094,7 @@ inline sycl::event potri(const char *func_name, Func func, sycl::queue &queue,
                                        a_, lda, scratch_, scratchpad_size, devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define POTRI_LAUNCHER_USM(TYPE, CUSOLVER_ROUTINE)                                            \
@@ -2024,9 +2179,7 @@ inline sycl::event syevd(const char *func_name, Func func, sycl::queue &queue,
                                        scratchpad_size, devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define SYEVD_LAUNCHER_USM(TYPE, CUSOLVER_ROUTINE)                                          \
@@ -2043,6 +2196,59 @@ SYEVD_LAUNCHER_USM(double, cusolverDnDsyevd)
 
 #undef SYEVD_LAUNCHER_USM
 
+// abstol is ignored: the cuSOLVER *evdx routines take no tolerance
+template <typename Func, typename T>
+inline sycl::event syevx(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T vl,
+                         T vu, std::int64_t il, std::int64_t iu, T abstol, std::int64_t *m, T *w,
+                         T *z, std::int64_t ldz, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    using cuDataType = typename CudaEquivalentType<T>::Type;
+    overflow_check(n, lda, il, iu, ldz, scratchpad_size);
+    int *devInfo = (int *)malloc_device(sizeof(int), queue);
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        onemkl_cusolver_host_task(cgh, queue, [=](CusolverScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = reinterpret_cast<cuDataType *>(a);
+            auto w_ = reinterpret_cast<cuDataType *>(w);
+            auto z_ = reinterpret_cast<cuDataType *>(z);
+            auto devInfo_ = reinterpret_cast<int *>(devInfo);
+            auto scratch_ = reinterpret_cast<cuDataType *>(scratchpad);
+            int meig = 0;
+            cusolverStatus_t err;
+            CUSOLVER_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_cusolver_job(jobz),
+                                       get_cusolver_range(range), get_cublas_fill_mode(uplo), n,
+                                       a_, lda, vl, vu, il, iu, &meig, w_, scratch_,
+                                       scratchpad_size, devInfo_);
+            store_selected_eigenvectors(meig, m, jobz == oneapi::mkl::compz::vectors, n, a_, lda,
+                                        z_, ldz);
+        });
+    });
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
+}
+
+#define SYEVX_LAUNCHER_USM(TYPE, CUSOLVER_ROUTINE)                                               \
+    sycl::event syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,    \
+                      oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a, std::int64_t lda, TYPE vl, \
+                      TYPE vu, std::int64_t il, std::int64_t iu, TYPE abstol, std::int64_t *m,   \
+                      TYPE *w, TYPE *z, std::int64_t ldz, TYPE *scratchpad,                      \
+                      std::int64_t scratchpad_size,                                              \
+                      const std::vector<sycl::event> &dependencies) {                            \
+        return syevx(#CUSOLVER_ROUTINE, CUSOLVER_ROUTINE, queue, jobz, range, uplo, n, a, lda,   \
+                     vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size,          \
+                     dependencies);                                                              \
+    }
+
+SYEVX_LAUNCHER_USM(float, cusolverDnSsyevdx)
+SYEVX_LAUNCHER_USM(double, cusolverDnDsyevdx)
+
+#undef SYEVX_LAUNCHER_USM
+
 template <typename Func, typename T>
 inline sycl::event sygvd(const char *func_name, Func func, sycl::queue &queue, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
@@ -2070,9 +2276,7 @@ inline sycl::event sygvd(const char *func_name, Func func, sycl::queue &queue, s
                                        lda, b_, ldb, w_, scratch_, scratchpad_size, devInfo);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define SYGVD_LAUNCHER_USM(TYPE, CUSOLVER_ROUTINE)                                                \
@@ -2115,9 +2319,7 @@ inline sycl::event sytrd(const char *func_name, Func func, sycl::queue &queue,
                                        a_, lda, d_, e_, tau_, scratch_, scratchpad_size, devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define SYTRD_LAUNCHER_USM(TYPE, CUSOLVER_ROUTINE)                                           \
@@ -2174,13 +2376,13 @@ inline sycl::event sytrf(const char *func_name, Func func, sycl::queue &queue,
         });
     });
 
-    queue.wait();
-
-    free(ipiv32, queue);
+    // Enqueue free memory, don't return event as not-neccessary for user to wait for ipiv32 being released
+    queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(done_casting);
+        cgh.host_task([=]() { sycl::free(ipiv32, queue); });
+    });
 
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done_casting;
+    return lapack_info_check(queue, devInfo, done_casting, __func__, func_name);
 }
 
 #define SYTRF_LAUNCHER_USM(TYPE, CUSOLVER_ROUTINE)                                         \
@@ -2656,6 +2858,43 @@ HEEVD_LAUNCHER_SCRATCH(std::complex<double>, cusolverDnZheevd_bufferSize)
 
 #undef HEEVD_LAUNCHER_SCRATCH
 
+template <typename Func, typename T>
+inline void evx_scratchpad_size(const char *func_name, Func func, sycl::queue &queue,
+                                oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, T vl,
+                                T vu, std::int64_t il, std::int64_t iu, int *scratch_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        onemkl_cusolver_host_task(cgh, queue, [=](CusolverScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            int meig;
+            cusolverStatus_t err;
+            CUSOLVER_ERROR_FUNC_T(func_name, func, err, handle, get_cusolver_job(jobz),
+                                  get_cusolver_range(range), get_cublas_fill_mode(uplo), n, nullptr,
+                                  lda, vl, vu, il, iu, &meig, nullptr, scratch_size);
+        });
+    });
+    queue.wait();
+}
+
+#define EVX_LAUNCHER_SCRATCH(ROUTINE, TYPE_A, TYPE_B, CUSOLVER_ROUTINE)                           \
+    template <>                                                                                   \
+    std::int64_t ROUTINE##_scratchpad_size<TYPE_A>(                                               \
+        sycl::queue & queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,                  \
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, TYPE_B vl, TYPE_B vu,           \
+        std::int64_t il, std::int64_t iu, TYPE_B abstol, std::int64_t ldz) {                      \
+        int scratch_size;                                                                         \
+        evx_scratchpad_size(#CUSOLVER_ROUTINE, CUSOLVER_ROUTINE, queue, jobz, range, uplo, n, lda, \
+                            vl, vu, il, iu, &scratch_size);                                       \
+        return scratch_size;                                                                      \
+    }
+
+EVX_LAUNCHER_SCRATCH(heevx, std::complex<float>, float, cusolverDnCheevdx_bufferSize)
+EVX_LAUNCHER_SCRATCH(heevx, std::complex<double>, double, cusolverDnZheevdx_bufferSize)
+EVX_LAUNCHER_SCRATCH(syevx, float, float, cusolverDnSsyevdx_bufferSize)
+EVX_LAUNCHER_SCRATCH(syevx, double, double, cusolverDnDsyevdx_bufferSize)
+
+#undef EVX_LAUNCHER_SCRATCH
+
 template <typename Func>
 inline void hegvd_scratchpad_size(const char *func_name, Func func, sycl::queue &queue,
                                   std::int64_t itype, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
@@ -3315,6 +3554,10 @@ UNMTR_LAUNCHER_SCRATCH(std::complex<double>, cusolverDnZunmtr_bufferSize)
 
 #undef UNMTR_LAUNCHER_SCRATCH
 
+void set_info_array(sycl::queue &queue, std::int64_t *info, std::int64_t size) {
+    oneapi::mkl::lapack::detail::set_info_array(queue, info, size);
+}
+
 } // namespace cusolver
 } // namespace lapack
 } // namespace mkl
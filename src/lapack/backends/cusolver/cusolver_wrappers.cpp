@@ -54,6 +54,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::cusolver::gesvd,
     oneapi::mkl::lapack::cusolver::heevd,
     oneapi::mkl::lapack::cusolver::heevd,
+    oneapi::mkl::lapack::cusolver::heevx,
+    oneapi::mkl::lapack::cusolver::heevx,
     oneapi::mkl::lapack::cusolver::hegvd,
     oneapi::mkl::lapack::cusolver::hegvd,
     oneapi::mkl::lapack::cusolver::hetrd,
@@ -86,6 +88,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::cusolver::potrs,
     oneapi::mkl::lapack::cusolver::syevd,
     oneapi::mkl::lapack::cusolver::syevd,
+    oneapi::mkl::lapack::cusolver::syevx,
+    oneapi::mkl::lapack::cusolver::syevx,
     oneapi::mkl::lapack::cusolver::sygvd,
     oneapi::mkl::lapack::cusolver::sygvd,
     oneapi::mkl::lapack::cusolver::sytrd,
@@ -140,6 +144,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::cusolver::gesvd,
     oneapi::mkl::lapack::cusolver::heevd,
     oneapi::mkl::lapack::cusolver::heevd,
+    oneapi::mkl::lapack::cusolver::heevx,
+    oneapi::mkl::lapack::cusolver::heevx,
     oneapi::mkl::lapack::cusolver::hegvd,
     oneapi::mkl::lapack::cusolver::hegvd,
     oneapi::mkl::lapack::cusolver::hetrd,
@@ -172,6 +178,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::cusolver::potrs,
     oneapi::mkl::lapack::cusolver::syevd,
     oneapi::mkl::lapack::cusolver::syevd,
+    oneapi::mkl::lapack::cusolver::syevx,
+    oneapi::mkl::lapack::cusolver::syevx,
     oneapi::mkl::lapack::cusolver::sygvd,
     oneapi::mkl::lapack::cusolver::sygvd,
     oneapi::mkl::lapack::cusolver::sytrd,
@@ -310,6 +318,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::cusolver::getrs_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::cusolver::heevd_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::cusolver::heevd_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::heevx_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::heevx_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::cusolver::hegvd_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::cusolver::hegvd_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::cusolver::hetrd_scratchpad_size<std::complex<float>>,
@@ -346,6 +356,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::cusolver::sytrf_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::cusolver::syevd_scratchpad_size<float>,
     oneapi::mkl::lapack::cusolver::syevd_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::syevx_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::syevx_scratchpad_size<double>,
     oneapi::mkl::lapack::cusolver::sygvd_scratchpad_size<float>,
     oneapi::mkl::lapack::cusolver::sygvd_scratchpad_size<double>,
     oneapi::mkl::lapack::cusolver::sytrd_scratchpad_size<float>,
@@ -421,6 +433,7 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::cusolver::potrs_batch_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::cusolver::potrs_batch_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::cusolver::ungqr_batch_scratchpad_size<std::complex<float>>,
-    oneapi::mkl::lapack::cusolver::ungqr_batch_scratchpad_size<std::complex<double>>
+    oneapi::mkl::lapack::cusolver::ungqr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::set_info_array
 #undef LAPACK_BACKEND
 };
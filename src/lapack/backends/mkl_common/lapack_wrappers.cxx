@@ -32,6 +32,7 @@ oneapi::mkl::lapack::LAPACK_BACKEND::gebrd, oneapi::mkl::lapack::LAPACK_BACKEND:
     oneapi::mkl::lapack::LAPACK_BACKEND::gesvd, oneapi::mkl::lapack::LAPACK_BACKEND::gesvd,
     oneapi::mkl::lapack::LAPACK_BACKEND::gesvd, oneapi::mkl::lapack::LAPACK_BACKEND::gesvd,
     oneapi::mkl::lapack::LAPACK_BACKEND::heevd, oneapi::mkl::lapack::LAPACK_BACKEND::heevd,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx, oneapi::mkl::lapack::LAPACK_BACKEND::heevx,
     oneapi::mkl::lapack::LAPACK_BACKEND::hegvd, oneapi::mkl::lapack::LAPACK_BACKEND::hegvd,
     oneapi::mkl::lapack::LAPACK_BACKEND::hetrd, oneapi::mkl::lapack::LAPACK_BACKEND::hetrd,
     oneapi::mkl::lapack::LAPACK_BACKEND::hetrf, oneapi::mkl::lapack::LAPACK_BACKEND::hetrf,
@@ -48,6 +49,7 @@ oneapi::mkl::lapack::LAPACK_BACKEND::gebrd, oneapi::mkl::lapack::LAPACK_BACKEND:
     oneapi::mkl::lapack::LAPACK_BACKEND::potrs, oneapi::mkl::lapack::LAPACK_BACKEND::potrs,
     oneapi::mkl::lapack::LAPACK_BACKEND::potrs, oneapi::mkl::lapack::LAPACK_BACKEND::potrs,
     oneapi::mkl::lapack::LAPACK_BACKEND::syevd, oneapi::mkl::lapack::LAPACK_BACKEND::syevd,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx, oneapi::mkl::lapack::LAPACK_BACKEND::syevx,
     oneapi::mkl::lapack::LAPACK_BACKEND::sygvd, oneapi::mkl::lapack::LAPACK_BACKEND::sygvd,
     oneapi::mkl::lapack::LAPACK_BACKEND::sytrd, oneapi::mkl::lapack::LAPACK_BACKEND::sytrd,
     oneapi::mkl::lapack::LAPACK_BACKEND::sytrf, oneapi::mkl::lapack::LAPACK_BACKEND::sytrf,
@@ -75,6 +77,7 @@ oneapi::mkl::lapack::LAPACK_BACKEND::gebrd, oneapi::mkl::lapack::LAPACK_BACKEND:
     oneapi::mkl::lapack::LAPACK_BACKEND::gesvd, oneapi::mkl::lapack::LAPACK_BACKEND::gesvd,
     oneapi::mkl::lapack::LAPACK_BACKEND::gesvd, oneapi::mkl::lapack::LAPACK_BACKEND::gesvd,
     oneapi::mkl::lapack::LAPACK_BACKEND::heevd, oneapi::mkl::lapack::LAPACK_BACKEND::heevd,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx, oneapi::mkl::lapack::LAPACK_BACKEND::heevx,
     oneapi::mkl::lapack::LAPACK_BACKEND::hegvd, oneapi::mkl::lapack::LAPACK_BACKEND::hegvd,
     oneapi::mkl::lapack::LAPACK_BACKEND::hetrd, oneapi::mkl::lapack::LAPACK_BACKEND::hetrd,
     oneapi::mkl::lapack::LAPACK_BACKEND::hetrf, oneapi::mkl::lapack::LAPACK_BACKEND::hetrf,
@@ -91,6 +94,7 @@ oneapi::mkl::lapack::LAPACK_BACKEND::gebrd, oneapi::mkl::lapack::LAPACK_BACKEND:
     oneapi::mkl::lapack::LAPACK_BACKEND::potrs, oneapi::mkl::lapack::LAPACK_BACKEND::potrs,
     oneapi::mkl::lapack::LAPACK_BACKEND::potrs, oneapi::mkl::lapack::LAPACK_BACKEND::potrs,
     oneapi::mkl::lapack::LAPACK_BACKEND::syevd, oneapi::mkl::lapack::LAPACK_BACKEND::syevd,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx, oneapi::mkl::lapack::LAPACK_BACKEND::syevx,
     oneapi::mkl::lapack::LAPACK_BACKEND::sygvd, oneapi::mkl::lapack::LAPACK_BACKEND::sygvd,
     oneapi::mkl::lapack::LAPACK_BACKEND::sytrd, oneapi::mkl::lapack::LAPACK_BACKEND::sytrd,
     oneapi::mkl::lapack::LAPACK_BACKEND::sytrf, oneapi::mkl::lapack::LAPACK_BACKEND::sytrf,
@@ -217,6 +221,8 @@ oneapi::mkl::lapack::LAPACK_BACKEND::gebrd, oneapi::mkl::lapack::LAPACK_BACKEND:
     oneapi::mkl::lapack::LAPACK_BACKEND::getrs_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::heevd_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::heevd_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::hegvd_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::hegvd_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::hetrd_scratchpad_size<std::complex<float>>,
@@ -253,6 +259,8 @@ oneapi::mkl::lapack::LAPACK_BACKEND::gebrd, oneapi::mkl::lapack::LAPACK_BACKEND:
     oneapi::mkl::lapack::LAPACK_BACKEND::sytrf_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::syevd_scratchpad_size<float>,
     oneapi::mkl::lapack::LAPACK_BACKEND::syevd_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_scratchpad_size<double>,
     oneapi::mkl::lapack::LAPACK_BACKEND::sygvd_scratchpad_size<float>,
     oneapi::mkl::lapack::LAPACK_BACKEND::sygvd_scratchpad_size<double>,
     oneapi::mkl::lapack::LAPACK_BACKEND::sytrd_scratchpad_size<float>,
@@ -328,4 +336,5 @@ oneapi::mkl::lapack::LAPACK_BACKEND::gebrd, oneapi::mkl::lapack::LAPACK_BACKEND:
     oneapi::mkl::lapack::LAPACK_BACKEND::potrs_batch_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::potrs_batch_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::ungqr_batch_scratchpad_size<std::complex<float>>,
-    oneapi::mkl::lapack::LAPACK_BACKEND::ungqr_batch_scratchpad_size<std::complex<double>>
+    oneapi::mkl::lapack::LAPACK_BACKEND::ungqr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::set_info_array
@@ -91,22 +91,38 @@ void geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
 void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<std::complex<float>> &a,
            std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+#ifdef ONEMKL_LAPACK_CALU
+    if (calu::is_selected(m, n))
+        return calu::getrf(queue, m, n, a, lda, ipiv);
+#endif
     ::oneapi::mkl::lapack::getrf(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
 }
 void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
            std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &scratchpad,
            std::int64_t scratchpad_size) {
+#ifdef ONEMKL_LAPACK_CALU
+    if (calu::is_selected(m, n))
+        return calu::getrf(queue, m, n, a, lda, ipiv);
+#endif
     ::oneapi::mkl::lapack::getrf(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
 }
 void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
            std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
+#ifdef ONEMKL_LAPACK_CALU
+    if (calu::is_selected(m, n))
+        return calu::getrf(queue, m, n, a, lda, ipiv);
+#endif
     ::oneapi::mkl::lapack::getrf(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
 }
 void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
+#ifdef ONEMKL_LAPACK_CALU
+    if (calu::is_selected(m, n))
+        return calu::getrf(queue, m, n, a, lda, ipiv);
+#endif
     ::oneapi::mkl::lapack::getrf(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
 }
 void getri(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>> &a,
@@ -198,6 +214,24 @@ void heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, st
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
     ::oneapi::mkl::lapack::heevd(queue, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size);
 }
+void heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::heevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w,
+                                 z, ldz, scratchpad, scratchpad_size);
+}
+void heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::heevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w,
+                                 z, ldz, scratchpad, scratchpad_size);
+}
 void hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
            std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>> &b, std::int64_t ldb, sycl::buffer<float> &w,
@@ -375,6 +409,22 @@ void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, st
            sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
     ::oneapi::mkl::lapack::syevd(queue, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size);
 }
+void syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+           std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::syevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w,
+                                 z, ldz, scratchpad, scratchpad_size);
+}
+void syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z,
+           std::int64_t ldz, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::syevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w,
+                                 z, ldz, scratchpad, scratchpad_size);
+}
 void sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
            std::int64_t n, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
            std::int64_t ldb, sycl::buffer<double> &w, sycl::buffer<double> &scratchpad,
@@ -615,24 +665,40 @@ sycl::event geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, std::compl
 sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> *a,
                   std::int64_t lda, std::int64_t *ipiv, std::complex<float> *scratchpad,
                   std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+#ifdef ONEMKL_LAPACK_CALU
+    if (calu::is_selected(m, n))
+        return calu::getrf(queue, m, n, a, lda, ipiv, dependencies);
+#endif
     return ::oneapi::mkl::lapack::getrf(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size,
                                         dependencies);
 }
 sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a, std::int64_t lda,
                   std::int64_t *ipiv, double *scratchpad, std::int64_t scratchpad_size,
                   const std::vector<sycl::event> &dependencies) {
+#ifdef ONEMKL_LAPACK_CALU
+    if (calu::is_selected(m, n))
+        return calu::getrf(queue, m, n, a, lda, ipiv, dependencies);
+#endif
     return ::oneapi::mkl::lapack::getrf(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size,
                                         dependencies);
 }
 sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a, std::int64_t lda,
                   std::int64_t *ipiv, float *scratchpad, std::int64_t scratchpad_size,
                   const std::vector<sycl::event> &dependencies) {
+#ifdef ONEMKL_LAPACK_CALU
+    if (calu::is_selected(m, n))
+        return calu::getrf(queue, m, n, a, lda, ipiv, dependencies);
+#endif
     return ::oneapi::mkl::lapack::getrf(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size,
                                         dependencies);
 }
 sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> *a,
                   std::int64_t lda, std::int64_t *ipiv, std::complex<double> *scratchpad,
                   std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+#ifdef ONEMKL_LAPACK_CALU
+    if (calu::is_selected(m, n))
+        return calu::getrf(queue, m, n, a, lda, ipiv, dependencies);
+#endif
     return ::oneapi::mkl::lapack::getrf(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size,
                                         dependencies);
 }
@@ -732,6 +798,24 @@ sycl::event heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo u
     return ::oneapi::mkl::lapack::heevd(queue, jobz, uplo, n, a, lda, w, scratchpad,
                                         scratchpad_size, dependencies);
 }
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                  std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    return ::oneapi::mkl::lapack::heevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                  std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    return ::oneapi::mkl::lapack::heevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
 sycl::event hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                   oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
                   std::complex<float> *b, std::int64_t ldb, float *w,
@@ -940,6 +1024,22 @@ sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo u
     return ::oneapi::mkl::lapack::syevd(queue, jobz, uplo, n, a, lda, w, scratchpad,
                                         scratchpad_size, dependencies);
 }
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl,
+                  double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                  double *w, double *z, std::int64_t ldz, double *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return ::oneapi::mkl::lapack::syevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl,
+                  float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                  float *w, float *z, std::int64_t ldz, float *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return ::oneapi::mkl::lapack::syevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
 sycl::event sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                   oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double *b,
                   std::int64_t ldb, double *w, double *scratchpad, std::int64_t scratchpad_size,
@@ -1977,6 +2077,29 @@ std::int64_t heevd_scratchpad_size<std::complex<double>>(sycl::queue &queue, one
                                                                               lda);
 }
 template <>
+std::int64_t heevx_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, float vl, float vu,
+                                                        std::int64_t il, std::int64_t iu,
+                                                        float abstol, std::int64_t ldz) {
+    return ::oneapi::mkl::lapack::heevx_scratchpad_size<std::complex<float>>(queue, jobz, range,
+                                                                             uplo, n, lda, vl, vu,
+                                                                             il, iu, abstol, ldz);
+}
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                         oneapi::mkl::compz jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, double vl, double vu,
+                                                         std::int64_t il, std::int64_t iu,
+                                                         double abstol, std::int64_t ldz) {
+    return ::oneapi::mkl::lapack::heevx_scratchpad_size<std::complex<double>>(queue, jobz, range,
+                                                                              uplo, n, lda, vl, vu,
+                                                                              il, iu, abstol, ldz);
+}
+template <>
 std::int64_t hegvd_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t itype,
                                                         oneapi::mkl::job jobz,
                                                         oneapi::mkl::uplo uplo, std::int64_t n,
@@ -2191,6 +2314,24 @@ std::int64_t syevd_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job
     return ::oneapi::mkl::lapack::syevd_scratchpad_size<double>(queue, jobz, uplo, n, lda);
 }
 template <>
+std::int64_t syevx_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                          oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, float vl, float vu,
+                                          std::int64_t il, std::int64_t iu, float abstol,
+                                          std::int64_t ldz) {
+    return ::oneapi::mkl::lapack::syevx_scratchpad_size<float>(queue, jobz, range, uplo, n, lda, vl,
+                                                               vu, il, iu, abstol, ldz);
+}
+template <>
+std::int64_t syevx_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, double vl, double vu,
+                                           std::int64_t il, std::int64_t iu, double abstol,
+                                           std::int64_t ldz) {
+    return ::oneapi::mkl::lapack::syevx_scratchpad_size<double>(queue, jobz, range, uplo, n, lda,
+                                                                vl, vu, il, iu, abstol, ldz);
+}
+template <>
 std::int64_t sygvd_scratchpad_size<float>(sycl::queue &queue, std::int64_t itype,
                                           oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
                                           std::int64_t n, std::int64_t lda, std::int64_t ldb) {
@@ -2791,3 +2932,9 @@ std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(sycl::queue &queu
     return ::oneapi::mkl::lapack::ungqr_batch_scratchpad_size<std::complex<double>>(
         queue, m, n, k, lda, group_count, group_sizes);
 }
+
+// Intel(R) oneMKL reports failures through its own exceptions when each routine runs, so there is
+// no device info to redirect.
+void set_info_array(sycl::queue &queue, std::int64_t *info, std::int64_t size) {
+    throw unimplemented("lapack", "set_info_array");
+}
@@ -0,0 +1,562 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_LAPACK_MKLCPU_CALU_HPP_
+#define _ONEMKL_LAPACK_MKLCPU_CALU_HPP_
+
+#include <algorithm>
+#include <complex>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl/lapack/exceptions.hpp"
+#include "env_helper.hpp"
+
+// MKLCPU headers
+#include "mkl_cblas.h"
+#include "mkl_lapacke.h"
+#include "mkl_service.h"
+
+// Communication-avoiding LU (CALU) for large getrf on the CPU backend.
+//
+// The matrix is split into nb x nb tiles. Each panel is factored with tournament pivoting: the
+// panel rows are divided between leaves that each select nb candidate rows with a partially
+// pivoted getrf of their own rows, and the candidates are reduced pairwise by further getrf calls
+// on the original rows until nb winners remain. The winners are swapped to the top of the panel,
+// which is then eliminated without pivoting, so only the reduction touches the whole panel. If
+// the winners are rank deficient the panel falls back to a partially pivoted getrf, which keeps
+// the LAPACK info semantics for singular matrices.
+//
+// The row swaps are recorded in the usual LAPACK ipiv form, so getrs/getri consume the result
+// unchanged. Panel, triangular solve and gemm update tiles form a task graph executed by
+// mkl_get_max_threads() workers, each calling sequential MKL; panel tasks and the next column
+// to factor have the highest priority, which gives lookahead without a fixed depth.
+//
+// The path is opt-in: it is taken for min(m, n) >= min_size(). The ONEMKL_LAPACK_CALU_MIN_SIZE
+// environment variable, read on every call, sets min_size() at run time; the LAPACK_CALU_MIN_SIZE
+// CMake cache variable gives the value used when the variable is unset. Both default to 0, which
+// turns the path off. The host task only records info; getrf waits for it and throws
+// computation_error from the calling thread, as the MKL getrf does.
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace mklcpu {
+namespace calu {
+
+constexpr std::int64_t block_size = 256;
+
+inline std::int64_t min_size() {
+    return env_size("ONEMKL_LAPACK_CALU_MIN_SIZE", ONEMKL_LAPACK_CALU_MIN_SIZE);
+}
+
+inline bool is_selected(std::int64_t m, std::int64_t n) {
+    const std::int64_t size = min_size();
+    return size > 0 && std::min(m, n) >= size;
+}
+
+inline lapack_int host_getrf(lapack_int m, lapack_int n, float *a, lapack_int lda,
+                             lapack_int *ipiv) {
+    return LAPACKE_sgetrf(LAPACK_COL_MAJOR, m, n, a, lda, ipiv);
+}
+inline lapack_int host_getrf(lapack_int m, lapack_int n, double *a, lapack_int lda,
+                             lapack_int *ipiv) {
+    return LAPACKE_dgetrf(LAPACK_COL_MAJOR, m, n, a, lda, ipiv);
+}
+inline lapack_int host_getrf(lapack_int m, lapack_int n, std::complex<float> *a, lapack_int lda,
+                             lapack_int *ipiv) {
+    return LAPACKE_cgetrf(LAPACK_COL_MAJOR, m, n, reinterpret_cast<lapack_complex_float *>(a), lda,
+                          ipiv);
+}
+inline lapack_int host_getrf(lapack_int m, lapack_int n, std::complex<double> *a, lapack_int lda,
+                             lapack_int *ipiv) {
+    return LAPACKE_zgetrf(LAPACK_COL_MAJOR, m, n, reinterpret_cast<lapack_complex_double *>(a),
+                          lda, ipiv);
+}
+
+inline lapack_int host_getrfnp(lapack_int m, lapack_int n, float *a, lapack_int lda) {
+    return LAPACKE_mkl_sgetrfnp(LAPACK_COL_MAJOR, m, n, a, lda);
+}
+inline lapack_int host_getrfnp(lapack_int m, lapack_int n, double *a, lapack_int lda) {
+    return LAPACKE_mkl_dgetrfnp(LAPACK_COL_MAJOR, m, n, a, lda);
+}
+inline lapack_int host_getrfnp(lapack_int m, lapack_int n, std::complex<float> *a,
+                               lapack_int lda) {
+    return LAPACKE_mkl_cgetrfnp(LAPACK_COL_MAJOR, m, n,
+                                reinterpret_cast<lapack_complex_float *>(a), lda);
+}
+inline lapack_int host_getrfnp(lapack_int m, lapack_int n, std::complex<double> *a,
+                               lapack_int lda) {
+    return LAPACKE_mkl_zgetrfnp(LAPACK_COL_MAJOR, m, n,
+                                reinterpret_cast<lapack_complex_double *>(a), lda);
+}
+
+// B := op(A)^-1 B or B := B op(A)^-1 with a unit alpha
+inline void host_trsm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_DIAG diag, MKL_INT m, MKL_INT n,
+                      const float *a, MKL_INT lda, float *b, MKL_INT ldb) {
+    cblas_strsm(CblasColMajor, side, uplo, CblasNoTrans, diag, m, n, 1.0f, a, lda, b, ldb);
+}
+inline void host_trsm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_DIAG diag, MKL_INT m, MKL_INT n,
+                      const double *a, MKL_INT lda, double *b, MKL_INT ldb) {
+    cblas_dtrsm(CblasColMajor, side, uplo, CblasNoTrans, diag, m, n, 1.0, a, lda, b, ldb);
+}
+inline void host_trsm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_DIAG diag, MKL_INT m, MKL_INT n,
+                      const std::complex<float> *a, MKL_INT lda, std::complex<float> *b,
+                      MKL_INT ldb) {
+    const std::complex<float> one{ 1.0f };
+    cblas_ctrsm(CblasColMajor, side, uplo, CblasNoTrans, diag, m, n, &one, a, lda, b, ldb);
+}
+inline void host_trsm(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_DIAG diag, MKL_INT m, MKL_INT n,
+                      const std::complex<double> *a, MKL_INT lda, std::complex<double> *b,
+                      MKL_INT ldb) {
+    const std::complex<double> one{ 1.0 };
+    cblas_ztrsm(CblasColMajor, side, uplo, CblasNoTrans, diag, m, n, &one, a, lda, b, ldb);
+}
+
+// C := C - A B
+inline void host_gemm_update(MKL_INT m, MKL_INT n, MKL_INT k, const float *a, MKL_INT lda,
+                             const float *b, MKL_INT ldb, float *c, MKL_INT ldc) {
+    cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k, -1.0f, a, lda, b, ldb, 1.0f, c,
+                ldc);
+}
+inline void host_gemm_update(MKL_INT m, MKL_INT n, MKL_INT k, const double *a, MKL_INT lda,
+                             const double *b, MKL_INT ldb, double *c, MKL_INT ldc) {
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k, -1.0, a, lda, b, ldb, 1.0, c,
+                ldc);
+}
+inline void host_gemm_update(MKL_INT m, MKL_INT n, MKL_INT k, const std::complex<float> *a,
+                             MKL_INT lda, const std::complex<float> *b, MKL_INT ldb,
+                             std::complex<float> *c, MKL_INT ldc) {
+    const std::complex<float> alpha{ -1.0f }, beta{ 1.0f };
+    cblas_cgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k, &alpha, a, lda, b, ldb, &beta,
+                c, ldc);
+}
+inline void host_gemm_update(MKL_INT m, MKL_INT n, MKL_INT k, const std::complex<double> *a,
+                             MKL_INT lda, const std::complex<double> *b, MKL_INT ldb,
+                             std::complex<double> *c, MKL_INT ldc) {
+    const std::complex<double> alpha{ -1.0 }, beta{ 1.0 };
+    cblas_zgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k, &alpha, a, lda, b, ldb, &beta,
+                c, ldc);
+}
+
+// Applies the interchanges ipiv[k1, k2) (1-based, LAPACK convention) to ncols columns of a.
+template <typename T>
+void swap_rows(T *a, std::int64_t lda, std::int64_t ncols, std::int64_t k1, std::int64_t k2,
+               const std::int64_t *ipiv) {
+    for (std::int64_t col = 0; col < ncols; col++) {
+        T *column = a + col * lda;
+        for (std::int64_t i = k1; i < k2; i++) {
+            const std::int64_t p = ipiv[i] - 1;
+            if (p != i)
+                std::swap(column[i], column[p]);
+        }
+    }
+}
+
+// Dependency graph of tasks run by a fixed set of threads, highest priority first among the
+// tasks whose predecessors have completed.
+class task_graph {
+public:
+    std::size_t add(int priority, std::function<void()> run) {
+        nodes_.push_back(node{ priority, std::move(run), {}, 0 });
+        return nodes_.size() - 1;
+    }
+
+    void depends(std::size_t task, std::size_t on) {
+        nodes_[on].successors.push_back(task);
+        nodes_[task].pending++;
+    }
+
+    // Runs every task with num_threads threads, including the calling one. The first exception
+    // thrown by a task is rethrown once the graph has drained; tasks not yet started are skipped.
+    void run(int num_threads) {
+        std::priority_queue<std::pair<int, std::size_t>> ready;
+        for (std::size_t id = 0; id < nodes_.size(); id++)
+            if (nodes_[id].pending == 0)
+                ready.emplace(nodes_[id].priority, id);
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::size_t completed = 0;
+        std::exception_ptr error;
+
+        auto worker = [&]() {
+            // Tile kernels are sequential; the graph provides the parallelism.
+            const int saved_threads = mkl_set_num_threads_local(1);
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                cv.wait(lock, [&]() { return !ready.empty() || completed == nodes_.size(); });
+                if (ready.empty())
+                    break;
+                const std::size_t id = ready.top().second;
+                ready.pop();
+                const bool skip = static_cast<bool>(error);
+                lock.unlock();
+                if (!skip) {
+                    try {
+                        nodes_[id].run();
+                    }
+                    catch (...) {
+                        std::lock_guard<std::mutex> error_lock(mutex);
+                        if (!error)
+                            error = std::current_exception();
+                    }
+                }
+                lock.lock();
+                completed++;
+                for (auto successor : nodes_[id].successors) {
+                    if (--nodes_[successor].pending == 0) {
+                        ready.emplace(nodes_[successor].priority, successor);
+                        cv.notify_one();
+                    }
+                }
+                if (completed == nodes_.size())
+                    cv.notify_all();
+            }
+            lock.unlock();
+            mkl_set_num_threads_local(saved_threads);
+        };
+
+        std::vector<std::thread> threads;
+        for (int t = 1; t < num_threads; t++)
+            threads.emplace_back(worker);
+        worker();
+        for (auto &thread : threads)
+            thread.join();
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+private:
+    struct node {
+        int priority;
+        std::function<void()> run;
+        std::vector<std::size_t> successors;
+        std::int64_t pending;
+    };
+
+    std::vector<node> nodes_;
+};
+
+template <typename T>
+class factorization {
+public:
+    factorization(std::int64_t m, std::int64_t n, T *a, std::int64_t lda, std::int64_t *ipiv,
+                  int num_threads)
+            : m_(m),
+              n_(n),
+              a_(a),
+              lda_(lda),
+              ipiv_(ipiv),
+              num_threads_(num_threads),
+              mt_((m + block_size - 1) / block_size),
+              nt_((n + block_size - 1) / block_size),
+              kt_(std::min(mt_, nt_)),
+              candidates_(kt_),
+              classic_(kt_, 0) {}
+
+    // Returns the LAPACK info of the factorization.
+    std::int64_t run() {
+        build().run(num_threads_);
+
+        // Interchanges of later panels also apply to the columns left of them.
+        task_graph finish;
+        for (std::int64_t j = 0; j + 1 < kt_; j++)
+            finish.add(0, [this, j]() {
+                for (std::int64_t k = j + 1; k < kt_; k++)
+                    swap_rows(tile(0, j), lda_, cols(j), k * block_size,
+                              k * block_size + pivots(k), ipiv_);
+            });
+        finish.run(num_threads_);
+        return info_;
+    }
+
+private:
+    static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+    std::int64_t rows(std::int64_t i) const {
+        return std::min(block_size, m_ - i * block_size);
+    }
+    std::int64_t cols(std::int64_t j) const {
+        return std::min(block_size, n_ - j * block_size);
+    }
+    std::int64_t pivots(std::int64_t k) const {
+        return std::min(m_ - k * block_size, cols(k));
+    }
+    T *tile(std::int64_t i, std::int64_t j) const {
+        return a_ + i * block_size + j * block_size * lda_;
+    }
+
+    // Panel tasks first, then columns in the order they will be factored.
+    int panel_priority(std::int64_t k) const {
+        return static_cast<int>(2 * (nt_ - k) + 1);
+    }
+    int update_priority(std::int64_t j) const {
+        return static_cast<int>(2 * (nt_ - j));
+    }
+
+    task_graph build() {
+        task_graph graph;
+        // Last gemm update of each tile
+        std::vector<std::size_t> updated(mt_ * nt_, none);
+        auto last_update = [&](std::int64_t i, std::int64_t j) { return updated[i + j * mt_]; };
+
+        for (std::int64_t k = 0; k < kt_; k++) {
+            const std::int64_t num_leaves = std::min<std::int64_t>(num_threads_, mt_ - k);
+            const std::int64_t leaf_tiles = (mt_ - k + num_leaves - 1) / num_leaves;
+
+            std::vector<std::size_t> leaves;
+            for (std::int64_t c = 0; k + c * leaf_tiles < mt_; c++) {
+                const std::int64_t first = k + c * leaf_tiles;
+                const std::int64_t last = std::min(mt_, first + leaf_tiles);
+                auto id = graph.add(panel_priority(k), [this, k, c, first, last]() {
+                    select_leaf(k, c, first * block_size, std::min(m_, last * block_size));
+                });
+                for (std::int64_t i = first; i < last; i++)
+                    if (last_update(i, k) != none)
+                        graph.depends(id, last_update(i, k));
+                leaves.push_back(id);
+            }
+            candidates_[k].resize(leaves.size());
+
+            auto panel = graph.add(panel_priority(k), [this, k]() { factor_panel(k); });
+            for (auto leaf : leaves)
+                graph.depends(panel, leaf);
+
+            // Tile k itself has rows below the diagonal block when the last panel is narrow.
+            std::vector<std::size_t> lower(mt_, none);
+            for (std::int64_t i = rows(k) > pivots(k) ? k : k + 1; i < mt_; i++) {
+                lower[i] = graph.add(panel_priority(k), [this, k, i]() { solve_lower(k, i); });
+                graph.depends(lower[i], panel);
+            }
+
+            for (std::int64_t j = k + 1; j < nt_; j++) {
+                auto upper =
+                    graph.add(update_priority(j), [this, k, j]() { solve_upper(k, j); });
+                graph.depends(upper, panel);
+                for (std::int64_t i = k; i < mt_; i++)
+                    if (last_update(i, j) != none)
+                        graph.depends(upper, last_update(i, j));
+
+                for (std::int64_t i = k + 1; i < mt_; i++) {
+                    auto update =
+                        graph.add(update_priority(j), [this, k, i, j]() { update_tile(k, i, j); });
+                    graph.depends(update, lower[i]);
+                    graph.depends(update, upper);
+                    updated[i + j * mt_] = update;
+                }
+            }
+        }
+        return graph;
+    }
+
+    // Partially pivoted getrf of the given panel rows, in the order listed. Returns the rows in
+    // pivot order (at most as many as the panel has columns) and the getrf info.
+    std::pair<std::vector<std::int64_t>, lapack_int> tournament_round(
+        std::int64_t k, std::vector<std::int64_t> rows) const {
+        const std::int64_t w = cols(k);
+        const std::int64_t r = static_cast<std::int64_t>(rows.size());
+        std::vector<T> block(r * w);
+        const T *panel = tile(0, k);
+        for (std::int64_t col = 0; col < w; col++)
+            for (std::int64_t row = 0; row < r; row++)
+                block[row + col * r] = panel[rows[row] + col * lda_];
+
+        std::vector<lapack_int> local(std::min(r, w));
+        const lapack_int info = host_getrf(r, w, block.data(), r, local.data());
+        for (std::size_t t = 0; t < local.size(); t++)
+            std::swap(rows[t], rows[local[t] - 1]);
+        rows.resize(local.size());
+        return { std::move(rows), info };
+    }
+
+    void select_leaf(std::int64_t k, std::int64_t c, std::int64_t first, std::int64_t last) {
+        std::vector<std::int64_t> rows(last - first);
+        for (std::int64_t row = first; row < last; row++)
+            rows[row - first] = row;
+        candidates_[k][c] = tournament_round(k, std::move(rows)).first;
+    }
+
+    void factor_panel(std::int64_t k) {
+        const std::int64_t k0 = k * block_size;
+        const std::int64_t w = cols(k);
+        const std::int64_t p = pivots(k);
+
+        // Pairwise reduction of the leaf candidates; the last round orders the winners.
+        auto sets = std::move(candidates_[k]);
+        while (sets.size() > 1) {
+            std::vector<std::vector<std::int64_t>> next;
+            for (std::size_t s = 0; s + 1 < sets.size(); s += 2) {
+                sets[s].insert(sets[s].end(), sets[s + 1].begin(), sets[s + 1].end());
+                next.push_back(tournament_round(k, std::move(sets[s])).first);
+            }
+            if (sets.size() % 2)
+                next.push_back(std::move(sets.back()));
+            sets = std::move(next);
+        }
+        auto winners = tournament_round(k, std::move(sets[0]));
+
+        if (winners.second > 0) {
+            // Rank deficient panel: plain partial pivoting reports the first zero pivot exactly.
+            classic_[k] = 1;
+            std::vector<lapack_int> local(p);
+            const lapack_int info = host_getrf(m_ - k0, w, tile(k, k), lda_, local.data());
+            for (std::int64_t t = 0; t < p; t++)
+                ipiv_[k0 + t] = k0 + local[t];
+            if (info > 0 && info_ == 0)
+                info_ = k0 + info;
+            return;
+        }
+
+        // Convert the winners to a sequence of interchanges; only displaced rows are tracked.
+        std::unordered_map<std::int64_t, std::int64_t> row_at, position_of;
+        auto row_at_position = [&](std::int64_t pos) {
+            auto it = row_at.find(pos);
+            return it == row_at.end() ? pos : it->second;
+        };
+        auto position_of_row = [&](std::int64_t row) {
+            auto it = position_of.find(row);
+            return it == position_of.end() ? row : it->second;
+        };
+        for (std::int64_t t = 0; t < p; t++) {
+            const std::int64_t target = k0 + t;
+            const std::int64_t winner = winners.first[t];
+            const std::int64_t current = position_of_row(winner);
+            ipiv_[target] = current + 1;
+            if (current != target) {
+                const std::int64_t displaced = row_at_position(target);
+                row_at[current] = displaced;
+                position_of[displaced] = current;
+                row_at[target] = winner;
+                position_of[winner] = target;
+            }
+        }
+        swap_rows(tile(0, k), lda_, w, k0, k0 + p, ipiv_);
+
+        const lapack_int info = host_getrfnp(p, w, tile(k, k), lda_);
+        if (info > 0 && info_ == 0)
+            info_ = k0 + info;
+    }
+
+    // L21 := A21 U11^-1 for the rows of tile i below the diagonal block
+    void solve_lower(std::int64_t k, std::int64_t i) {
+        if (classic_[k])
+            return;
+        const std::int64_t skip = i == k ? pivots(k) : 0;
+        host_trsm(CblasRight, CblasUpper, CblasNonUnit, rows(i) - skip, pivots(k), tile(k, k),
+                  lda_, tile(i, k) + skip, lda_);
+    }
+
+    // Applies the panel interchanges to column j, then U12 := L11^-1 A12
+    void solve_upper(std::int64_t k, std::int64_t j) {
+        const std::int64_t k0 = k * block_size;
+        swap_rows(tile(0, j), lda_, cols(j), k0, k0 + pivots(k), ipiv_);
+        host_trsm(CblasLeft, CblasLower, CblasUnit, pivots(k), cols(j), tile(k, k), lda_,
+                  tile(k, j), lda_);
+    }
+
+    // A22 := A22 - L21 U12
+    void update_tile(std::int64_t k, std::int64_t i, std::int64_t j) {
+        host_gemm_update(rows(i), cols(j), pivots(k), tile(i, k), lda_, tile(k, j), lda_,
+                         tile(i, j), lda_);
+    }
+
+    const std::int64_t m_, n_;
+    T *const a_;
+    const std::int64_t lda_;
+    std::int64_t *const ipiv_;
+    const int num_threads_;
+    const std::int64_t mt_, nt_, kt_;
+    // Candidate rows selected by each leaf of each panel
+    std::vector<std::vector<std::vector<std::int64_t>>> candidates_;
+    std::vector<char> classic_;
+    // Panels are factored in order, so only the first positive value is kept.
+    std::int64_t info_ = 0;
+};
+
+template <typename T>
+std::int64_t factorize(std::int64_t m, std::int64_t n, T *a, std::int64_t lda,
+                       std::int64_t *ipiv) {
+    factorization<T> lu(m, n, a, lda, ipiv, std::max(1, mkl_get_max_threads()));
+    return lu.run();
+}
+
+inline void check_info(std::int64_t info) {
+    if (info > 0)
+        throw oneapi::mkl::lapack::computation_error(
+            "getrf", "U(" + std::to_string(info) + "," + std::to_string(info) + ") is zero",
+            info);
+}
+
+template <typename T>
+void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<T> &a,
+           std::int64_t lda, sycl::buffer<std::int64_t> &ipiv) {
+    auto info = std::make_shared<std::int64_t>(0);
+    queue
+        .submit([&](sycl::handler &cgh) {
+            auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+            auto ipiv_acc = ipiv.template get_access<sycl::access::mode::write>(cgh);
+            cgh.host_task([=]() {
+                *info = factorize(
+                    m, n, a_acc.template get_multi_ptr<sycl::access::decorated::no>().get(), lda,
+                    ipiv_acc.template get_multi_ptr<sycl::access::decorated::no>().get());
+            });
+        })
+        .wait();
+    check_info(*info);
+}
+
+template <typename T>
+sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, T *a, std::int64_t lda,
+                  std::int64_t *ipiv, const std::vector<sycl::event> &dependencies) {
+    auto info = std::make_shared<std::int64_t>(0);
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() { *info = factorize(m, n, a, lda, ipiv); });
+    });
+    done.wait();
+    check_info(*info);
+    return done;
+}
+
+} // namespace calu
+} // namespace mklcpu
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _ONEMKL_LAPACK_MKLCPU_CALU_HPP_
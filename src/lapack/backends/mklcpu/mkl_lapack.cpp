@@ -23,10 +23,15 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/types.hpp"
 #include "oneapi/mkl/lapack/types.hpp"
 #include "oneapi/mkl/lapack/detail/mklcpu/onemkl_lapack_mklcpu.hpp"
 #include "../mkl_common/mkl_lapack_backend.hpp"
+#include "calu.hpp"
+
+// Large getrf takes the tournament-pivoting path of calu.hpp
+#define ONEMKL_LAPACK_CALU
 
 namespace oneapi {
 namespace mkl {
@@ -36,6 +36,7 @@
 #include "runtime_support_helper.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/lapack/exceptions.hpp"
+#include "lapack/info_array.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -183,6 +184,23 @@ inline rocblas_evect get_rocsolver_job(oneapi::mkl::job jobz) {
     }
 }
 
+inline rocblas_evect get_rocsolver_job(oneapi::mkl::compz jobz) {
+    switch (jobz) {
+        case oneapi::mkl::compz::N: return rocblas_evect_none;
+        case oneapi::mkl::compz::V: return rocblas_evect_original;
+        default: throw "Wrong jobz.";
+    }
+}
+
+inline rocblas_erange get_rocsolver_range(oneapi::mkl::rangev range) {
+    switch (range) {
+        case oneapi::mkl::rangev::A: return rocblas_erange_all;
+        case oneapi::mkl::rangev::V: return rocblas_erange_value;
+        case oneapi::mkl::rangev::I: return rocblas_erange_index;
+        default: throw "Wrong range.";
+    }
+}
+
 inline rocblas_svect get_rocsolver_jobsvd(oneapi::mkl::jobsvd job) {
     switch (job) {
         case oneapi::mkl::jobsvd::N: return rocblas_svect_none;
@@ -270,6 +288,35 @@ inline void lapack_info_check(sycl::queue &queue, DEVINFO_T devinfo, const char
             devinfo_);
 }
 
+// USM routines hand devInfo over to this check, which releases it. Without an info array
+// registered for the queue, waits for done and throws on a positive info; otherwise records the
+// value asynchronously and returns without blocking.
+inline sycl::event lapack_info_check(sycl::queue &queue, int *devInfo, const sycl::event &done,
+                                     const char *func_name, const char *cufunc_name) {
+    const auto array = oneapi::mkl::lapack::detail::get_info_array(queue);
+    if (array.info)
+        return oneapi::mkl::lapack::detail::record_info(queue, array, devInfo, 1, done);
+    int devinfo_;
+    queue.memcpy(&devinfo_, devInfo, sizeof(int), done).wait();
+    sycl::free(devInfo, queue);
+    if (devinfo_ > 0)
+        throw oneapi::mkl::lapack::computation_error(
+            func_name, std::string(cufunc_name) + " failed with info = " + std::to_string(devinfo_),
+            devinfo_);
+    return done;
+}
+
+// rocSOLVER *evx routines return the number of eigenvalues found as a rocblas_int on the device;
+// widens it into m. Must be called from a host task after the rocSOLVER call has completed.
+inline void store_eigenvalue_count(const rocblas_int *nev, std::int64_t *m) {
+    hipError_t hip_err;
+    rocblas_int nev_host;
+    HIP_ERROR_FUNC(hipMemcpy, hip_err, &nev_host, nev, sizeof(rocblas_int),
+                   hipMemcpyDeviceToHost);
+    const std::int64_t m_host = nev_host;
+    HIP_ERROR_FUNC(hipMemcpy, hip_err, m, &m_host, sizeof(std::int64_t), hipMemcpyHostToDevice);
+}
+
 } // namespace rocsolver
 } // namespace lapack
 } // namespace mkl
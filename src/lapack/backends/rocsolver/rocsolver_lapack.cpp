@@ -358,6 +358,58 @@ HEEVD_LAUNCHER(std::complex<double>, double, rocsolver_zheevd)
 
 #undef HEEVD_LAUNCHER
 
+template <typename Func, typename T_A, typename T_B>
+inline void heevx(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::compz jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  sycl::buffer<T_A> &a, std::int64_t lda, T_B vl, T_B vu, std::int64_t il,
+                  std::int64_t iu, T_B abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<T_B> &w,
+                  sycl::buffer<T_A> &z, std::int64_t ldz, sycl::buffer<T_A> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    using rocmDataType_A = typename RocmEquivalentType<T_A>::Type;
+    using rocmDataType_B = typename RocmEquivalentType<T_B>::Type;
+    overflow_check(n, lda, il, iu, ldz, scratchpad_size);
+    sycl::buffer<int> devInfo{ 1 };
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto devInfo_acc = devInfo.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        onemkl_rocsolver_host_task(cgh, queue, [=](RocsolverScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = sc.get_mem<rocmDataType_A *>(a_acc);
+            auto m_ = sc.get_mem<std::int64_t *>(m_acc);
+            auto w_ = sc.get_mem<rocmDataType_B *>(w_acc);
+            auto z_ = sc.get_mem<rocmDataType_A *>(z_acc);
+            auto devInfo_ = sc.get_mem<int *>(devInfo_acc);
+            auto nev_ = sc.get_mem<rocblas_int *>(scratch_acc);
+            rocblas_status err;
+            ROCSOLVER_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_rocsolver_job(jobz),
+                                        get_rocsolver_range(range), get_rocblas_fill_mode(uplo), n,
+                                        a_, lda, vl, vu, il, iu, abstol, nev_, w_, z_, ldz,
+                                        nev_ + 1, devInfo_);
+            store_eigenvalue_count(nev_, m_);
+        });
+    });
+    lapack_info_check(queue, devInfo, __func__, func_name);
+}
+
+#define HEEVX_LAUNCHER(TYPE_A, TYPE_B, ROCSOLVER_ROUTINE)                                         \
+    void heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,            \
+               oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE_A> &a, std::int64_t lda, \
+               TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu, TYPE_B abstol,             \
+               sycl::buffer<std::int64_t> &m, sycl::buffer<TYPE_B> &w, sycl::buffer<TYPE_A> &z,   \
+               std::int64_t ldz, sycl::buffer<TYPE_A> &scratchpad, std::int64_t scratchpad_size) { \
+        heevx(#ROCSOLVER_ROUTINE, ROCSOLVER_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl, vu, \
+              il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);                         \
+    }
+
+HEEVX_LAUNCHER(std::complex<float>, float, rocsolver_cheevx)
+HEEVX_LAUNCHER(std::complex<double>, double, rocsolver_zheevx)
+
+#undef HEEVX_LAUNCHER
+
 template <typename Func, typename T_A, typename T_B>
 inline void hegvd(const char *func_name, Func func, sycl::queue &queue, std::int64_t itype,
                   oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
@@ -794,6 +846,57 @@ SYEVD_LAUNCHER(double, rocsolver_dsyevd)
 
 #undef SYEVD_LAUNCHER
 
+template <typename Func, typename T>
+inline void syevx(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::compz jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  sycl::buffer<T> &a, std::int64_t lda, T vl, T vu, std::int64_t il,
+                  std::int64_t iu, T abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<T> &w,
+                  sycl::buffer<T> &z, std::int64_t ldz, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    using rocmDataType = typename RocmEquivalentType<T>::Type;
+    overflow_check(n, lda, il, iu, ldz, scratchpad_size);
+    sycl::buffer<int> devInfo{ 1 };
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto devInfo_acc = devInfo.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        onemkl_rocsolver_host_task(cgh, queue, [=](RocsolverScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = sc.get_mem<rocmDataType *>(a_acc);
+            auto m_ = sc.get_mem<std::int64_t *>(m_acc);
+            auto w_ = sc.get_mem<rocmDataType *>(w_acc);
+            auto z_ = sc.get_mem<rocmDataType *>(z_acc);
+            auto devInfo_ = sc.get_mem<int *>(devInfo_acc);
+            auto nev_ = sc.get_mem<rocblas_int *>(scratch_acc);
+            rocblas_status err;
+            ROCSOLVER_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_rocsolver_job(jobz),
+                                        get_rocsolver_range(range), get_rocblas_fill_mode(uplo), n,
+                                        a_, lda, vl, vu, il, iu, abstol, nev_, w_, z_, ldz,
+                                        nev_ + 1, devInfo_);
+            store_eigenvalue_count(nev_, m_);
+        });
+    });
+    lapack_info_check(queue, devInfo, __func__, func_name);
+}
+
+#define SYEVX_LAUNCHER(TYPE, ROCSOLVER_ROUTINE)                                                   \
+    void syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,            \
+               oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a, std::int64_t lda,   \
+               TYPE vl, TYPE vu, std::int64_t il, std::int64_t iu, TYPE abstol,                   \
+               sycl::buffer<std::int64_t> &m, sycl::buffer<TYPE> &w, sycl::buffer<TYPE> &z,       \
+               std::int64_t ldz, sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {  \
+        syevx(#ROCSOLVER_ROUTINE, ROCSOLVER_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl, vu, \
+              il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);                         \
+    }
+
+SYEVX_LAUNCHER(float, rocsolver_ssyevx)
+SYEVX_LAUNCHER(double, rocsolver_dsyevx)
+
+#undef SYEVX_LAUNCHER
+
 template <typename Func, typename T>
 inline void sygvd(const char *func_name, Func func, sycl::queue &queue, std::int64_t itype,
                   oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<T> &a,
@@ -1298,10 +1401,12 @@ inline sycl::event getrf(const char *func_name, Func func, sycl::queue &queue, s
         });
     });
 
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(ipiv32, queue);
-    free(devInfo, queue);
-    return done_casting;
+    queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(done_casting);
+        cgh.host_task([=]() { sycl::free(ipiv32, queue); });
+    });
+
+    return lapack_info_check(queue, devInfo, done_casting, __func__, func_name);
 }
 
 #define GETRF_LAUNCHER_USM(TYPE, ROCSOLVER_ROUTINE)                                                \
@@ -1357,6 +1462,7 @@ inline sycl::event getrs(const char *func_name, Func func, sycl::queue &queue,
     int *ipiv32 = (int *)malloc_device(sizeof(int) * ipiv_size, queue);
 
     auto done_casting = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
         cgh.parallel_for(sycl::range<1>{ ipiv_size }, [=](sycl::id<1> index) {
             ipiv32[index] = static_cast<std::int32_t>(ipiv[index]);
         });
@@ -1379,9 +1485,11 @@ inline sycl::event getrs(const char *func_name, Func func, sycl::queue &queue,
         });
     });
 
-    queue.wait();
-
-    free(ipiv32, queue);
+    // Enqueue free memory, don't return event as not-neccessary for user to wait for ipiv32 being released
+    queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(done);
+        cgh.host_task([=]() { sycl::free(ipiv32, queue); });
+    });
 
     return done;
 }
@@ -1432,9 +1540,7 @@ inline sycl::event gesvd(const char *func_name, Func func, sycl::queue &queue,
                                         devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define GESVD_LAUNCHER_USM(TYPE_A, TYPE_B, ROCSOLVER_ROUTINE)                                    \
@@ -1480,9 +1586,7 @@ inline sycl::event heevd(const char *func_name, Func func, sycl::queue &queue,
                                         devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define HEEVD_LAUNCHER_USM(TYPE_A, TYPE_B, ROCSOLVER_ROUTINE)                                     \
@@ -1499,6 +1603,58 @@ HEEVD_LAUNCHER_USM(std::complex<double>, double, rocsolver_zheevd)
 
 #undef HEEVD_LAUNCHER_USM
 
+template <typename Func, typename T_A, typename T_B>
+inline sycl::event heevx(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, T_A *a, std::int64_t lda, T_B vl,
+                         T_B vu, std::int64_t il, std::int64_t iu, T_B abstol, std::int64_t *m,
+                         T_B *w, T_A *z, std::int64_t ldz, T_A *scratchpad,
+                         std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    using rocmDataType_A = typename RocmEquivalentType<T_A>::Type;
+    using rocmDataType_B = typename RocmEquivalentType<T_B>::Type;
+    overflow_check(n, lda, il, iu, ldz, scratchpad_size);
+    int *devInfo = (int *)malloc_device(sizeof(int), queue);
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        onemkl_rocsolver_host_task(cgh, queue, [=](RocsolverScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = reinterpret_cast<rocmDataType_A *>(a);
+            auto w_ = reinterpret_cast<rocmDataType_B *>(w);
+            auto z_ = reinterpret_cast<rocmDataType_A *>(z);
+            auto devInfo_ = reinterpret_cast<int *>(devInfo);
+            auto nev_ = reinterpret_cast<rocblas_int *>(scratchpad);
+            rocblas_status err;
+            ROCSOLVER_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_rocsolver_job(jobz),
+                                        get_rocsolver_range(range), get_rocblas_fill_mode(uplo), n,
+                                        a_, lda, vl, vu, il, iu, abstol, nev_, w_, z_, ldz,
+                                        nev_ + 1, devInfo_);
+            store_eigenvalue_count(nev_, m);
+        });
+    });
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
+}
+
+#define HEEVX_LAUNCHER_USM(TYPE_A, TYPE_B, ROCSOLVER_ROUTINE)                                     \
+    sycl::event heevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,     \
+                      oneapi::mkl::uplo uplo, std::int64_t n, TYPE_A *a, std::int64_t lda,        \
+                      TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu, TYPE_B abstol,      \
+                      std::int64_t *m, TYPE_B *w, TYPE_A *z, std::int64_t ldz, TYPE_A *scratchpad, \
+                      std::int64_t scratchpad_size,                                               \
+                      const std::vector<sycl::event> &dependencies) {                             \
+        return heevx(#ROCSOLVER_ROUTINE, ROCSOLVER_ROUTINE, queue, jobz, range, uplo, n, a, lda,   \
+                     vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size,           \
+                     dependencies);                                                               \
+    }
+
+HEEVX_LAUNCHER_USM(std::complex<float>, float, rocsolver_cheevx)
+HEEVX_LAUNCHER_USM(std::complex<double>, double, rocsolver_zheevx)
+
+#undef HEEVX_LAUNCHER_USM
+
 template <typename Func, typename T_A, typename T_B>
 inline sycl::event hegvd(const char *func_name, Func func, sycl::queue &queue, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, T_A *&a,
@@ -1527,9 +1683,7 @@ inline sycl::event hegvd(const char *func_name, Func func, sycl::queue &queue, s
                                         lda, b_, ldb, w_, scratch_, devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define HEGVD_LAUNCHER_USM(TYPE_A, TYPE_B, ROCSOLVER_ROUTINE)                                    \
@@ -1833,9 +1987,7 @@ inline sycl::event potrf(const char *func_name, Func func, sycl::queue &queue,
                                         n, a_, lda, devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define POTRF_LAUNCHER_USM(TYPE, ROCSOLVER_ROUTINE)                                             \
@@ -1876,9 +2028,7 @@ inline sycl::event potri(const char *func_name, Func func, sycl::queue &queue,
                                         n, a_, lda, devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define POTRI_LAUNCHER_USM(TYPE, ROCSOLVER_ROUTINE)                                             \
@@ -1962,9 +2112,7 @@ inline sycl::event syevd(const char *func_name, Func func, sycl::queue &queue,
                                         devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define SYEVD_LAUNCHER_USM(TYPE, ROCSOLVER_ROUTINE)                                          \
@@ -1981,6 +2129,56 @@ SYEVD_LAUNCHER_USM(double, rocsolver_dsyevd)
 
 #undef SYEVD_LAUNCHER_USM
 
+template <typename Func, typename T>
+inline sycl::event syevx(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T vl,
+                         T vu, std::int64_t il, std::int64_t iu, T abstol, std::int64_t *m, T *w,
+                         T *z, std::int64_t ldz, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    using rocmDataType = typename RocmEquivalentType<T>::Type;
+    overflow_check(n, lda, il, iu, ldz, scratchpad_size);
+    int *devInfo = (int *)malloc_device(sizeof(int), queue);
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        onemkl_rocsolver_host_task(cgh, queue, [=](RocsolverScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = reinterpret_cast<rocmDataType *>(a);
+            auto w_ = reinterpret_cast<rocmDataType *>(w);
+            auto z_ = reinterpret_cast<rocmDataType *>(z);
+            auto devInfo_ = reinterpret_cast<int *>(devInfo);
+            auto nev_ = reinterpret_cast<rocblas_int *>(scratchpad);
+            rocblas_status err;
+            ROCSOLVER_ERROR_FUNC_T_SYNC(func_name, func, err, handle, get_rocsolver_job(jobz),
+                                        get_rocsolver_range(range), get_rocblas_fill_mode(uplo), n,
+                                        a_, lda, vl, vu, il, iu, abstol, nev_, w_, z_, ldz,
+                                        nev_ + 1, devInfo_);
+            store_eigenvalue_count(nev_, m);
+        });
+    });
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
+}
+
+#define SYEVX_LAUNCHER_USM(TYPE, ROCSOLVER_ROUTINE)                                              \
+    sycl::event syevx(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,    \
+                      oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a, std::int64_t lda, TYPE vl, \
+                      TYPE vu, std::int64_t il, std::int64_t iu, TYPE abstol, std::int64_t *m,   \
+                      TYPE *w, TYPE *z, std::int64_t ldz, TYPE *scratchpad,                      \
+                      std::int64_t scratchpad_size,                                              \
+                      const std::vector<sycl::event> &dependencies) {                            \
+        return syevx(#ROCSOLVER_ROUTINE, ROCSOLVER_ROUTINE, queue, jobz, range, uplo, n, a, lda,  \
+                     vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size,          \
+                     dependencies);                                                              \
+    }
+
+SYEVX_LAUNCHER_USM(float, rocsolver_ssyevx)
+SYEVX_LAUNCHER_USM(double, rocsolver_dsyevx)
+
+#undef SYEVX_LAUNCHER_USM
+
 template <typename Func, typename T>
 inline sycl::event sygvd(const char *func_name, Func func, sycl::queue &queue, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
@@ -2008,9 +2206,7 @@ inline sycl::event sygvd(const char *func_name, Func func, sycl::queue &queue, s
                                         lda, b_, ldb, w_, scratch_, devInfo_);
         });
     });
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(devInfo, queue);
-    return done;
+    return lapack_info_check(queue, devInfo, done, __func__, func_name);
 }
 
 #define SYGVD_LAUNCHER_USM(TYPE, ROCSOLVER_ROUTINE)                                               \
@@ -2106,10 +2302,12 @@ inline sycl::event sytrf(const char *func_name, Func func, sycl::queue &queue,
         });
     });
 
-    lapack_info_check(queue, devInfo, __func__, func_name);
-    free(ipiv32, queue);
-    free(devInfo, queue);
-    return done_casting;
+    queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(done_casting);
+        cgh.host_task([=]() { sycl::free(ipiv32, queue); });
+    });
+
+    return lapack_info_check(queue, devInfo, done_casting, __func__, func_name);
 }
 
 #define SYTRF_LAUNCHER_USM(TYPE, ROCSOLVER_ROUTINE)                                        \
@@ -2494,6 +2692,28 @@ HEEVD_LAUNCHER_SCRATCH(std::complex<double>)
 
 #undef HEEVD_LAUNCHER_SCRATCH
 
+// The scratchpad holds the number of eigenvalues found followed by the n entries of ifail.
+template <typename T>
+inline std::int64_t evx_scratchpad_size(std::int64_t n) {
+    return ((n + 1) * sizeof(rocblas_int) + sizeof(T) - 1) / sizeof(T);
+}
+
+#define EVX_LAUNCHER_SCRATCH(ROUTINE, TYPE_A, TYPE_B)                                             \
+    template <>                                                                                   \
+    std::int64_t ROUTINE##_scratchpad_size<TYPE_A>(                                               \
+        sycl::queue & queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,                  \
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, TYPE_B vl, TYPE_B vu,           \
+        std::int64_t il, std::int64_t iu, TYPE_B abstol, std::int64_t ldz) {                      \
+        return evx_scratchpad_size<TYPE_A>(n);                                                    \
+    }
+
+EVX_LAUNCHER_SCRATCH(heevx, std::complex<float>, float)
+EVX_LAUNCHER_SCRATCH(heevx, std::complex<double>, double)
+EVX_LAUNCHER_SCRATCH(syevx, float, float)
+EVX_LAUNCHER_SCRATCH(syevx, double, double)
+
+#undef EVX_LAUNCHER_SCRATCH
+
 #define HEGVD_LAUNCHER_SCRATCH(TYPE)                                                               \
     template <>                                                                                    \
     std::int64_t hegvd_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t itype,              \
@@ -2801,6 +3021,10 @@ UNMTR_LAUNCHER_SCRATCH(std::complex<double>)
 
 #undef UNMTR_LAUNCHER_SCRATCH
 
+void set_info_array(sycl::queue &queue, std::int64_t *info, std::int64_t size) {
+    oneapi::mkl::lapack::detail::set_info_array(queue, info, size);
+}
+
 } // namespace rocsolver
 } // namespace lapack
 } // namespace mkl
@@ -56,6 +56,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::rocsolver::gesvd,
     oneapi::mkl::lapack::rocsolver::heevd,
     oneapi::mkl::lapack::rocsolver::heevd,
+    oneapi::mkl::lapack::rocsolver::heevx,
+    oneapi::mkl::lapack::rocsolver::heevx,
     oneapi::mkl::lapack::rocsolver::hegvd,
     oneapi::mkl::lapack::rocsolver::hegvd,
     oneapi::mkl::lapack::rocsolver::hetrd,
@@ -88,6 +90,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::rocsolver::potrs,
     oneapi::mkl::lapack::rocsolver::syevd,
     oneapi::mkl::lapack::rocsolver::syevd,
+    oneapi::mkl::lapack::rocsolver::syevx,
+    oneapi::mkl::lapack::rocsolver::syevx,
     oneapi::mkl::lapack::rocsolver::sygvd,
     oneapi::mkl::lapack::rocsolver::sygvd,
     oneapi::mkl::lapack::rocsolver::sytrd,
@@ -142,6 +146,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::rocsolver::gesvd,
     oneapi::mkl::lapack::rocsolver::heevd,
     oneapi::mkl::lapack::rocsolver::heevd,
+    oneapi::mkl::lapack::rocsolver::heevx,
+    oneapi::mkl::lapack::rocsolver::heevx,
     oneapi::mkl::lapack::rocsolver::hegvd,
     oneapi::mkl::lapack::rocsolver::hegvd,
     oneapi::mkl::lapack::rocsolver::hetrd,
@@ -174,6 +180,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::rocsolver::potrs,
     oneapi::mkl::lapack::rocsolver::syevd,
     oneapi::mkl::lapack::rocsolver::syevd,
+    oneapi::mkl::lapack::rocsolver::syevx,
+    oneapi::mkl::lapack::rocsolver::syevx,
     oneapi::mkl::lapack::rocsolver::sygvd,
     oneapi::mkl::lapack::rocsolver::sygvd,
     oneapi::mkl::lapack::rocsolver::sytrd,
@@ -312,6 +320,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::rocsolver::getrs_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::rocsolver::heevd_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::rocsolver::heevd_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::heevx_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::heevx_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::rocsolver::hegvd_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::rocsolver::hegvd_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::rocsolver::hetrd_scratchpad_size<std::complex<float>>,
@@ -348,6 +358,8 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::rocsolver::sytrf_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::rocsolver::syevd_scratchpad_size<float>,
     oneapi::mkl::lapack::rocsolver::syevd_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::syevx_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::syevx_scratchpad_size<double>,
     oneapi::mkl::lapack::rocsolver::sygvd_scratchpad_size<float>,
     oneapi::mkl::lapack::rocsolver::sygvd_scratchpad_size<double>,
     oneapi::mkl::lapack::rocsolver::sytrd_scratchpad_size<float>,
@@ -423,6 +435,7 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::rocsolver::potrs_batch_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::rocsolver::potrs_batch_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::rocsolver::ungqr_batch_scratchpad_size<std::complex<float>>,
-    oneapi::mkl::lapack::rocsolver::ungqr_batch_scratchpad_size<std::complex<double>>
+    oneapi::mkl::lapack::rocsolver::ungqr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::set_info_array
 #undef LAPACK_BACKEND
 };
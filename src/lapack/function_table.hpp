@@ -166,6 +166,22 @@ typedef struct {
                         std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
                         sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &scratchpad,
                         std::int64_t scratchpad_size);
+    void (*cheevx_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n,
+                        sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                        std::int64_t il, std::int64_t iu, float abstol,
+                        sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                        sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+    void (*zheevx_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n,
+                        sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                        double vu, std::int64_t il, std::int64_t iu, double abstol,
+                        sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                        sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
     void (*chegvd_sycl)(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                         oneapi::mkl::uplo uplo, std::int64_t n,
                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -304,6 +320,18 @@ typedef struct {
                         std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
                         sycl::buffer<float> &w, sycl::buffer<float> &scratchpad,
                         std::int64_t scratchpad_size);
+    void (*dsyevx_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                        std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                        double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                        sycl::buffer<double> &z, std::int64_t ldz, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size);
+    void (*ssyevx_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                        std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                        float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                        sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size);
     void (*dsygvd_sycl)(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
                         std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
@@ -574,6 +602,22 @@ typedef struct {
                                    std::int64_t lda, double *w, std::complex<double> *scratchpad,
                                    std::int64_t scratchpad_size,
                                    const std::vector<sycl::event> &dependencies);
+    sycl::event (*cheevx_usm_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                                   float vl, float vu, std::int64_t il, std::int64_t iu,
+                                   float abstol, std::int64_t *m, float *w, std::complex<float> *z,
+                                   std::int64_t ldz, std::complex<float> *scratchpad,
+                                   std::int64_t scratchpad_size,
+                                   const std::vector<sycl::event> &dependencies);
+    sycl::event (*zheevx_usm_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                                   double vl, double vu, std::int64_t il, std::int64_t iu,
+                                   double abstol, std::int64_t *m, double *w,
+                                   std::complex<double> *z, std::int64_t ldz,
+                                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                   const std::vector<sycl::event> &dependencies);
     sycl::event (*chegvd_usm_sycl)(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
                                    std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
@@ -726,6 +770,20 @@ typedef struct {
                                    std::int64_t lda, float *w, float *scratchpad,
                                    std::int64_t scratchpad_size,
                                    const std::vector<sycl::event> &dependencies);
+    sycl::event (*dsyevx_usm_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, double *a, std::int64_t lda, double vl,
+                                   double vu, std::int64_t il, std::int64_t iu, double abstol,
+                                   std::int64_t *m, double *w, double *z, std::int64_t ldz,
+                                   double *scratchpad, std::int64_t scratchpad_size,
+                                   const std::vector<sycl::event> &dependencies);
+    sycl::event (*ssyevx_usm_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, float *a, std::int64_t lda, float vl, float vu,
+                                   std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                                   float *w, float *z, std::int64_t ldz, float *scratchpad,
+                                   std::int64_t scratchpad_size,
+                                   const std::vector<sycl::event> &dependencies);
     sycl::event (*dsygvd_usm_sycl)(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, double *a,
                                    std::int64_t lda, double *b, std::int64_t ldb, double *w,
@@ -1437,6 +1495,16 @@ typedef struct {
     std::int64_t (*zheevd_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
                                                 oneapi::mkl::uplo uplo, std::int64_t n,
                                                 std::int64_t lda);
+    std::int64_t (*cheevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, float vl,
+                                                float vu, std::int64_t il, std::int64_t iu,
+                                                float abstol, std::int64_t ldz);
+    std::int64_t (*zheevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, double vl,
+                                                double vu, std::int64_t il, std::int64_t iu,
+                                                double abstol, std::int64_t ldz);
     std::int64_t (*chegvd_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t itype,
                                                 oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
                                                 std::int64_t n, std::int64_t lda, std::int64_t ldb);
@@ -1531,6 +1599,16 @@ typedef struct {
     std::int64_t (*dsyevd_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
                                                 oneapi::mkl::uplo uplo, std::int64_t n,
                                                 std::int64_t lda);
+    std::int64_t (*ssyevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, float vl,
+                                                float vu, std::int64_t il, std::int64_t iu,
+                                                float abstol, std::int64_t ldz);
+    std::int64_t (*dsyevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::compz jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, double vl,
+                                                double vu, std::int64_t il, std::int64_t iu,
+                                                double abstol, std::int64_t ldz);
     std::int64_t (*ssygvd_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t itype,
                                                 oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
                                                 std::int64_t n, std::int64_t lda, std::int64_t ldb);
@@ -1835,5 +1913,6 @@ typedef struct {
                                                       std::int64_t *n, std::int64_t *k,
                                                       std::int64_t *lda, std::int64_t group_count,
                                                       std::int64_t *group_sizes);
+    void (*set_info_array_sycl)(sycl::queue &queue, std::int64_t *info, std::int64_t size);
 
 } lapack_function_table_t;
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_LAPACK_INFO_ARRAY_HPP_
+#define _ONEMKL_LAPACK_INFO_ARRAY_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/lapack/exceptions.hpp"
+
+// Asynchronous info reporting for the USM entry points of backends that read info back from the
+// device (cusolver, rocsolver).
+//
+// By default such a backend waits for each routine and throws computation_error for a positive
+// info. Once a USM array has been registered for a queue with set_info_array, routines submitted
+// to that queue do not block: a kernel folds their info values into the array instead, entry i
+// receiving the info of matrix i of a batch (entry 0 for non-batched routines). An entry keeps the
+// first nonzero value it receives, so the caller can clear the array, enqueue any number of calls
+// and inspect it at the next synchronization point.
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace detail {
+
+struct info_array {
+    std::int64_t *info = nullptr;
+    std::int64_t size = 0;
+};
+
+inline std::mutex &info_array_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+inline std::unordered_map<sycl::queue, info_array> &info_arrays() {
+    static std::unordered_map<sycl::queue, info_array> arrays;
+    return arrays;
+}
+
+inline void set_info_array(sycl::queue &queue, std::int64_t *info, std::int64_t size) {
+    if (info != nullptr) {
+        if (size < 1)
+            throw oneapi::mkl::lapack::invalid_argument("set_info_array", "size must be positive",
+                                                        3);
+        if (sycl::get_pointer_type(info, queue.get_context()) == sycl::usm::alloc::unknown)
+            throw oneapi::mkl::lapack::invalid_argument(
+                "set_info_array", "info must be a USM allocation in the queue context", 2);
+    }
+    std::lock_guard<std::mutex> lock(info_array_mutex());
+    if (info == nullptr)
+        info_arrays().erase(queue);
+    else
+        info_arrays()[queue] = info_array{ info, size };
+}
+
+inline info_array get_info_array(const sycl::queue &queue) {
+    std::lock_guard<std::mutex> lock(info_array_mutex());
+    auto it = info_arrays().find(queue);
+    return it == info_arrays().end() ? info_array{} : it->second;
+}
+
+// Folds count device info values into the registered array once done has completed, then
+// releases devInfo. Returns the event of the fold so callers can hand it back to the user.
+inline sycl::event record_info(sycl::queue &queue, const info_array &array, int *devInfo,
+                               std::int64_t count, const sycl::event &done) {
+    std::int64_t *info = array.info;
+    const std::int64_t n = std::min(count, array.size);
+    auto recorded = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(done);
+        cgh.parallel_for(sycl::range<1>{ static_cast<size_t>(n) }, [=](sycl::id<1> index) {
+            if (info[index] == 0)
+                info[index] = static_cast<std::int64_t>(devInfo[index]);
+        });
+    });
+    auto context = queue.get_context();
+    queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(recorded);
+        cgh.host_task([=]() { sycl::free(devInfo, context); });
+    });
+    return recorded;
+}
+
+} // namespace detail
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _ONEMKL_LAPACK_INFO_ARRAY_HPP_
@@ -21,6 +21,7 @@
 
 #include "function_table_initializer.hpp"
 #include "lapack/function_table.hpp"
+#include "lapack/tsqr.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -224,6 +225,24 @@ void heevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz
     function_tables[libkey].zheevd_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
                                         scratchpad_size);
 }
+void heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+           std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+           sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].cheevx_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
+void heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu,
+           std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+           sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].zheevx_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
 void hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
            oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -426,6 +445,24 @@ void syevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz
     function_tables[libkey].ssyevd_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
                                         scratchpad_size);
 }
+void syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<double> &a, std::int64_t lda, double vl, double vu, std::int64_t il,
+           std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<double> &z, std::int64_t ldz, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    function_tables[libkey].dsyevx_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
+void syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<float> &a, std::int64_t lda, float vl, float vu, std::int64_t il,
+           std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    function_tables[libkey].ssyevx_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
 void sygvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
            oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
            std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &w,
@@ -657,18 +694,27 @@ sycl::event geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m
                   std::complex<float> *a, std::int64_t lda, std::complex<float> *tau,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const std::vector<sycl::event> &dependencies) {
+    if (tsqr::is_selected(m, n))
+        return tsqr::geqrf(libkey, queue, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                           dependencies);
     return function_tables[libkey].cgeqrf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
                                                    scratchpad_size, dependencies);
 }
 sycl::event geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   double *a, std::int64_t lda, double *tau, double *scratchpad,
                   std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    if (tsqr::is_selected(m, n))
+        return tsqr::geqrf(libkey, queue, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                           dependencies);
     return function_tables[libkey].dgeqrf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
                                                    scratchpad_size, dependencies);
 }
 sycl::event geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   float *a, std::int64_t lda, float *tau, float *scratchpad,
                   std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    if (tsqr::is_selected(m, n))
+        return tsqr::geqrf(libkey, queue, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                           dependencies);
     return function_tables[libkey].sgeqrf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
                                                    scratchpad_size, dependencies);
 }
@@ -676,6 +722,9 @@ sycl::event geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m
                   std::complex<double> *a, std::int64_t lda, std::complex<double> *tau,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const std::vector<sycl::event> &dependencies) {
+    if (tsqr::is_selected(m, n))
+        return tsqr::geqrf(libkey, queue, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                           dependencies);
     return function_tables[libkey].zgeqrf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
                                                    scratchpad_size, dependencies);
 }
@@ -808,6 +857,26 @@ sycl::event heevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::j
     return function_tables[libkey].zheevd_usm_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
                                                    scratchpad_size, dependencies);
 }
+sycl::event heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                  std::int64_t iu, float abstol, std::int64_t *m, float *w, std::complex<float> *z,
+                  std::int64_t ldz, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cheevx_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
+sycl::event heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                  std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                  std::complex<double> *z, std::int64_t ldz, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zheevx_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
 sycl::event hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                   oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                   std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
@@ -1032,6 +1101,26 @@ sycl::event syevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::j
     return function_tables[libkey].ssyevd_usm_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
                                                    scratchpad_size, dependencies);
 }
+sycl::event syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                  std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                  double abstol, std::int64_t *m, double *w, double *z, std::int64_t ldz,
+                  double *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dsyevx_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
+sycl::event syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::compz jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                  std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                  float abstol, std::int64_t *m, float *w, float *z, std::int64_t ldz,
+                  float *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].ssyevx_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
 sycl::event sygvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                   oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
                   std::int64_t lda, double *b, std::int64_t ldb, double *w, double *scratchpad,
@@ -2004,24 +2093,38 @@ std::int64_t gerqf_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
 template <>
 std::int64_t geqrf_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
                                           std::int64_t m, std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].sgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    std::int64_t size = function_tables[libkey].sgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    if (tsqr::is_selected(m, n))
+        size = std::max(size, tsqr::geqrf_scratchpad_size<float>(libkey, queue, m, n, lda));
+    return size;
 }
 template <>
 std::int64_t geqrf_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
                                            std::int64_t m, std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].dgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    std::int64_t size = function_tables[libkey].dgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    if (tsqr::is_selected(m, n))
+        size = std::max(size, tsqr::geqrf_scratchpad_size<double>(libkey, queue, m, n, lda));
+    return size;
 }
 template <>
 std::int64_t geqrf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, std::int64_t m,
                                                         std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].cgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    std::int64_t size = function_tables[libkey].cgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    if (tsqr::is_selected(m, n))
+        size = std::max(size,
+                        tsqr::geqrf_scratchpad_size<std::complex<float>>(libkey, queue, m, n, lda));
+    return size;
 }
 template <>
 std::int64_t geqrf_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, std::int64_t m,
                                                          std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].zgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    std::int64_t size = function_tables[libkey].zgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    if (tsqr::is_selected(m, n))
+        size = std::max(size,
+                        tsqr::geqrf_scratchpad_size<std::complex<double>>(libkey, queue, m, n, lda));
+    return size;
 }
 template <>
 std::int64_t gesvd_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
@@ -2146,6 +2249,29 @@ std::int64_t heevd_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
     return function_tables[libkey].zheevd_scratchpad_size_sycl(queue, jobz, uplo, n, lda);
 }
 template <>
+std::int64_t heevx_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, oneapi::mkl::compz jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, float vl, float vu,
+                                                        std::int64_t il, std::int64_t iu,
+                                                        float abstol, std::int64_t ldz) {
+    return function_tables[libkey].cheevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, vl,
+                                                               vu, il, iu, abstol, ldz);
+}
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
+                                                         sycl::queue &queue,
+                                                         oneapi::mkl::compz jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, double vl, double vu,
+                                                         std::int64_t il, std::int64_t iu,
+                                                         double abstol, std::int64_t ldz) {
+    return function_tables[libkey].zheevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, vl,
+                                                               vu, il, iu, abstol, ldz);
+}
+template <>
 std::int64_t hegvd_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, std::int64_t itype,
                                                         oneapi::mkl::job jobz,
@@ -2382,6 +2508,24 @@ std::int64_t syevd_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::que
     return function_tables[libkey].dsyevd_scratchpad_size_sycl(queue, jobz, uplo, n, lda);
 }
 template <>
+std::int64_t syevx_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                          oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                          oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                          float vl, float vu, std::int64_t il, std::int64_t iu,
+                                          float abstol, std::int64_t ldz) {
+    return function_tables[libkey].ssyevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, vl,
+                                                               vu, il, iu, abstol, ldz);
+}
+template <>
+std::int64_t syevx_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                           oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                                           oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                           double vl, double vu, std::int64_t il, std::int64_t iu,
+                                           double abstol, std::int64_t ldz) {
+    return function_tables[libkey].dsyevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, vl,
+                                                               vu, il, iu, abstol, ldz);
+}
+template <>
 std::int64_t sygvd_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
                                           std::int64_t itype, oneapi::mkl::job jobz,
                                           oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
@@ -2998,6 +3142,11 @@ std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(
                                                                      group_count, group_sizes);
 }
 
+void set_info_array(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *info,
+                    std::int64_t size) {
+    function_tables[libkey].set_info_array_sycl(queue, info, size);
+}
+
 } //namespace detail
 } //namespace lapack
 } //namespace mkl
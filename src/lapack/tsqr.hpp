@@ -0,0 +1,344 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_LAPACK_TSQR_HPP_
+#define _ONEMKL_LAPACK_TSQR_HPP_
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/lapack/exceptions.hpp"
+#include "oneapi/mkl/lapack/detail/lapack_loader.hpp"
+#include "env_helper.hpp"
+
+// Tall-skinny QR (TSQR) path for the USM geqrf entry points of the run-time dispatch API.
+//
+// The rows of A are split into p blocks. The first p - 1 blocks are copied to consecutive
+// matrices in the scratchpad, so they form an ordinary non-overlapping strided batch factored by
+// a single geqrf_batch call, and the last block is factored in place. The p stacked n x n R
+// factors are then factored with geqrf, which takes this path again while the stack is still
+// tall, forming the reduction tree. The explicit Q
+// of the tree is converted back to LAPACK Householder form with the Householder
+// reconstruction of Ballard et al.: Q - D = L U with D = -phase(pivot) chosen during the
+// elimination, V = L, tau(j) = -U(j, j) conj(D(j)) and R scaled to D R. The output is
+// therefore interchangeable with the backend geqrf output for ormqr/orgqr and friends.
+//
+// The path is taken for m >= min_rows(). The ONEMKL_LAPACK_TSQR_MIN_ROWS environment variable,
+// read on every call, sets min_rows() at run time; the LAPACK_TSQR_MIN_ROWS CMake cache variable
+// gives the value used when the variable is unset. Both default to 0, which turns the path off.
+// The variable must not change between the scratchpad query and the geqrf call.
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace detail {
+namespace tsqr {
+
+// Widest matrix handled; bounds the private row buffers of the reconstruction kernel.
+constexpr std::int64_t max_cols = 64;
+// Smallest number of rows taking the path, 0 when the path is off.
+inline std::int64_t min_rows() {
+    return env_size("ONEMKL_LAPACK_TSQR_MIN_ROWS", ONEMKL_LAPACK_TSQR_MIN_ROWS);
+}
+// Keeps the stack of R factors much shorter than A, which also bounds the depth of the tree.
+constexpr std::int64_t min_aspect_ratio = 16;
+// Leaf blocks have at least max(min_block_rows, block_rows_per_col * n) rows.
+constexpr std::int64_t min_block_rows = 256;
+constexpr std::int64_t block_rows_per_col = 8;
+constexpr std::int64_t max_blocks = 256;
+
+inline bool is_selected(std::int64_t m, std::int64_t n) {
+    if (n <= 0 || n > max_cols || m < min_aspect_ratio * n)
+        return false;
+    const std::int64_t rows = min_rows();
+    return rows > 0 && m >= rows;
+}
+
+template <typename T>
+struct is_complex : std::false_type {};
+template <typename T>
+struct is_complex<std::complex<T>> : std::true_type {};
+
+template <typename T>
+inline T conjugate(const T &x) {
+    if constexpr (is_complex<T>::value)
+        return std::conj(x);
+    else
+        return x;
+}
+
+// Sign of the diagonal correction: -phase(x), with -1 for a zero pivot.
+template <typename T>
+inline T diagonal_shift(const T &x) {
+    if constexpr (is_complex<T>::value) {
+        using real_t = typename T::value_type;
+        const real_t mag = std::abs(x);
+        return mag == real_t(0) ? T(-1) : -x / mag;
+    }
+    else {
+        return x < T(0) ? T(1) : T(-1);
+    }
+}
+
+// Scratchpad partitioning, in elements of T.
+struct layout {
+    std::int64_t p;  // number of leaf blocks
+    std::int64_t mb; // rows in each of the first p - 1 blocks
+    std::int64_t mt; // rows in the last block
+    std::int64_t ls; // rows (and leading dimension) of the stacked R factors, p * n
+
+    std::int64_t tau_blocks, leaves, stack, tau_top, r_top, lu, d;
+    std::int64_t work_blocks, work_tail, work_stack;
+    std::int64_t size_blocks, size_tail, size_stack;
+    std::int64_t total;
+};
+
+template <typename T>
+std::int64_t form_q_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                    std::int64_t m, std::int64_t n, std::int64_t lda) {
+    if constexpr (is_complex<T>::value)
+        return detail::ungqr_scratchpad_size<T>(libkey, queue, m, n, n, lda);
+    else
+        return detail::orgqr_scratchpad_size<T>(libkey, queue, m, n, n, lda);
+}
+
+template <typename T>
+std::int64_t form_q_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                          std::int64_t m, std::int64_t n, std::int64_t lda,
+                                          std::int64_t stride_a, std::int64_t batch_size) {
+    if constexpr (is_complex<T>::value)
+        return detail::ungqr_batch_scratchpad_size<T>(libkey, queue, m, n, n, lda, stride_a, n,
+                                                      batch_size);
+    else
+        return detail::orgqr_batch_scratchpad_size<T>(libkey, queue, m, n, n, lda, stride_a, n,
+                                                      batch_size);
+}
+
+template <typename T>
+sycl::event form_q(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   T *a, std::int64_t lda, T *tau, T *scratchpad, std::int64_t scratchpad_size,
+                   const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_complex<T>::value)
+        return detail::ungqr(libkey, queue, m, n, n, a, lda, tau, scratchpad, scratchpad_size,
+                             dependencies);
+    else
+        return detail::orgqr(libkey, queue, m, n, n, a, lda, tau, scratchpad, scratchpad_size,
+                             dependencies);
+}
+
+template <typename T>
+sycl::event form_q_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, T *a, std::int64_t lda, std::int64_t stride_a, T *tau,
+                         std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_complex<T>::value)
+        return detail::ungqr_batch(libkey, queue, m, n, n, a, lda, stride_a, tau, n, batch_size,
+                                   scratchpad, scratchpad_size, dependencies);
+    else
+        return detail::orgqr_batch(libkey, queue, m, n, n, a, lda, stride_a, tau, n, batch_size,
+                                   scratchpad, scratchpad_size, dependencies);
+}
+
+template <typename T>
+layout make_layout(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   std::int64_t lda) {
+    layout l;
+    const std::int64_t block_rows = std::max(min_block_rows, block_rows_per_col * n);
+    l.p = std::max<std::int64_t>(2, std::min(max_blocks, m / block_rows));
+    l.mb = m / l.p;
+    l.mt = m - (l.p - 1) * l.mb;
+    l.ls = l.p * n;
+
+    // The first p - 1 leaf blocks are copied to mb x n matrices stored one after the other.
+    l.size_blocks = std::max(
+        detail::geqrf_batch_scratchpad_size<T>(libkey, queue, l.mb, n, l.mb, l.mb * n, n, l.p - 1),
+        form_q_batch_scratchpad_size<T>(libkey, queue, l.mb, n, l.mb, l.mb * n, l.p - 1));
+    l.size_tail = std::max(detail::geqrf_scratchpad_size<T>(libkey, queue, l.mt, n, lda),
+                           form_q_scratchpad_size<T>(libkey, queue, l.mt, n, lda));
+    l.size_stack = std::max(detail::geqrf_scratchpad_size<T>(libkey, queue, l.ls, n, l.ls),
+                            form_q_scratchpad_size<T>(libkey, queue, l.ls, n, l.ls));
+
+    l.tau_blocks = 0;
+    l.leaves = l.tau_blocks + l.ls;
+    l.stack = l.leaves + (l.p - 1) * l.mb * n;
+    l.tau_top = l.stack + l.ls * n;
+    l.r_top = l.tau_top + n;
+    l.lu = l.r_top + n * n;
+    l.d = l.lu + n * n;
+    // The leaf, tail and stack factorizations may run concurrently, so each gets its own area.
+    l.work_blocks = l.d + n;
+    l.work_tail = l.work_blocks + l.size_blocks;
+    l.work_stack = l.work_tail + l.size_tail;
+    l.total = l.work_stack + l.size_stack;
+    return l;
+}
+
+template <typename T>
+std::int64_t geqrf_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                   std::int64_t m, std::int64_t n, std::int64_t lda) {
+    return make_layout<T>(libkey, queue, m, n, lda).total;
+}
+
+template <typename T>
+sycl::event geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  T *a, std::int64_t lda, T *tau, T *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    const layout l = make_layout<T>(libkey, queue, m, n, lda);
+    if (scratchpad_size < l.total) {
+        throw oneapi::mkl::lapack::invalid_argument(
+            "geqrf", "scratchpad_size is smaller than the value returned by geqrf_scratchpad_size",
+            -9);
+    }
+
+    const std::int64_t p = l.p, mb = l.mb, ls = l.ls;
+    T *tau_blocks = scratchpad + l.tau_blocks;
+    T *leaves = scratchpad + l.leaves;
+    T *stack = scratchpad + l.stack;
+    T *tau_top = scratchpad + l.tau_top;
+    T *r_top = scratchpad + l.r_top;
+    T *lu = scratchpad + l.lu;
+    T *d = scratchpad + l.d;
+    T *a_tail = a + (p - 1) * mb;
+
+    // Leaf factorizations.
+    auto copy_blocks = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.parallel_for(sycl::range<2>((p - 1) * mb, n), [=](sycl::item<2> it) {
+            const std::int64_t r = it.get_id(0), j = it.get_id(1);
+            const std::int64_t b = r / mb, i = r % mb;
+            leaves[b * mb * n + i + j * mb] = a[r + j * lda];
+        });
+    });
+    auto qr_blocks =
+        detail::geqrf_batch(libkey, queue, mb, n, leaves, mb, mb * n, tau_blocks, n, p - 1,
+                            scratchpad + l.work_blocks, l.size_blocks, { copy_blocks });
+    auto qr_tail = detail::geqrf(libkey, queue, l.mt, n, a_tail, lda, tau_blocks + (p - 1) * n,
+                                 scratchpad + l.work_tail, l.size_tail, dependencies);
+
+    // Stack the upper triangular leaf factors.
+    auto gather = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on({ qr_blocks, qr_tail });
+        cgh.parallel_for(sycl::range<2>(ls, n), [=](sycl::item<2> it) {
+            const std::int64_t r = it.get_id(0), j = it.get_id(1);
+            const std::int64_t b = r / n, i = r % n;
+            if (i > j)
+                stack[r + j * ls] = T(0);
+            else if (b < p - 1)
+                stack[r + j * ls] = leaves[b * mb * n + i + j * mb];
+            else
+                stack[r + j * ls] = a_tail[i + j * lda];
+        });
+    });
+
+    // Reduction: tall stacks come back through this path, which forms the tree.
+    auto qr_stack = detail::geqrf(libkey, queue, ls, n, stack, ls, tau_top,
+                                  scratchpad + l.work_stack, l.size_stack, { gather });
+    auto save_r = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(qr_stack);
+        cgh.parallel_for(sycl::range<2>(n, n), [=](sycl::item<2> it) {
+            const std::int64_t i = it.get_id(0), j = it.get_id(1);
+            r_top[i + j * n] = (i <= j) ? stack[i + j * ls] : T(0);
+        });
+    });
+
+    // Explicit Q of the tree and of every leaf.
+    auto q_stack = form_q(libkey, queue, ls, n, stack, ls, tau_top, scratchpad + l.work_stack,
+                          l.size_stack, { save_r });
+    auto q_blocks = form_q_batch(libkey, queue, mb, n, leaves, mb, mb * n, tau_blocks, p - 1,
+                                 scratchpad + l.work_blocks, l.size_blocks, { gather });
+    auto q_tail = form_q(libkey, queue, l.mt, n, a_tail, lda, tau_blocks + (p - 1) * n,
+                         scratchpad + l.work_tail, l.size_tail, { gather });
+
+    // Leading n x n block of Q, then its modified LU factorization Q1 - D = L U.
+    auto top_rows = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on({ q_stack, q_blocks });
+        cgh.parallel_for(sycl::range<2>(n, n), [=](sycl::item<2> it) {
+            const std::int64_t i = it.get_id(0), j = it.get_id(1);
+            T sum = T(0);
+            for (std::int64_t k = 0; k < n; k++)
+                sum += leaves[i + k * mb] * stack[k + j * ls];
+            lu[i + j * n] = sum;
+        });
+    });
+    auto modified_lu = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(top_rows);
+        cgh.single_task([=]() {
+            for (std::int64_t j = 0; j < n; j++) {
+                const T shift = diagonal_shift(lu[j + j * n]);
+                lu[j + j * n] -= shift;
+                d[j] = shift;
+                tau[j] = -lu[j + j * n] * conjugate(shift);
+                const T pivot = lu[j + j * n];
+                for (std::int64_t i = j + 1; i < n; i++)
+                    lu[i + j * n] /= pivot;
+                for (std::int64_t k = j + 1; k < n; k++) {
+                    const T u = lu[j + k * n];
+                    for (std::int64_t i = j + 1; i < n; i++)
+                        lu[i + k * n] -= lu[i + j * n] * u;
+                }
+            }
+        });
+    });
+
+    // Assemble the output: D R and V1 in the first n rows, V = Q U^-1 below them.
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on({ modified_lu, q_tail });
+        cgh.parallel_for(sycl::range<1>(m), [=](sycl::item<1> it) {
+            const std::int64_t i = it.get_id(0);
+            if (i < n) {
+                for (std::int64_t j = 0; j < n; j++)
+                    a[i + j * lda] = (j < i) ? lu[i + j * n] : d[i] * r_top[i + j * n];
+                return;
+            }
+            const std::int64_t b = sycl::min(i / mb, p - 1);
+            T q_leaf[max_cols];
+            T v[max_cols];
+            for (std::int64_t k = 0; k < n; k++)
+                q_leaf[k] = (b < p - 1) ? leaves[b * mb * n + i - b * mb + k * mb] : a[i + k * lda];
+            for (std::int64_t j = 0; j < n; j++) {
+                T q = T(0);
+                for (std::int64_t k = 0; k < n; k++)
+                    q += q_leaf[k] * stack[b * n + k + j * ls];
+                for (std::int64_t k = 0; k < j; k++)
+                    q -= v[k] * lu[k + j * n];
+                v[j] = q / lu[j + j * n];
+                a[i + j * lda] = v[j];
+            }
+        });
+    });
+}
+
+} // namespace tsqr
+} // namespace detail
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_LAPACK_TSQR_HPP_
@@ -303,6 +303,18 @@ public:
             "ICDF method not used for pseudorandom generators in cuRAND backend");
     }
 
+    virtual void generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32ka engine",
+                                         "gaussian_mv distribution unsupported by cuRAND backend");
+    }
+
+    virtual void generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32ka engine",
+                                         "gaussian_mv distribution unsupported by cuRAND backend");
+    }
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) override {
         queue_
@@ -522,6 +534,22 @@ public:
         return sycl::event{};
     }
 
+    virtual sycl::event generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32ka engine",
+                                         "gaussian_mv distribution unsupported by cuRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32ka engine",
+                                         "gaussian_mv distribution unsupported by cuRAND backend");
+        return sycl::event{};
+    }
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
@@ -676,6 +704,16 @@ public:
         throw oneapi::mkl::unimplemented("rng", "mrg32ka engine");
     }
 
+    virtual void generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32ka engine");
+    }
+
+    virtual void generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32ka engine");
+    }
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) override {
         throw oneapi::mkl::unimplemented("rng", "mrg32ka engine");
@@ -807,6 +845,20 @@ public:
         return sycl::event{};
     }
 
+    virtual sycl::event generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32ka engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32ka engine");
+        return sycl::event{};
+    }
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         throw oneapi::mkl::unimplemented("rng", "mrg32ka engine");
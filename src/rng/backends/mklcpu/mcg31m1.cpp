@@ -0,0 +1,643 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <iostream>
+#include <iterator>
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "mkl_vsl.h"
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/rng/detail/engine_impl.hpp"
+#include "oneapi/mkl/rng/detail/mklcpu/onemkl_rng_mklcpu.hpp"
+
+#include "cpu_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace mklcpu {
+
+// Period of MCG31m1: the multiplier is a primitive root modulo 2^31 - 1
+constexpr std::uint64_t mcg31m1_period = 0x7FFFFFFE;
+
+class mcg31m1_impl : public oneapi::mkl::rng::detail::engine_impl {
+public:
+    mcg31m1_impl(sycl::queue queue, std::uint32_t seed)
+            : oneapi::mkl::rng::detail::engine_impl(queue) {
+        vslNewStream(&stream_, VSL_BRNG_MCG31, seed);
+        state_size_ = vslGetStreamSize(stream_);
+    }
+
+    mcg31m1_impl(const mcg31m1_impl* other) : oneapi::mkl::rng::detail::engine_impl(*other) {
+        vslCopyStream(&stream_, other->stream_);
+        state_size_ = vslGetStreamSize(stream_);
+    }
+
+    // Buffers APIs
+
+    virtual void generate(const uniform<float, uniform_method::standard>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD,
+                             static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                             get_raw_ptr(acc_r), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const uniform<double, uniform_method::standard>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD,
+                             static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                             get_raw_ptr(acc_r), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const uniform<std::int32_t, uniform_method::standard>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                viRngUniform(VSL_RNG_METHOD_UNIFORM_STD,
+                             static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                             get_raw_ptr(acc_r), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const uniform<float, uniform_method::accurate>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD_ACCURATE,
+                             static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                             get_raw_ptr(acc_r), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const uniform<double, uniform_method::accurate>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD_ACCURATE,
+                             static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                             get_raw_ptr(acc_r), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const gaussian<float, gaussian_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGaussian(VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2,
+                              static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                              get_raw_ptr(acc_r), distr.mean(), distr.stddev());
+            });
+        });
+    }
+
+    virtual void generate(const gaussian<double, gaussian_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2,
+                              static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                              get_raw_ptr(acc_r), distr.mean(), distr.stddev());
+            });
+        });
+    }
+
+    virtual void generate(const gaussian<float, gaussian_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF,
+                              static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                              get_raw_ptr(acc_r), distr.mean(), distr.stddev());
+            });
+        });
+    }
+
+    virtual void generate(const gaussian<double, gaussian_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF,
+                              static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                              get_raw_ptr(acc_r), distr.mean(), distr.stddev());
+            });
+        });
+    }
+
+    virtual void generate(const lognormal<float, lognormal_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngLognormal(VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2,
+                               static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                               get_raw_ptr(acc_r), distr.m(), distr.s(), distr.displ(),
+                               distr.scale());
+            });
+        });
+    }
+
+    virtual void generate(const lognormal<double, lognormal_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngLognormal(VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2,
+                               static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                               get_raw_ptr(acc_r), distr.m(), distr.s(), distr.displ(),
+                               distr.scale());
+            });
+        });
+    }
+
+    virtual void generate(const lognormal<float, lognormal_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngLognormal(VSL_RNG_METHOD_LOGNORMAL_ICDF,
+                               static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                               get_raw_ptr(acc_r), distr.m(), distr.s(), distr.displ(),
+                               distr.scale());
+            });
+        });
+    }
+
+    virtual void generate(const lognormal<double, lognormal_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngLognormal(VSL_RNG_METHOD_LOGNORMAL_ICDF,
+                               static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                               get_raw_ptr(acc_r), distr.m(), distr.s(), distr.displ(),
+                               distr.scale());
+            });
+        });
+    }
+
+    virtual void generate(const bernoulli<std::int32_t, bernoulli_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                viRngBernoulli(VSL_RNG_METHOD_BERNOULLI_ICDF,
+                               static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                               get_raw_ptr(acc_r), distr.p());
+            });
+        });
+    }
+
+    virtual void generate(const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                std::uint32_t* r_ptr = get_raw_ptr(acc_r);
+                viRngBernoulli(VSL_RNG_METHOD_BERNOULLI_ICDF,
+                               static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                               reinterpret_cast<std::int32_t*>(r_ptr), distr.p());
+            });
+        });
+    }
+
+    virtual void generate(const poisson<std::int32_t, poisson_method::gaussian_icdf_based>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                viRngPoisson(VSL_RNG_METHOD_POISSON_POISNORM,
+                             static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                             get_raw_ptr(acc_r), distr.lambda());
+            });
+        });
+    }
+
+    virtual void generate(const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                std::uint32_t* r_ptr = get_raw_ptr(acc_r);
+                viRngPoisson(VSL_RNG_METHOD_POISSON_POISNORM,
+                             static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                             reinterpret_cast<std::int32_t*>(r_ptr), distr.lambda());
+            });
+        });
+    }
+
+    virtual void generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2,
+                                static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                                get_raw_ptr(acc_r), distr.dimen(), VSL_MATRIX_STORAGE_PACKED,
+                                distr.mean().data(), distr.matrix().data());
+            });
+        });
+    }
+
+    virtual void generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2,
+                                static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                                get_raw_ptr(acc_r), distr.dimen(), VSL_MATRIX_STORAGE_PACKED,
+                                distr.mean().data(), distr.matrix().data());
+            });
+        });
+    }
+
+    virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
+                          sycl::buffer<std::uint32_t, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                viRngUniformBits(VSL_RNG_METHOD_UNIFORMBITS_STD,
+                                 static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                                 get_raw_ptr(acc_r));
+            });
+        });
+    }
+
+    // USM APIs
+
+    virtual sycl::event generate(const uniform<float, uniform_method::standard>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const uniform<double, uniform_method::standard>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const uniform<std::int32_t, uniform_method::standard>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                viRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const uniform<float, uniform_method::accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD_ACCURATE, stream, n, r, distr.a(),
+                             distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const uniform<double, uniform_method::accurate>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD_ACCURATE, stream, n, r, distr.a(),
+                             distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gaussian<float, gaussian_method::box_muller2>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGaussian(VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2, stream, n, r, distr.mean(),
+                              distr.stddev());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gaussian<double, gaussian_method::box_muller2>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2, stream, n, r, distr.mean(),
+                              distr.stddev());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gaussian<float, gaussian_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n, r, distr.mean(),
+                              distr.stddev());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gaussian<double, gaussian_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n, r, distr.mean(),
+                              distr.stddev());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const lognormal<float, lognormal_method::box_muller2>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngLognormal(VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2, stream, n, r, distr.m(),
+                               distr.s(), distr.displ(), distr.scale());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const lognormal<double, lognormal_method::box_muller2>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngLognormal(VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2, stream, n, r, distr.m(),
+                               distr.s(), distr.displ(), distr.scale());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const lognormal<float, lognormal_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngLognormal(VSL_RNG_METHOD_LOGNORMAL_ICDF, stream, n, r, distr.m(), distr.s(),
+                               distr.displ(), distr.scale());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const lognormal<double, lognormal_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngLognormal(VSL_RNG_METHOD_LOGNORMAL_ICDF, stream, n, r, distr.m(), distr.s(),
+                               distr.displ(), distr.scale());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const bernoulli<std::int32_t, bernoulli_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                viRngBernoulli(VSL_RNG_METHOD_BERNOULLI_ICDF, stream, n, r, distr.p());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                viRngBernoulli(VSL_RNG_METHOD_BERNOULLI_ICDF, stream, n,
+                               reinterpret_cast<int32_t*>(r), distr.p());
+            });
+        });
+    }
+
+    virtual sycl::event generate(
+        const poisson<std::int32_t, poisson_method::gaussian_icdf_based>& distr, std::int64_t n,
+        std::int32_t* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                viRngPoisson(VSL_RNG_METHOD_POISSON_POISNORM, stream, n, r, distr.lambda());
+            });
+        });
+    }
+
+    virtual sycl::event generate(
+        const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr, std::int64_t n,
+        std::uint32_t* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                viRngPoisson(VSL_RNG_METHOD_POISSON_POISNORM, stream, n,
+                             reinterpret_cast<int32_t*>(r), distr.lambda());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2, stream, n, r, distr.dimen(),
+                                VSL_MATRIX_STORAGE_PACKED, distr.mean().data(),
+                                distr.matrix().data());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2, stream, n, r, distr.dimen(),
+                                VSL_MATRIX_STORAGE_PACKED, distr.mean().data(),
+                                distr.matrix().data());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mcg31m1_impl, decltype(distr)>>(
+                cgh, [=]() { viRngUniformBits(VSL_RNG_METHOD_UNIFORMBITS_STD, stream, n, r); });
+        });
+    }
+
+    virtual oneapi::mkl::rng::detail::engine_impl* copy_state() override {
+        return new mcg31m1_impl(this);
+    }
+
+    virtual void skip_ahead(std::uint64_t num_to_skip) override {
+        vslSkipAheadStream(stream_, num_to_skip);
+    }
+
+    // The sequence repeats after mcg31m1_period elements, so the multi-word count is reduced
+    // modulo the period and skipped in one step
+    virtual void skip_ahead(std::initializer_list<std::uint64_t> num_to_skip) override {
+        // 2^64 modulo the period
+        const std::uint64_t word_mod = (UINT64_MAX % mcg31m1_period + 1) % mcg31m1_period;
+        std::uint64_t num = 0;
+        for (auto it = std::rbegin(num_to_skip); it != std::rend(num_to_skip); ++it) {
+            num = (num * word_mod + *it % mcg31m1_period) % mcg31m1_period;
+        }
+        vslSkipAheadStream(stream_, num);
+    }
+
+    virtual void leapfrog(std::uint64_t idx, std::uint64_t stride) override {
+        vslLeapfrogStream(stream_, idx, stride);
+    }
+
+    virtual ~mcg31m1_impl() override {
+        vslDeleteStream(&stream_);
+    }
+
+private:
+    VSLStreamStatePtr stream_;
+    std::int32_t state_size_;
+};
+
+oneapi::mkl::rng::detail::engine_impl* create_mcg31m1(sycl::queue queue, std::uint32_t seed) {
+    return new mcg31m1_impl(queue, seed);
+}
+
+} // namespace mklcpu
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
@@ -303,6 +303,36 @@ public:
         });
     }
 
+    virtual void generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2,
+                                static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                                get_raw_ptr(acc_r), distr.dimen(), VSL_MATRIX_STORAGE_PACKED,
+                                distr.mean().data(), distr.matrix().data());
+            });
+        });
+    }
+
+    virtual void generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2,
+                                static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                                get_raw_ptr(acc_r), distr.dimen(), VSL_MATRIX_STORAGE_PACKED,
+                                distr.mean().data(), distr.matrix().data());
+            });
+        });
+    }
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) override {
         sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
@@ -535,6 +565,34 @@ public:
         });
     }
 
+    virtual sycl::event generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2, stream, n, r, distr.dimen(),
+                                VSL_MATRIX_STORAGE_PACKED, distr.mean().data(),
+                                distr.matrix().data());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2, stream, n, r, distr.dimen(),
+                                VSL_MATRIX_STORAGE_PACKED, distr.mean().data(),
+                                distr.matrix().data());
+            });
+        });
+    }
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
@@ -0,0 +1,346 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <array>
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/rng/detail/engine_impl.hpp"
+#include "oneapi/mkl/rng/detail/portable/onemkl_rng_portable.hpp"
+
+#include "portable_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace portable {
+
+class mcg31m1_impl : public oneapi::mkl::rng::detail::engine_impl {
+    using device_engine = oneapi::mkl::rng::device::mcg31m1<1>;
+
+public:
+    mcg31m1_impl(sycl::queue queue, std::uint32_t seed)
+            : oneapi::mkl::rng::detail::engine_impl(queue),
+              seed_{ seed },
+              offset_{ 0, 0, 0 } {}
+
+    mcg31m1_impl(const mcg31m1_impl* other)
+            : oneapi::mkl::rng::detail::engine_impl(*other),
+              seed_(other->seed_),
+              offset_(other->offset_) {}
+
+    // Buffers API
+
+    virtual void generate(const uniform<float, uniform_method::standard>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const uniform<double, uniform_method::standard>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const uniform<std::int32_t, uniform_method::standard>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const uniform<float, uniform_method::accurate>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const uniform<double, uniform_method::accurate>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const gaussian<float, gaussian_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const gaussian<double, gaussian_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const gaussian<float, gaussian_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const gaussian<double, gaussian_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const lognormal<float, lognormal_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const lognormal<double, lognormal_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const lognormal<float, lognormal_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const lognormal<double, lognormal_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const bernoulli<std::int32_t, bernoulli_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const poisson<std::int32_t, poisson_method::gaussian_icdf_based>&,
+                          std::int64_t, sycl::buffer<std::int32_t, 1>&) override {
+        throw oneapi::mkl::unimplemented("rng", "mcg31m1 engine",
+                                         "poisson unsupported by portable backend");
+    }
+
+    virtual void generate(const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>&,
+                          std::int64_t, sycl::buffer<std::uint32_t, 1>&) override {
+        throw oneapi::mkl::unimplemented("rng", "mcg31m1 engine",
+                                         "poisson unsupported by portable backend");
+    }
+
+    virtual void generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
+                          sycl::buffer<std::uint32_t, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    // USM APIs
+
+    virtual sycl::event generate(const uniform<float, uniform_method::standard>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const uniform<double, uniform_method::standard>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const uniform<std::int32_t, uniform_method::standard>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const uniform<float, uniform_method::accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const uniform<double, uniform_method::accurate>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const gaussian<float, gaussian_method::box_muller2>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const gaussian<double, gaussian_method::box_muller2>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const gaussian<float, gaussian_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const gaussian<double, gaussian_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const lognormal<float, lognormal_method::box_muller2>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const lognormal<double, lognormal_method::box_muller2>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const lognormal<float, lognormal_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const lognormal<double, lognormal_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const bernoulli<std::int32_t, bernoulli_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(
+        const poisson<std::int32_t, poisson_method::gaussian_icdf_based>&, std::int64_t,
+        std::int32_t*, const std::vector<sycl::event>&) override {
+        throw oneapi::mkl::unimplemented("rng", "mcg31m1 engine",
+                                         "poisson unsupported by portable backend");
+    }
+
+    virtual sycl::event generate(
+        const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>&, std::int64_t,
+        std::uint32_t*, const std::vector<sycl::event>&) override {
+        throw oneapi::mkl::unimplemented("rng", "mcg31m1 engine",
+                                         "poisson unsupported by portable backend");
+    }
+
+    virtual sycl::event generate(const gaussian_mv<float, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const gaussian_mv<double, gaussian_mv_method::box_muller2>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual oneapi::mkl::rng::detail::engine_impl* copy_state() override {
+        return new mcg31m1_impl(this);
+    }
+
+    virtual void skip_ahead(std::uint64_t num_to_skip) override {
+        add_offset(offset_, num_to_skip);
+    }
+
+    virtual void skip_ahead(std::initializer_list<std::uint64_t> num_to_skip) override {
+        add_offset(offset_, num_to_skip);
+    }
+
+    virtual void leapfrog(std::uint64_t, std::uint64_t) override {
+        throw oneapi::mkl::unimplemented("rng", "leapfrog");
+    }
+
+    virtual ~mcg31m1_impl() override {}
+
+private:
+    // The offset is advanced when the kernel is submitted, so later calls see the right position
+    // even before this one has run
+    template <typename Distr>
+    void generate_impl(const Distr& distr, std::int64_t n,
+                       sycl::buffer<typename Distr::result_type, 1>& r) {
+        portable::generate<device_engine>(queue_, seed_, offset_, to_device(distr), n, r);
+        add_offset(offset_, engine_outputs(distr, n));
+    }
+
+    template <typename Distr>
+    sycl::event generate_impl(const Distr& distr, std::int64_t n, typename Distr::result_type* r,
+                              const std::vector<sycl::event>& dependencies) {
+        auto event = portable::generate<device_engine>(queue_, seed_, offset_, to_device(distr), n,
+                                                       r, dependencies);
+        add_offset(offset_, engine_outputs(distr, n));
+        return event;
+    }
+
+    // gaussian_mv does not map to a device distribution on the host, its kernel builds one from
+    // copies of the mean and the factor
+    template <typename RealType>
+    void generate_impl(const gaussian_mv<RealType, gaussian_mv_method::box_muller2>& distr,
+                       std::int64_t n, sycl::buffer<RealType, 1>& r) {
+        portable::generate<device_engine>(queue_, seed_, offset_, distr, n, r);
+        add_offset(offset_, engine_outputs(distr, n));
+    }
+
+    template <typename RealType>
+    sycl::event generate_impl(const gaussian_mv<RealType, gaussian_mv_method::box_muller2>& distr,
+                              std::int64_t n, RealType* r,
+                              const std::vector<sycl::event>& dependencies) {
+        auto event =
+            portable::generate<device_engine>(queue_, seed_, offset_, distr, n, r, dependencies);
+        add_offset(offset_, engine_outputs(distr, n));
+        return event;
+    }
+
+    std::array<std::uint32_t, 1> seed_;
+    offset_type offset_;
+};
+
+oneapi::mkl::rng::detail::engine_impl* create_mcg31m1(sycl::queue queue, std::uint32_t seed) {
+    return new mcg31m1_impl(queue, seed);
+}
+
+} // namespace portable
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,427 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _RNG_PORTABLE_COMMON_HPP_
+#define _RNG_PORTABLE_COMMON_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/rng/device.hpp"
+#include "oneapi/mkl/rng/distributions.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace portable {
+
+// The host engines are kept as a seed and the number of engine outputs consumed so far. Every
+// generate call launches a kernel in which each work-item constructs the matching device engine
+// skipped ahead to the first output it owns, so the result does not depend on how the range is
+// split and the host state only has to advance the offset.
+
+// Number of engine outputs consumed so far, least significant word first. Three words cover
+// the skip_ahead initializer lists accepted by all engines.
+using offset_type = std::array<std::uint64_t, 3>;
+
+// Values produced by one work-item. It is even so that Box-Muller pairs never straddle two
+// work-items, and large enough to amortize the skip_ahead done when each engine is created.
+constexpr std::int64_t block_size = 256;
+
+template <typename Engine, typename Distr>
+class kernel_name {};
+
+template <typename Engine, typename Distr>
+class kernel_name_usm {};
+
+static inline void add_offset(offset_type& offset, std::uint64_t num) {
+    offset[0] += num;
+    if (offset[0] < num && ++offset[1] == 0) {
+        ++offset[2];
+    }
+}
+
+static inline void add_offset(offset_type& offset, std::initializer_list<std::uint64_t> num) {
+    if (num.size() > offset.size()) {
+        throw oneapi::mkl::invalid_argument("rng", "skip_ahead",
+                                            "more than 3 elements in num_to_skip");
+    }
+    std::uint64_t carry = 0;
+    std::size_t i = 0;
+    for (std::uint64_t word : num) {
+        std::uint64_t sum = offset[i] + word;
+        std::uint64_t next_carry = sum < word;
+        offset[i] = sum + carry;
+        carry = next_carry | (offset[i] < carry);
+        ++i;
+    }
+    for (; carry && i < offset.size(); ++i) {
+        carry = (++offset[i] == 0);
+    }
+}
+
+// Host distributions mapped to the device distributions that produce the same sequence
+
+template <typename Type, typename Method>
+auto to_device(const uniform<Type, Method>& distr) {
+    using device_method =
+        typename std::conditional<std::is_same<Method, uniform_method::accurate>::value,
+                                  oneapi::mkl::rng::device::uniform_method::accurate,
+                                  oneapi::mkl::rng::device::uniform_method::standard>::type;
+    return oneapi::mkl::rng::device::uniform<Type, device_method>(distr.a(), distr.b());
+}
+
+template <typename RealType>
+auto to_device(const gaussian<RealType, gaussian_method::box_muller2>& distr) {
+    return oneapi::mkl::rng::device::gaussian<
+        RealType, oneapi::mkl::rng::device::gaussian_method::box_muller2>(distr.mean(),
+                                                                           distr.stddev());
+}
+
+template <typename RealType>
+auto to_device(const lognormal<RealType, lognormal_method::box_muller2>& distr) {
+    return oneapi::mkl::rng::device::lognormal<
+        RealType, oneapi::mkl::rng::device::lognormal_method::box_muller2>(
+        distr.m(), distr.s(), distr.displ(), distr.scale());
+}
+
+template <typename IntType>
+auto to_device(const bernoulli<IntType, bernoulli_method::icdf>& distr) {
+    return oneapi::mkl::rng::device::bernoulli<IntType,
+                                               oneapi::mkl::rng::device::bernoulli_method::icdf>(
+        distr.p());
+}
+
+static inline auto to_device(const bits<std::uint32_t>&) {
+    return oneapi::mkl::rng::device::bits<std::uint32_t>();
+}
+
+// The inversion methods, which the device API only offers with the binary code of Intel oneMKL.
+// As there, each value takes one engine output as a uniform value u of (-1, 1), and the Gaussian
+// value is mean + stddev * sqrt(2) * erfinv(u).
+
+template <typename RealType>
+struct gaussian_icdf {
+    RealType mean;
+    RealType stddev;
+};
+
+template <typename RealType>
+struct lognormal_icdf {
+    gaussian_icdf<RealType> gaussian;
+    RealType displ;
+    RealType scale;
+};
+
+template <typename RealType>
+gaussian_icdf<RealType> to_device(const gaussian<RealType, gaussian_method::icdf>& distr) {
+    return { distr.mean(), distr.stddev() };
+}
+
+template <typename RealType>
+lognormal_icdf<RealType> to_device(const lognormal<RealType, lognormal_method::icdf>& distr) {
+    return { { distr.m(), distr.s() }, distr.displ(), distr.scale() };
+}
+
+// Polynomial with coefficients c, highest degree first, at x
+template <typename RealType, std::size_t N>
+inline RealType horner(RealType x, const RealType (&c)[N]) {
+    RealType res = c[0];
+    for (std::size_t i = 1; i < N; ++i) {
+        res = res * x + c[i];
+    }
+    return res;
+}
+
+// sqrt(2) * erfinv(u) for u in [-1, 1], the standard normal quantile of (1 + u) / 2, by algorithm
+// AS 241 of Wichura (1988), accurate to about 1e-16. The tails are evaluated from (1 - |u|) / 2,
+// which is exact there, so values close to -1 and 1 keep their digits.
+template <typename RealType>
+inline RealType normal_icdf(RealType u) {
+    const RealType q = u / RealType(2);
+    if (sycl::fabs(q) <= RealType(0.425)) {
+        const RealType num[] = { RealType(2509.0809287301226727), RealType(33430.575583588128105),
+                                 RealType(67265.770927008700853), RealType(45921.953931549871457),
+                                 RealType(13731.693765509461125), RealType(1971.5909503065514427),
+                                 RealType(133.14166789178437745), RealType(3.387132872796366608) };
+        const RealType den[] = { RealType(5226.495278852545925),  RealType(28729.085735721942674),
+                                 RealType(39307.89580009271061),  RealType(21213.794301586595867),
+                                 RealType(5394.1960214247511077), RealType(687.1870074920579083),
+                                 RealType(42.313330701600911252), RealType(1) };
+        const RealType r = RealType(0.180625) - q * q;
+        return q * horner(r, num) / horner(r, den);
+    }
+    const RealType tail = (RealType(1) - sycl::fabs(u)) / RealType(2);
+    if (tail == RealType(0)) {
+        return u < RealType(0) ? -std::numeric_limits<RealType>::infinity()
+                               : std::numeric_limits<RealType>::infinity();
+    }
+    RealType r = sycl::sqrt(-sycl::log(tail));
+    RealType res;
+    if (r <= RealType(5)) {
+        const RealType num[] = {
+            RealType(7.7454501427834140764e-4), RealType(0.0227238449892691845833),
+            RealType(0.24178072517745061177),   RealType(1.27045825245236838258),
+            RealType(3.64784832476320460504),   RealType(5.7694972214606914055),
+            RealType(4.6303378461565452959),    RealType(1.42343711074968357734)
+        };
+        const RealType den[] = {
+            RealType(1.05075007164441684324e-9), RealType(5.475938084995344946e-4),
+            RealType(0.0151986665636164571966),  RealType(0.14810397642748007459),
+            RealType(0.68976733498510000455),    RealType(1.6763848301838038494),
+            RealType(2.05319162663775882187),    RealType(1)
+        };
+        r -= RealType(1.6);
+        res = horner(r, num) / horner(r, den);
+    }
+    else {
+        const RealType num[] = {
+            RealType(2.01033439929228813265e-7), RealType(2.71155556874348757815e-5),
+            RealType(0.0012426609473880784386),  RealType(0.026532189526576123093),
+            RealType(0.29656057182850489123),    RealType(1.7848265399172913358),
+            RealType(5.4637849111641143699),     RealType(6.6579046435011037772)
+        };
+        const RealType den[] = {
+            RealType(2.04426310338993978564e-15), RealType(1.4215117583164458887e-7),
+            RealType(1.8463183175100546818e-5),   RealType(7.868691311456132591e-4),
+            RealType(0.0148753612908506148525),   RealType(0.13692988092273580531),
+            RealType(0.59983220655588793769),     RealType(1)
+        };
+        r -= RealType(5);
+        res = horner(r, num) / horner(r, den);
+    }
+    return u < RealType(0) ? -res : res;
+}
+
+// One value of distr
+template <typename DeviceDistr, typename Engine>
+inline auto generate_value(DeviceDistr& distr, Engine& engine) {
+    return oneapi::mkl::rng::device::generate(distr, engine);
+}
+
+template <typename RealType, typename Engine>
+inline RealType generate_value(gaussian_icdf<RealType>& distr, Engine& engine) {
+    oneapi::mkl::rng::device::uniform<RealType> uniform(RealType(-1), RealType(1));
+    RealType u = oneapi::mkl::rng::device::generate(uniform, engine);
+    return sycl::fma(normal_icdf(u), distr.stddev, distr.mean);
+}
+
+template <typename RealType, typename Engine>
+inline RealType generate_value(lognormal_icdf<RealType>& distr, Engine& engine) {
+    return sycl::exp(generate_value(distr.gaussian, engine)) * distr.scale + distr.displ;
+}
+
+// Engine outputs consumed to produce n values. Box-Muller always uses a full pair of uniform
+// numbers, so an odd count discards the second value of the last pair.
+template <typename Distr>
+std::uint64_t engine_outputs(const Distr&, std::int64_t n) {
+    using method_type = typename Distr::method_type;
+    if constexpr (std::is_same<method_type, gaussian_method::box_muller2>::value ||
+                  std::is_same<method_type, lognormal_method::box_muller2>::value) {
+        return static_cast<std::uint64_t>(n + (n & 1));
+    }
+    else {
+        return static_cast<std::uint64_t>(n);
+    }
+}
+
+static inline std::uint64_t engine_outputs(const bits<std::uint32_t>&, std::int64_t n) {
+    return static_cast<std::uint64_t>(n);
+}
+
+// Each vector takes the uniform pairs of dimen Box-Muller values
+template <typename RealType>
+std::uint64_t engine_outputs(const gaussian_mv<RealType, gaussian_mv_method::box_muller2>& distr,
+                             std::int64_t n) {
+    std::uint64_t dimen = distr.dimen();
+    return static_cast<std::uint64_t>(n) * (dimen + (dimen & 1));
+}
+
+// The sequence of mcg31m1 repeats after 2^31 - 2 outputs, so the offset is reduced modulo the
+// period to the single word taken by the device engine
+static inline std::uint64_t mcg31m1_offset(const offset_type& offset) {
+    constexpr std::uint64_t period = 0x7FFFFFFE;
+    // 2^64 modulo the period
+    constexpr std::uint64_t word_mod = (UINT64_MAX % period + 1) % period;
+    std::uint64_t num = 0;
+    for (auto it = offset.rbegin(); it != offset.rend(); ++it) {
+        num = (num * word_mod + *it % period) % period;
+    }
+    return num;
+}
+
+// The device mcg engines take the offset as a single word. For mcg59 it is the low one: the
+// period divides 2^64, so the higher words do not change the state.
+template <typename Engine, typename Seed, std::size_t... I>
+inline Engine make_engine(const Seed& seed, offset_type offset, std::uint64_t begin,
+                          std::index_sequence<I...>) {
+    add_offset(offset, begin);
+    if constexpr (std::is_same<Engine, oneapi::mkl::rng::device::mcg31m1<1>>::value) {
+        return Engine({ seed[I]... }, mcg31m1_offset(offset));
+    }
+    else if constexpr (std::is_same<Engine, oneapi::mkl::rng::device::mcg59<1>>::value) {
+        return Engine({ seed[I]... }, offset[0]);
+    }
+    else {
+        return Engine({ seed[I]... }, { offset[0], offset[1], offset[2] });
+    }
+}
+
+// Fills r[begin, end) from the engine positioned at offset + begin
+template <typename Engine, typename Seed, typename DeviceDistr, typename Out>
+inline void generate_block(const Seed& seed, const offset_type& offset, DeviceDistr distr,
+                           std::int64_t begin, std::int64_t end, Out r) {
+    auto engine = make_engine<Engine>(seed, offset, static_cast<std::uint64_t>(begin),
+                                      std::make_index_sequence<std::tuple_size<Seed>::value>{});
+    for (std::int64_t i = begin; i < end; ++i) {
+        r[i] = generate_value(distr, engine);
+    }
+}
+
+static inline sycl::range<1> work_range(std::int64_t n) {
+    return sycl::range<1>(static_cast<std::size_t>((n + block_size - 1) / block_size));
+}
+
+template <typename Engine, typename Seed, typename DeviceDistr, typename T>
+void generate(sycl::queue& queue, const Seed& seed, const offset_type& offset,
+              const DeviceDistr& distr, std::int64_t n, sycl::buffer<T, 1>& r) {
+    queue.submit([&](sycl::handler& cgh) {
+        auto acc = r.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.parallel_for<kernel_name<Engine, DeviceDistr>>(
+            work_range(n), [=](sycl::item<1> item) {
+                std::int64_t begin = static_cast<std::int64_t>(item.get_id(0)) * block_size;
+                std::int64_t end = sycl::min(begin + block_size, n);
+                generate_block<Engine>(seed, offset, distr, begin, end, acc);
+            });
+    });
+}
+
+template <typename Engine, typename Seed, typename DeviceDistr, typename T>
+sycl::event generate(sycl::queue& queue, const Seed& seed, const offset_type& offset,
+                     const DeviceDistr& distr, std::int64_t n, T* r,
+                     const std::vector<sycl::event>& dependencies) {
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        cgh.parallel_for<kernel_name_usm<Engine, DeviceDistr>>(
+            work_range(n), [=](sycl::item<1> item) {
+                std::int64_t begin = static_cast<std::int64_t>(item.get_id(0)) * block_size;
+                std::int64_t end = sycl::min(begin + block_size, n);
+                generate_block<Engine>(seed, offset, distr, begin, end, r);
+            });
+    });
+}
+
+// gaussian_mv: the work-items produce whole vectors, each one generated by the device
+// distribution with the correlation applied as the normal values are drawn. The mean and the
+// factor are copied to buffers built from iterators, whose destruction does not wait for the
+// kernel.
+
+template <typename T, sycl::access_mode AccMode>
+auto get_raw_ptr(sycl::accessor<T, 1, AccMode> acc) {
+    return acc.template get_multi_ptr<sycl::access::decorated::no>().get_raw();
+}
+
+// Vectors produced by one work-item
+static inline std::int64_t mv_block_size(std::uint32_t dimen) {
+    return std::max<std::int64_t>(1, block_size / dimen);
+}
+
+// Fills vectors [begin, end) of r from the engine positioned at the first output of vector begin
+template <typename Engine, typename Seed, typename RealType>
+inline void generate_mv_block(const Seed& seed, const offset_type& offset, std::uint32_t dimen,
+                              const RealType* mean, const RealType* matrix, std::int64_t begin,
+                              std::int64_t end, RealType* r) {
+    std::uint64_t stride = dimen + (dimen & 1);
+    auto engine = make_engine<Engine>(seed, offset, static_cast<std::uint64_t>(begin) * stride,
+                                      std::make_index_sequence<std::tuple_size<Seed>::value>{});
+    oneapi::mkl::rng::device::gaussian_mv<
+        RealType, oneapi::mkl::rng::device::gaussian_mv_method::box_muller2>
+        distr(dimen, sycl::span<const RealType>(mean, dimen),
+              sycl::span<const RealType>(matrix, std::size_t{ dimen } * (dimen + 1) / 2));
+    for (std::int64_t i = begin; i < end; ++i) {
+        oneapi::mkl::rng::device::generate(distr, engine,
+                                           sycl::span<RealType>(r + i * dimen, dimen));
+    }
+}
+
+template <typename Engine, typename Seed, typename RealType>
+void generate(sycl::queue& queue, const Seed& seed, const offset_type& offset,
+              const gaussian_mv<RealType, gaussian_mv_method::box_muller2>& distr,
+              std::int64_t n, sycl::buffer<RealType, 1>& r) {
+    using Distr = gaussian_mv<RealType, gaussian_mv_method::box_muller2>;
+    sycl::buffer<RealType, 1> mean_buf(distr.mean().begin(), distr.mean().end());
+    sycl::buffer<RealType, 1> matrix_buf(distr.matrix().begin(), distr.matrix().end());
+    std::uint32_t dimen = distr.dimen();
+    std::int64_t mv_block = mv_block_size(dimen);
+    queue.submit([&](sycl::handler& cgh) {
+        auto mean_acc = mean_buf.template get_access<sycl::access::mode::read>(cgh);
+        auto matrix_acc = matrix_buf.template get_access<sycl::access::mode::read>(cgh);
+        auto acc = r.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.parallel_for<kernel_name<Engine, Distr>>(
+            sycl::range<1>(static_cast<std::size_t>((n + mv_block - 1) / mv_block)),
+            [=](sycl::item<1> item) {
+                std::int64_t begin = static_cast<std::int64_t>(item.get_id(0)) * mv_block;
+                std::int64_t end = sycl::min(begin + mv_block, n);
+                generate_mv_block<Engine>(seed, offset, dimen, get_raw_ptr(mean_acc),
+                                          get_raw_ptr(matrix_acc), begin, end, get_raw_ptr(acc));
+            });
+    });
+}
+
+template <typename Engine, typename Seed, typename RealType>
+sycl::event generate(sycl::queue& queue, const Seed& seed, const offset_type& offset,
+                     const gaussian_mv<RealType, gaussian_mv_method::box_muller2>& distr,
+                     std::int64_t n, RealType* r, const std::vector<sycl::event>& dependencies) {
+    using Distr = gaussian_mv<RealType, gaussian_mv_method::box_muller2>;
+    sycl::buffer<RealType, 1> mean_buf(distr.mean().begin(), distr.mean().end());
+    sycl::buffer<RealType, 1> matrix_buf(distr.matrix().begin(), distr.matrix().end());
+    std::uint32_t dimen = distr.dimen();
+    std::int64_t mv_block = mv_block_size(dimen);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto mean_acc = mean_buf.template get_access<sycl::access::mode::read>(cgh);
+        auto matrix_acc = matrix_buf.template get_access<sycl::access::mode::read>(cgh);
+        cgh.parallel_for<kernel_name_usm<Engine, Distr>>(
+            sycl::range<1>(static_cast<std::size_t>((n + mv_block - 1) / mv_block)),
+            [=](sycl::item<1> item) {
+                std::int64_t begin = static_cast<std::int64_t>(item.get_id(0)) * mv_block;
+                std::int64_t end = sycl::min(begin + mv_block, n);
+                generate_mv_block<Engine>(seed, offset, dimen, get_raw_ptr(mean_acc),
+                                          get_raw_ptr(matrix_acc), begin, end, r);
+            });
+    });
+}
+
+} // namespace portable
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_RNG_PORTABLE_COMMON_HPP_
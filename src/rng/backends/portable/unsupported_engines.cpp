@@ -0,0 +1,38 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "oneapi/mkl/rng/detail/portable/onemkl_rng_portable.hpp"
+
+#include "rng/backends/unsupported_engines.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace portable {
+
+// Engines of the host API that are only implemented by the mklcpu backend, the portable backend
+// provides mcg31m1 and mcg59 from the device engines
+
+ONEMKL_RNG_UNSUPPORTED_MT19937("portable")
+ONEMKL_RNG_UNSUPPORTED_SOBOL("portable")
+
+} // namespace portable
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
@@ -66,5 +66,8 @@
 extern "C" ONEMKL_EXPORT rng_function_table_t mkl_rng_table = {
     WRAPPER_VERSION, oneapi::mkl::rng::rocrand::create_philox4x32x10,
     oneapi::mkl::rng::rocrand::create_philox4x32x10, oneapi::mkl::rng::rocrand::create_mrg32k3a,
-    oneapi::mkl::rng::rocrand::create_mrg32k3a
+    oneapi::mkl::rng::rocrand::create_mrg32k3a, oneapi::mkl::rng::rocrand::create_mcg31m1,
+    oneapi::mkl::rng::rocrand::create_mcg59, oneapi::mkl::rng::rocrand::create_mt19937,
+    oneapi::mkl::rng::rocrand::create_mt19937, oneapi::mkl::rng::rocrand::create_sobol,
+    oneapi::mkl::rng::rocrand::create_sobol
 };
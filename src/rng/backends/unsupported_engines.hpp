@@ -0,0 +1,78 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _RNG_UNSUPPORTED_ENGINES_HPP_
+#define _RNG_UNSUPPORTED_ENGINES_HPP_
+
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/rng/detail/engine_impl.hpp"
+
+// Definitions of the create functions of the host API engines that a backend does not implement.
+// Each macro is expanded in the namespace of the backend, with its display name as a string
+// literal, and defines functions that throw oneapi::mkl::unimplemented.
+
+#define ONEMKL_RNG_UNSUPPORTED_ENGINE_MESSAGE(BACKEND) \
+    "engine is not supported by the " BACKEND " backend"
+
+#define ONEMKL_RNG_UNSUPPORTED_MCG31M1(BACKEND)                                           \
+    oneapi::mkl::rng::detail::engine_impl* create_mcg31m1(sycl::queue, std::uint32_t) {   \
+        throw oneapi::mkl::unimplemented("rng", "mcg31m1 engine",                         \
+                                         ONEMKL_RNG_UNSUPPORTED_ENGINE_MESSAGE(BACKEND)); \
+    }
+
+#define ONEMKL_RNG_UNSUPPORTED_MCG59(BACKEND)                                             \
+    oneapi::mkl::rng::detail::engine_impl* create_mcg59(sycl::queue, std::uint64_t) {     \
+        throw oneapi::mkl::unimplemented("rng", "mcg59 engine",                           \
+                                         ONEMKL_RNG_UNSUPPORTED_ENGINE_MESSAGE(BACKEND)); \
+    }
+
+#define ONEMKL_RNG_UNSUPPORTED_MT19937(BACKEND)                                           \
+    oneapi::mkl::rng::detail::engine_impl* create_mt19937(sycl::queue, std::uint32_t) {   \
+        throw oneapi::mkl::unimplemented("rng", "mt19937 engine",                         \
+                                         ONEMKL_RNG_UNSUPPORTED_ENGINE_MESSAGE(BACKEND)); \
+    }                                                                                     \
+                                                                                          \
+    oneapi::mkl::rng::detail::engine_impl* create_mt19937(                                \
+        sycl::queue, std::initializer_list<std::uint32_t>) {                              \
+        throw oneapi::mkl::unimplemented("rng", "mt19937 engine",                         \
+                                         ONEMKL_RNG_UNSUPPORTED_ENGINE_MESSAGE(BACKEND)); \
+    }
+
+#define ONEMKL_RNG_UNSUPPORTED_SOBOL(BACKEND)                                             \
+    oneapi::mkl::rng::detail::engine_impl* create_sobol(sycl::queue, std::uint32_t) {     \
+        throw oneapi::mkl::unimplemented("rng", "sobol engine",                           \
+                                         ONEMKL_RNG_UNSUPPORTED_ENGINE_MESSAGE(BACKEND)); \
+    }                                                                                     \
+                                                                                          \
+    oneapi::mkl::rng::detail::engine_impl* create_sobol(sycl::queue,                      \
+                                                        std::vector<std::uint32_t>&) {    \
+        throw oneapi::mkl::unimplemented("rng", "sobol engine",                           \
+                                         ONEMKL_RNG_UNSUPPORTED_ENGINE_MESSAGE(BACKEND)); \
+    }
+
+#endif //_RNG_UNSUPPORTED_ENGINES_HPP_
@@ -21,6 +21,7 @@
 #define _RNG_FUNCTION_TABLE_HPP_
 
 #include <cstdint>
+#include <vector>
 #if __has_include(<sycl/sycl.hpp>)
 #include <sycl/sycl.hpp>
 #else
@@ -41,6 +42,22 @@ typedef struct {
                                                                    std::uint32_t seed);
     oneapi::mkl::rng::detail::engine_impl* (*create_mrg32k3a_ex_sycl)(
         sycl::queue queue, std::initializer_list<std::uint32_t> seed);
+
+    oneapi::mkl::rng::detail::engine_impl* (*create_mcg31m1_sycl)(sycl::queue queue,
+                                                                  std::uint32_t seed);
+
+    oneapi::mkl::rng::detail::engine_impl* (*create_mcg59_sycl)(sycl::queue queue,
+                                                                std::uint64_t seed);
+
+    oneapi::mkl::rng::detail::engine_impl* (*create_mt19937_sycl)(sycl::queue queue,
+                                                                  std::uint32_t seed);
+    oneapi::mkl::rng::detail::engine_impl* (*create_mt19937_ex_sycl)(
+        sycl::queue queue, std::initializer_list<std::uint32_t> seed);
+
+    oneapi::mkl::rng::detail::engine_impl* (*create_sobol_sycl)(sycl::queue queue,
+                                                                std::uint32_t dimensions);
+    oneapi::mkl::rng::detail::engine_impl* (*create_sobol_ex_sycl)(
+        sycl::queue queue, std::vector<std::uint32_t>& direction_numbers);
 } rng_function_table_t;
 
 #endif //_RNG_FUNCTION_TABLE_HPP_
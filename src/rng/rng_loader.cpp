@@ -48,6 +48,32 @@ engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, sycl::queue queue,
     return function_tables[libkey].create_mrg32k3a_ex_sycl(queue, seed);
 }
 
+engine_impl* create_mcg31m1(oneapi::mkl::device libkey, sycl::queue queue, std::uint32_t seed) {
+    return function_tables[libkey].create_mcg31m1_sycl(queue, seed);
+}
+
+engine_impl* create_mcg59(oneapi::mkl::device libkey, sycl::queue queue, std::uint64_t seed) {
+    return function_tables[libkey].create_mcg59_sycl(queue, seed);
+}
+
+engine_impl* create_mt19937(oneapi::mkl::device libkey, sycl::queue queue, std::uint32_t seed) {
+    return function_tables[libkey].create_mt19937_sycl(queue, seed);
+}
+
+engine_impl* create_mt19937(oneapi::mkl::device libkey, sycl::queue queue,
+                            std::initializer_list<std::uint32_t> seed) {
+    return function_tables[libkey].create_mt19937_ex_sycl(queue, seed);
+}
+
+engine_impl* create_sobol(oneapi::mkl::device libkey, sycl::queue queue, std::uint32_t dimensions) {
+    return function_tables[libkey].create_sobol_sycl(queue, dimensions);
+}
+
+engine_impl* create_sobol(oneapi::mkl::device libkey, sycl::queue queue,
+                          std::vector<std::uint32_t>& direction_numbers) {
+    return function_tables[libkey].create_sobol_ex_sycl(queue, direction_numbers);
+}
+
 } // namespace detail
 } // namespace rng
 } // namespace mkl
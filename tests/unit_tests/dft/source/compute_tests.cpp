@@ -17,7 +17,12 @@
 *
 **************************************************************************/
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #if __has_include(<sycl/sycl.hpp>)
@@ -35,6 +40,10 @@
 #include "compute_out_of_place.hpp"
 #include "compute_out_of_place_real_real.hpp"
 
+#ifdef ENABLE_PORTABLE_BACKEND
+#include "oneapi/mkl/dft/detail/portable/onemkl_dft_portable.hpp"
+#endif
+
 extern std::vector<sycl::device *> devices;
 
 namespace {
@@ -98,6 +107,1074 @@ class ComputeTests_real_real_out_of_place_REAL
 INSTANTIATE_TEST_DIMENSIONS_PRECISION_DOMAIN_PLACE_LAYOUT(buffer)
 INSTANTIATE_TEST_DIMENSIONS_PRECISION_DOMAIN_PLACE_LAYOUT(USM)
 
+// HALF and BFLOAT16 transforms read and write 16-bit data, so they are checked against a reference
+// computed from the rounded input, within the error of rounding the output. With portable set, the
+// descriptor is committed to the portable backend, which run-time dispatch only selects on CPU
+// devices when the Intel oneMKL CPU backend is not built.
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain,
+          typename StorageT>
+int test_16bit_forward(sycl::device* dev, bool portable) {
+    sycl::queue sycl_queue(*dev, exception_handler);
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    constexpr bool is_real = domain == oneapi::mkl::dft::domain::REAL;
+    using complex_t = oneapi::mkl::dft::detail::complex_pair<StorageT>;
+    using fwd_t = std::conditional_t<is_real, StorageT, complex_t>;
+    using bwd_t = complex_t;
+    const std::int64_t length = 64;
+    const std::int64_t bwd_length = is_real ? length / 2 + 1 : length;
+
+    oneapi::mkl::dft::descriptor<precision, domain> descriptor{ length };
+    descriptor.set_value(oneapi::mkl::dft::config_param::PLACEMENT,
+                         oneapi::mkl::dft::config_value::NOT_INPLACE);
+    if (portable) {
+#if !defined(CALL_RT_API) && defined(ENABLE_PORTABLE_BACKEND)
+        descriptor.commit(
+            oneapi::mkl::backend_selector<oneapi::mkl::backend::portable>{ sycl_queue });
+#else
+        std::cout << "The portable backend is only selected by compile-time dispatch." << std::endl;
+        return test_skipped;
+#endif
+    }
+    else {
+        commit_descriptor(descriptor, sycl_queue);
+    }
+
+    std::vector<std::complex<float>> input;
+    rand_vector(input, cast_unsigned(length));
+    auto in = sycl::malloc_shared<fwd_t>(cast_unsigned(length), sycl_queue);
+    auto out = sycl::malloc_shared<bwd_t>(cast_unsigned(bwd_length), sycl_queue);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        const auto re = static_cast<StorageT>(input[i].real());
+        const auto im = static_cast<StorageT>(is_real ? 0.0f : input[i].imag());
+        if constexpr (is_real) {
+            in[i] = re;
+        }
+        else {
+            in[i] = fwd_t{ re, im };
+        }
+        input[i] = { static_cast<float>(re), static_cast<float>(im) };
+    }
+
+    oneapi::mkl::dft::compute_forward<decltype(descriptor), fwd_t, bwd_t>(
+        descriptor, in, out, std::vector<sycl::event>{})
+        .wait_and_throw();
+
+    std::vector<std::complex<double>> reference(cast_unsigned(length));
+    reference_forward_dft<std::complex<float>, std::complex<double>>({ length }, input.data(),
+                                                                     reference.data());
+    double max_norm_ref = 0;
+    for (const auto& value : reference) {
+        max_norm_ref = std::max(max_norm_ref, std::abs(value));
+    }
+    const double epsilon = precision == oneapi::mkl::dft::precision::HALF ? 1.0 / 1024 : 1.0 / 128;
+    for (std::int64_t k = 0; k < bwd_length; ++k) {
+        const std::complex<double> result{ static_cast<float>(out[k].real()),
+                                           static_cast<float>(out[k].imag()) };
+        EXPECT_LE(std::abs(result - reference[cast_unsigned(k)]), 4 * epsilon * max_norm_ref)
+            << "at index " << k;
+    }
+    sycl::free(in, sycl_queue);
+    sycl::free(out, sycl_queue);
+    return !::testing::Test::HasFailure();
+}
+
+class ComputeTests_16bit : public ::testing::TestWithParam<sycl::device*> {};
+
+#define INSTANTIATE_16BIT_TEST(PRECISION, DOMAIN, STORAGE_T, NAME, PORTABLE)                    \
+    TEST_P(ComputeTests_16bit, DOMAIN##_##PRECISION##_##NAME##out_of_place_USM) {               \
+        try {                                                                                   \
+            EXPECT_TRUEORSKIP((test_16bit_forward<oneapi::mkl::dft::precision::PRECISION,       \
+                                                  oneapi::mkl::dft::domain::DOMAIN, STORAGE_T>( \
+                GetParam(), PORTABLE)));                                                        \
+        }                                                                                       \
+        catch (oneapi::mkl::unimplemented & e) {                                                \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;          \
+            GTEST_SKIP();                                                                       \
+        }                                                                                       \
+        catch (oneapi::mkl::unsupported_device & e) {                                           \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;          \
+            GTEST_SKIP();                                                                       \
+        }                                                                                       \
+    }
+
+INSTANTIATE_16BIT_TEST(HALF, COMPLEX, sycl::half, , false)
+INSTANTIATE_16BIT_TEST(HALF, REAL, sycl::half, , false)
+INSTANTIATE_16BIT_TEST(BFLOAT16, COMPLEX, oneapi::mkl::bfloat16, , false)
+INSTANTIATE_16BIT_TEST(BFLOAT16, REAL, oneapi::mkl::bfloat16, , false)
+INSTANTIATE_16BIT_TEST(HALF, COMPLEX, sycl::half, portable_, true)
+INSTANTIATE_16BIT_TEST(HALF, REAL, sycl::half, portable_, true)
+INSTANTIATE_16BIT_TEST(BFLOAT16, COMPLEX, oneapi::mkl::bfloat16, portable_, true)
+INSTANTIATE_16BIT_TEST(BFLOAT16, REAL, oneapi::mkl::bfloat16, portable_, true)
+
+// dft::convolve and dft::correlate of a signal several blocks long, checked against the direct
+// sums.
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+int test_convolution(sycl::device* dev, bool correlate) {
+    sycl::queue sycl_queue(*dev, exception_handler);
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::DOUBLE, double,
+                                      float>;
+    using data_t = std::conditional_t<domain == oneapi::mkl::dft::domain::REAL, real_t,
+                                      std::complex<real_t>>;
+    const std::int64_t length = 32, signal_length = 200, kernel_length = 9;
+    const std::int64_t out_length = signal_length + kernel_length - 1;
+
+    oneapi::mkl::dft::descriptor<precision, domain> descriptor{ length };
+    commit_descriptor(descriptor, sycl_queue);
+
+    std::vector<data_t> signal, kernel;
+    rand_vector(signal, cast_unsigned(signal_length));
+    rand_vector(kernel, cast_unsigned(kernel_length));
+    auto signal_usm = sycl::malloc_shared<data_t>(cast_unsigned(signal_length), sycl_queue);
+    auto kernel_usm = sycl::malloc_shared<data_t>(cast_unsigned(kernel_length), sycl_queue);
+    auto out = sycl::malloc_shared<data_t>(cast_unsigned(out_length), sycl_queue);
+    std::copy(signal.begin(), signal.end(), signal_usm);
+    std::copy(kernel.begin(), kernel.end(), kernel_usm);
+
+    auto done = correlate ? oneapi::mkl::dft::correlate(descriptor, signal_usm, signal_length,
+                                                        kernel_usm, kernel_length, out)
+                          : oneapi::mkl::dft::convolve(descriptor, signal_usm, signal_length,
+                                                       kernel_usm, kernel_length, out);
+    done.wait_and_throw();
+
+    for (std::int64_t k = 0; k < out_length; ++k) {
+        std::complex<double> expected = 0;
+        for (std::int64_t j = 0; j < kernel_length; ++j) {
+            const std::int64_t i = correlate ? k + j - (kernel_length - 1) : k - j;
+            if (i >= 0 && i < signal_length) {
+                const std::complex<double> h = kernel[cast_unsigned(j)];
+                expected += (correlate ? std::conj(h) : h) *
+                            std::complex<double>(signal[cast_unsigned(i)]);
+            }
+        }
+        EXPECT_LE(std::abs(std::complex<double>(out[k]) - expected),
+                  1e3 * std::numeric_limits<real_t>::epsilon())
+            << "at index " << k;
+    }
+    sycl::free(signal_usm, sycl_queue);
+    sycl::free(kernel_usm, sycl_queue);
+    sycl::free(out, sycl_queue);
+    return !::testing::Test::HasFailure();
+}
+
+class ComputeTests_convolution : public ::testing::TestWithParam<sycl::device*> {};
+
+#define INSTANTIATE_CONVOLUTION_TEST(PRECISION, DOMAIN, KIND, CORRELATE)                 \
+    TEST_P(ComputeTests_convolution, DOMAIN##_##PRECISION##_##KIND##_USM) {              \
+        try {                                                                            \
+            EXPECT_TRUEORSKIP((test_convolution<oneapi::mkl::dft::precision::PRECISION,  \
+                                                oneapi::mkl::dft::domain::DOMAIN>(       \
+                GetParam(), CORRELATE)));                                                \
+        }                                                                                \
+        catch (oneapi::mkl::unimplemented & e) {                                         \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;   \
+            GTEST_SKIP();                                                                \
+        }                                                                                \
+    }
+
+INSTANTIATE_CONVOLUTION_TEST(SINGLE, REAL, convolve, false)
+INSTANTIATE_CONVOLUTION_TEST(SINGLE, COMPLEX, correlate, true)
+INSTANTIATE_CONVOLUTION_TEST(DOUBLE, REAL, correlate, true)
+INSTANTIATE_CONVOLUTION_TEST(DOUBLE, COMPLEX, convolve, false)
+
+// dft::convolve reads and writes contiguous sequences, so descriptors with several transforms or
+// other strides must be rejected rather than have their layout ignored.
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+int test_convolution_layout(sycl::device* dev) {
+    sycl::queue sycl_queue(*dev, exception_handler);
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::DOUBLE, double,
+                                      float>;
+    using data_t = std::conditional_t<domain == oneapi::mkl::dft::domain::REAL, real_t,
+                                      std::complex<real_t>>;
+    const std::int64_t length = 32, signal_length = 64, kernel_length = 9;
+    const std::int64_t out_length = signal_length + kernel_length - 1;
+    auto signal = sycl::malloc_shared<data_t>(cast_unsigned(2 * signal_length), sycl_queue);
+    auto kernel = sycl::malloc_shared<data_t>(cast_unsigned(2 * kernel_length), sycl_queue);
+    auto out = sycl::malloc_shared<data_t>(cast_unsigned(2 * out_length), sycl_queue);
+    std::fill(signal, signal + 2 * signal_length, data_t{ 1 });
+    std::fill(kernel, kernel + 2 * kernel_length, data_t{ 1 });
+
+    oneapi::mkl::dft::descriptor<precision, domain> batched{ length };
+    batched.set_value(oneapi::mkl::dft::config_param::NUMBER_OF_TRANSFORMS, std::int64_t{ 2 });
+    batched.set_value(oneapi::mkl::dft::config_param::FWD_DISTANCE, length);
+    batched.set_value(oneapi::mkl::dft::config_param::BWD_DISTANCE,
+                      domain == oneapi::mkl::dft::domain::REAL ? length / 2 + 1 : length);
+    batched.set_value(oneapi::mkl::dft::config_param::PLACEMENT,
+                      oneapi::mkl::dft::config_value::NOT_INPLACE);
+    commit_descriptor(batched, sycl_queue);
+    EXPECT_THROW(oneapi::mkl::dft::convolve(batched, signal, signal_length, kernel, kernel_length,
+                                            out),
+                 oneapi::mkl::invalid_argument);
+
+    oneapi::mkl::dft::descriptor<precision, domain> strided{ length };
+    std::vector<std::int64_t> strides{ 0, 2 };
+    strided.set_value(oneapi::mkl::dft::config_param::INPUT_STRIDES, strides.data());
+    strided.set_value(oneapi::mkl::dft::config_param::OUTPUT_STRIDES, strides.data());
+    strided.set_value(oneapi::mkl::dft::config_param::PLACEMENT,
+                      oneapi::mkl::dft::config_value::NOT_INPLACE);
+    commit_descriptor(strided, sycl_queue);
+    EXPECT_THROW(oneapi::mkl::dft::correlate(strided, signal, signal_length, kernel,
+                                             kernel_length, out),
+                 oneapi::mkl::invalid_argument);
+
+    sycl::free(signal, sycl_queue);
+    sycl::free(kernel, sycl_queue);
+    sycl::free(out, sycl_queue);
+    return !::testing::Test::HasFailure();
+}
+
+#define INSTANTIATE_CONVOLUTION_LAYOUT_TEST(PRECISION, DOMAIN)                                 \
+    TEST_P(ComputeTests_convolution, DOMAIN##_##PRECISION##_batched_or_strided_USM) {          \
+        try {                                                                                  \
+            EXPECT_TRUEORSKIP((test_convolution_layout<oneapi::mkl::dft::precision::PRECISION, \
+                                                       oneapi::mkl::dft::domain::DOMAIN>(      \
+                GetParam())));                                                                 \
+        }                                                                                      \
+        catch (oneapi::mkl::unimplemented & e) {                                               \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;         \
+            GTEST_SKIP();                                                                      \
+        }                                                                                      \
+    }
+
+INSTANTIATE_CONVOLUTION_LAYOUT_TEST(SINGLE, REAL)
+INSTANTIATE_CONVOLUTION_LAYOUT_TEST(SINGLE, COMPLEX)
+
+// dft::stft of overlapping Hann-windowed frames, checked against the direct sums, and dft::istft,
+// which must return the signal wherever the windows overlap.
+template <oneapi::mkl::dft::precision precision>
+int test_stft(sycl::device* dev) {
+    sycl::queue sycl_queue(*dev, exception_handler);
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::DOUBLE, double,
+                                      float>;
+    using complex_t = std::complex<real_t>;
+    const std::int64_t length = 64, hop = 16, signal_length = 500;
+    const std::int64_t frames = (signal_length - length) / hop + 1;
+    const std::int64_t spectrum_size = length / 2 + 1;
+    const std::int64_t out_length = (frames - 1) * hop + length;
+
+    oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::REAL> descriptor{ length };
+    descriptor.set_value(oneapi::mkl::dft::config_param::BACKWARD_SCALE,
+                         real_t(1) / static_cast<real_t>(length));
+    commit_descriptor(descriptor, sycl_queue);
+
+    std::vector<real_t> signal;
+    rand_vector(signal, cast_unsigned(signal_length));
+    auto signal_usm = sycl::malloc_shared<real_t>(cast_unsigned(signal_length), sycl_queue);
+    auto window = sycl::malloc_shared<real_t>(cast_unsigned(length), sycl_queue);
+    auto spectra =
+        sycl::malloc_shared<complex_t>(cast_unsigned(frames * spectrum_size), sycl_queue);
+    auto out = sycl::malloc_shared<real_t>(cast_unsigned(out_length), sycl_queue);
+    std::copy(signal.begin(), signal.end(), signal_usm);
+    const double pi = std::acos(-1.0);
+    for (std::int64_t j = 0; j < length; ++j) {
+        window[j] = static_cast<real_t>(0.5 - 0.5 * std::cos(2 * pi * j / length));
+    }
+
+    oneapi::mkl::dft::stft(descriptor, signal_usm, signal_length, window, hop, spectra)
+        .wait_and_throw();
+    for (std::int64_t f = 0; f < frames; ++f) {
+        for (std::int64_t k = 0; k < spectrum_size; ++k) {
+            std::complex<double> expected = 0;
+            for (std::int64_t j = 0; j < length; ++j) {
+                expected += static_cast<double>(signal[cast_unsigned(f * hop + j)] * window[j]) *
+                            std::polar(1.0, -2 * pi * static_cast<double>(j * k) / length);
+            }
+            EXPECT_LE(std::abs(std::complex<double>(spectra[f * spectrum_size + k]) - expected),
+                      1e3 * std::numeric_limits<real_t>::epsilon())
+                << "at frame " << f << ", index " << k;
+        }
+    }
+
+    oneapi::mkl::dft::istft(descriptor, spectra, frames, window, hop, out).wait_and_throw();
+    // The first sample is only under the zero of a window. Away from the tapered ends, where the
+    // division by small sums of squared windows loses precision, the sums are 3 / 2.
+    EXPECT_EQ(out[0], real_t(0));
+    for (std::int64_t i = hop; i < out_length - hop; ++i) {
+        EXPECT_LE(std::abs(out[i] - signal[cast_unsigned(i)]),
+                  1e3 * std::numeric_limits<real_t>::epsilon())
+            << "at index " << i;
+    }
+    sycl::free(signal_usm, sycl_queue);
+    sycl::free(window, sycl_queue);
+    sycl::free(spectra, sycl_queue);
+    sycl::free(out, sycl_queue);
+    return !::testing::Test::HasFailure();
+}
+
+class ComputeTests_stft : public ::testing::TestWithParam<sycl::device*> {};
+
+#define INSTANTIATE_STFT_TEST(PRECISION)                                                        \
+    TEST_P(ComputeTests_stft, REAL_##PRECISION##_USM) {                                         \
+        try {                                                                                   \
+            EXPECT_TRUEORSKIP((test_stft<oneapi::mkl::dft::precision::PRECISION>(GetParam()))); \
+        }                                                                                       \
+        catch (oneapi::mkl::unimplemented & e) {                                                \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;          \
+            GTEST_SKIP();                                                                       \
+        }                                                                                       \
+    }
+
+INSTANTIATE_STFT_TEST(SINGLE)
+INSTANTIATE_STFT_TEST(DOUBLE)
+
+// A transform whose working set is bounded below the size of its data is streamed with the
+// four-step algorithm, and must match the same transform without a bound.
+template <oneapi::mkl::dft::precision precision>
+int test_streamed(sycl::device* dev, bool in_place) {
+    sycl::queue sycl_queue(*dev, exception_handler);
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::DOUBLE, double,
+                                      float>;
+    using data_t = std::complex<real_t>;
+    const std::int64_t length = 4096;
+    const std::int64_t working_set = length * static_cast<std::int64_t>(sizeof(data_t)) / 2;
+
+    std::vector<data_t> input;
+    rand_vector(input, cast_unsigned(length));
+    std::vector<data_t> results[2];
+    for (std::int64_t bound : { std::int64_t{ 0 }, working_set }) {
+        oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::COMPLEX> descriptor{
+            length
+        };
+        descriptor.set_value(oneapi::mkl::dft::config_param::PLACEMENT,
+                             in_place ? oneapi::mkl::dft::config_value::INPLACE
+                                      : oneapi::mkl::dft::config_value::NOT_INPLACE);
+        descriptor.set_value(oneapi::mkl::dft::config_param::MAX_WORKING_SET_BYTES, bound);
+        commit_descriptor(descriptor, sycl_queue);
+
+        auto in = sycl::malloc_shared<data_t>(cast_unsigned(length), sycl_queue);
+        auto out = in_place ? in : sycl::malloc_shared<data_t>(cast_unsigned(length), sycl_queue);
+        std::copy(input.begin(), input.end(), in);
+        auto done = in_place ? oneapi::mkl::dft::compute_forward<decltype(descriptor), data_t>(
+                                   descriptor, in, std::vector<sycl::event>{})
+                             : oneapi::mkl::dft::compute_forward<decltype(descriptor), data_t,
+                                                                 data_t>(
+                                   descriptor, in, out, std::vector<sycl::event>{});
+        done.wait_and_throw();
+        results[bound == 0 ? 0 : 1].assign(out, out + length);
+        if (!in_place) {
+            sycl::free(out, sycl_queue);
+        }
+        sycl::free(in, sycl_queue);
+    }
+
+    // The two results differ by the rounding of different factorizations.
+    EXPECT_TRUE(check_equal_vector(results[1].data(), results[0].data(), cast_unsigned(length),
+                                   length, length, std::cout));
+    return !::testing::Test::HasFailure();
+}
+
+class ComputeTests_streamed : public ::testing::TestWithParam<sycl::device*> {};
+
+#define INSTANTIATE_STREAMED_TEST(PRECISION, PLACE, IN_PLACE)                                   \
+    TEST_P(ComputeTests_streamed, COMPLEX_##PRECISION##_##PLACE##_USM) {                        \
+        try {                                                                                   \
+            EXPECT_TRUEORSKIP(                                                                  \
+                (test_streamed<oneapi::mkl::dft::precision::PRECISION>(GetParam(), IN_PLACE))); \
+        }                                                                                       \
+        catch (oneapi::mkl::unimplemented & e) {                                                \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;          \
+            GTEST_SKIP();                                                                       \
+        }                                                                                       \
+    }
+
+INSTANTIATE_STREAMED_TEST(SINGLE, out_of_place, false)
+INSTANTIATE_STREAMED_TEST(SINGLE, in_place, true)
+INSTANTIATE_STREAMED_TEST(DOUBLE, out_of_place, false)
+INSTANTIATE_STREAMED_TEST(DOUBLE, in_place, true)
+
+// A forward transform with a transposed result or BACKWARD_SCRAMBLED ordering followed by the
+// backward transform of the same descriptor must return the input. The layout of such a result is
+// backend-specific, so this runs on the portable backend, whose transposed result is the transpose
+// of the usual one and whose scrambled result is in the natural order.
+template <oneapi::mkl::dft::precision precision>
+int test_reordered_round_trip(sycl::device* dev, bool transpose) {
+#if defined(CALL_RT_API) || !defined(ENABLE_PORTABLE_BACKEND)
+    static_cast<void>(dev);
+    static_cast<void>(transpose);
+    std::cout << "The portable backend is only selected by compile-time dispatch." << std::endl;
+    return test_skipped;
+#else
+    sycl::queue sycl_queue(*dev, exception_handler);
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::DOUBLE, double,
+                                      float>;
+    using data_t = std::complex<real_t>;
+    using descriptor_t = oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::COMPLEX>;
+    // Square, so that the strides of the transposed result are the default ones.
+    const std::int64_t side = 8, size = side * side;
+
+    std::vector<data_t> input;
+    rand_vector(input, cast_unsigned(size));
+    auto in = sycl::malloc_shared<data_t>(cast_unsigned(size), sycl_queue);
+    auto mid = sycl::malloc_shared<data_t>(cast_unsigned(size), sycl_queue);
+    auto out = sycl::malloc_shared<data_t>(cast_unsigned(size), sycl_queue);
+    std::copy(input.begin(), input.end(), in);
+
+    descriptor_t descriptor{ { side, side } };
+    descriptor.set_value(oneapi::mkl::dft::config_param::PLACEMENT,
+                         oneapi::mkl::dft::config_value::NOT_INPLACE);
+    descriptor.set_value(oneapi::mkl::dft::config_param::BACKWARD_SCALE,
+                         real_t{ 1 } / static_cast<real_t>(size));
+    descriptor.set_value(oneapi::mkl::dft::config_param::TRANSPOSE, transpose);
+    if (!transpose) {
+        descriptor.set_value(oneapi::mkl::dft::config_param::ORDERING,
+                             oneapi::mkl::dft::config_value::BACKWARD_SCRAMBLED);
+    }
+    descriptor.commit(oneapi::mkl::backend_selector<oneapi::mkl::backend::portable>{ sycl_queue });
+    oneapi::mkl::dft::compute_forward<descriptor_t, data_t, data_t>(descriptor, in, mid)
+        .wait_and_throw();
+
+    if (transpose) {
+        std::vector<std::complex<double>> reference(cast_unsigned(size));
+        reference_forward_dft<data_t, std::complex<double>>({ side, side }, input.data(),
+                                                            reference.data());
+        std::vector<std::complex<double>> transposed(cast_unsigned(size));
+        for (std::int64_t i = 0; i < side; ++i) {
+            for (std::int64_t j = 0; j < side; ++j) {
+                transposed[cast_unsigned(j * side + i)] = reference[cast_unsigned(i * side + j)];
+            }
+        }
+        std::vector<data_t> result(mid, mid + size);
+        EXPECT_TRUE(check_equal_vector(result.data(), transposed.data(), cast_unsigned(size),
+                                       size, size, std::cout));
+    }
+
+    oneapi::mkl::dft::compute_backward<descriptor_t, data_t, data_t>(descriptor, mid, out)
+        .wait_and_throw();
+    EXPECT_TRUE(check_equal_vector(out, input.data(), cast_unsigned(size), size, size, std::cout));
+
+    sycl::free(in, sycl_queue);
+    sycl::free(mid, sycl_queue);
+    sycl::free(out, sycl_queue);
+    return !::testing::Test::HasFailure();
+#endif
+}
+
+class ComputeTests_reordered : public ::testing::TestWithParam<sycl::device*> {};
+
+#define INSTANTIATE_REORDERED_TEST(PRECISION, KIND, TRANSPOSE)                                  \
+    TEST_P(ComputeTests_reordered, COMPLEX_##PRECISION##_##KIND##_USM) {                        \
+        try {                                                                                   \
+            EXPECT_TRUEORSKIP(                                                                  \
+                (test_reordered_round_trip<oneapi::mkl::dft::precision::PRECISION>(             \
+                    GetParam(), TRANSPOSE)));                                                   \
+        }                                                                                       \
+        catch (oneapi::mkl::unimplemented & e) {                                                \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;          \
+            GTEST_SKIP();                                                                       \
+        }                                                                                       \
+    }
+
+INSTANTIATE_REORDERED_TEST(SINGLE, scrambled, false)
+INSTANTIATE_REORDERED_TEST(SINGLE, transposed, true)
+INSTANTIATE_REORDERED_TEST(DOUBLE, scrambled, false)
+INSTANTIATE_REORDERED_TEST(DOUBLE, transposed, true)
+
+// An in-place one-dimensional complex transform with BACKWARD_SCRAMBLED ordering on the backend
+// selected for the device, whose forward result may be in any order, must return the input after
+// the backward transform. MKLCPU leaves the result scrambled.
+template <oneapi::mkl::dft::precision precision>
+int test_scrambled_round_trip_1d(sycl::device* dev) {
+    sycl::queue sycl_queue(*dev, exception_handler);
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::DOUBLE, double,
+                                      float>;
+    using data_t = std::complex<real_t>;
+    using descriptor_t = oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::COMPLEX>;
+    const std::int64_t size = 64;
+
+    std::vector<data_t> input;
+    rand_vector(input, cast_unsigned(size));
+    auto inout = sycl::malloc_shared<data_t>(cast_unsigned(size), sycl_queue);
+    std::copy(input.begin(), input.end(), inout);
+
+    descriptor_t descriptor{ size };
+    descriptor.set_value(oneapi::mkl::dft::config_param::BACKWARD_SCALE,
+                         real_t{ 1 } / static_cast<real_t>(size));
+    descriptor.set_value(oneapi::mkl::dft::config_param::ORDERING,
+                         oneapi::mkl::dft::config_value::BACKWARD_SCRAMBLED);
+    commit_descriptor(descriptor, sycl_queue);
+    oneapi::mkl::dft::compute_forward<descriptor_t, data_t>(descriptor, inout).wait_and_throw();
+    oneapi::mkl::dft::compute_backward<descriptor_t, data_t>(descriptor, inout).wait_and_throw();
+    EXPECT_TRUE(
+        check_equal_vector(inout, input.data(), cast_unsigned(size), size, size, std::cout));
+
+    sycl::free(inout, sycl_queue);
+    return !::testing::Test::HasFailure();
+}
+
+#define INSTANTIATE_SCRAMBLED_1D_TEST(PRECISION)                                                \
+    TEST_P(ComputeTests_reordered, COMPLEX_##PRECISION##_scrambled_1d_USM) {                    \
+        try {                                                                                   \
+            EXPECT_TRUEORSKIP(                                                                  \
+                (test_scrambled_round_trip_1d<oneapi::mkl::dft::precision::PRECISION>(          \
+                    GetParam())));                                                              \
+        }                                                                                       \
+        catch (oneapi::mkl::unimplemented & e) {                                                \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;          \
+            GTEST_SKIP();                                                                       \
+        }                                                                                       \
+    }
+
+INSTANTIATE_SCRAMBLED_1D_TEST(SINGLE)
+INSTANTIATE_SCRAMBLED_1D_TEST(DOUBLE)
+
+// A batch of transforms of awkward lengths committed with each tuning level must match the
+// untuned result.
+template <oneapi::mkl::dft::precision precision>
+int test_tuned(sycl::device* dev) {
+    sycl::queue sycl_queue(*dev, exception_handler);
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::DOUBLE, double,
+                                      float>;
+    using data_t = std::complex<real_t>;
+    using descriptor_t = oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::COMPLEX>;
+    const std::int64_t n0 = 30, n1 = 77, size = n0 * n1, batches = 3, total = size * batches;
+
+    std::vector<data_t> input;
+    rand_vector(input, cast_unsigned(total));
+    std::vector<data_t> results[3];
+    const oneapi::mkl::dft::config_value levels[] = {
+        oneapi::mkl::dft::config_value::TUNING_NONE, oneapi::mkl::dft::config_value::TUNING_MEASURE,
+        oneapi::mkl::dft::config_value::TUNING_EXHAUSTIVE
+    };
+    for (int level = 0; level < 3; ++level) {
+        descriptor_t descriptor{ { n0, n1 } };
+        descriptor.set_value(oneapi::mkl::dft::config_param::PLACEMENT,
+                             oneapi::mkl::dft::config_value::NOT_INPLACE);
+        descriptor.set_value(oneapi::mkl::dft::config_param::NUMBER_OF_TRANSFORMS, batches);
+        descriptor.set_value(oneapi::mkl::dft::config_param::FWD_DISTANCE, size);
+        descriptor.set_value(oneapi::mkl::dft::config_param::BWD_DISTANCE, size);
+        descriptor.set_value(oneapi::mkl::dft::config_param::TUNING_LEVEL, levels[level]);
+        commit_descriptor(descriptor, sycl_queue);
+
+        auto in = sycl::malloc_shared<data_t>(cast_unsigned(total), sycl_queue);
+        auto out = sycl::malloc_shared<data_t>(cast_unsigned(total), sycl_queue);
+        std::copy(input.begin(), input.end(), in);
+        oneapi::mkl::dft::compute_forward<descriptor_t, data_t, data_t>(descriptor, in, out)
+            .wait_and_throw();
+        results[level].assign(out, out + total);
+        sycl::free(in, sycl_queue);
+        sycl::free(out, sycl_queue);
+    }
+
+    // The results differ by the rounding of different factorizations.
+    for (int level = 1; level < 3; ++level) {
+        EXPECT_TRUE(check_equal_vector(results[level].data(), results[0].data(),
+                                       cast_unsigned(total), size, size, std::cout));
+    }
+    return !::testing::Test::HasFailure();
+}
+
+class ComputeTests_tuned : public ::testing::TestWithParam<sycl::device*> {};
+
+#define INSTANTIATE_TUNED_TEST(PRECISION)                                                       \
+    TEST_P(ComputeTests_tuned, COMPLEX_##PRECISION##_out_of_place_USM) {                        \
+        try {                                                                                   \
+            EXPECT_TRUEORSKIP(                                                                  \
+                (test_tuned<oneapi::mkl::dft::precision::PRECISION>(GetParam())));              \
+        }                                                                                       \
+        catch (oneapi::mkl::unimplemented & e) {                                                \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;          \
+            GTEST_SKIP();                                                                       \
+        }                                                                                       \
+    }
+
+INSTANTIATE_TUNED_TEST(SINGLE)
+INSTANTIATE_TUNED_TEST(DOUBLE)
+
+// Wisdom exported after a tuned commit and imported into a fresh process state must be used as
+// is: importing it again with every choice of radices reversed, which fits the same lengths,
+// must give the same result, and a tuned commit must keep the imported choices rather than
+// measuring its own. Text that is malformed or holds a choice that does not fit its key must be
+// rejected without changing the wisdom.
+template <oneapi::mkl::dft::precision precision>
+int test_wisdom(sycl::device* dev) {
+#if defined(CALL_RT_API) || !defined(ENABLE_PORTABLE_BACKEND)
+    static_cast<void>(dev);
+    std::cout << "The portable backend is only selected by compile-time dispatch." << std::endl;
+    return test_skipped;
+#else
+    sycl::queue sycl_queue(*dev, exception_handler);
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::DOUBLE, double,
+                                      float>;
+    using data_t = std::complex<real_t>;
+    using descriptor_t = oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::COMPLEX>;
+    const std::int64_t n0 = 30, n1 = 77, size = n0 * n1;
+    namespace portable = oneapi::mkl::dft::portable;
+
+    std::vector<data_t> input;
+    rand_vector(input, cast_unsigned(size));
+    auto in = sycl::malloc_shared<data_t>(cast_unsigned(size), sycl_queue);
+    auto out = sycl::malloc_shared<data_t>(cast_unsigned(size), sycl_queue);
+    std::copy(input.begin(), input.end(), in);
+    auto transform = [&](oneapi::mkl::dft::config_value level) {
+        descriptor_t descriptor{ { n0, n1 } };
+        descriptor.set_value(oneapi::mkl::dft::config_param::PLACEMENT,
+                             oneapi::mkl::dft::config_value::NOT_INPLACE);
+        descriptor.set_value(oneapi::mkl::dft::config_param::TUNING_LEVEL, level);
+        descriptor.commit(
+            oneapi::mkl::backend_selector<oneapi::mkl::backend::portable>{ sycl_queue });
+        oneapi::mkl::dft::compute_forward<descriptor_t, data_t, data_t>(descriptor, in, out)
+            .wait_and_throw();
+        return std::vector<data_t>(out, out + size);
+    };
+
+    const auto untuned = transform(oneapi::mkl::dft::config_value::TUNING_NONE);
+    portable::forget_wisdom();
+    transform(oneapi::mkl::dft::config_value::TUNING_MEASURE);
+    const std::string measured = portable::export_wisdom();
+
+    // Both lengths have more than one factorization, so each has an entry after the header.
+    std::istringstream lines(measured);
+    std::string header, line, reversed;
+    std::getline(lines, header);
+    reversed = header + "\n";
+    int entries = 0;
+    while (std::getline(lines, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        std::vector<std::string> values;
+        fields >> key;
+        for (std::string value; fields >> value;)
+            values.push_back(value);
+        reversed += key;
+        for (auto value = values.rbegin(); value != values.rend(); ++value)
+            reversed += " " + *value;
+        reversed += "\n";
+        ++entries;
+    }
+    EXPECT_EQ(entries, 2);
+
+    portable::forget_wisdom();
+    EXPECT_EQ(portable::export_wisdom(), header + "\n");
+    portable::import_wisdom(measured);
+    EXPECT_EQ(portable::export_wisdom(), measured);
+    const auto imported = transform(oneapi::mkl::dft::config_value::TUNING_MEASURE);
+    EXPECT_EQ(portable::export_wisdom(), measured);
+    EXPECT_TRUE(check_equal_vector(imported.data(), untuned.data(), cast_unsigned(size), size,
+                                   size, std::cout));
+
+    portable::forget_wisdom();
+    portable::import_wisdom(reversed);
+    const auto reversed_result = transform(oneapi::mkl::dft::config_value::TUNING_MEASURE);
+    EXPECT_EQ(portable::export_wisdom(), reversed);
+    EXPECT_TRUE(check_equal_vector(reversed_result.data(), untuned.data(), cast_unsigned(size),
+                                   size, size, std::cout));
+
+    const std::string rejected[] = {
+        "",
+        "onemkl-dft-portable-wisdom 0\n",
+        header + "\nfft1d/d/30\n",
+        header + "\nfft1d/d/30 2 3 x\n",
+        header + "\nfft1d/d/30 2 3\n",
+        header + "\nfft1d/d/30 -2 -3 5\n",
+        header + "\nfft1d/d/30 1 2 3 5\n",
+        header + "\nfft1d/q/30 2 3 5\n",
+        header + "\nlines/c/d/30/77 0\n",
+        header + "\nlines/c/d/30/77 4 8\n",
+        header + "\nunknown/d/30 2 3 5\n",
+        // A valid entry before an invalid one must not be imported either.
+        header + "\nfft1d/d/12 3 4\nfft1d/d/35 5 5\n",
+    };
+    for (const auto& text : rejected) {
+        EXPECT_THROW(portable::import_wisdom(text), oneapi::mkl::invalid_argument) << text;
+        EXPECT_EQ(portable::export_wisdom(), reversed);
+    }
+
+    portable::forget_wisdom();
+    sycl::free(in, sycl_queue);
+    sycl::free(out, sycl_queue);
+    return !::testing::Test::HasFailure();
+#endif
+}
+
+class ComputeTests_wisdom : public ::testing::TestWithParam<sycl::device*> {};
+
+#define INSTANTIATE_WISDOM_TEST(PRECISION)                                                      \
+    TEST_P(ComputeTests_wisdom, COMPLEX_##PRECISION##_out_of_place_USM) {                       \
+        try {                                                                                   \
+            EXPECT_TRUEORSKIP(                                                                  \
+                (test_wisdom<oneapi::mkl::dft::precision::PRECISION>(GetParam())));             \
+        }                                                                                       \
+        catch (oneapi::mkl::unimplemented & e) {                                                \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;          \
+            GTEST_SKIP();                                                                       \
+        }                                                                                       \
+    }
+
+INSTANTIATE_WISDOM_TEST(SINGLE)
+INSTANTIATE_WISDOM_TEST(DOUBLE)
+
+// Pruned transforms must write the window of the full transform of the zero-padded input, whatever
+// the input holds past its pruned length, and leave the rest of the output alone. The cases favour
+// each of the ways a pruned transform can be computed.
+template <oneapi::mkl::dft::precision precision>
+int test_pruned(sycl::device* dev) {
+    sycl::queue sycl_queue(*dev, exception_handler);
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::DOUBLE, double,
+                                      float>;
+    using data_t = std::complex<real_t>;
+    using descriptor_t = oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::COMPLEX>;
+    const std::int64_t n = 1024, batches = 2, total = n * batches;
+    const data_t untouched{ 7, 7 };
+
+    struct pruning {
+        std::int64_t input_length, output_offset, output_length;
+    };
+    for (auto [input_length, output_offset, output_length] :
+         { pruning{ 10, 0, n }, pruning{ n, 100, 10 }, pruning{ 10, 500, 20 } }) {
+        std::vector<data_t> input;
+        rand_vector(input, cast_unsigned(total));
+        auto in = sycl::malloc_shared<data_t>(cast_unsigned(total), sycl_queue);
+        auto ref = sycl::malloc_shared<data_t>(cast_unsigned(total), sycl_queue);
+        auto out = sycl::malloc_shared<data_t>(cast_unsigned(total), sycl_queue);
+        for (std::int64_t i = 0; i < total; ++i) {
+            in[i] = i % n < input_length ? input[cast_unsigned(i)] : data_t{ 0 };
+            out[i] = untouched;
+        }
+
+        descriptor_t full{ n }, pruned{ n };
+        for (descriptor_t* descriptor : { &full, &pruned }) {
+            descriptor->set_value(oneapi::mkl::dft::config_param::PLACEMENT,
+                                  oneapi::mkl::dft::config_value::NOT_INPLACE);
+            descriptor->set_value(oneapi::mkl::dft::config_param::NUMBER_OF_TRANSFORMS, batches);
+            descriptor->set_value(oneapi::mkl::dft::config_param::FWD_DISTANCE, n);
+            descriptor->set_value(oneapi::mkl::dft::config_param::BWD_DISTANCE, n);
+        }
+        pruned.set_value(oneapi::mkl::dft::config_param::PRUNED_INPUT_LENGTH, input_length);
+        pruned.set_value(oneapi::mkl::dft::config_param::PRUNED_OUTPUT_OFFSET, output_offset);
+        pruned.set_value(oneapi::mkl::dft::config_param::PRUNED_OUTPUT_LENGTH, output_length);
+        commit_descriptor(full, sycl_queue);
+        commit_descriptor(pruned, sycl_queue);
+
+        oneapi::mkl::dft::compute_forward<descriptor_t, data_t, data_t>(full, in, ref)
+            .wait_and_throw();
+        std::copy(input.begin(), input.end(), in);
+        oneapi::mkl::dft::compute_forward<descriptor_t, data_t, data_t>(pruned, in, out)
+            .wait_and_throw();
+
+        std::vector<data_t> expected(ref, ref + total);
+        for (std::int64_t i = 0; i < total; ++i) {
+            if (i % n < output_offset || i % n >= output_offset + output_length) {
+                expected[cast_unsigned(i)] = untouched;
+            }
+        }
+        EXPECT_TRUE(check_equal_vector(out, expected.data(), cast_unsigned(total), n, n,
+                                       std::cout));
+
+        sycl::free(in, sycl_queue);
+        sycl::free(ref, sycl_queue);
+        sycl::free(out, sycl_queue);
+    }
+    return !::testing::Test::HasFailure();
+}
+
+class ComputeTests_pruned : public ::testing::TestWithParam<sycl::device*> {};
+
+#define INSTANTIATE_PRUNED_TEST(PRECISION)                                                      \
+    TEST_P(ComputeTests_pruned, COMPLEX_##PRECISION##_out_of_place_USM) {                       \
+        try {                                                                                   \
+            EXPECT_TRUEORSKIP(                                                                  \
+                (test_pruned<oneapi::mkl::dft::precision::PRECISION>(GetParam())));             \
+        }                                                                                       \
+        catch (oneapi::mkl::unimplemented & e) {                                                \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;          \
+            GTEST_SKIP();                                                                       \
+        }                                                                                       \
+    }
+
+INSTANTIATE_PRUNED_TEST(SINGLE)
+INSTANTIATE_PRUNED_TEST(DOUBLE)
+
+// A batch split across several queues, one per NUMA domain of the device when it has more than
+// one, must give the same result as the whole batch on one queue.
+template <oneapi::mkl::dft::precision precision>
+int test_multi_queue(sycl::device* dev) {
+#ifndef CALL_RT_API
+    std::cout << "Multi-queue commit is only available with run-time dispatch." << std::endl;
+    return test_skipped;
+#else
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::DOUBLE, double,
+                                      float>;
+    using data_t = std::complex<real_t>;
+    using descriptor_t = oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::COMPLEX>;
+    const std::int64_t n = 48, batches = 7, total = n * batches;
+
+    // The queues share a context, so that each of them can access the data.
+    auto queues = oneapi::mkl::dft::numa_queues(*dev);
+    if (queues.size() == 1) {
+        const auto context = queues.front().get_context();
+        queues = { sycl::queue(context, *dev, exception_handler),
+                   sycl::queue(context, *dev, exception_handler),
+                   sycl::queue(context, *dev, exception_handler) };
+    }
+    auto& sycl_queue = queues.front();
+
+    std::vector<data_t> input;
+    rand_vector(input, cast_unsigned(total));
+    auto in = sycl::malloc_shared<data_t>(cast_unsigned(total), sycl_queue);
+    auto out = sycl::malloc_shared<data_t>(cast_unsigned(total), sycl_queue);
+    auto split_out = sycl::malloc_shared<data_t>(cast_unsigned(total), sycl_queue);
+    std::copy(input.begin(), input.end(), in);
+
+    descriptor_t whole{ n }, split{ n };
+    for (descriptor_t* descriptor : { &whole, &split }) {
+        descriptor->set_value(oneapi::mkl::dft::config_param::PLACEMENT,
+                              oneapi::mkl::dft::config_value::NOT_INPLACE);
+        descriptor->set_value(oneapi::mkl::dft::config_param::NUMBER_OF_TRANSFORMS, batches);
+        descriptor->set_value(oneapi::mkl::dft::config_param::FWD_DISTANCE, n);
+        descriptor->set_value(oneapi::mkl::dft::config_param::BWD_DISTANCE, n);
+    }
+    whole.commit(sycl_queue);
+    split.commit(queues);
+
+    oneapi::mkl::dft::compute_forward<descriptor_t, data_t, data_t>(whole, in, out)
+        .wait_and_throw();
+    oneapi::mkl::dft::compute_forward<descriptor_t, data_t, data_t>(split, in, split_out)
+        .wait_and_throw();
+    EXPECT_TRUE(check_equal_vector(split_out, out, cast_unsigned(total), n, n, std::cout));
+
+    oneapi::mkl::dft::compute_backward<descriptor_t, data_t, data_t>(split, split_out, in)
+        .wait_and_throw();
+    for (auto& value : input) {
+        value *= static_cast<real_t>(n);
+    }
+    EXPECT_TRUE(check_equal_vector(in, input.data(), cast_unsigned(total), n, n, std::cout));
+
+    sycl::free(in, sycl_queue);
+    sycl::free(out, sycl_queue);
+    sycl::free(split_out, sycl_queue);
+    return !::testing::Test::HasFailure();
+#endif
+}
+
+class ComputeTests_multi_queue : public ::testing::TestWithParam<sycl::device*> {};
+
+#define INSTANTIATE_MULTI_QUEUE_TEST(PRECISION)                                                 \
+    TEST_P(ComputeTests_multi_queue, COMPLEX_##PRECISION##_out_of_place_USM) {                  \
+        try {                                                                                   \
+            EXPECT_TRUEORSKIP(                                                                  \
+                (test_multi_queue<oneapi::mkl::dft::precision::PRECISION>(GetParam())));        \
+        }                                                                                       \
+        catch (oneapi::mkl::unimplemented & e) {                                                \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;          \
+            GTEST_SKIP();                                                                       \
+        }                                                                                       \
+    }
+
+INSTANTIATE_MULTI_QUEUE_TEST(SINGLE)
+INSTANTIATE_MULTI_QUEUE_TEST(DOUBLE)
+
+// The unnormalized type II and III cosine and sine transforms of config_param::REAL_REAL_KIND, of
+// length n, evaluated at k.
+template <typename real_t>
+double reference_real_real(oneapi::mkl::dft::config_value kind, const real_t* x, std::int64_t n,
+                           std::int64_t stride, std::int64_t k) {
+    const double pi = std::acos(-1.0);
+    double sum = 0;
+    for (std::int64_t j = 0; j < n; ++j) {
+        const double v = static_cast<double>(x[j * stride]);
+        switch (kind) {
+            case oneapi::mkl::dft::config_value::DCT_II:
+                sum += 2 * v * std::cos(pi * (j + 0.5) * k / n);
+                break;
+            case oneapi::mkl::dft::config_value::DCT_III:
+                sum += j == 0 ? v : 2 * v * std::cos(pi * j * (k + 0.5) / n);
+                break;
+            case oneapi::mkl::dft::config_value::DST_II:
+                sum += 2 * v * std::sin(pi * (j + 0.5) * (k + 1) / n);
+                break;
+            default:
+                sum += j == n - 1 ? (k % 2 ? -v : v)
+                                  : 2 * v * std::sin(pi * (j + 1) * (k + 0.5) / n);
+                break;
+        }
+    }
+    return sum;
+}
+
+// A batch of two-dimensional real-to-real transforms must match the separable direct sums, and
+// the backward transform, the inverse kind, must return the input scaled by 4 * n0 * n1.
+template <oneapi::mkl::dft::precision precision>
+int test_real_real_kind(sycl::device* dev, oneapi::mkl::dft::config_value kind) {
+    sycl::queue sycl_queue(*dev, exception_handler);
+    if (!dev->has(sycl::aspect::usm_shared_allocations)) {
+        std::cout << "Device does not support usm shared allocations." << std::endl;
+        return test_skipped;
+    }
+    if constexpr (precision == oneapi::mkl::dft::precision::DOUBLE) {
+        if (!dev->has(sycl::aspect::fp64)) {
+            std::cout << "Device does not support double precision." << std::endl;
+            return test_skipped;
+        }
+    }
+    using real_t = std::conditional_t<precision == oneapi::mkl::dft::precision::DOUBLE, double,
+                                      float>;
+    using descriptor_t =
+        oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::REAL_REAL>;
+    const std::int64_t n0 = 5, n1 = 8, size = n0 * n1, batches = 2, total = size * batches;
+
+    std::vector<real_t> input;
+    rand_vector(input, cast_unsigned(total));
+    auto in = sycl::malloc_shared<real_t>(cast_unsigned(total), sycl_queue);
+    auto mid = sycl::malloc_shared<real_t>(cast_unsigned(total), sycl_queue);
+    auto out = sycl::malloc_shared<real_t>(cast_unsigned(total), sycl_queue);
+    std::copy(input.begin(), input.end(), in);
+
+    descriptor_t descriptor{ { n0, n1 } };
+    descriptor.set_value(oneapi::mkl::dft::config_param::PLACEMENT,
+                         oneapi::mkl::dft::config_value::NOT_INPLACE);
+    descriptor.set_value(oneapi::mkl::dft::config_param::NUMBER_OF_TRANSFORMS, batches);
+    descriptor.set_value(oneapi::mkl::dft::config_param::FWD_DISTANCE, size);
+    descriptor.set_value(oneapi::mkl::dft::config_param::BWD_DISTANCE, size);
+    descriptor.set_value(oneapi::mkl::dft::config_param::BACKWARD_SCALE,
+                         real_t{ 1 } / static_cast<real_t>(4 * size));
+    descriptor.set_value(oneapi::mkl::dft::config_param::REAL_REAL_KIND, kind);
+    commit_descriptor(descriptor, sycl_queue);
+    oneapi::mkl::dft::compute_forward<descriptor_t, real_t, real_t>(descriptor, in, mid)
+        .wait_and_throw();
+
+    std::vector<double> rows(cast_unsigned(total)), reference(cast_unsigned(total));
+    for (std::int64_t b = 0; b < batches; ++b) {
+        for (std::int64_t i = 0; i < n0; ++i) {
+            for (std::int64_t k = 0; k < n1; ++k) {
+                rows[cast_unsigned(b * size + i * n1 + k)] =
+                    reference_real_real(kind, input.data() + b * size + i * n1, n1, 1, k);
+            }
+        }
+        for (std::int64_t j = 0; j < n1; ++j) {
+            for (std::int64_t k = 0; k < n0; ++k) {
+                reference[cast_unsigned(b * size + k * n1 + j)] =
+                    reference_real_real(kind, rows.data() + b * size + j, n0, n1, k);
+            }
+        }
+    }
+    EXPECT_TRUE(check_equal_vector(mid, reference.data(), cast_unsigned(total), size, size,
+                                   std::cout));
+
+    oneapi::mkl::dft::compute_backward<descriptor_t, real_t, real_t>(descriptor, mid, out)
+        .wait_and_throw();
+    EXPECT_TRUE(check_equal_vector(out, input.data(), cast_unsigned(total), size, size, std::cout));
+
+    sycl::free(in, sycl_queue);
+    sycl::free(mid, sycl_queue);
+    sycl::free(out, sycl_queue);
+    return !::testing::Test::HasFailure();
+}
+
+class ComputeTests_real_real_kinds : public ::testing::TestWithParam<sycl::device*> {};
+
+#define INSTANTIATE_REAL_REAL_KIND_TEST(PRECISION, KIND)                                        \
+    TEST_P(ComputeTests_real_real_kinds, REAL_REAL_##PRECISION##_##KIND##_USM) {                \
+        try {                                                                                   \
+            EXPECT_TRUEORSKIP((test_real_real_kind<oneapi::mkl::dft::precision::PRECISION>(     \
+                GetParam(), oneapi::mkl::dft::config_value::KIND)));                            \
+        }                                                                                       \
+        catch (oneapi::mkl::unimplemented & e) {                                                \
+            std::cout << "Skipping test because: \"" << e.what() << "\"" << std::endl;          \
+            GTEST_SKIP();                                                                       \
+        }                                                                                       \
+    }
+
+INSTANTIATE_REAL_REAL_KIND_TEST(SINGLE, DCT_II)
+INSTANTIATE_REAL_REAL_KIND_TEST(SINGLE, DST_III)
+INSTANTIATE_REAL_REAL_KIND_TEST(DOUBLE, DCT_III)
+INSTANTIATE_REAL_REAL_KIND_TEST(DOUBLE, DST_II)
+
 using shape = std::vector<std::int64_t>;
 using i64 = std::int64_t;
 // Parameter format - { shape of transform, number of transforms } or { shape, forward strides, backward strides, number of transforms }
@@ -204,4 +1281,25 @@ INSTANTIATE_TEST_SUITE_P(ComputeTestSuite, ComputeTests_real_real_out_of_place_R
                                           testing::ValuesIn(test_params)),
                          DFTParamsPrint{});
 
+INSTANTIATE_TEST_SUITE_P(ComputeTestSuite, ComputeTests_16bit, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+INSTANTIATE_TEST_SUITE_P(ComputeTestSuite, ComputeTests_convolution, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+INSTANTIATE_TEST_SUITE_P(ComputeTestSuite, ComputeTests_stft, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+INSTANTIATE_TEST_SUITE_P(ComputeTestSuite, ComputeTests_streamed, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+INSTANTIATE_TEST_SUITE_P(ComputeTestSuite, ComputeTests_reordered, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+INSTANTIATE_TEST_SUITE_P(ComputeTestSuite, ComputeTests_real_real_kinds, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+INSTANTIATE_TEST_SUITE_P(ComputeTestSuite, ComputeTests_tuned, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+INSTANTIATE_TEST_SUITE_P(ComputeTestSuite, ComputeTests_wisdom, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+INSTANTIATE_TEST_SUITE_P(ComputeTestSuite, ComputeTests_multi_queue, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+INSTANTIATE_TEST_SUITE_P(ComputeTestSuite, ComputeTests_pruned, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
 } // anonymous namespace
@@ -17,6 +17,7 @@
 *
 **************************************************************************/
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <variant>
@@ -30,6 +31,8 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include "oneapi/mkl/detail/backends.hpp"
+#include "oneapi/mkl/detail/config.hpp"
 #include "test_helper.hpp"
 #include "test_common.hpp"
 #include <gtest/gtest.h>
@@ -344,6 +347,109 @@ static void set_and_get_values() {
         descriptor.get_value(oneapi::mkl::dft::config_param::PACKED_FORMAT, &value);
         EXPECT_EQ(oneapi::mkl::dft::config_value::CCE_FORMAT, value);
     }
+
+    {
+        oneapi::mkl::dft::config_value value{
+            oneapi::mkl::dft::config_value::COMMITTED
+        }; // Initialize with invalid value
+        descriptor.get_value(oneapi::mkl::dft::config_param::WORKSPACE_PLACEMENT, &value);
+        EXPECT_EQ(oneapi::mkl::dft::config_value::WORKSPACE_AUTOMATIC, value);
+
+        descriptor.set_value(oneapi::mkl::dft::config_param::WORKSPACE_PLACEMENT,
+                             oneapi::mkl::dft::config_value::WORKSPACE_EXTERNAL);
+        value = oneapi::mkl::dft::config_value::COMMITTED; // Initialize with invalid value
+        descriptor.get_value(oneapi::mkl::dft::config_param::WORKSPACE_PLACEMENT, &value);
+        EXPECT_EQ(oneapi::mkl::dft::config_value::WORKSPACE_EXTERNAL, value);
+
+        EXPECT_THROW(descriptor.set_value(oneapi::mkl::dft::config_param::WORKSPACE_PLACEMENT,
+                                          oneapi::mkl::dft::config_value::ALLOW),
+                     oneapi::mkl::invalid_argument);
+        descriptor.set_value(oneapi::mkl::dft::config_param::WORKSPACE_PLACEMENT,
+                             oneapi::mkl::dft::config_value::WORKSPACE_AUTOMATIC);
+    }
+
+    {
+        std::int64_t value{ -1 };
+        descriptor.get_value(oneapi::mkl::dft::config_param::MAX_WORKING_SET_BYTES, &value);
+        EXPECT_EQ(0, value);
+
+        const std::int64_t bound{ std::int64_t{ 1 } << 20 };
+        descriptor.set_value(oneapi::mkl::dft::config_param::MAX_WORKING_SET_BYTES, bound);
+        descriptor.get_value(oneapi::mkl::dft::config_param::MAX_WORKING_SET_BYTES, &value);
+        EXPECT_EQ(bound, value);
+
+        EXPECT_THROW(descriptor.set_value(oneapi::mkl::dft::config_param::MAX_WORKING_SET_BYTES,
+                                          std::int64_t{ -1 }),
+                     oneapi::mkl::invalid_argument);
+        descriptor.set_value(oneapi::mkl::dft::config_param::MAX_WORKING_SET_BYTES,
+                             std::int64_t{ 0 });
+    }
+
+    {
+        oneapi::mkl::dft::config_value value{ oneapi::mkl::dft::config_value::COMMITTED };
+        EXPECT_THROW(descriptor.get_value(oneapi::mkl::dft::config_param::REAL_REAL_KIND, &value),
+                     oneapi::mkl::invalid_argument);
+        EXPECT_THROW(descriptor.set_value(oneapi::mkl::dft::config_param::REAL_REAL_KIND,
+                                          oneapi::mkl::dft::config_value::DCT_II),
+                     oneapi::mkl::invalid_argument);
+    }
+
+    {
+        oneapi::mkl::dft::config_value value{ oneapi::mkl::dft::config_value::COMMITTED };
+        descriptor.get_value(oneapi::mkl::dft::config_param::TUNING_LEVEL, &value);
+        EXPECT_EQ(oneapi::mkl::dft::config_value::TUNING_NONE, value);
+
+        descriptor.set_value(oneapi::mkl::dft::config_param::TUNING_LEVEL,
+                             oneapi::mkl::dft::config_value::TUNING_EXHAUSTIVE);
+        descriptor.get_value(oneapi::mkl::dft::config_param::TUNING_LEVEL, &value);
+        EXPECT_EQ(oneapi::mkl::dft::config_value::TUNING_EXHAUSTIVE, value);
+
+        EXPECT_THROW(descriptor.set_value(oneapi::mkl::dft::config_param::TUNING_LEVEL,
+                                          oneapi::mkl::dft::config_value::ALLOW),
+                     oneapi::mkl::invalid_argument);
+        descriptor.set_value(oneapi::mkl::dft::config_param::TUNING_LEVEL,
+                             oneapi::mkl::dft::config_value::TUNING_NONE);
+    }
+
+    for (auto param : { oneapi::mkl::dft::config_param::PRUNED_INPUT_LENGTH,
+                        oneapi::mkl::dft::config_param::PRUNED_OUTPUT_OFFSET,
+                        oneapi::mkl::dft::config_param::PRUNED_OUTPUT_LENGTH }) {
+        std::int64_t value{ -1 };
+        descriptor.get_value(param, &value);
+        EXPECT_EQ(0, value);
+
+        descriptor.set_value(param, std::int64_t{ 2 });
+        descriptor.get_value(param, &value);
+        EXPECT_EQ(2, value);
+
+        EXPECT_THROW(descriptor.set_value(param, std::int64_t{ -1 }),
+                     oneapi::mkl::invalid_argument);
+        descriptor.set_value(param, std::int64_t{ 0 });
+    }
+}
+
+template <oneapi::mkl::dft::precision precision>
+static void set_and_get_real_real_kind() {
+    oneapi::mkl::dft::descriptor<precision, oneapi::mkl::dft::domain::REAL_REAL> descriptor{
+        default_1d_lengths
+    };
+
+    oneapi::mkl::dft::config_value value{ oneapi::mkl::dft::config_value::COMMITTED };
+    descriptor.get_value(oneapi::mkl::dft::config_param::REAL_REAL_KIND, &value);
+    EXPECT_EQ(oneapi::mkl::dft::config_value::DCT_II, value);
+
+    for (auto kind : { oneapi::mkl::dft::config_value::DCT_III,
+                       oneapi::mkl::dft::config_value::DST_II,
+                       oneapi::mkl::dft::config_value::DST_III,
+                       oneapi::mkl::dft::config_value::DCT_II }) {
+        descriptor.set_value(oneapi::mkl::dft::config_param::REAL_REAL_KIND, kind);
+        descriptor.get_value(oneapi::mkl::dft::config_param::REAL_REAL_KIND, &value);
+        EXPECT_EQ(kind, value);
+    }
+
+    EXPECT_THROW(descriptor.set_value(oneapi::mkl::dft::config_param::REAL_REAL_KIND,
+                                      oneapi::mkl::dft::config_value::COMPLEX_COMPLEX),
+                 oneapi::mkl::invalid_argument);
 }
 
 template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
@@ -399,6 +505,15 @@ static void set_readonly_values() {
     EXPECT_THROW(descriptor.set_value(oneapi::mkl::dft::config_param::COMMIT_STATUS,
                                       oneapi::mkl::dft::config_value::UNCOMMITTED),
                  oneapi::mkl::invalid_argument);
+
+    std::int64_t workspace_bytes{ 0 };
+    EXPECT_THROW(descriptor.set_value(oneapi::mkl::dft::config_param::WORKSPACE_EXTERNAL_BYTES,
+                                      workspace_bytes),
+                 oneapi::mkl::invalid_argument);
+    // The size of the workspace is only known once the descriptor is committed.
+    EXPECT_THROW(descriptor.get_value(oneapi::mkl::dft::config_param::WORKSPACE_EXTERNAL_BYTES,
+                                      &workspace_bytes),
+                 oneapi::mkl::invalid_argument);
 }
 
 template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
@@ -443,7 +558,8 @@ inline void recommit_values(sycl::queue& sycl_queue) {
         { std::make_pair(config_param::WORKSPACE, config_value::ALLOW),
           std::make_pair(config_param::ORDERING, config_value::ORDERED),
           std::make_pair(config_param::TRANSPOSE, bool{ false }),
-          std::make_pair(config_param::PACKED_FORMAT, config_value::CCE_FORMAT) },
+          std::make_pair(config_param::PACKED_FORMAT, config_value::CCE_FORMAT),
+          std::make_pair(config_param::TUNING_LEVEL, config_value::TUNING_MEASURE) },
         { std::make_pair(config_param::LENGTHS, std::int64_t{ 10 }),
           std::make_pair(config_param::FORWARD_SCALE, PrecisionType(1.2)),
           std::make_pair(config_param::BACKWARD_SCALE, PrecisionType(3.4)) }
@@ -547,6 +663,164 @@ inline void swap_out_dead_queue(sycl::queue& sycl_queue) {
     sycl::free(inout, sycl_queue);
 }
 
+// Transform a unit impulse in place and return the real part of its first component, which is
+// equal to the forward scale.
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+inline auto forward_impulse(oneapi::mkl::dft::descriptor<precision, domain>& descriptor,
+                            sycl::queue& sycl_queue) {
+    using ftype = typename std::conditional_t<precision == oneapi::mkl::dft::precision::SINGLE,
+                                              float, double>;
+    using forward_type = typename std::conditional_t<domain == oneapi::mkl::dft::domain::REAL,
+                                                     ftype, std::complex<ftype>>;
+
+    // add two so that real-complex transforms have space for all the conjugate even components
+    auto inout = sycl::malloc_shared<forward_type>(default_1d_lengths + 2, sycl_queue);
+    std::fill(inout, inout + default_1d_lengths + 2, forward_type{ 0 });
+    inout[0] = forward_type{ 1 };
+    oneapi::mkl::dft::compute_forward<std::remove_reference_t<decltype(descriptor)>, forward_type>(
+        descriptor, inout, std::vector<sycl::event>{})
+        .wait_and_throw();
+    ftype first = std::real(inout[0]);
+    sycl::free(inout, sycl_queue);
+    return first;
+}
+
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+inline void recommit_shared_configuration(sycl::queue& sycl_queue) {
+    // descriptors committed with the same configuration may share plans, so check that
+    // recommitting one of them with a new value does not affect the other.
+    using ftype = typename std::conditional_t<precision == oneapi::mkl::dft::precision::SINGLE,
+                                              float, double>;
+    const ftype scale = 2;
+
+    oneapi::mkl::dft::descriptor<precision, domain> unchanged{ default_1d_lengths };
+    oneapi::mkl::dft::descriptor<precision, domain> changed{ default_1d_lengths };
+    EXPECT_NO_THROW(commit_descriptor(unchanged, sycl_queue));
+    EXPECT_NO_THROW(commit_descriptor(changed, sycl_queue));
+    changed.set_value(oneapi::mkl::dft::config_param::FORWARD_SCALE, scale);
+    EXPECT_NO_THROW(commit_descriptor(changed, sycl_queue));
+
+    EXPECT_NEAR(forward_impulse(unchanged, sycl_queue), ftype{ 1 }, 1e-5);
+    EXPECT_NEAR(forward_impulse(changed, sycl_queue), scale, 1e-5);
+}
+
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+inline void cached_plans(sycl::queue& sycl_queue) {
+    // with the plan cache enabled, descriptors committed with the same configuration share one
+    // commit_impl, except on cuFFT and rocFFT, and with it disabled they never do. Releasing the
+    // cached plans leaves the descriptors using them committed.
+    using ftype = typename std::conditional_t<precision == oneapi::mkl::dft::precision::SINGLE,
+                                              float, double>;
+    using descriptor_t = oneapi::mkl::dft::descriptor<precision, domain>;
+    using oneapi::mkl::dft::detail::get_commit;
+
+    EXPECT_THROW(descriptor_t::set_plan_cache_capacity(-1), oneapi::mkl::invalid_argument);
+    for (std::int64_t capacity : { 0, 4 }) {
+        descriptor_t::set_plan_cache_capacity(capacity);
+        descriptor_t first{ default_1d_lengths };
+        descriptor_t second{ default_1d_lengths };
+        EXPECT_NO_THROW(commit_descriptor(first, sycl_queue));
+        EXPECT_NO_THROW(commit_descriptor(second, sycl_queue));
+        const auto backend = get_commit(first)->get_backend();
+        const bool cached = capacity > 0 && backend != oneapi::mkl::backend::cufft &&
+                            backend != oneapi::mkl::backend::rocfft;
+        EXPECT_EQ(get_commit(first) == get_commit(second), cached);
+
+        descriptor_t::release_cached_plans();
+        descriptor_t third{ default_1d_lengths };
+        EXPECT_NO_THROW(commit_descriptor(third, sycl_queue));
+        EXPECT_NE(get_commit(third), get_commit(first));
+
+        EXPECT_NEAR(forward_impulse(first, sycl_queue), ftype{ 1 }, 1e-5);
+        EXPECT_NEAR(forward_impulse(third, sycl_queue), ftype{ 1 }, 1e-5);
+    }
+    descriptor_t::set_plan_cache_capacity(ONEMKL_DFT_PLAN_CACHE_SIZE);
+}
+
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+inline void copy_committed(sycl::queue& sycl_queue) {
+    // a copy of a committed descriptor is committed and computes the same transform, and
+    // recommitting it leaves the original untouched.
+    using ftype = typename std::conditional_t<precision == oneapi::mkl::dft::precision::SINGLE,
+                                              float, double>;
+    const ftype scale = 3;
+
+    oneapi::mkl::dft::descriptor<precision, domain> original{ default_1d_lengths };
+    original.set_value(oneapi::mkl::dft::config_param::FORWARD_SCALE, scale);
+    EXPECT_NO_THROW(commit_descriptor(original, sycl_queue));
+    oneapi::mkl::dft::descriptor<precision, domain> copy{ original };
+
+    oneapi::mkl::dft::config_value commit_status;
+    copy.get_value(oneapi::mkl::dft::config_param::COMMIT_STATUS, &commit_status);
+    EXPECT_EQ(commit_status, oneapi::mkl::dft::config_value::COMMITTED);
+
+    EXPECT_NEAR(forward_impulse(copy, sycl_queue), scale, 1e-5);
+
+    // cuFFT and rocFFT plans hold a stream binding and work area, so copies get their own.
+    using oneapi::mkl::dft::detail::get_commit;
+    const auto backend = get_commit(original)->get_backend();
+    const bool shared =
+        backend != oneapi::mkl::backend::cufft && backend != oneapi::mkl::backend::rocfft;
+    EXPECT_EQ(get_commit(copy) == get_commit(original), shared);
+    oneapi::mkl::dft::descriptor<precision, domain> assigned{ default_1d_lengths };
+    assigned = original;
+    EXPECT_EQ(get_commit(assigned) == get_commit(original), shared);
+    EXPECT_NEAR(forward_impulse(assigned, sycl_queue), scale, 1e-5);
+
+    copy.set_value(oneapi::mkl::dft::config_param::FORWARD_SCALE, ftype{ 1 });
+    EXPECT_NO_THROW(commit_descriptor(copy, sycl_queue));
+    EXPECT_NEAR(forward_impulse(copy, sycl_queue), ftype{ 1 }, 1e-5);
+    EXPECT_NEAR(forward_impulse(original, sycl_queue), scale, 1e-5);
+}
+
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+inline void external_workspace(sycl::queue& sycl_queue) {
+    // descriptors sharing one external workspace compute the same results as with an automatic
+    // workspace, and computing before the workspace is set throws, also for a copy of a
+    // descriptor whose workspace is set.
+    using ftype = typename std::conditional_t<precision == oneapi::mkl::dft::precision::SINGLE,
+                                              float, double>;
+    const ftype scale = 2;
+
+    oneapi::mkl::dft::descriptor<precision, domain> first{ default_1d_lengths };
+    oneapi::mkl::dft::descriptor<precision, domain> second{ default_1d_lengths };
+    second.set_value(oneapi::mkl::dft::config_param::FORWARD_SCALE, scale);
+    for (auto* descriptor : { &first, &second }) {
+        descriptor->set_value(oneapi::mkl::dft::config_param::WORKSPACE_PLACEMENT,
+                              oneapi::mkl::dft::config_value::WORKSPACE_EXTERNAL);
+        try {
+            commit_descriptor(*descriptor, sycl_queue);
+        }
+        catch (oneapi::mkl::unimplemented&) {
+            std::cout << "External workspaces are not supported by this backend." << std::endl;
+            return;
+        }
+    }
+    EXPECT_THROW(forward_impulse(first, sycl_queue), oneapi::mkl::invalid_argument);
+
+    std::int64_t first_bytes{ -1 }, second_bytes{ -1 };
+    first.get_value(oneapi::mkl::dft::config_param::WORKSPACE_EXTERNAL_BYTES, &first_bytes);
+    second.get_value(oneapi::mkl::dft::config_param::WORKSPACE_EXTERNAL_BYTES, &second_bytes);
+    EXPECT_GE(first_bytes, 0);
+    EXPECT_GE(second_bytes, 0);
+    const auto elements =
+        static_cast<std::size_t>(std::max(first_bytes, second_bytes)) / sizeof(ftype) + 1;
+    auto workspace = sycl::malloc_device<ftype>(elements, sycl_queue);
+    first.set_workspace(workspace);
+    second.set_workspace(workspace);
+
+    EXPECT_NEAR(forward_impulse(first, sycl_queue), ftype{ 1 }, 1e-5);
+    EXPECT_NEAR(forward_impulse(second, sycl_queue), scale, 1e-5);
+
+    oneapi::mkl::dft::descriptor<precision, domain> copy{ second };
+    EXPECT_THROW(forward_impulse(copy, sycl_queue), oneapi::mkl::invalid_argument);
+    auto copy_workspace = sycl::malloc_device<ftype>(elements, sycl_queue);
+    copy.set_workspace(copy_workspace);
+    EXPECT_NEAR(forward_impulse(copy, sycl_queue), scale, 1e-5);
+    sycl::free(copy_workspace, sycl_queue);
+    sycl::free(workspace, sycl_queue);
+}
+
 template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
 static int test_move() {
     using config_param = oneapi::mkl::dft::config_param;
@@ -580,6 +854,44 @@ static int test_move() {
     return !::testing::Test::HasFailure();
 }
 
+template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
+static int test_copy() {
+    using config_param = oneapi::mkl::dft::config_param;
+    std::int64_t fwdDistanceRef(123);
+    {
+        // Copy constructor
+        oneapi::mkl::dft::descriptor<precision, domain> descriptor{ default_1d_lengths };
+        descriptor.set_value(config_param::FWD_DISTANCE, fwdDistanceRef);
+        oneapi::mkl::dft::descriptor<precision, domain> descCopied{ descriptor };
+        std::int64_t fwdDistance(0), dftLength(0);
+        descCopied.get_value(config_param::FWD_DISTANCE, &fwdDistance);
+        EXPECT_EQ(fwdDistance, fwdDistanceRef);
+        descCopied.get_value(config_param::LENGTHS, &dftLength);
+        EXPECT_EQ(default_1d_lengths, dftLength);
+
+        // The copies are independent.
+        descCopied.set_value(config_param::FWD_DISTANCE, fwdDistanceRef + 1);
+        descriptor.get_value(config_param::FWD_DISTANCE, &fwdDistance);
+        EXPECT_EQ(fwdDistance, fwdDistanceRef);
+    }
+    {
+        // Copy assignment
+        oneapi::mkl::dft::descriptor<precision, domain> descriptor{ default_1d_lengths };
+        descriptor.set_value(config_param::FWD_DISTANCE, fwdDistanceRef);
+        oneapi::mkl::dft::descriptor<precision, domain> descCopied{ default_3d_lengths };
+        descCopied = descriptor;
+        std::int64_t fwdDistance(0), dftLength(0), dimension(0);
+        descCopied.get_value(config_param::FWD_DISTANCE, &fwdDistance);
+        EXPECT_EQ(fwdDistance, fwdDistanceRef);
+        descCopied.get_value(config_param::DIMENSION, &dimension);
+        EXPECT_EQ(dimension, 1);
+        descCopied.get_value(config_param::LENGTHS, &dftLength);
+        EXPECT_EQ(default_1d_lengths, dftLength);
+    }
+
+    return !::testing::Test::HasFailure();
+}
+
 template <oneapi::mkl::dft::precision precision, oneapi::mkl::dft::domain domain>
 static int test_getter_setter() {
     set_and_get_lengths<precision, domain>();
@@ -606,6 +918,10 @@ int test_commit(sycl::device* dev) {
     recommit_values<precision, domain>(sycl_queue);
     change_queue_causes_wait<precision, domain>(sycl_queue);
     swap_out_dead_queue<precision, domain>(sycl_queue);
+    recommit_shared_configuration<precision, domain>(sycl_queue);
+    cached_plans<precision, domain>(sycl_queue);
+    copy_committed<precision, domain>(sycl_queue);
+    external_workspace<precision, domain>(sycl_queue);
 
     return !::testing::Test::HasFailure();
 }
@@ -628,6 +944,24 @@ TEST(DescriptorTests, DescriptorMoveComplexDouble) {
         (test_move<oneapi::mkl::dft::precision::DOUBLE, oneapi::mkl::dft::domain::COMPLEX>()));
 }
 
+TEST(DescriptorTests, DescriptorCopyRealSingle) {
+    EXPECT_TRUE((test_copy<oneapi::mkl::dft::precision::SINGLE, oneapi::mkl::dft::domain::REAL>()));
+}
+
+TEST(DescriptorTests, DescriptorCopyRealDouble) {
+    EXPECT_TRUE((test_copy<oneapi::mkl::dft::precision::DOUBLE, oneapi::mkl::dft::domain::REAL>()));
+}
+
+TEST(DescriptorTests, DescriptorCopyComplexSingle) {
+    EXPECT_TRUE(
+        (test_copy<oneapi::mkl::dft::precision::SINGLE, oneapi::mkl::dft::domain::COMPLEX>()));
+}
+
+TEST(DescriptorTests, DescriptorCopyComplexDouble) {
+    EXPECT_TRUE(
+        (test_copy<oneapi::mkl::dft::precision::DOUBLE, oneapi::mkl::dft::domain::COMPLEX>()));
+}
+
 TEST(DescriptorTests, DescriptorTestsRealSingle) {
     EXPECT_TRUE((
         test_getter_setter<oneapi::mkl::dft::precision::SINGLE, oneapi::mkl::dft::domain::REAL>()));
@@ -648,6 +982,14 @@ TEST(DescriptorTests, DescriptorTestsComplexDouble) {
                                     oneapi::mkl::dft::domain::COMPLEX>()));
 }
 
+TEST(DescriptorTests, DescriptorTestsRealRealSingle) {
+    set_and_get_real_real_kind<oneapi::mkl::dft::precision::SINGLE>();
+}
+
+TEST(DescriptorTests, DescriptorTestsRealRealDouble) {
+    set_and_get_real_real_kind<oneapi::mkl::dft::precision::DOUBLE>();
+}
+
 class DescriptorCommitTests : public ::testing::TestWithParam<sycl::device*> {};
 
 TEST_P(DescriptorCommitTests, DescriptorCommitTestsRealSingle) {
@@ -150,6 +150,18 @@
 #define TEST_RUN_AMDGPU_ROCFFT_SELECT(q, func, ...)
 #endif
 
+// The portable DFT and RNG backends are exercised on CPU devices when the Intel oneMKL CPU backend
+// is not built.
+#if defined(ENABLE_PORTABLE_BACKEND) && !defined(ENABLE_MKLCPU_BACKEND)
+#define TEST_RUN_PORTABLE_SELECT_NO_ARGS(q, func) \
+    func(oneapi::mkl::backend_selector<oneapi::mkl::backend::portable>{ q })
+#define TEST_RUN_PORTABLE_SELECT(q, func, ...) \
+    func(oneapi::mkl::backend_selector<oneapi::mkl::backend::portable>{ q }, __VA_ARGS__)
+#else
+#define TEST_RUN_PORTABLE_SELECT_NO_ARGS(q, func)
+#define TEST_RUN_PORTABLE_SELECT(q, func, ...)
+#endif
+
 #ifndef __HIPSYCL__
 #define CHECK_HOST_OR_CPU(q) q.get_device().is_cpu()
 #else
@@ -160,6 +172,7 @@
     do {                                                                   \
         if (CHECK_HOST_OR_CPU(q)) {                                        \
             TEST_RUN_INTELCPU_SELECT_NO_ARGS(q, func);                     \
+            TEST_RUN_PORTABLE_SELECT_NO_ARGS(q, func);                     \
         }                                                                  \
         else if (q.get_device().is_gpu()) {                                \
             unsigned int vendor_id = static_cast<unsigned int>(            \
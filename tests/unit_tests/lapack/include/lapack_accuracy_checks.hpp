@@ -582,6 +582,119 @@ bool check_sy_he_evd_accuracy(oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, int
     return result;
 }
 
+template <typename fp>
+bool check_sy_he_evx_accuracy(oneapi::mkl::compz jobz, oneapi::mkl::uplo uplo, int64_t n,
+                              int64_t il, int64_t iu, int64_t m,
+                              const std::vector<typename complex_info<fp>::real_type>& w,
+                              const std::vector<fp>& Z, int64_t ldz, std::vector<fp> A_initial,
+                              int64_t lda) {
+    using fp_real = typename complex_info<fp>::real_type;
+    hermitian_to_full(uplo, n, A_initial, lda);
+    bool result = true;
+
+    if (m != iu - il + 1) {
+        test_log::lout << "Number of eigenvalues found " << m << " does not match "
+                       << iu - il + 1 << std::endl;
+        return false;
+    }
+
+    /* |D_ref(il:iu) - D| < |D_ref(il:iu)| O(eps) */
+    std::vector<fp_real> D_ref(n);
+    if constexpr (complex_info<fp>::is_complex)
+        reference::heevd(oneapi::mkl::job::novec, uplo, n, std::vector<fp>(A_initial).data(), lda,
+                         D_ref.data());
+    else
+        reference::syevd(oneapi::mkl::job::novec, uplo, n, std::vector<fp>(A_initial).data(), lda,
+                         D_ref.data());
+    std::vector<fp_real> D_sel(D_ref.begin() + il - 1, D_ref.begin() + iu);
+    std::vector<fp_real> D(w.begin(), w.begin() + m);
+
+    if (!rel_vec_err_check(m, D_sel, D, 10.0)) {
+        test_log::lout << "Eigenvalue check failed" << std::endl;
+        result = false;
+    }
+
+    if (oneapi::mkl::compz::vectors == jobz) {
+        /* |A Z - Z D| < |A| O(eps) */
+        std::vector<fp> AZ(n * m);
+        reference::gemm(oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, n, m,
+                        n, 1.0, A_initial.data(), lda, Z.data(), ldz, 0.0, AZ.data(), n);
+        for (int64_t col = 0; col < m; col++)
+            for (int64_t row = 0; row < n; row++)
+                AZ[row + col * n] -= Z[row + col * ldz] * D[col];
+
+        auto norm_residual = reference::lange('1', n, m, AZ.data(), n);
+        auto norm_A = reference::lange('1', n, n, A_initial.data(), lda);
+        auto ulp = reference::lamch<fp_real>('P');
+        auto denom = norm_A * n * ulp;
+        denom = denom > 0.0 ? denom : ulp;
+        auto rel_err = norm_residual / denom;
+        if (!(rel_err < 10.0)) {
+            snprintf(test_log::buffer.data(), test_log::buffer.size(),
+                     "|A Z - Z D| / (|A| n eps) = |%e| / (|%e| %d * %e) = %e", norm_residual,
+                     norm_A, static_cast<int>(n), ulp, rel_err);
+            test_log::lout << test_log::buffer.data() << std::endl;
+            test_log::lout << "Eigenvector residual check failed" << std::endl;
+            result = false;
+        }
+
+        /* |I - Z' Z| < m O(eps) */
+        std::vector<fp> ZZ(m * m);
+        int64_t ldzz = m;
+        reference::sy_he_rk(oneapi::mkl::uplo::upper, oneapi::mkl::transpose::conjtrans, m, n,
+                            1.0, Z.data(), ldz, 0.0, ZZ.data(), ldzz);
+        hermitian_to_full(oneapi::mkl::uplo::upper, m, ZZ, ldzz);
+        if (!rel_id_err_check(m, ZZ, ldzz)) {
+            test_log::lout << "Orthogonality check failed" << std::endl;
+            result = false;
+        }
+    }
+    return result;
+}
+
+template <typename fp>
+bool check_sy_he_evx_accuracy(oneapi::mkl::compz jobz, oneapi::mkl::rangev range,
+                              oneapi::mkl::uplo uplo, int64_t n,
+                              typename complex_info<fp>::real_type vl,
+                              typename complex_info<fp>::real_type vu, int64_t il, int64_t iu,
+                              int64_t m,
+                              const std::vector<typename complex_info<fp>::real_type>& w,
+                              const std::vector<fp>& Z, int64_t ldz,
+                              const std::vector<fp>& A_initial, int64_t lda) {
+    using fp_real = typename complex_info<fp>::real_type;
+
+    if (oneapi::mkl::rangev::values == range) {
+        /* Select the indices of the reference eigenvalues in (vl, vu] */
+        std::vector<fp> A(A_initial);
+        std::vector<fp_real> D_ref(n);
+        if constexpr (complex_info<fp>::is_complex)
+            reference::heevd(oneapi::mkl::job::novec, uplo, n, A.data(), lda, D_ref.data());
+        else
+            reference::syevd(oneapi::mkl::job::novec, uplo, n, A.data(), lda, D_ref.data());
+        il = 1;
+        iu = 0;
+        for (int64_t i = 0; i < n; i++) {
+            if (D_ref[i] <= vl)
+                il = i + 2;
+            if (D_ref[i] <= vu)
+                iu = i + 1;
+        }
+        if (iu < il) {
+            if (m != 0) {
+                test_log::lout << "Number of eigenvalues found " << m
+                               << " in an empty interval" << std::endl;
+                return false;
+            }
+            return true;
+        }
+    }
+    else if (oneapi::mkl::rangev::all == range) {
+        il = 1;
+        iu = n;
+    }
+    return check_sy_he_evx_accuracy(jobz, uplo, n, il, iu, m, w, Z, ldz, A_initial, lda);
+}
+
 template <typename fp>
 bool check_trtrs_accuracy(oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
                           oneapi::mkl::diag diag, int64_t n, int64_t nrhs, std::vector<fp> A,
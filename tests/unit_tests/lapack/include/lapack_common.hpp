@@ -20,9 +20,12 @@
 #pragma once
 
 #include <complex>
+#include <cstdlib>
+#include <optional>
 #include <random>
 #include <sstream>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #if __has_include(<sycl/sycl.hpp>)
@@ -77,6 +80,37 @@ inline void async_error_handler(sycl::exception_list exceptions) {
     }
 }
 
+/* Sets an environment variable for the lifetime of the object, then restores its previous value.
+   Used to force the run-time selected paths of some routines. */
+class scoped_env {
+public:
+    scoped_env(const char* name, const std::string& value) : name_(name) {
+        if (const char* previous = std::getenv(name))
+            previous_ = previous;
+        set(value.c_str());
+    }
+    ~scoped_env() {
+        set(previous_ ? previous_->c_str() : nullptr);
+    }
+    scoped_env(const scoped_env&) = delete;
+    scoped_env& operator=(const scoped_env&) = delete;
+
+private:
+    void set(const char* value) {
+#ifdef _WIN32
+        _putenv_s(name_.c_str(), value ? value : "");
+#else
+        if (value)
+            setenv(name_.c_str(), value, 1);
+        else
+            unsetenv(name_.c_str());
+#endif
+    }
+
+    std::string name_;
+    std::optional<std::string> previous_;
+};
+
 template <typename T>
 struct complex_info {
     using real_type = T;
@@ -68,6 +68,14 @@ inline std::ostream& operator<<(std::ostream& os, const oneapi::mkl::generate& t
     os << static_cast<int64_t>(t);
     return os;
 }
+inline std::ostream& operator<<(std::ostream& os, const oneapi::mkl::compz& t) {
+    os << static_cast<int64_t>(t);
+    return os;
+}
+inline std::ostream& operator<<(std::ostream& os, const oneapi::mkl::rangev& t) {
+    os << static_cast<int64_t>(t);
+    return os;
+}
 
 class result_T {
 public:
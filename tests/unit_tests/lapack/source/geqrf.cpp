@@ -18,6 +18,7 @@
 *******************************************************************************/
 
 #include <complex>
+#include <optional>
 #include <vector>
 
 #if __has_include(<sycl/sycl.hpp>)
@@ -35,18 +36,31 @@
 
 namespace {
 
+/* The last column forces the tall-skinny QR path of the run-time dispatch API by setting
+   ONEMKL_LAPACK_TSQR_MIN_ROWS for the call. Those shapes have n <= 64 and m >= 16 n, a last row
+   block longer than the others, lda > m, and for n = 1 a stack of R factors tall enough to take
+   the path again. */
 const char* accuracy_input = R"(
-31 50 37 27182
-30 30 34 27182
-50 37 54 27182
-31 22 37 27182
+31 50 37 0 27182
+30 30 34 0 27182
+50 37 54 0 27182
+31 22 37 0 27182
+53 1 58 1 27182
+4133 1 4138 1 27182
+2100 12 2104 1 27182
+1061 64 1066 1 27182
 )";
 
 template <typename data_T>
-bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed) {
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, int64_t tsqr,
+              uint64_t seed) {
     using fp = typename data_T_info<data_T>::value_type;
     using fp_real = typename complex_info<fp>::real_type;
 
+    std::optional<scoped_env> min_rows;
+    if (tsqr)
+        min_rows.emplace("ONEMKL_LAPACK_TSQR_MIN_ROWS", "1");
+
     /* Initialize */
     std::vector<fp> A_initial(lda * n);
     rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, n, A_initial, lda);
@@ -0,0 +1,204 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+/* A is built with exact rank k, so the truncated factorization must reproduce it */
+const char* accuracy_input = R"(
+120 40 6 5 1 121 120 8 27182
+40 120 6 5 1 41 41 7 27182
+200 200 10 10 2 200 200 10 27182
+)";
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t k, int64_t oversampling,
+              int64_t power_iterations, int64_t lda, int64_t ldu, int64_t ldvt, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    using fp_real = typename complex_info<fp>::real_type;
+    const auto jobu = oneapi::mkl::jobsvd::somevec;
+    const auto jobvt = oneapi::mkl::jobsvd::somevec;
+
+    /* Initialize */
+    std::vector<fp> X(m * k);
+    std::vector<fp> Y(k * n);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, k, X, m);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, k, n, Y, k);
+    std::vector<fp> A(lda * n);
+    reference::gemm(oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, m, n, k,
+                    1.0, X.data(), m, Y.data(), k, 0.0, A.data(), lda);
+    std::vector<fp> A_initial = A;
+
+    std::vector<fp> U(ldu * k);
+    std::vector<fp> Vt(ldvt * n);
+    std::vector<fp_real> s(k);
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto U_dev = device_alloc<data_T>(queue, U.size());
+        auto Vt_dev = device_alloc<data_T>(queue, Vt.size());
+        auto s_dev = device_alloc<data_T, fp_real>(queue, s.size());
+        const auto scratchpad_size = oneapi::mkl::lapack::gesvd_randomized_scratchpad_size<fp>(
+            queue, jobu, jobvt, m, n, k, lda, ldu, ldvt, oversampling);
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        queue.wait_and_throw();
+
+        oneapi::mkl::lapack::gesvd_randomized(queue, jobu, jobvt, m, n, k, A_dev, lda, s_dev, U_dev,
+                                              ldu, Vt_dev, ldvt, oversampling, power_iterations,
+                                              seed, scratchpad_dev, scratchpad_size);
+        queue.wait_and_throw();
+
+        device_to_host_copy(queue, U_dev, U.data(), U.size());
+        device_to_host_copy(queue, Vt_dev, Vt.data(), Vt.size());
+        device_to_host_copy(queue, s_dev, s.data(), s.size());
+        queue.wait_and_throw();
+
+        device_free(queue, A_dev);
+        device_free(queue, U_dev);
+        device_free(queue, Vt_dev);
+        device_free(queue, s_dev);
+        device_free(queue, scratchpad_dev);
+    }
+    bool result = true;
+
+    /* |A - U S V'| < |A| O(eps) */
+    std::vector<fp> US(m * k);
+    int64_t ldus = m;
+    for (int64_t col = 0; col < k; col++)
+        for (int64_t row = 0; row < m; row++)
+            US[row + col * ldus] = U[row + col * ldu] * s[col];
+    std::vector<fp> USV(m * n);
+    int64_t ldusv = m;
+    reference::gemm(oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, m, n, k,
+                    1.0, US.data(), ldus, Vt.data(), ldvt, 0.0, USV.data(), ldusv);
+    if (!rel_mat_err_check(m, n, A_initial, lda, USV, ldusv, 100.0)) {
+        test_log::lout << "Factorization check failed" << std::endl;
+        result = false;
+    }
+
+    /* |I - U' U| < k O(eps) */
+    std::vector<fp> UU(k * k);
+    reference::gemm(oneapi::mkl::transpose::conjtrans, oneapi::mkl::transpose::nontrans, k, k, m,
+                    1.0, U.data(), ldu, U.data(), ldu, 0.0, UU.data(), k);
+    if (!rel_id_err_check(k, UU, k)) {
+        test_log::lout << "U Orthogonality check failed" << std::endl;
+        result = false;
+    }
+
+    /* |I - V' V| < k O(eps) */
+    std::vector<fp> VV(k * k);
+    reference::gemm(oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::conjtrans, k, k, n,
+                    1.0, Vt.data(), ldvt, Vt.data(), ldvt, 0.0, VV.data(), k);
+    if (!rel_id_err_check(k, VV, k)) {
+        test_log::lout << "V Orthogonality check failed" << std::endl;
+        result = false;
+    }
+
+    /* singular values are returned in descending order */
+    for (int64_t i = 1; i < k; i++) {
+        if (s[i] > s[i - 1]) {
+            test_log::lout << "Singular values are not sorted" << std::endl;
+            result = false;
+            break;
+        }
+    }
+    return result;
+}
+
+const char* dependency_input = R"(
+4 4 1 1 1 4 4 1 1
+)";
+
+template <typename data_T>
+bool usm_dependency(const sycl::device& dev, int64_t m, int64_t n, int64_t k,
+                    int64_t oversampling, int64_t power_iterations, int64_t lda, int64_t ldu,
+                    int64_t ldvt, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    using fp_real = typename complex_info<fp>::real_type;
+    const auto jobu = oneapi::mkl::jobsvd::somevec;
+    const auto jobvt = oneapi::mkl::jobsvd::somevec;
+
+    /* Initialize */
+    std::vector<fp> A(lda * n);
+    rand_matrix_diag_dom(seed, oneapi::mkl::transpose::nontrans, m, n, A, lda);
+    std::vector<fp> U(ldu * k);
+    std::vector<fp> Vt(ldvt * n);
+    std::vector<fp_real> s(k);
+
+    /* Compute on device */
+    bool result;
+    {
+        sycl::queue queue{ dev, async_error_handler };
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto U_dev = device_alloc<data_T>(queue, U.size());
+        auto Vt_dev = device_alloc<data_T>(queue, Vt.size());
+        auto s_dev = device_alloc<data_T, fp_real>(queue, s.size());
+        const auto scratchpad_size = oneapi::mkl::lapack::gesvd_randomized_scratchpad_size<fp>(
+            queue, jobu, jobvt, m, n, k, lda, ldu, ldvt, oversampling);
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        queue.wait_and_throw();
+
+        /* Check dependency handling */
+        auto in_event = create_dependency(queue);
+        sycl::event func_event = oneapi::mkl::lapack::gesvd_randomized(
+            queue, jobu, jobvt, m, n, k, A_dev, lda, s_dev, U_dev, ldu, Vt_dev, ldvt, oversampling,
+            power_iterations, seed, scratchpad_dev, scratchpad_size,
+            std::vector<sycl::event>{ in_event });
+        result = check_dependency(queue, in_event, func_event);
+
+        queue.wait_and_throw();
+        device_free(queue, A_dev);
+        device_free(queue, U_dev);
+        device_free(queue, Vt_dev);
+        device_free(queue, s_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+InputTestController<decltype(::usm_dependency<void>)> dependency_controller{ dependency_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_USM(GesvdRandomized);
+INSTANTIATE_GTEST_SUITE_DEPENDENCY(GesvdRandomized);
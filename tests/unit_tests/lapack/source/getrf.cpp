@@ -18,6 +18,7 @@
 *******************************************************************************/
 
 #include <complex>
+#include <optional>
 #include <vector>
 
 #if __has_include(<sycl/sycl.hpp>)
@@ -35,21 +36,31 @@
 
 namespace {
 
+/* The last column forces the tournament-pivoting path of the mklcpu backend by setting
+   ONEMKL_LAPACK_CALU_MIN_SIZE for the call. Those shapes span several 256 x 256 tiles with
+   partial edge tiles. */
 const char* accuracy_input = R"(
-13 28 13 27182
-24 15 29 27182
-67 74 74 27182
-82 39 85 27182
-98 98 98 27182
-329 329 329 27182
-428 428 428 27182
+13 28 13 0 27182
+24 15 29 0 27182
+67 74 74 0 27182
+82 39 85 0 27182
+98 98 98 0 27182
+329 329 329 0 27182
+428 428 428 0 27182
+637 605 640 1 27182
+600 901 603 1 27182
 )";
 
 template <typename data_T>
-bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed) {
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, int64_t calu,
+              uint64_t seed) {
     using fp = typename data_T_info<data_T>::value_type;
     using fp_real = typename complex_info<fp>::real_type;
 
+    std::optional<scoped_env> min_size;
+    if (calu)
+        min_size.emplace("ONEMKL_LAPACK_CALU_MIN_SIZE", "1");
+
     /* Initialize */
     std::vector<fp> A_initial(lda * n);
     rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, n, A_initial, lda);
@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+/* Two singular matrices are factored back to back without waiting: column zero_col of the first
+   is zero, and the first column of the second one is zero. The info array must keep the first
+   report, zero_col. */
+const char* accuracy_input = R"(
+13 13 13 5 27182
+67 67 74 40 27182
+)";
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, int64_t zero_col,
+              uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+
+    /* Initialize */
+    std::vector<fp> A1(lda * n);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, n, A1, lda);
+    std::vector<fp> A2 = A1;
+    for (int64_t row = 0; row < m; row++) {
+        A1[row + (zero_col - 1) * lda] = 0.0;
+        A2[row] = 0.0;
+    }
+    std::vector<int64_t> ipiv(std::min(m, n));
+    int64_t info_host = 0;
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        auto A1_dev = device_alloc<data_T>(queue, A1.size());
+        auto A2_dev = device_alloc<data_T>(queue, A2.size());
+        auto ipiv_dev = device_alloc<data_T, int64_t>(queue, ipiv.size());
+        auto info_dev = device_alloc<data_T, int64_t>(queue, 1);
+#ifdef CALL_RT_API
+        const auto scratchpad_size =
+            oneapi::mkl::lapack::getrf_scratchpad_size<fp>(queue, m, n, lda);
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_CT_SELECT(queue, scratchpad_size = oneapi::mkl::lapack::getrf_scratchpad_size<fp>,
+                           m, n, lda);
+#endif
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A1.data(), A1_dev, A1.size());
+        host_to_device_copy(queue, A2.data(), A2_dev, A2.size());
+        host_to_device_copy(queue, &info_host, info_dev, 1);
+        queue.wait_and_throw();
+
+#ifdef CALL_RT_API
+        oneapi::mkl::lapack::set_info_array(queue, info_dev, 1);
+        oneapi::mkl::lapack::getrf(queue, m, n, A1_dev, lda, ipiv_dev, scratchpad_dev,
+                                   scratchpad_size);
+        oneapi::mkl::lapack::getrf(queue, m, n, A2_dev, lda, ipiv_dev, scratchpad_dev,
+                                   scratchpad_size);
+#else
+        TEST_RUN_CT_SELECT(queue, oneapi::mkl::lapack::set_info_array, info_dev, 1);
+        TEST_RUN_CT_SELECT(queue, oneapi::mkl::lapack::getrf, m, n, A1_dev, lda, ipiv_dev,
+                           scratchpad_dev, scratchpad_size);
+        TEST_RUN_CT_SELECT(queue, oneapi::mkl::lapack::getrf, m, n, A2_dev, lda, ipiv_dev,
+                           scratchpad_dev, scratchpad_size);
+#endif
+        queue.wait_and_throw();
+
+        device_to_host_copy(queue, info_dev, &info_host, 1);
+        queue.wait_and_throw();
+
+#ifdef CALL_RT_API
+        oneapi::mkl::lapack::set_info_array(queue, nullptr, 0);
+#else
+        TEST_RUN_CT_SELECT(queue, oneapi::mkl::lapack::set_info_array, nullptr, 0);
+#endif
+        device_free(queue, A1_dev);
+        device_free(queue, A2_dev);
+        device_free(queue, ipiv_dev);
+        device_free(queue, info_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    if (info_host != zero_col) {
+        test_log::lout << "info = " << info_host << ", expected " << zero_col << std::endl;
+        return false;
+    }
+    return true;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_USM(GetrfInfoArray);
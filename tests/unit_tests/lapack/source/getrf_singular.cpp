@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <optional>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+/* Column zero_col of the matrix is zero, so U(zero_col, zero_col) is the first zero pivot. getrf
+   must throw computation_error with that info from the call itself rather than through the
+   asynchronous handler. A nonzero calu column forces the tournament-pivoting path of the mklcpu
+   backend by setting ONEMKL_LAPACK_CALU_MIN_SIZE for the call; that shape has the zero column in
+   a later tile. */
+const char* accuracy_input = R"(
+13 13 13 5 0 27182
+67 50 74 40 0 27182
+637 605 640 301 1 27182
+)";
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, int64_t zero_col,
+              int64_t calu, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+
+    std::optional<scoped_env> min_size;
+    if (calu)
+        min_size.emplace("ONEMKL_LAPACK_CALU_MIN_SIZE", "1");
+
+    /* Initialize */
+    std::vector<fp> A(lda * n);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, n, A, lda);
+    for (int64_t row = 0; row < m; row++)
+        A[row + (zero_col - 1) * lda] = 0.0;
+    std::vector<int64_t> ipiv(std::min(m, n));
+    int64_t info = 0;
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto ipiv_dev = device_alloc<data_T, int64_t>(queue, ipiv.size());
+#ifdef CALL_RT_API
+        const auto scratchpad_size =
+            oneapi::mkl::lapack::getrf_scratchpad_size<fp>(queue, m, n, lda);
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_CT_SELECT(queue, scratchpad_size = oneapi::mkl::lapack::getrf_scratchpad_size<fp>,
+                           m, n, lda);
+#endif
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        queue.wait_and_throw();
+
+        try {
+#ifdef CALL_RT_API
+            oneapi::mkl::lapack::getrf(queue, m, n, A_dev, lda, ipiv_dev, scratchpad_dev,
+                                       scratchpad_size);
+#else
+            TEST_RUN_CT_SELECT(queue, oneapi::mkl::lapack::getrf, m, n, A_dev, lda, ipiv_dev,
+                               scratchpad_dev, scratchpad_size);
+#endif
+        }
+        catch (const oneapi::mkl::lapack::computation_error& e) {
+            info = e.info();
+        }
+        queue.wait_and_throw();
+
+        device_free(queue, A_dev);
+        device_free(queue, ipiv_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    if (info != zero_col) {
+        test_log::lout << "computation_error info = " << info << ", expected " << zero_col
+                       << std::endl;
+        return false;
+    }
+    return true;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_USM(GetrfSingular);
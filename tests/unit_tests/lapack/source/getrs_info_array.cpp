@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+/* getrf and getrs are chained through their events without waiting in between. Neither may
+   block, so getrs must still order its pivot conversion after getrf. */
+const char* accuracy_input = R"(
+0 27 13 29 31 27182
+1 64 5 67 64 27182
+)";
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, oneapi::mkl::transpose trans, int64_t n, int64_t nrhs,
+              int64_t lda, int64_t ldb, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+
+    /* Initialize */
+    std::vector<fp> A_initial(lda * n);
+    std::vector<fp> B_initial(ldb * nrhs);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, n, n, A_initial, lda);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, n, nrhs, B_initial, ldb);
+
+    std::vector<fp> A = A_initial;
+    std::vector<fp> B = B_initial;
+    int64_t info_host = 0;
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto B_dev = device_alloc<data_T>(queue, B.size());
+        auto ipiv_dev = device_alloc<data_T, int64_t>(queue, n);
+        auto info_dev = device_alloc<data_T, int64_t>(queue, 1);
+#ifdef CALL_RT_API
+        const auto getrf_size = oneapi::mkl::lapack::getrf_scratchpad_size<fp>(queue, n, n, lda);
+        const auto getrs_size =
+            oneapi::mkl::lapack::getrs_scratchpad_size<fp>(queue, trans, n, nrhs, lda, ldb);
+#else
+        int64_t getrf_size, getrs_size;
+        TEST_RUN_CT_SELECT(queue, getrf_size = oneapi::mkl::lapack::getrf_scratchpad_size<fp>, n,
+                           n, lda);
+        TEST_RUN_CT_SELECT(queue, getrs_size = oneapi::mkl::lapack::getrs_scratchpad_size<fp>,
+                           trans, n, nrhs, lda, ldb);
+#endif
+        const auto scratchpad_size = std::max(getrf_size, getrs_size);
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        host_to_device_copy(queue, B.data(), B_dev, B.size());
+        host_to_device_copy(queue, &info_host, info_dev, 1);
+        queue.wait_and_throw();
+
+#ifdef CALL_RT_API
+        oneapi::mkl::lapack::set_info_array(queue, info_dev, 1);
+        auto factored = oneapi::mkl::lapack::getrf(queue, n, n, A_dev, lda, ipiv_dev,
+                                                   scratchpad_dev, scratchpad_size);
+        oneapi::mkl::lapack::getrs(queue, trans, n, nrhs, A_dev, lda, ipiv_dev, B_dev, ldb,
+                                   scratchpad_dev, scratchpad_size,
+                                   std::vector<sycl::event>{ factored });
+#else
+        sycl::event factored;
+        TEST_RUN_CT_SELECT(queue, oneapi::mkl::lapack::set_info_array, info_dev, 1);
+        TEST_RUN_CT_SELECT(queue, factored = oneapi::mkl::lapack::getrf, n, n, A_dev, lda,
+                           ipiv_dev, scratchpad_dev, scratchpad_size);
+        TEST_RUN_CT_SELECT(queue, oneapi::mkl::lapack::getrs, trans, n, nrhs, A_dev, lda, ipiv_dev,
+                           B_dev, ldb, scratchpad_dev, scratchpad_size,
+                           std::vector<sycl::event>{ factored });
+#endif
+        queue.wait_and_throw();
+
+        device_to_host_copy(queue, B_dev, B.data(), B.size());
+        device_to_host_copy(queue, info_dev, &info_host, 1);
+        queue.wait_and_throw();
+
+#ifdef CALL_RT_API
+        oneapi::mkl::lapack::set_info_array(queue, nullptr, 0);
+#else
+        TEST_RUN_CT_SELECT(queue, oneapi::mkl::lapack::set_info_array, nullptr, 0);
+#endif
+        device_free(queue, A_dev);
+        device_free(queue, B_dev);
+        device_free(queue, ipiv_dev);
+        device_free(queue, info_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    if (info_host != 0) {
+        test_log::lout << "info = " << info_host << ", expected 0" << std::endl;
+        return false;
+    }
+    return check_getrs_accuracy(trans, n, nrhs, B, ldb, A_initial, lda, B_initial);
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_USM(GetrsInfoArray);
@@ -0,0 +1,184 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+/* The selected eigenvalues are shifted by 10 n away from the others so that the iterations
+ * converge to full accuracy with the default tolerance; the last row with converged = 1 is small
+ * enough for the direct path. Rows with converged = 0 allow no iteration after the starting
+ * block, so the routine must raise computation_error with the number of unconverged pairs. */
+const char* accuracy_input = R"(
+1 0 200 203 196 200 201 50 1 27182
+1 1 200 200 1 5 200 50 1 27182
+0 1 150 151 141 150 150 50 1 27182
+1 0 30 33 28 30 31 5 1 27182
+1 0 200 203 196 200 201 0 0 27182
+)";
+
+template <typename fp>
+void shift_selected(int64_t n, int64_t il, int64_t iu, std::vector<fp>& A, int64_t lda) {
+    using fp_real = typename complex_info<fp>::real_type;
+    const fp_real shift = (iu == n ? 10.0 : -10.0) * n;
+    for (int64_t diag = 0; diag < iu - il + 1; diag++)
+        A[diag + diag * lda] += shift;
+}
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, oneapi::mkl::compz jobz, oneapi::mkl::uplo uplo, int64_t n,
+              int64_t lda, int64_t il, int64_t iu, int64_t ldz, int64_t max_iterations,
+              int64_t converged, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    using fp_real = typename complex_info<fp>::real_type;
+    const int64_t k = iu - il + 1;
+    const fp_real tol = 0.0;
+    int64_t unconverged = 0;
+
+    /* Initialize */
+    std::vector<fp> A(lda * n);
+    rand_hermitian_matrix(seed, uplo, n, A, lda);
+    shift_selected(n, il, iu, A, lda);
+
+    std::vector<fp> A_initial = A;
+    std::vector<fp_real> w(k);
+    std::vector<fp> Z(ldz * k);
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto w_dev = device_alloc<data_T, fp_real>(queue, w.size());
+        auto Z_dev = device_alloc<data_T>(queue, Z.size());
+        const auto scratchpad_size = oneapi::mkl::lapack::syevx_lobpcg_scratchpad_size<fp>(
+            queue, jobz, uplo, n, lda, il, iu, ldz);
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        queue.wait_and_throw();
+
+        try {
+            oneapi::mkl::lapack::syevx_lobpcg(queue, jobz, uplo, n, A_dev, lda, il, iu, tol,
+                                             max_iterations, seed, w_dev, Z_dev, ldz,
+                                             scratchpad_dev, scratchpad_size);
+        }
+        catch (const oneapi::mkl::lapack::computation_error& e) {
+            unconverged = e.info();
+        }
+        queue.wait_and_throw();
+
+        device_to_host_copy(queue, w_dev, w.data(), w.size());
+        device_to_host_copy(queue, Z_dev, Z.data(), Z.size());
+        queue.wait_and_throw();
+
+        device_free(queue, A_dev);
+        device_free(queue, w_dev);
+        device_free(queue, Z_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    if (!converged) {
+        if (unconverged < 1 || unconverged > k) {
+            test_log::lout << "computation_error info = " << unconverged << ", expected 1 to " << k
+                           << std::endl;
+            return false;
+        }
+        return true;
+    }
+    if (unconverged != 0) {
+        test_log::lout << unconverged << " eigenpairs did not converge" << std::endl;
+        return false;
+    }
+    return check_sy_he_evx_accuracy(jobz, uplo, n, il, iu, k, w, Z, ldz, A_initial, lda);
+}
+
+const char* dependency_input = R"(
+1 0 30 30 28 30 30 1 1
+)";
+
+template <typename data_T>
+bool usm_dependency(const sycl::device& dev, oneapi::mkl::compz jobz, oneapi::mkl::uplo uplo,
+                    int64_t n, int64_t lda, int64_t il, int64_t iu, int64_t ldz,
+                    int64_t max_iterations, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    using fp_real = typename complex_info<fp>::real_type;
+    const int64_t k = iu - il + 1;
+    /* Any residual is accepted: only the dependency handling is checked */
+    const fp_real tol = std::numeric_limits<fp_real>::max();
+
+    /* Initialize */
+    std::vector<fp> A(lda * n);
+    rand_hermitian_matrix(seed, uplo, n, A, lda);
+    std::vector<fp_real> w(k);
+    std::vector<fp> Z(ldz * k);
+
+    /* Compute on device */
+    bool result;
+    {
+        sycl::queue queue{ dev, async_error_handler };
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto w_dev = device_alloc<data_T, fp_real>(queue, w.size());
+        auto Z_dev = device_alloc<data_T>(queue, Z.size());
+        const auto scratchpad_size = oneapi::mkl::lapack::syevx_lobpcg_scratchpad_size<fp>(
+            queue, jobz, uplo, n, lda, il, iu, ldz);
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        queue.wait_and_throw();
+
+        /* Check dependency handling */
+        auto in_event = create_dependency(queue);
+        sycl::event func_event = oneapi::mkl::lapack::syevx_lobpcg(
+            queue, jobz, uplo, n, A_dev, lda, il, iu, tol, max_iterations, seed, w_dev, Z_dev,
+            ldz, scratchpad_dev, scratchpad_size, std::vector<sycl::event>{ in_event });
+        result = check_dependency(queue, in_event, func_event);
+
+        queue.wait_and_throw();
+        device_free(queue, A_dev);
+        device_free(queue, w_dev);
+        device_free(queue, Z_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+InputTestController<decltype(::usm_dependency<void>)> dependency_controller{ dependency_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_USM_REAL(SyevxLobpcg);
+INSTANTIATE_GTEST_SUITE_DEPENDENCY_REAL(SyevxLobpcg);
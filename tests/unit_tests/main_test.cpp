@@ -110,7 +110,8 @@ int main(int argc, char** argv) {
                         unique_devices.insert(dev.get_info<sycl::info::device::name>());
                         unsigned int vendor_id = static_cast<unsigned int>(
                             dev.get_info<sycl::info::device::vendor_id>());
-#if !defined(ENABLE_MKLCPU_BACKEND) && !defined(ENABLE_PORTBLAS_BACKEND_INTEL_CPU)
+#if !defined(ENABLE_MKLCPU_BACKEND) && !defined(ENABLE_PORTBLAS_BACKEND_INTEL_CPU) && \
+    !defined(ENABLE_PORTABLE_BACKEND)
                         if (dev.is_cpu())
                             continue;
 #endif
@@ -150,7 +151,7 @@ int main(int argc, char** argv) {
     }
 
 #if defined(ENABLE_MKLCPU_BACKEND) || defined(ENABLE_NETLIB_BACKEND) || \
-    defined(ENABLE_PORTBLAS_BACKEND_INTEL_CPU)
+    defined(ENABLE_PORTBLAS_BACKEND_INTEL_CPU) || defined(ENABLE_PORTABLE_BACKEND)
 #ifdef __HIPSYCL__
     local_devices.push_back(sycl::device(sycl::cpu_selector()));
 #else
@@ -42,8 +42,8 @@
 template <class Engine, class Distribution>
 class moments_test {
 public:
-    template <typename Queue>
-    void operator()(Queue queue) {
+    template <typename Queue, typename... Args>
+    void operator()(Queue queue, Args... args) {
         using Type = typename Distribution::result_type;
         // prepare array for random numbers
         std::vector<Type> r(N_GEN);
@@ -61,7 +61,7 @@ public:
                                                  oneapi::mkl::rng::device::uniform_bits<uint64_t>>)
                         multiplier *= 2;
                     Engine engine(SEED, id * multiplier);
-                    Distribution distr;
+                    Distribution distr(args...);
                     auto res = oneapi::mkl::rng::device::generate(distr, engine);
                     if constexpr (Engine::vec_size == 1) {
                         acc[id] = res;
@@ -89,7 +89,7 @@ public:
         if constexpr (!std::is_same<Engine,
                                     oneapi::mkl::rng::device::mcg59<Engine::vec_size>>::value) {
             statistics_device<Distribution> stat;
-            status = stat.check(r, Distribution{});
+            status = stat.check(r, Distribution(args...));
         }
         return;
     }
@@ -97,4 +97,142 @@ public:
     int status = test_passed;
 };
 
+// One multinomial value is the vector of the counts of all categories, each of which is binomial
+template <class Engine, class Distribution>
+class multinomial_moments_test {
+public:
+    template <typename Queue>
+    void operator()(Queue queue, std::int32_t ntrial) {
+        using Type = typename Distribution::result_type;
+        constexpr std::size_t k = 4;
+        std::vector<double> p = { 0.1, 0.2, 0.3, 0.4 };
+        std::vector<Type> r(N_GEN * k);
+
+        try {
+            sycl::range<1> range(N_GEN);
+
+            sycl::buffer<double> p_buf(p);
+            sycl::buffer<Type> buf(r);
+            auto event = queue.submit([&](sycl::handler& cgh) {
+                sycl::accessor p_acc(p_buf, cgh, sycl::read_only);
+                sycl::accessor acc(buf, cgh, sycl::write_only);
+                cgh.parallel_for(range, [=](sycl::item<1> item) {
+                    size_t id = item.get_id(0);
+                    Engine engine(SEED, id * Engine::vec_size);
+                    Distribution distr(ntrial, sycl::span<const double>(&p_acc[0], k));
+                    Type res[k];
+                    oneapi::mkl::rng::device::generate(distr, engine, sycl::span<Type>(res, k));
+                    for (std::size_t j = 0; j < k; j++) {
+                        acc[id * k + j] = res[j];
+                    }
+                });
+            });
+            event.wait_and_throw();
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl
+                      << e.what() << std::endl
+                      << "Error code: " << get_error_code(e) << std::endl;
+            status = test_failed;
+            return;
+        }
+
+        std::vector<Type> counts(N_GEN);
+        for (std::size_t j = 0; j < k; j++) {
+            for (int i = 0; i < N_GEN; i++) {
+                counts[i] = r[i * k + j];
+            }
+            double q = 1.0 - p[j];
+            double tM = ntrial * p[j];
+            double tD = tM * q;
+            double tQ = tD * (1.0 + 3.0 * (ntrial - 2) * p[j] * q);
+            if (!compare_moments(counts, tM, tD, tQ)) {
+                status = test_failed;
+                return;
+            }
+        }
+    }
+
+    int status = test_passed;
+};
+
+// Each component of a gaussian_mv vector is normal with the variance on the diagonal of the
+// covariance T * T^t, and so is their sum with the total sum of the covariance
+template <class Engine, class Distribution>
+class gaussian_mv_moments_test {
+public:
+    template <typename Queue>
+    void operator()(Queue queue) {
+        using Type = typename Distribution::result_type;
+        constexpr std::uint32_t dimen = 3;
+        std::vector<Type> mean = { 1.0, -2.0, 3.0 };
+        // T = { { 2, 0, 0 }, { 0.5, 1, 0 }, { -1, 0.3, 0.7 } } packed by columns
+        std::vector<Type> matrix = { 2.0, 0.5, -1.0, 1.0, 0.3, 0.7 };
+        std::vector<double> variance = { 4.0, 1.25, 1.58 };
+        double sum_variance = 4.0 + 1.25 + 1.58 + 2.0 * (1.0 - 2.0 - 0.2);
+        std::vector<Type> r(N_GEN * dimen);
+
+        try {
+            sycl::range<1> range(N_GEN);
+
+            sycl::buffer<Type> mean_buf(mean);
+            sycl::buffer<Type> matrix_buf(matrix);
+            sycl::buffer<Type> buf(r);
+            auto event = queue.submit([&](sycl::handler& cgh) {
+                sycl::accessor mean_acc(mean_buf, cgh, sycl::read_only);
+                sycl::accessor matrix_acc(matrix_buf, cgh, sycl::read_only);
+                sycl::accessor acc(buf, cgh, sycl::write_only);
+                cgh.parallel_for(range, [=](sycl::item<1> item) {
+                    size_t id = item.get_id(0);
+                    Engine engine(SEED, id * Engine::vec_size);
+                    Distribution distr(dimen, sycl::span<const Type>(&mean_acc[0], dimen),
+                                       sycl::span<const Type>(&matrix_acc[0], 6));
+                    Type res[dimen];
+                    oneapi::mkl::rng::device::generate(distr, engine,
+                                                       sycl::span<Type>(res, dimen));
+                    for (std::uint32_t j = 0; j < dimen; j++) {
+                        acc[id * dimen + j] = res[j];
+                    }
+                });
+            });
+            event.wait_and_throw();
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl
+                      << e.what() << std::endl
+                      << "Error code: " << get_error_code(e) << std::endl;
+            status = test_failed;
+            return;
+        }
+
+        std::vector<Type> x(N_GEN);
+        for (std::uint32_t j = 0; j < dimen; j++) {
+            for (int i = 0; i < N_GEN; i++) {
+                x[i] = r[i * dimen + j];
+            }
+            double tD = variance[j];
+            if (!compare_moments(x, mean[j], tD, 3.0 * tD * tD)) {
+                status = test_failed;
+                return;
+            }
+        }
+        for (int i = 0; i < N_GEN; i++) {
+            x[i] = r[i * dimen] + r[i * dimen + 1] + r[i * dimen + 2];
+        }
+        if (!compare_moments(x, 2.0, sum_variance, 3.0 * sum_variance * sum_variance)) {
+            status = test_failed;
+        }
+    }
+
+    int status = test_passed;
+};
+
 #endif // _RNG_DEVICE_DISTR_MOMENTS_TEST_HPP_
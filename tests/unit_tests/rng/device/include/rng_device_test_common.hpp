@@ -307,6 +307,103 @@ struct statistics_device<oneapi::mkl::rng::device::bernoulli<Fp, Method>> {
     }
 };
 
+template <typename Fp, typename Method>
+struct statistics_device<oneapi::mkl::rng::device::gamma<Fp, Method>> {
+    template <typename AllocType>
+    bool check(const std::vector<Fp, AllocType>& r,
+               const oneapi::mkl::rng::device::gamma<Fp, Method>& distr) {
+        double tM, tD, tQ;
+        double alpha = distr.alpha();
+        double a = distr.a();
+        double beta = distr.beta();
+
+        tM = a + beta * alpha;
+        tD = beta * beta * alpha;
+        tQ = beta * beta * beta * beta * 3.0 * alpha * (alpha + 2.0);
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+template <typename Fp, typename Method>
+struct statistics_device<oneapi::mkl::rng::device::beta<Fp, Method>> {
+    template <typename AllocType>
+    bool check(const std::vector<Fp, AllocType>& r,
+               const oneapi::mkl::rng::device::beta<Fp, Method>& distr) {
+        double tM, tD, tQ;
+        double p = distr.p();
+        double q = distr.q();
+        double a = distr.a();
+        double b = distr.b();
+        double pq = p + q;
+
+        tM = a + b * p / pq;
+        tD = b * b * p * q / (pq * pq * (pq + 1.0));
+        tQ = tD * tD *
+             (3.0 + 6.0 * ((p - q) * (p - q) * (pq + 1.0) - p * q * (pq + 2.0)) /
+                        (p * q * (pq + 2.0) * (pq + 3.0)));
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+template <typename Fp, typename Method>
+struct statistics_device<oneapi::mkl::rng::device::chi_square<Fp, Method>> {
+    template <typename AllocType>
+    bool check(const std::vector<Fp, AllocType>& r,
+               const oneapi::mkl::rng::device::chi_square<Fp, Method>& distr) {
+        double tM, tD, tQ;
+        double n = distr.n();
+
+        tM = n;
+        tD = 2.0 * n;
+        tQ = 12.0 * n * (n + 4.0);
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+// Cauchy distribution has no moments: check the share of values within one scale of the
+// median, which is 1/2
+template <typename Fp, typename Method>
+struct statistics_device<oneapi::mkl::rng::device::cauchy<Fp, Method>> {
+    template <typename AllocType>
+    bool check(const std::vector<Fp, AllocType>& r,
+               const oneapi::mkl::rng::device::cauchy<Fp, Method>& distr) {
+        double a = distr.a();
+        double b = distr.b();
+        std::vector<double> inside(N_GEN);
+        for (int i = 0; i < N_GEN; i++) {
+            inside[i] = std::abs(r[i] - a) < b ? 1.0 : 0.0;
+        }
+
+        return compare_moments(inside, 0.5, 0.25, 0.0625);
+    }
+};
+
+template <typename Fp, typename Method>
+struct statistics_device<oneapi::mkl::rng::device::weibull<Fp, Method>> {
+    template <typename AllocType>
+    bool check(const std::vector<Fp, AllocType>& r,
+               const oneapi::mkl::rng::device::weibull<Fp, Method>& distr) {
+        double tM, tD, tQ;
+        double alpha = distr.alpha();
+        double a = distr.a();
+        double beta = distr.beta();
+        double g1 = std::tgamma(1.0 + 1.0 / alpha);
+        double g2 = std::tgamma(1.0 + 2.0 / alpha);
+        double g3 = std::tgamma(1.0 + 3.0 / alpha);
+        double g4 = std::tgamma(1.0 + 4.0 / alpha);
+
+        tM = a + beta * g1;
+        tD = beta * beta * (g2 - g1 * g1);
+        tQ = beta * beta * beta * beta *
+             (g4 - 4.0 * g3 * g1 + 6.0 * g2 * g1 * g1 - 3.0 * g1 * g1 * g1 * g1);
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
 template <typename Fp>
 struct statistics_device<oneapi::mkl::rng::device::bits<Fp>> {
     template <typename AllocType>
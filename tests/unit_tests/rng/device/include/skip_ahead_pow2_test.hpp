@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       oneapi::mkl::rng::device::mrg32k3a skip_ahead test for
+*       ONEMKL_RNG_DEVICE_MRG32K3A_POW2_SKIP_AHEAD (SYCL interface)
+*
+*******************************************************************************/
+
+#ifndef _RNG_DEVICE_SKIP_AHEAD_POW2_TEST_HPP__
+#define _RNG_DEVICE_SKIP_AHEAD_POW2_TEST_HPP__
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/rng/device.hpp"
+// The default tables, which the engine does not include in this mode
+#include "oneapi/mkl/rng/device/detail/mrg32k3a_skip_ahead_matrix.hpp"
+
+#include "rng_device_test_common.hpp"
+
+// Skips of one, two and three words, including the largest of each
+struct pow2_skip_cases {
+    static constexpr int count = 9;
+    std::uint64_t words[count][3] = { { 1, 0, 0 },
+                                      { 7, 0, 0 },
+                                      { 8, 0, 0 },
+                                      { (std::uint64_t{ 1 } << 40) + 3, 0, 0 },
+                                      { ~std::uint64_t{ 0 }, 0, 0 },
+                                      { 5, 3, 0 },
+                                      { ~std::uint64_t{ 0 }, ~std::uint64_t{ 0 }, 0 },
+                                      { 1, 2, 3 },
+                                      { ~std::uint64_t{ 0 }, ~std::uint64_t{ 0 },
+                                        ~std::uint64_t{ 0 } } };
+};
+
+// x = A^skip * x for a component of mrg32k3a, from the default table of its matrices
+// A^(d * 8^p), d = 1, ..., 7. Word j of the skip stands for (word * 2^j) * 8^(21 * j).
+template <std::uint32_t M>
+void reference_skip_ahead(std::uint32_t x[3], const std::uint64_t skip[3],
+                          const std::uint32_t table[][3][3]) {
+    for (std::uint64_t j = 0; j < 3; j++) {
+        std::uint64_t s = skip[j];
+        for (std::uint64_t p = 21 * j, shift = j; s != 0; p++, shift = 0) {
+            std::uint64_t digit = (s << shift) & 7;
+            s >>= 3 - shift;
+            if (digit == 0) {
+                continue;
+            }
+            const std::uint32_t(&a)[3][3] = table[7 * p + digit - 1];
+            std::uint64_t y[3];
+            for (int i = 0; i < 3; i++) {
+                y[i] = 0;
+                for (int k = 0; k < 3; k++) {
+                    y[i] = (y[i] + static_cast<std::uint64_t>(a[i][k]) * x[k] % M) % M;
+                }
+            }
+            for (int i = 0; i < 3; i++) {
+                x[i] = static_cast<std::uint32_t>(y[i]);
+            }
+        }
+    }
+}
+
+// The states of engines skipped ahead with the power-of-two matrices must be those given by the
+// default tables.
+template <typename Engine>
+class skip_ahead_pow2_test {
+public:
+    template <typename Queue>
+    void operator()(Queue queue) {
+        using State = typename Engine::state_type;
+        constexpr int count = pow2_skip_cases::count;
+
+        std::vector<std::uint32_t> r(6 * count);
+        std::vector<std::uint32_t> r_ref(6 * count);
+        pow2_skip_cases cases;
+
+        try {
+            sycl::buffer<std::uint32_t> buf(r);
+            auto event = queue.submit([&](sycl::handler& cgh) {
+                sycl::accessor acc(buf, cgh, sycl::write_only);
+                cgh.parallel_for(sycl::range<1>(count), [=](sycl::item<1> item) {
+                    size_t id = item.get_id(0);
+                    const std::uint64_t* w = cases.words[id];
+                    Engine engine(SEED);
+                    if (w[1] == 0 && w[2] == 0) {
+                        oneapi::mkl::rng::device::skip_ahead(engine, w[0]);
+                    }
+                    else if (w[2] == 0) {
+                        oneapi::mkl::rng::device::skip_ahead(engine, { w[0], w[1] });
+                    }
+                    else {
+                        oneapi::mkl::rng::device::skip_ahead(engine, { w[0], w[1], w[2] });
+                    }
+                    State state;
+                    oneapi::mkl::rng::device::store_state(engine, &state);
+                    for (int k = 0; k < 6; k++) {
+                        acc[6 * id + k] = state.s[k];
+                    }
+                });
+            });
+            event.wait_and_throw();
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl
+                      << e.what() << std::endl
+                      << "Error code: " << get_error_code(e) << std::endl;
+            status = test_failed;
+            return;
+        }
+
+        // validation
+        namespace impl = oneapi::mkl::rng::device::detail::mrg32k3a_impl;
+        for (int c = 0; c < count; c++) {
+            std::uint32_t* x = r_ref.data() + 6 * c;
+            x[0] = SEED;
+            x[1] = x[2] = x[3] = x[4] = x[5] = 1;
+            reference_skip_ahead<impl::mrg32k3a_params::m1>(x, cases.words[c],
+                                                            impl::skip_ahead_matrix[0]);
+            reference_skip_ahead<impl::mrg32k3a_params::m2>(x + 3, cases.words[c],
+                                                            impl::skip_ahead_matrix[1]);
+        }
+
+        status = check_equal_vector_device(r, r_ref);
+    }
+
+    int status = test_passed;
+};
+
+#endif // _RNG_DEVICE_SKIP_AHEAD_POW2_TEST_HPP__
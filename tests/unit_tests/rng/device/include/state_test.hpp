@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       oneapi::mkl::rng::device:: engines store_state, load_state and init_states tests
+*       (SYCL interface)
+*
+*******************************************************************************/
+
+#ifndef _RNG_DEVICE_STATE_TEST_HPP__
+#define _RNG_DEVICE_STATE_TEST_HPP__
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/rng/device.hpp"
+
+#include "rng_device_test_common.hpp"
+
+// Every work-item owns 2 * vec_size consecutive outputs. The states are initialized by
+// init_states and each of two kernels loads them, generates vec_size outputs and stores them
+// back, so the result has to match one engine generating the whole sequence.
+template <typename Engine>
+class state_test {
+public:
+    template <typename Queue>
+    void operator()(Queue queue) {
+        using UIntType = std::conditional_t<is_mcg59<Engine>::value, std::uint64_t, std::uint32_t>;
+        using State = typename Engine::state_type;
+
+        std::vector<UIntType> r(N_GEN);
+        std::vector<UIntType> r_ref(N_GEN);
+
+        std::int64_t n = N_GEN / (2 * Engine::vec_size);
+        State* states = sycl::malloc_device<State>(n, queue);
+        try {
+            sycl::buffer<UIntType> buf(r);
+            auto event = oneapi::mkl::rng::device::init_states<Engine>(queue, n, states, SEED,
+                                                                       2 * Engine::vec_size);
+            for (int pass = 0; pass < 2; pass++) {
+                event = queue.submit([&](sycl::handler& cgh) {
+                    cgh.depends_on(event);
+                    sycl::accessor acc(buf, cgh, sycl::write_only);
+                    cgh.parallel_for(sycl::range<1>(n), [=](sycl::item<1> item) {
+                        size_t id = item.get_id(0);
+                        auto engine = oneapi::mkl::rng::device::load_state<Engine>(states + id);
+                        oneapi::mkl::rng::device::bits<UIntType> distr;
+                        auto res = oneapi::mkl::rng::device::generate(distr, engine);
+                        oneapi::mkl::rng::device::store_state(engine, states + id);
+                        if constexpr (Engine::vec_size == 1) {
+                            acc[2 * id + pass] = res;
+                        }
+                        else {
+                            res.store(2 * id + pass, get_multi_ptr(acc));
+                        }
+                    });
+                });
+            }
+            event.wait_and_throw();
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            sycl::free(states, queue);
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl
+                      << e.what() << std::endl
+                      << "Error code: " << get_error_code(e) << std::endl;
+            sycl::free(states, queue);
+            status = test_failed;
+            return;
+        }
+        sycl::free(states, queue);
+
+        // validation
+        Engine engine(SEED);
+        oneapi::mkl::rng::device::bits<UIntType> distr;
+        for (int i = 0; i < N_GEN; i += Engine::vec_size) {
+            auto res = oneapi::mkl::rng::device::generate(distr, engine);
+            if constexpr (Engine::vec_size == 1) {
+                r_ref[i] = res;
+            }
+            else {
+                for (int j = 0; j < Engine::vec_size; ++j) {
+                    r_ref[i + j] = res[j];
+                }
+            }
+        }
+
+        status = check_equal_vector_device(r, r_ref);
+    }
+
+    int status = test_passed;
+};
+
+#endif // _RNG_DEVICE_STATE_TEST_HPP__
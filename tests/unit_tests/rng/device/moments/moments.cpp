@@ -818,6 +818,51 @@ INSTANTIATE_TEST_SUITE_P(Philox4x32x10GaussianBoxMuller2DeviceMomentsTestsSuite,
                          Philox4x32x10GaussianBoxMuller2DeviceMomentsTests,
                          ::testing::ValuesIn(devices), ::DeviceNamePrint());
 
+class Philox4x32x10GaussianZigguratDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10GaussianZigguratDeviceMomentsTests, RealSinglePrecision) {
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                 oneapi::mkl::rng::device::gaussian<
+                                     float, oneapi::mkl::rng::device::gaussian_method::ziggurat>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                 oneapi::mkl::rng::device::gaussian<
+                                     float, oneapi::mkl::rng::device::gaussian_method::ziggurat>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                 oneapi::mkl::rng::device::gaussian<
+                                     float, oneapi::mkl::rng::device::gaussian_method::ziggurat>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+TEST_P(Philox4x32x10GaussianZigguratDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                 oneapi::mkl::rng::device::gaussian<
+                                     double, oneapi::mkl::rng::device::gaussian_method::ziggurat>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                 oneapi::mkl::rng::device::gaussian<
+                                     double, oneapi::mkl::rng::device::gaussian_method::ziggurat>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                 oneapi::mkl::rng::device::gaussian<
+                                     double, oneapi::mkl::rng::device::gaussian_method::ziggurat>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10GaussianZigguratDeviceMomentsTestsSuite,
+                         Philox4x32x10GaussianZigguratDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
 class Philox4x32x10LognormalBoxMuller2DeviceMomentsTests
         : public ::testing::TestWithParam<sycl::device*> {};
 
@@ -961,6 +1006,57 @@ INSTANTIATE_TEST_SUITE_P(Philox4x32x10ExponentialIcdfAccDeviceMomentsTestsSuite,
                          Philox4x32x10ExponentialIcdfAccDeviceMomentsTests,
                          ::testing::ValuesIn(devices), ::DeviceNamePrint());
 
+class Philox4x32x10ExponentialZigguratDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10ExponentialZigguratDeviceMomentsTests, RealSinglePrecision) {
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                     oneapi::mkl::rng::device::exponential<
+                         float, oneapi::mkl::rng::device::exponential_method::ziggurat>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                     oneapi::mkl::rng::device::exponential<
+                         float, oneapi::mkl::rng::device::exponential_method::ziggurat>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                     oneapi::mkl::rng::device::exponential<
+                         float, oneapi::mkl::rng::device::exponential_method::ziggurat>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+TEST_P(Philox4x32x10ExponentialZigguratDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                     oneapi::mkl::rng::device::exponential<
+                         double, oneapi::mkl::rng::device::exponential_method::ziggurat>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                     oneapi::mkl::rng::device::exponential<
+                         double, oneapi::mkl::rng::device::exponential_method::ziggurat>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                     oneapi::mkl::rng::device::exponential<
+                         double, oneapi::mkl::rng::device::exponential_method::ziggurat>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10ExponentialZigguratDeviceMomentsTestsSuite,
+                         Philox4x32x10ExponentialZigguratDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
 class Philox4x32x10PoissonDevroyeDeviceMomentsTests
         : public ::testing::TestWithParam<sycl::device*> {};
 
@@ -1047,4 +1143,356 @@ INSTANTIATE_TEST_SUITE_P(Philox4x32x10BernoulliIcdfDeviceMomentsTestsSuite,
                          Philox4x32x10BernoulliIcdfDeviceMomentsTests, ::testing::ValuesIn(devices),
                          ::DeviceNamePrint());
 
+class Philox4x32x10GammaMarsagliaDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10GammaMarsagliaDeviceMomentsTests, RealSinglePrecision) {
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                 oneapi::mkl::rng::device::gamma<
+                                     float, oneapi::mkl::rng::device::gamma_method::marsaglia>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 0.5f, 1.0f, 2.0f)));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                 oneapi::mkl::rng::device::gamma<
+                                     float, oneapi::mkl::rng::device::gamma_method::marsaglia>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                 oneapi::mkl::rng::device::gamma<
+                                     float, oneapi::mkl::rng::device::gamma_method::marsaglia>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 3.0f, 0.0f, 1.0f)));
+}
+
+TEST_P(Philox4x32x10GammaMarsagliaDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                 oneapi::mkl::rng::device::gamma<
+                                     double, oneapi::mkl::rng::device::gamma_method::marsaglia>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 0.5, 1.0, 2.0)));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                 oneapi::mkl::rng::device::gamma<
+                                     double, oneapi::mkl::rng::device::gamma_method::marsaglia>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                 oneapi::mkl::rng::device::gamma<
+                                     double, oneapi::mkl::rng::device::gamma_method::marsaglia>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 3.0, 0.0, 1.0)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10GammaMarsagliaDeviceMomentsTestsSuite,
+                         Philox4x32x10GammaMarsagliaDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Philox4x32x10BetaGammaBasedDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10BetaGammaBasedDeviceMomentsTests, RealSinglePrecision) {
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                 oneapi::mkl::rng::device::beta<
+                                     float, oneapi::mkl::rng::device::beta_method::gamma_based>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 0.5f, 0.5f, 0.0f, 1.0f)));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                 oneapi::mkl::rng::device::beta<
+                                     float, oneapi::mkl::rng::device::beta_method::gamma_based>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                 oneapi::mkl::rng::device::beta<
+                                     float, oneapi::mkl::rng::device::beta_method::gamma_based>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 2.0f, 3.0f, 1.0f, 2.0f)));
+}
+
+TEST_P(Philox4x32x10BetaGammaBasedDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                 oneapi::mkl::rng::device::beta<
+                                     double, oneapi::mkl::rng::device::beta_method::gamma_based>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 0.5, 0.5, 0.0, 1.0)));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                 oneapi::mkl::rng::device::beta<
+                                     double, oneapi::mkl::rng::device::beta_method::gamma_based>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                 oneapi::mkl::rng::device::beta<
+                                     double, oneapi::mkl::rng::device::beta_method::gamma_based>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 2.0, 3.0, 1.0, 2.0)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10BetaGammaBasedDeviceMomentsTestsSuite,
+                         Philox4x32x10BetaGammaBasedDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Philox4x32x10ChiSquareGammaBasedDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10ChiSquareGammaBasedDeviceMomentsTests, RealSinglePrecision) {
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                     oneapi::mkl::rng::device::chi_square<
+                         float, oneapi::mkl::rng::device::chi_square_method::gamma_based>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 1)));
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                     oneapi::mkl::rng::device::chi_square<
+                         float, oneapi::mkl::rng::device::chi_square_method::gamma_based>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                     oneapi::mkl::rng::device::chi_square<
+                         float, oneapi::mkl::rng::device::chi_square_method::gamma_based>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 20)));
+}
+
+TEST_P(Philox4x32x10ChiSquareGammaBasedDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                     oneapi::mkl::rng::device::chi_square<
+                         double, oneapi::mkl::rng::device::chi_square_method::gamma_based>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 1)));
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                     oneapi::mkl::rng::device::chi_square<
+                         double, oneapi::mkl::rng::device::chi_square_method::gamma_based>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                     oneapi::mkl::rng::device::chi_square<
+                         double, oneapi::mkl::rng::device::chi_square_method::gamma_based>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 20)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10ChiSquareGammaBasedDeviceMomentsTestsSuite,
+                         Philox4x32x10ChiSquareGammaBasedDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Philox4x32x10CauchyIcdfDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10CauchyIcdfDeviceMomentsTests, RealSinglePrecision) {
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                 oneapi::mkl::rng::device::cauchy<
+                                     float, oneapi::mkl::rng::device::cauchy_method::icdf>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                 oneapi::mkl::rng::device::cauchy<
+                                     float, oneapi::mkl::rng::device::cauchy_method::icdf>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                 oneapi::mkl::rng::device::cauchy<
+                                     float, oneapi::mkl::rng::device::cauchy_method::icdf>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 1.0f, 2.0f)));
+}
+
+TEST_P(Philox4x32x10CauchyIcdfDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                 oneapi::mkl::rng::device::cauchy<
+                                     double, oneapi::mkl::rng::device::cauchy_method::icdf>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                 oneapi::mkl::rng::device::cauchy<
+                                     double, oneapi::mkl::rng::device::cauchy_method::icdf>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                 oneapi::mkl::rng::device::cauchy<
+                                     double, oneapi::mkl::rng::device::cauchy_method::icdf>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 1.0, 2.0)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10CauchyIcdfDeviceMomentsTestsSuite,
+                         Philox4x32x10CauchyIcdfDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Philox4x32x10WeibullIcdfDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10WeibullIcdfDeviceMomentsTests, RealSinglePrecision) {
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                 oneapi::mkl::rng::device::weibull<
+                                     float, oneapi::mkl::rng::device::weibull_method::icdf>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 0.5f, 0.0f, 1.0f)));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                 oneapi::mkl::rng::device::weibull<
+                                     float, oneapi::mkl::rng::device::weibull_method::icdf>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                 oneapi::mkl::rng::device::weibull<
+                                     float, oneapi::mkl::rng::device::weibull_method::icdf>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 2.0f, 1.0f, 3.0f)));
+}
+
+TEST_P(Philox4x32x10WeibullIcdfDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                 oneapi::mkl::rng::device::weibull<
+                                     double, oneapi::mkl::rng::device::weibull_method::icdf>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 0.5, 0.0, 1.0)));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                 oneapi::mkl::rng::device::weibull<
+                                     double, oneapi::mkl::rng::device::weibull_method::icdf>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                 oneapi::mkl::rng::device::weibull<
+                                     double, oneapi::mkl::rng::device::weibull_method::icdf>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 2.0, 1.0, 3.0)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10WeibullIcdfDeviceMomentsTestsSuite,
+                         Philox4x32x10WeibullIcdfDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Philox4x32x10MultinomialDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+// implementation uses double precision for accuracy
+TEST_P(Philox4x32x10MultinomialDeviceMomentsTests, IntegerPrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<multinomial_moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                             oneapi::mkl::rng::device::multinomial<std::int32_t>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 1)));
+    rng_device_test<multinomial_moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                             oneapi::mkl::rng::device::multinomial<std::int32_t>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam(), 10)));
+    rng_device_test<multinomial_moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                             oneapi::mkl::rng::device::multinomial<std::int32_t>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 1000)));
+}
+
+// implementation uses double precision for accuracy
+TEST_P(Philox4x32x10MultinomialDeviceMomentsTests, UnsignedIntegerPrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<multinomial_moments_test<oneapi::mkl::rng::device::philox4x32x10<1>,
+                                             oneapi::mkl::rng::device::multinomial<std::uint32_t>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 1)));
+    rng_device_test<multinomial_moments_test<oneapi::mkl::rng::device::philox4x32x10<4>,
+                                             oneapi::mkl::rng::device::multinomial<std::uint32_t>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam(), 10)));
+    rng_device_test<multinomial_moments_test<oneapi::mkl::rng::device::philox4x32x10<16>,
+                                             oneapi::mkl::rng::device::multinomial<std::uint32_t>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 1000)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10MultinomialDeviceMomentsTestsSuite,
+                         Philox4x32x10MultinomialDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Philox4x32x10GaussianMvBoxmullerDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10GaussianMvBoxmullerDeviceMomentsTests, RealSinglePrecision) {
+    rng_device_test<gaussian_mv_moments_test<
+        oneapi::mkl::rng::device::philox4x32x10<1>,
+        oneapi::mkl::rng::device::gaussian_mv<
+            float, oneapi::mkl::rng::device::gaussian_mv_method::box_muller2>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<gaussian_mv_moments_test<
+        oneapi::mkl::rng::device::philox4x32x10<16>,
+        oneapi::mkl::rng::device::gaussian_mv<
+            float, oneapi::mkl::rng::device::gaussian_mv_method::box_muller2>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+TEST_P(Philox4x32x10GaussianMvBoxmullerDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<gaussian_mv_moments_test<
+        oneapi::mkl::rng::device::philox4x32x10<1>,
+        oneapi::mkl::rng::device::gaussian_mv<
+            double, oneapi::mkl::rng::device::gaussian_mv_method::box_muller2>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<gaussian_mv_moments_test<
+        oneapi::mkl::rng::device::philox4x32x10<16>,
+        oneapi::mkl::rng::device::gaussian_mv<
+            double, oneapi::mkl::rng::device::gaussian_mv_method::box_muller2>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10GaussianMvBoxmullerDeviceMomentsTestsSuite,
+                         Philox4x32x10GaussianMvBoxmullerDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Philox4x32x10GaussianMvZigguratDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10GaussianMvZigguratDeviceMomentsTests, RealSinglePrecision) {
+    rng_device_test<gaussian_mv_moments_test<
+        oneapi::mkl::rng::device::philox4x32x10<1>,
+        oneapi::mkl::rng::device::gaussian_mv<
+            float, oneapi::mkl::rng::device::gaussian_mv_method::ziggurat>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<gaussian_mv_moments_test<
+        oneapi::mkl::rng::device::philox4x32x10<4>,
+        oneapi::mkl::rng::device::gaussian_mv<
+            float, oneapi::mkl::rng::device::gaussian_mv_method::ziggurat>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+TEST_P(Philox4x32x10GaussianMvZigguratDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<gaussian_mv_moments_test<
+        oneapi::mkl::rng::device::philox4x32x10<1>,
+        oneapi::mkl::rng::device::gaussian_mv<
+            double, oneapi::mkl::rng::device::gaussian_mv_method::ziggurat>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<gaussian_mv_moments_test<
+        oneapi::mkl::rng::device::philox4x32x10<4>,
+        oneapi::mkl::rng::device::gaussian_mv<
+            double, oneapi::mkl::rng::device::gaussian_mv_method::ziggurat>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10GaussianMvZigguratDeviceMomentsTestsSuite,
+                         Philox4x32x10GaussianMvZigguratDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
 } // anonymous namespace
@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Built with ONEMKL_RNG_DEVICE_MRG32K3A_POW2_SKIP_AHEAD into its own executable, as the macro
+// changes the definition of the mrg32k3a engine.
+
+#include "skip_ahead_pow2_test.hpp"
+#include "skip_ahead_test.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+class Mrg32k3aDevicePow2SkipAheadTests : public ::testing::TestWithParam<sycl::device*> {};
+
+class Mrg32k3aDevicePow2SkipAheadExTests : public ::testing::TestWithParam<sycl::device*> {};
+
+class Mrg32k3aDevicePow2SkipAheadTablesTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mrg32k3aDevicePow2SkipAheadTests, BinaryPrecision) {
+    rng_device_test<skip_ahead_test<oneapi::mkl::rng::device::mrg32k3a<1>>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<skip_ahead_test<oneapi::mkl::rng::device::mrg32k3a<4>>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<skip_ahead_test<oneapi::mkl::rng::device::mrg32k3a<16>>> test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+TEST_P(Mrg32k3aDevicePow2SkipAheadExTests, BinaryPrecision) {
+    rng_device_test<skip_ahead_ex_test<oneapi::mkl::rng::device::mrg32k3a<1>>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<skip_ahead_ex_test<oneapi::mkl::rng::device::mrg32k3a<4>>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<skip_ahead_ex_test<oneapi::mkl::rng::device::mrg32k3a<16>>> test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+TEST_P(Mrg32k3aDevicePow2SkipAheadTablesTests, BinaryPrecision) {
+    rng_device_test<skip_ahead_pow2_test<oneapi::mkl::rng::device::mrg32k3a<1>>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<skip_ahead_pow2_test<oneapi::mkl::rng::device::mrg32k3a<4>>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<skip_ahead_pow2_test<oneapi::mkl::rng::device::mrg32k3a<16>>> test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mrg32k3aDevicePow2SkipAheadTestsSuite, Mrg32k3aDevicePow2SkipAheadTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+INSTANTIATE_TEST_SUITE_P(Mrg32k3aDevicePow2SkipAheadExTestsSuite,
+                         Mrg32k3aDevicePow2SkipAheadExTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+INSTANTIATE_TEST_SUITE_P(Mrg32k3aDevicePow2SkipAheadTablesTestsSuite,
+                         Mrg32k3aDevicePow2SkipAheadTablesTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // namespace
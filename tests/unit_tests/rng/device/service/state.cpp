@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "state_test.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+class Philox4x32x10DeviceStateTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10DeviceStateTests, BinaryPrecision) {
+    rng_device_test<state_test<oneapi::mkl::rng::device::philox4x32x10<1>>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<state_test<oneapi::mkl::rng::device::philox4x32x10<4>>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<state_test<oneapi::mkl::rng::device::philox4x32x10<16>>> test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10DeviceStateTestsSuite, Philox4x32x10DeviceStateTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Mrg32k3aDeviceStateTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mrg32k3aDeviceStateTests, BinaryPrecision) {
+    rng_device_test<state_test<oneapi::mkl::rng::device::mrg32k3a<1>>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<state_test<oneapi::mkl::rng::device::mrg32k3a<4>>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<state_test<oneapi::mkl::rng::device::mrg32k3a<16>>> test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mrg32k3aDeviceStateTestsSuite, Mrg32k3aDeviceStateTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Mcg31m1DeviceStateTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mcg31m1DeviceStateTests, BinaryPrecision) {
+    rng_device_test<state_test<oneapi::mkl::rng::device::mcg31m1<1>>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<state_test<oneapi::mkl::rng::device::mcg31m1<4>>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<state_test<oneapi::mkl::rng::device::mcg31m1<16>>> test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mcg31m1DeviceStateTestsSuite, Mcg31m1DeviceStateTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Mcg59DeviceStateTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mcg59DeviceStateTests, BinaryPrecision) {
+    rng_device_test<state_test<oneapi::mkl::rng::device::mcg59<1>>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<state_test<oneapi::mkl::rng::device::mcg59<4>>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<state_test<oneapi::mkl::rng::device::mcg59<16>>> test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mcg59DeviceStateTestsSuite, Mcg59DeviceStateTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // namespace
@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _RNG_TEST_LEAPFROG_TEST_HPP__
+#define _RNG_TEST_LEAPFROG_TEST_HPP__
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+
+#include "rng_test_common.hpp"
+
+// Engine i with leapfrog(i, N_ENGINES) has to produce every N_ENGINES-th element of the original
+// sequence starting from element i. init is the seed, or the number of dimensions for
+// quasi-random engines.
+template <typename Engine>
+class leapfrog_test {
+public:
+    template <typename Queue>
+    void operator()(Queue queue, std::uint32_t init) {
+        // Prepare arrays for random numbers
+        std::vector<std::uint32_t> r1(N_GEN_SERVICE);
+        std::vector<std::uint32_t> r2(N_GEN_SERVICE);
+
+        try {
+            // Initialize rng objects
+            Engine engine(queue, init);
+            std::vector<Engine*> engines;
+
+            oneapi::mkl::rng::bits<std::uint32_t> distr;
+
+            // Perform leapfrog
+            for (int i = 0; i < N_ENGINES; i++) {
+                engines.push_back(new Engine(queue, init));
+                oneapi::mkl::rng::leapfrog(*(engines[i]), i, N_ENGINES);
+            }
+
+            sycl::buffer<std::uint32_t, 1> r_buffer(r1.data(), r1.size());
+            std::vector<sycl::buffer<std::uint32_t, 1>> r_buffers;
+            for (int i = 0; i < N_ENGINES; i++) {
+                r_buffers.push_back(
+                    sycl::buffer<std::uint32_t, 1>(r2.data() + i * N_PORTION, N_PORTION));
+            }
+
+            oneapi::mkl::rng::generate(distr, engine, N_GEN_SERVICE, r_buffer);
+            for (int i = 0; i < N_ENGINES; i++) {
+                oneapi::mkl::rng::generate(distr, *(engines[i]), N_PORTION, r_buffers[i]);
+            }
+            QUEUE_WAIT(queue);
+
+            // Clear memory
+            for (int i = 0; i < N_ENGINES; i++) {
+                delete engines[i];
+            }
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl << e.what() << std::endl;
+            print_error_code(e);
+            status = test_failed;
+            return;
+        }
+
+        // Validation
+        for (int i = 0; i < N_ENGINES; i++) {
+            for (int j = 0; j < N_PORTION; j++) {
+                if (r1[j * N_ENGINES + i] != r2[i * N_PORTION + j]) {
+                    status = test_failed;
+                    return;
+                }
+            }
+        }
+    }
+
+    int status = test_passed;
+};
+
+#endif // _RNG_TEST_LEAPFROG_TEST_HPP__
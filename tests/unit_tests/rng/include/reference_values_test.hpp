@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _RNG_TEST_REFERENCE_VALUES_TEST_HPP__
+#define _RNG_TEST_REFERENCE_VALUES_TEST_HPP__
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+
+#include "rng_test_common.hpp"
+
+// Positions in the sequence and the bits expected there
+using reference_bits = std::vector<std::pair<std::int64_t, std::uint32_t>>;
+
+// The sequences of an engine seeded the same way must be those of the Intel oneMKL CPU backend
+// on every CPU backend: its bits at reference positions of N_GEN values, whose work spans several
+// kernel work-items on the portable backend, its bits after a skip_ahead, and its first Gaussian
+// values by inversion, which only agree to rounding. Other devices are skipped, as their vendor
+// libraries need not reproduce the Intel oneMKL sequences.
+template <typename Engine>
+class reference_values_test {
+public:
+    template <typename Queue, typename Seed>
+    void operator()(Queue queue, Seed seed, reference_bits bits_ref, std::uint64_t num_to_skip,
+                    std::vector<std::uint32_t> skipped_ref, std::vector<double> gaussian_ref) {
+#ifdef CALL_RT_API
+        const bool is_cpu = queue.get_device().is_cpu();
+#else
+        const bool is_cpu = queue.get_queue().get_device().is_cpu();
+#endif
+        if (!is_cpu) {
+            status = test_skipped;
+            return;
+        }
+
+        std::vector<std::uint32_t> r_bits(N_GEN);
+        std::vector<std::uint32_t> r_skipped(skipped_ref.size());
+        std::vector<double> r_gaussian(gaussian_ref.size());
+
+        try {
+            Engine engine(queue, seed);
+            Engine skipped_engine(queue, seed);
+            Engine gaussian_engine(queue, seed);
+            oneapi::mkl::rng::skip_ahead(skipped_engine, num_to_skip);
+
+            oneapi::mkl::rng::bits<std::uint32_t> distr;
+            oneapi::mkl::rng::gaussian<double, oneapi::mkl::rng::gaussian_method::icdf>
+                gaussian_distr;
+
+            sycl::buffer<std::uint32_t, 1> bits_buffer(r_bits.data(), r_bits.size());
+            sycl::buffer<std::uint32_t, 1> skipped_buffer(r_skipped.data(), r_skipped.size());
+            sycl::buffer<double, 1> gaussian_buffer(r_gaussian.data(), r_gaussian.size());
+
+            oneapi::mkl::rng::generate(distr, engine, N_GEN, bits_buffer);
+            oneapi::mkl::rng::generate(distr, skipped_engine, r_skipped.size(), skipped_buffer);
+            oneapi::mkl::rng::generate(gaussian_distr, gaussian_engine, r_gaussian.size(),
+                                       gaussian_buffer);
+            QUEUE_WAIT(queue);
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl << e.what() << std::endl;
+            print_error_code(e);
+            status = test_failed;
+            return;
+        }
+
+        // Validation
+        bool good = check_equal_vector(r_skipped, skipped_ref);
+        for (const auto& [position, value] : bits_ref) {
+            if (r_bits[position] != value) {
+                std::cout << "Value " << position << " is " << r_bits[position] << " instead of "
+                          << value << std::endl;
+                good = false;
+            }
+        }
+        for (std::size_t i = 0; i < gaussian_ref.size(); i++) {
+            if (!(std::abs(r_gaussian[i] - gaussian_ref[i]) <= 1e-10)) {
+                std::cout << "Gaussian value " << i << " is " << r_gaussian[i] << " instead of "
+                          << gaussian_ref[i] << std::endl;
+                good = false;
+            }
+        }
+        status = good;
+    }
+
+    int status = test_passed;
+};
+
+#endif // _RNG_TEST_REFERENCE_VALUES_TEST_HPP__
@@ -113,6 +113,9 @@ public:
         test_(queue, args...);
 #else
         TEST_RUN_CT_SELECT(queue, test_, args...);
+        if (CHECK_HOST_OR_CPU(queue)) {
+            TEST_RUN_PORTABLE_SELECT(queue, test_, args...);
+        }
 #endif
 
         return test_.status;
@@ -176,4 +176,54 @@ struct statistics<oneapi::mkl::rng::poisson<Type, Method>> {
     }
 };
 
+// Checks every component and the sum of the components of the vectors, which are normal with the
+// variances on the diagonal of the covariance T * T^t and its total sum
+template <typename Type, typename Method>
+struct statistics<oneapi::mkl::rng::gaussian_mv<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::mkl::rng::gaussian_mv<Type, Method>& distr) {
+        std::size_t dimen = distr.dimen();
+        std::size_t n = r.size() / dimen;
+
+        // Unpack the factor, stored by columns
+        std::vector<double> t(dimen * dimen, 0.0);
+        for (std::size_t j = 0, k = 0; j < dimen; j++) {
+            for (std::size_t i = j; i < dimen; i++) {
+                t[i * dimen + j] = distr.matrix()[k++];
+            }
+        }
+
+        std::vector<Type> x(n);
+        double sum_mean = 0.0;
+        double sum_var = 0.0;
+        for (std::size_t i = 0; i < dimen; i++) {
+            double tM = distr.mean()[i];
+            double tD = 0.0;
+            for (std::size_t l = 0; l < dimen; l++) {
+                tD += t[i * dimen + l] * t[i * dimen + l];
+                for (std::size_t j = 0; j < dimen; j++) {
+                    sum_var += t[i * dimen + l] * t[j * dimen + l];
+                }
+            }
+            sum_mean += tM;
+            for (std::size_t m = 0; m < n; m++) {
+                x[m] = r[m * dimen + i];
+            }
+            if (!compare_moments(x, tM, tD, 3.0 * tD * tD)) {
+                return false;
+            }
+        }
+
+        for (std::size_t m = 0; m < n; m++) {
+            double s = 0.0;
+            for (std::size_t i = 0; i < dimen; i++) {
+                s += r[m * dimen + i];
+            }
+            x[m] = static_cast<Type>(s);
+        }
+        return compare_moments(x, sum_mean, sum_var, 3.0 * sum_var * sum_var);
+    }
+};
+
 #endif // _RNG_TEST_STATISTICS_CHECK_HPP__
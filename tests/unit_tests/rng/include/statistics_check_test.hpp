@@ -48,6 +48,24 @@
 
 #define POISSON_ARGS 0.5
 
+// Covariance T * T^t = { { 4, 1, -2 }, { 1, 1.25, -0.2 }, { -2, -0.2, 1.58 } }
+#define GAUSSIAN_MV_ARGS_FLOAT                  \
+    3, std::vector<float>{ 1.0f, -2.0f, 3.0f }, \
+        std::vector<float>{ 2.0f, 0.5f, -1.0f, 1.0f, 0.3f, 0.7f }
+#define GAUSSIAN_MV_ARGS_DOUBLE \
+    3, std::vector<double>{ 1.0, -2.0, 3.0 }, std::vector<double>{ 2.0, 0.5, -1.0, 1.0, 0.3, 0.7 }
+
+// Number of values in one generated element, gaussian_mv generates whole vectors
+template <typename Distr>
+std::int64_t values_per_draw(const Distr& /*distr*/) {
+    return 1;
+}
+
+template <typename Type, typename Method>
+std::int64_t values_per_draw(const oneapi::mkl::rng::gaussian_mv<Type, Method>& distr) {
+    return distr.dimen();
+}
+
 template <typename Distr, typename Engine>
 class statistics_test {
 public:
@@ -55,7 +73,7 @@ public:
     void operator()(Queue queue, std::int64_t n_gen, Args... args) {
         using Type = typename Distr::result_type;
 
-        std::vector<Type> r(n_gen);
+        std::vector<Type> r(n_gen * values_per_draw(Distr{ args... }));
 
         try {
             sycl::buffer<Type, 1> r_buffer(r.data(), r.size());
@@ -96,7 +114,7 @@ public:
 #else
         auto ua = sycl::usm_allocator<Type, sycl::usm::alloc::shared, 64>(queue.get_queue());
 #endif
-        std::vector<Type, decltype(ua)> r(n_gen, ua);
+        std::vector<Type, decltype(ua)> r(n_gen * values_per_draw(Distr{ args... }), ua);
 
         try {
             Engine engine(queue, SEED);
@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "leapfrog_test.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+class Mcg31m1LeapfrogTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mcg31m1LeapfrogTests, BinaryPrecision) {
+    rng_test<leapfrog_test<oneapi::mkl::rng::mcg31m1>> test;
+    EXPECT_TRUEORSKIP((test(GetParam(), SEED)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mcg31m1LeapfrogTestSuite, Mcg31m1LeapfrogTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Mcg59LeapfrogTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mcg59LeapfrogTests, BinaryPrecision) {
+    rng_test<leapfrog_test<oneapi::mkl::rng::mcg59>> test;
+    EXPECT_TRUEORSKIP((test(GetParam(), SEED)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mcg59LeapfrogTestSuite, Mcg59LeapfrogTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+class SobolLeapfrogTests : public ::testing::TestWithParam<sycl::device*> {};
+
+// Each of the N_ENGINES engines takes one coordinate of an N_ENGINES-dimensional sequence
+TEST_P(SobolLeapfrogTests, BinaryPrecision) {
+    rng_test<leapfrog_test<oneapi::mkl::rng::sobol>> test;
+    EXPECT_TRUEORSKIP((test(GetParam(), N_ENGINES)));
+}
+
+INSTANTIATE_TEST_SUITE_P(SobolLeapfrogTestSuite, SobolLeapfrogTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2023 Codeplay Software Ltd.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "reference_values_test.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// The sequences were computed from the engine definitions. The philox4x32x10 seed sets the key
+// and the counter of a known-answer vector of the Random123 library, whose first four values it
+// gives.
+
+class Philox4x32x10ReferenceValuesTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10ReferenceValuesTests, BinaryPrecision) {
+    rng_test<reference_values_test<oneapi::mkl::rng::philox4x32x10>> test;
+    std::initializer_list<std::uint64_t> seed = { 0x299f31d0a4093822, 0x85a308d3243f6a88,
+                                                  0x0370734413198a2e };
+    reference_bits bits_ref = {
+        { 0, 0xd16cfe09 },   { 1, 0x94fdcceb },   { 2, 0x5001e420 },   { 3, 0x24126ea1 },
+        { 4, 0x5757c6ce },   { 5, 0x254cd124 },   { 6, 0x3c0f08a0 },   { 7, 0xf40a747b },
+        { 252, 0xdd11e820 }, { 253, 0xf33709b6 }, { 254, 0x0d98ef77 }, { 255, 0xf7250a87 },
+        { 256, 0x52119f40 }, { 257, 0xf69adcca }, { 258, 0x8785a9a4 }, { 259, 0xee5c89c5 },
+        { 992, 0xb0820d2f }, { 993, 0x0960e034 }, { 994, 0x7c71d6cf }, { 995, 0xe556650c },
+        { 996, 0xd076d1cd }, { 997, 0x0a97d0ee }, { 998, 0x5e81cd1a }, { 999, 0x50af6ceb }
+    };
+    std::vector<std::uint32_t> skipped_ref = { 0xcfafee44, 0x7a385312, 0x6b5d178a, 0x766b0fa5,
+                                               0x491798f1, 0xe8ec8de6, 0x3e891ca9, 0x8bdfd744 };
+    std::vector<double> gaussian_ref = { -0.47310442244565309, -1.3917590460225915,
+                                         0.88725377249627368,  0.36088221996844261,
+                                         0.99933224240141461,  0.37374608835745793,
+                                         0.62679868113895609,  -0.11736721725074134 };
+    EXPECT_TRUEORSKIP((test(GetParam(), seed, bits_ref, (std::uint64_t{ 1 } << 40) + 3,
+                            skipped_ref, gaussian_ref)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10ReferenceValuesTestSuite, Philox4x32x10ReferenceValuesTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Mrg32k3aReferenceValuesTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mrg32k3aReferenceValuesTests, BinaryPrecision) {
+    rng_test<reference_values_test<oneapi::mkl::rng::mrg32k3a>> test;
+    std::initializer_list<std::uint32_t> seed = { SEED };
+    reference_bits bits_ref = {
+        { 0, 0xda969118 },   { 1, 0x8e4e3264 },   { 2, 0x387e0dca },   { 3, 0x2d1a3f58 },
+        { 4, 0xe3fba1a7 },   { 5, 0xc20bad47 },   { 6, 0x24cb5835 },   { 7, 0xcdba99d6 },
+        { 252, 0x80032d47 }, { 253, 0x4fd38c3f }, { 254, 0x04259ade }, { 255, 0xad41ab7d },
+        { 256, 0x8d2d7b7a }, { 257, 0xb08bbb30 }, { 258, 0x2482cb6d }, { 259, 0x24afe7ff },
+        { 992, 0x73d8efb9 }, { 993, 0x42525b40 }, { 994, 0x070dfdd9 }, { 995, 0x42a5163b },
+        { 996, 0xb76dd07f }, { 997, 0x44f2b745 }, { 998, 0x4cff17ad }, { 999, 0x369e34f3 }
+    };
+    std::vector<std::uint32_t> skipped_ref = { 0xdb2da115, 0x451f96e6, 0x0c7bb316, 0xe2d672ba,
+                                               0x770cf8a0, 0xf17336e5, 0x744608eb, 0x408df98b };
+    std::vector<double> gaussian_ref = { 1.0531331235766093,  0.14053339641903573,
+                                         -0.76992079093475096, -0.93001459978486278,
+                                         1.2295031147304374,  0.69985385694554747,
+                                         -1.0637199205827934, 0.85465383716074661 };
+    EXPECT_TRUEORSKIP((test(GetParam(), seed, bits_ref, (std::uint64_t{ 1 } << 40) + 3,
+                            skipped_ref, gaussian_ref)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mrg32k3aReferenceValuesTestSuite, Mrg32k3aReferenceValuesTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -65,4 +65,74 @@ INSTANTIATE_TEST_SUITE_P(Mrg32k3aSkipAheadTestSuite, Mrg32k3aSkipAheadTests,
 INSTANTIATE_TEST_SUITE_P(Mrg32k3aSkipAheadExTestSuite, Mrg32k3aSkipAheadExTests,
                          ::testing::ValuesIn(devices), ::DeviceNamePrint());
 
+class Mcg31m1SkipAheadTests : public ::testing::TestWithParam<sycl::device*> {};
+
+class Mcg31m1SkipAheadExTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mcg31m1SkipAheadTests, BinaryPrecision) {
+    rng_test<skip_ahead_test<oneapi::mkl::rng::mcg31m1>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+TEST_P(Mcg31m1SkipAheadExTests, BinaryPrecision) {
+    rng_test<skip_ahead_ex_test<oneapi::mkl::rng::mcg31m1>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mcg31m1SkipAheadTestSuite, Mcg31m1SkipAheadTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+INSTANTIATE_TEST_SUITE_P(Mcg31m1SkipAheadExTestSuite, Mcg31m1SkipAheadExTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Mcg59SkipAheadTests : public ::testing::TestWithParam<sycl::device*> {};
+
+class Mcg59SkipAheadExTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mcg59SkipAheadTests, BinaryPrecision) {
+    rng_test<skip_ahead_test<oneapi::mkl::rng::mcg59>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+TEST_P(Mcg59SkipAheadExTests, BinaryPrecision) {
+    rng_test<skip_ahead_ex_test<oneapi::mkl::rng::mcg59>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mcg59SkipAheadTestSuite, Mcg59SkipAheadTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+INSTANTIATE_TEST_SUITE_P(Mcg59SkipAheadExTestSuite, Mcg59SkipAheadExTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Mt19937SkipAheadTests : public ::testing::TestWithParam<sycl::device*> {};
+
+class Mt19937SkipAheadExTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mt19937SkipAheadTests, BinaryPrecision) {
+    rng_test<skip_ahead_test<oneapi::mkl::rng::mt19937>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+TEST_P(Mt19937SkipAheadExTests, BinaryPrecision) {
+    rng_test<skip_ahead_ex_test<oneapi::mkl::rng::mt19937>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mt19937SkipAheadTestSuite, Mt19937SkipAheadTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+INSTANTIATE_TEST_SUITE_P(Mt19937SkipAheadExTestSuite, Mt19937SkipAheadExTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class SobolSkipAheadTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(SobolSkipAheadTests, BinaryPrecision) {
+    rng_test<skip_ahead_test<oneapi::mkl::rng::sobol>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(SobolSkipAheadTestSuite, SobolSkipAheadTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
 } // anonymous namespace